@@ -50,7 +50,8 @@ namespace association_rules
 enum Method
 {
     apriori      = 0, /*!< Apriori method */
-    defaultDense = 0  /*!< Apriori default method */
+    defaultDense = 0, /*!< Apriori default method */
+    fpGrowth     = 1  /*!< FP-Growth method: mining of the prefix tree of the transactions without candidate generation */
 };
 
 /**
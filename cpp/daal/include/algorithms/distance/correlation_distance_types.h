@@ -70,7 +70,22 @@ enum InputId
 enum ResultId
 {
     correlationDistance, /*!< Table to store the result.*/
-    lastResultId = correlationDistance
+    nearestIndices,      /*!< n x k table of indices of the nearest observations, nearestK output mode */
+    nearestDistances,    /*!< n x k table of distances to the nearest observations, nearestK output mode */
+    pairIndices,         /*!< nPairs x 2 table of indices of the close pairs of observations, belowThreshold output mode */
+    pairDistances,       /*!< nPairs x 1 table of distances between the close pairs of observations, belowThreshold output mode */
+    lastResultId = pairDistances
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CORRELATION_DISTANCE__OUTPUTMODE"></a>
+ * Available modes of storing the correlation distances
+ */
+enum OutputMode
+{
+    fullMatrix     = 0, /*!< Full n x n distance matrix */
+    nearestK       = 1, /*!< k nearest observations for every observation, requires O(n * k) memory */
+    belowThreshold = 2  /*!< Pairs of observations with the distance not greater than the threshold, i < j */
 };
 
 /**
@@ -78,6 +93,31 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__CORRELATION_DISTANCE__PARAMETER"></a>
+ * \brief Parameters for the correlation distance algorithm
+ *
+ * \snippet distance/correlation_distance_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Constructs parameters of the correlation distance algorithm
+     *  \param[in] outputMode  Mode of storing the distances, \ref OutputMode
+     *  \param[in] k           Number of the nearest observations to find in the nearestK output mode
+     *  \param[in] threshold   Maximal distance between the pairs of observations in the belowThreshold output mode
+     */
+    Parameter(OutputMode outputMode = fullMatrix, size_t k = 1, double threshold = 0.0);
+
+    OutputMode outputMode; /*!< Mode of storing the distances */
+    size_t k;              /*!< Number of the nearest observations to find in the nearestK output mode */
+    double threshold;      /*!< Maximal distance between the pairs of observations in the belowThreshold output mode */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CORRELATION_DISTANCE__INPUT"></a>
  * \brief %Input objects for the correlation distance algorithm
@@ -168,6 +208,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
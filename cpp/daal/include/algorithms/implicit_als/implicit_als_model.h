@@ -63,9 +63,16 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] alpha               Confidence parameter of the implicit ALS training algorithm
      * \param[in] lambda              Regularization parameter
      * \param[in] preferenceThreshold Threshold used to define preference values
+     * \param[in] nCGIterations       Number of conjugate gradient steps per row, used by the training::conjugateGradientCSR method only
      */
-    Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0)
-        : nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda), preferenceThreshold(preferenceThreshold)
+    Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0,
+              size_t nCGIterations = 3)
+        : nFactors(nFactors),
+          maxIterations(maxIterations),
+          alpha(alpha),
+          lambda(lambda),
+          preferenceThreshold(preferenceThreshold),
+          nCGIterations(nCGIterations)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -73,6 +80,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    size_t nCGIterations;       /*!< Number of conjugate gradient steps per row on each iteration
+                                     of the training::conjugateGradientCSR method */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
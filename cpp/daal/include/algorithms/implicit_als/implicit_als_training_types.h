@@ -53,8 +53,11 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0, /*!< Default: method proposed by Hu, Koren, Volinsky for input data stored in the dense format */
-    fastCSR      = 1  /*!< Method proposed by Hu, Koren, Volinsky for input data stored in the compressed sparse row (CSR) format */
+    defaultDense         = 0, /*!< Default: method proposed by Hu, Koren, Volinsky for input data stored in the dense format */
+    fastCSR              = 1, /*!< Method proposed by Hu, Koren, Volinsky for input data stored in the compressed sparse row (CSR) format */
+    conjugateGradientCSR = 2  /*!< Method for input data stored in the compressed sparse row (CSR) format that solves
+                                   the normal equations with a fixed number of conjugate gradient steps
+                                   started from the factors of the previous iteration, as proposed by Takacs, Pilaszy, Tikk */
 };
 
 /**
@@ -32,6 +32,7 @@
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -56,7 +57,9 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense     = 0, /*!< PCA Default method */
-    svdDense         = 1  /*!< PCA SVD method */
+    svdDense         = 1, /*!< PCA SVD method */
+    randomizedDense  = 2  /*!< PCA randomized SVD method, computes the leading components only.
+                               Available in the batch processing mode only */
 };
 
 /**
@@ -508,6 +511,26 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that rejects the PCA randomized SVD algorithm in the online computing mode.
+    *        The power iterations of the method need several passes over the whole data set,
+    *        so the method is available in the batch processing mode only
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, randomizedDense> : public BaseParameter<algorithmFPType, randomizedDense>
+{
+public:
+    /** Constructs PCA parameters */
+    OnlineParameter();
+
+    /**
+    * Checks online parameter of the PCA randomized SVD algorithm
+    * \return services::ErrorMethodNotSupported: the method is not supported in the online computing mode
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
     * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
@@ -538,6 +561,26 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that rejects the PCA randomized SVD algorithm in the distributed computing mode.
+    *        The power iterations of the method need several passes over the whole data set,
+    *        so the method is available in the batch processing mode only
+    */
+template <ComputeStep step, typename algorithmFPType>
+class DAAL_EXPORT DistributedParameter<step, algorithmFPType, randomizedDense> : public BaseParameter<algorithmFPType, randomizedDense>
+{
+public:
+    /** Constructs PCA parameters */
+    DistributedParameter();
+
+    /**
+    * Checks distributed parameter of the PCA randomized SVD algorithm
+    * \return services::ErrorMethodNotSupported: the method is not supported in the distributed computing mode
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDINPUT"></a>
     * \brief Input objects for the PCA algorithm in the distributed processing mode
@@ -726,6 +769,31 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA randomized SVD algorithm in the batch computing mode
+*/
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense> : public BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
+                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
+                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    services::SharedPtr<normalization::zscore::BatchImpl> normalization; /*!< Pointer to batch normalization */
+    size_t oversampling;       /*!< Number of random directions sampled in addition to the requested components */
+    size_t nPowerIterations;   /*!< Number of power iterations that refine the sampled subspace */
+    engines::EnginePtr engine; /*!< Engine used to generate the random test matrix */
+
+    /**
+    * Checks batch parameter of the PCA randomized SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -82,10 +82,23 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      *  \param[in] nClasses Number of classes
      */
     Parameter(size_t nClasses = 2)
-        : daal::algorithms::classifier::Parameter(nClasses), splitCriterion(decision_tree::classification::gini), varImportance(none)
+        : daal::algorithms::classifier::Parameter(nClasses),
+          splitCriterion(decision_tree::classification::gini),
+          varImportance(none),
+          maxBins(256),
+          minBinSize(5)
     {}
     decision_tree::classification::SplitCriterion splitCriterion; /*!< Split criterion for stump classification */
     VariableImportanceMode varImportance;                         /*!< Variable importance computation mode */
+    size_t maxBins;                                               /*!< Used with 'hist' training method only.
+                                                                       Maximal number of discrete bins to bucket continuous features.
+                                                                       Default is 256 */
+    size_t minBinSize;                                            /*!< Used with 'hist' training method only.
+                                                                       Minimal number of observations in a bin. Default is 5 */
+    services::SharedPtr<Base> binnedDataCache;                    /*!< Used with 'hist' training method only.
+                                                                       Binned training data shared by the trainings of one boosting run,
+                                                                       set by the boosting algorithms for their own copy of the stump.
+                                                                       By default is empty and the data is binned by every training */
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -60,7 +60,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    hist         = 1  /*!< Histogram method. The features are mapped to bins, the boosting algorithms reuse the bins
+                           for all the iterations of one training */
 };
 
 /**
@@ -83,15 +83,23 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      *  Main constructor
      */
-    Parameter() : daal::algorithms::Parameter(), varImportance(none) {}
+    Parameter() : daal::algorithms::Parameter(), varImportance(none), maxBins(256), minBinSize(5) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
      */
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    VariableImportanceMode varImportance; /*!< Variable importance mode.
-                                               Variable importance computation is not supported for current version of the library */
+    VariableImportanceMode varImportance;      /*!< Variable importance mode.
+                                                    Variable importance computation is not supported for current version of the library */
+    size_t maxBins;                            /*!< Used with 'hist' training method only.
+                                                    Maximal number of discrete bins to bucket continuous features. Default is 256 */
+    size_t minBinSize;                         /*!< Used with 'hist' training method only.
+                                                    Minimal number of observations in a bin. Default is 5 */
+    services::SharedPtr<Base> binnedDataCache; /*!< Used with 'hist' training method only.
+                                                    Binned training data shared by the trainings of one boosting run,
+                                                    set by the boosting algorithms for their own copy of the stump.
+                                                    By default is empty and the data is binned by every training */
 };
 /* [Parameter source code] */
 
@@ -794,6 +794,7 @@ protected:
         _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
 
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
+        daal::services::daal_first_touch(_ptr.get(), size * sizeof(DataType));
 
         _memStatus = internallyAllocated;
         return services::Status();
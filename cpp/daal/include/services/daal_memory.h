@@ -54,6 +54,15 @@ DAAL_EXPORT void * daal_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAU
  */
 DAAL_EXPORT void * daal_calloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
 
+/**
+ * Touches the pages of a newly allocated block of memory by the threads that process its parts
+ * in the blocked loops of the library, so the pages are placed on the NUMA nodes of these threads.
+ * Does nothing unless NUMA affinity is enabled in the Environment
+ * \param[in] ptr       Pointer to the beginning of the block of memory
+ * \param[in] size      Size of the block of memory in bytes
+ */
+DAAL_EXPORT void daal_first_touch(void * ptr, size_t size);
+
 /**
  * Deallocates the space previously allocated by daal_malloc
  * \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
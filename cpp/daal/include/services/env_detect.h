@@ -153,6 +153,20 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     *  Enables NUMA affinity: the blocks of the tables allocated by the library are placed on the NUMA nodes
+     *  of the threads that process them in the blocked loops of the algorithms
+     *  \param[in] enableNumaAffinityFlag   Flag to NUMA affinity enable
+     */
+    void enableNumaAffinity(bool enableNumaAffinityFlag = true);
+
+    /**
+     *  Enables deterministic reductions: the results of the algorithms are bitwise reproducible
+     *  for any number of threads at the cost of the fixed partitioning of the work
+     *  \param[in] enableDeterministicReductionsFlag   Flag to deterministic reductions enable
+     */
+    void enableDeterministicReductions(bool enableDeterministicReductionsFlag = true);
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
@@ -283,7 +283,8 @@ enum ErrorID
     ErrorLCNinnerConvolution = -8400, /*!< Error in convolution 2d layer  */
 
     // SVM errors: -8600..-8799
-    ErrorSVMPredictKernerFunctionCall = -8601, /*!< SVM predict: error in kernel function call. Details are as follows. */
+    ErrorSVMPredictKernerFunctionCall                  = -8601, /*!< SVM predict: error in kernel function call. Details are as follows. */
+    ErrorKernelApproximationFailedToComputeEigenvalues = -8602, /*!< Failed to compute eigenvalues of the kernel matrix of the landmarks */
 
     // WeakLearner errors: -8800..-8999
     ErrorIncorrectWeakLearnerClassificationAlgorithm = -8800, /*!< Weak learner can not be casted to classifier algorithm */
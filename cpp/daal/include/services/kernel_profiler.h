@@ -0,0 +1,98 @@
+/* file: kernel_profiler.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Control of the built-in profiler of the library kernels.
+//--
+*/
+
+#ifndef __KERNEL_PROFILER_H__
+#define __KERNEL_PROFILER_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__KERNELPROFILER"></a>
+ * \brief Controls the built-in profiler that measures the phases of the library kernels.
+ *
+ * While the profiler is enabled, every thread records the nested kernel tasks it runs
+ * into its own buffer. The report aggregates the number of calls and the total, self and
+ * maximal time of each task, both per task name and per path in the tree of nested tasks.
+ *
+ * The profiler can also be enabled by the DAAL_PROFILER environment variable set to
+ * a non-zero value. In that case the report is written at exit into the file specified
+ * by the DAAL_PROFILER_OUTPUT environment variable or into the standard error stream.
+ *
+ * The report is a JSON document. The report requested while the kernels are running
+ * may not include the tasks that are not finished yet.
+ */
+class DAAL_EXPORT KernelProfiler
+{
+public:
+    /**
+     * Starts recording the kernel tasks
+     */
+    static void enable();
+
+    /**
+     * Stops recording the kernel tasks, the recorded data is kept
+     */
+    static void disable();
+
+    /**
+     * Returns true if the kernel tasks are being recorded
+     */
+    static bool isEnabled();
+
+    /**
+     * Discards the recorded data. Must not be called while the kernels are running
+     */
+    static void reset();
+
+    /**
+     * Writes the report into the buffer
+     * \param[out] buffer     Buffer for the null-terminated report, the report is truncated if it does not fit
+     * \param[in]  bufferSize Size of the buffer in bytes
+     * \return Size of the full report in bytes including the terminating null character
+     */
+    static size_t getReport(char * buffer, size_t bufferSize);
+
+    /**
+     * Writes the report into the file
+     * \param[in] fileName Name of the file, the report is written into the standard error stream if the name is null
+     * \return true if the report is written successfully
+     */
+    static bool writeReport(const char * fileName = NULL);
+};
+/** @} */
+} // namespace interface1
+using interface1::KernelProfiler;
+
+} // namespace services
+} // namespace daal
+#endif
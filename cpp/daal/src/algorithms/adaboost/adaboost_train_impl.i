@@ -46,6 +46,8 @@
 
 #include "algorithms/classifier/classifier_model.h"
 #include "algorithms/boosting/adaboost_model.h"
+#include "algorithms/stump/stump_classification_training_batch.h"
+#include "src/algorithms/stump/stump_train_hist_aux.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -100,6 +102,8 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaboostSAMM
 
     services::SharedPtr<classifier::training::Batch> learnerTrain = parameter->weakLearnerTraining->clone();
     learnerTrain->enableChecks(false);
+    stump::internal::shareBinnedData<stump::classification::training::Batch<algorithmFPType, stump::classification::training::hist>,
+                                     algorithmFPType, cpu>(learnerTrain);
     const size_t nClasses                    = parameter->nClasses;
     classifier::training::Input * trainInput = learnerTrain->getInput();
     DAAL_CHECK(trainInput, services::ErrorNullInput);
@@ -270,6 +274,8 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaboostSAMM
 
     services::SharedPtr<classifier::training::Batch> learnerTrain = parameter->weakLearnerTraining->clone();
     learnerTrain->enableChecks(false);
+    stump::internal::shareBinnedData<stump::classification::training::Batch<algorithmFPType, stump::classification::training::hist>,
+                                     algorithmFPType, cpu>(learnerTrain);
     classifier::training::Input * trainInput = learnerTrain->getInput();
     DAAL_CHECK(trainInput, services::ErrorNullInput);
     trainInput->set(classifier::training::data, weakLearnerInputTables[0]);
@@ -0,0 +1,78 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  with FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_kernel.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  Only the search of "large" itemsets differs from Apriori method,
+ *  the resulting tables and the association rules are built in the same way
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+protected:
+    /** Find "large" item sets by mining the prefix tree of the transactions */
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                       size_t & L_size) DAAL_C11_OVERRIDE;
+
+    /** Build the prefix tree of the "large" transactions with items ordered by decreasing support */
+    services::Status buildTree(const assocrules_dataset<cpu> & data, const size_t * itemRanks, fpgrowth_tree<cpu> & tree);
+
+    /** Build the tree of the prefix paths that end with the item (conditional tree of the item) */
+    services::Status buildConditionalTree(const fpgrowth_tree<cpu> & tree, size_t item, size_t minSupport, fpgrowth_tree<cpu> & condTree);
+
+    /** Find "large" itemsets that contain the suffix and one or more items of the tree */
+    services::Status mineTree(const fpgrowth_tree<cpu> & tree, size_t minSupport, size_t maxItemsetSize, const size_t * rankItems, size_t * suffix,
+                              size_t suffixSize, ItemSetList<cpu> & itemsets);
+
+    /** Mine the itemsets that end with the item of the tree */
+    services::Status mineItem(const fpgrowth_tree<cpu> & tree, size_t item, size_t minSupport, size_t maxItemsetSize, const size_t * rankItems,
+                              size_t * suffix, size_t suffixSize, ItemSetList<cpu> & itemsets);
+
+    /** Create the itemset from the suffix given by ranks of the items */
+    services::Status addItemset(const size_t * rankItems, const size_t * suffix, size_t suffixSize, size_t support, ItemSetList<cpu> & itemsets);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
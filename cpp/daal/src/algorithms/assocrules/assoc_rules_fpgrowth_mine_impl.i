@@ -0,0 +1,335 @@
+/* file: assoc_rules_fpgrowth_mine_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of "large" itemsets mining with FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_MINE_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_MINE_IMPL_I__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_impl.i"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/** \brief Data used by a thread to mine the conditional trees */
+template <CpuType cpu>
+struct fpgrowth_thread_data
+{
+    DAAL_NEW_DELETE();
+    fpgrowth_thread_data(size_t maxSuffixSize) : suffix(maxSuffixSize) {}
+
+    ItemSetList<cpu> itemsets;  /*<! "Large" itemsets found by the thread */
+    TArray<size_t, cpu> suffix; /*<! Ranks of the items that are common for the itemsets of the current tree */
+};
+
+template <CpuType cpu>
+int compareUniqueItemsBySupport(const void * a, const void * b)
+{
+    const assocRulesUniqueItem<cpu> * aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> * bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (aa->support != bb->support)
+    {
+        return (bb->support < aa->support) ? -1 : 1;
+    }
+    return (aa->itemID < bb->itemID) ? -1 : ((bb->itemID < aa->itemID) ? 1 : 0);
+}
+
+/* Orders itemsets by size and then lexicographically, as Apriori method generates them */
+template <CpuType cpu>
+int compareItemsetsBySizeAndItems(const void * a, const void * b)
+{
+    typedef const assocrules_itemset<cpu> * ItemsetConstPtr;
+    ItemsetConstPtr aa = *((ItemsetConstPtr *)a);
+    ItemsetConstPtr bb = *((ItemsetConstPtr *)b);
+
+    if (aa->size != bb->size)
+    {
+        return (aa->size < bb->size) ? -1 : 1;
+    }
+    for (size_t i = 0; i < aa->size; i++)
+    {
+        if (aa->items[i] != bb->items[i])
+        {
+            return (aa->items[i] < bb->items[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *  \brief Find "large" itemsets with FP-Growth method.
+ *
+ *  The first pass over the data that counts the support of the items is done when the data set is created.
+ *  The second pass builds the prefix tree of the transactions. Then the conditional trees of the items
+ *  are mined recursively, the items of the first level are processed in parallel.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                           assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                                                                           size_t & L_size)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(minSupport, data, *L));
+    L_size = 1;
+
+    const size_t nItems = data.numOfUniqueItems;
+    if (nItems < 2 || maxItemsetSize < 2) return s;
+
+    /* Rank the items in the order of decreasing support, so that the paths of the tree share the most frequent items */
+    TArray<assocRulesUniqueItem<cpu>, cpu> sortedItems(nItems);
+    DAAL_CHECK_MALLOC(sortedItems.get());
+    for (size_t i = 0; i < nItems; i++)
+    {
+        sortedItems[i] = data.uniq_items[i];
+    }
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, sortedItems.get(), compareUniqueItemsBySupport<cpu>);
+
+    const size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+    TArray<size_t, cpu> rankItems(nItems);
+    TArray<size_t, cpu> itemRanks(maxItemID + 1);
+    DAAL_CHECK_MALLOC(rankItems.get() && itemRanks.get());
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankItems[i]                     = sortedItems[i].itemID;
+        itemRanks[sortedItems[i].itemID] = i;
+    }
+
+    fpgrowth_tree<cpu> tree;
+    DAAL_CHECK_STATUS(s, buildTree(data, itemRanks.get(), tree));
+
+    /* Conditional trees of the items are mined independently. Each item of the first level is a separate task,
+       the tasks are balanced between the threads by the work stealing of the threading layer */
+    const size_t maxSuffixSize = (maxItemsetSize < nItems) ? maxItemsetSize : nItems;
+    daal::tls<fpgrowth_thread_data<cpu> *> tlsData(
+        [=]() -> fpgrowth_thread_data<cpu> * { return new fpgrowth_thread_data<cpu>(maxSuffixSize); });
+
+    SafeStatus safeStat;
+    daal::threader_for(nItems, nItems, [&](size_t item) {
+        fpgrowth_thread_data<cpu> * local = tlsData.local();
+        DAAL_CHECK_THR(local && local->suffix.get(), services::ErrorMemoryAllocationFailed);
+        safeStat |= mineItem(tree, item, minSupport, maxItemsetSize, rankItems.get(), local->suffix.get(), 0, local->itemsets);
+    });
+
+    /* Collect the itemsets found by all the threads */
+    size_t nItemsets = 0;
+    tlsData.reduce([&](fpgrowth_thread_data<cpu> * local) {
+        if (local) nItemsets += local->itemsets.size;
+    });
+
+    typedef assocrules_itemset<cpu> * ItemsetPtr;
+    TArray<ItemsetPtr, cpu> itemsets(nItemsets);
+    size_t iItemset = 0;
+    tlsData.reduce([&](fpgrowth_thread_data<cpu> * local) {
+        if (!local) return;
+        for (auto * current = local->itemsets.start; current != nullptr; current = current->next())
+        {
+            if (itemsets.get())
+            {
+                itemsets[iItemset++] = current->itemSet();
+            }
+            else
+            {
+                delete current->itemSet();
+            }
+        }
+        delete local;
+    });
+
+    DAAL_CHECK_MALLOC(itemsets.get() || nItemsets == 0);
+    s = safeStat.detach();
+
+    qSort<ItemsetPtr, cpu>(nItemsets, itemsets.get(), compareItemsetsBySizeAndItems<cpu>);
+    for (size_t i = 0; i < nItemsets; i++)
+    {
+        const size_t size = itemsets[i]->size;
+        if (s.ok() && L[size - 1].insert(itemsets[i]))
+        {
+            L_size = (size > L_size) ? size : L_size;
+        }
+        else
+        {
+            if (s.ok()) s = services::Status(services::ErrorMemoryAllocationFailed);
+            delete itemsets[i];
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(const assocrules_dataset<cpu> & data, const size_t * itemRanks,
+                                                                                   fpgrowth_tree<cpu> & tree)
+{
+    const size_t nItems = data.numOfUniqueItems;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, tree.init(nItems, nItems));
+
+    TArray<size_t, cpu> path(nItems);
+    DAAL_CHECK_MALLOC(path.get());
+
+    for (size_t i = 0; i < data.numOfLargeTransactions; i++)
+    {
+        const assocrules_transaction<cpu> * transaction = data.large_tran[i];
+        for (size_t j = 0; j < transaction->size; j++)
+        {
+            path[j] = itemRanks[transaction->items[j]];
+        }
+        qSort<size_t, cpu>(transaction->size, path.get());
+        DAAL_CHECK_STATUS(s, tree.insert(path.get(), transaction->size, 1));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildConditionalTree(const fpgrowth_tree<cpu> & tree, size_t item,
+                                                                                              size_t minSupport, fpgrowth_tree<cpu> & condTree)
+{
+    typedef typename fpgrowth_tree<cpu>::Node Node;
+    const size_t nil   = fpgrowth_tree<cpu>::nil;
+    const Node * nodes = tree.nodes;
+
+    /* Only the items with smaller ranks can precede the item on the paths */
+    TArrayScalableCalloc<size_t, cpu> condSupport(item);
+    TArrayScalable<size_t, cpu> path(item);
+    DAAL_CHECK_MALLOC(condSupport.get() && path.get());
+
+    size_t nPathNodes = 0;
+    for (size_t node = tree.head[item]; node != nil; node = nodes[node].nextSameItem)
+    {
+        const size_t count = nodes[node].count;
+        for (size_t parent = nodes[node].parent; parent != nil; parent = nodes[parent].parent)
+        {
+            condSupport[nodes[parent].item] += count;
+            nPathNodes++;
+        }
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, condTree.init(item, nPathNodes));
+
+    for (size_t node = tree.head[item]; node != nil; node = nodes[node].nextSameItem)
+    {
+        /* Paths are traversed from the leaves, so the items are collected in the order of decreasing ranks */
+        size_t pathSize = 0;
+        for (size_t parent = nodes[node].parent; parent != nil; parent = nodes[parent].parent)
+        {
+            const size_t parentItem = nodes[parent].item;
+            if (condSupport[parentItem] >= minSupport)
+            {
+                path[item - 1 - pathSize++] = parentItem;
+            }
+        }
+        DAAL_CHECK_STATUS(s, condTree.insert(path.get() + item - pathSize, pathSize, nodes[node].count));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineTree(const fpgrowth_tree<cpu> & tree, size_t minSupport,
+                                                                                  size_t maxItemsetSize, const size_t * rankItems, size_t * suffix,
+                                                                                  size_t suffixSize, ItemSetList<cpu> & itemsets)
+{
+    services::Status s;
+    for (size_t item = 0; item < tree.nItems; item++)
+    {
+        DAAL_CHECK_STATUS(s, mineItem(tree, item, minSupport, maxItemsetSize, rankItems, suffix, suffixSize, itemsets));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineItem(const fpgrowth_tree<cpu> & tree, size_t item, size_t minSupport,
+                                                                                  size_t maxItemsetSize, const size_t * rankItems, size_t * suffix,
+                                                                                  size_t suffixSize, ItemSetList<cpu> & itemsets)
+{
+    services::Status s;
+    if (tree.support[item] < minSupport) return s;
+
+    suffix[suffixSize++] = item;
+
+    /* "Large" itemsets of size 1 are found by the first pass over the data */
+    if (suffixSize > 1)
+    {
+        DAAL_CHECK_STATUS(s, addItemset(rankItems, suffix, suffixSize, tree.support[item], itemsets));
+    }
+
+    if (suffixSize < maxItemsetSize && item > 0)
+    {
+        fpgrowth_tree<cpu> condTree;
+        DAAL_CHECK_STATUS(s, buildConditionalTree(tree, item, minSupport, condTree));
+        if (condTree.nNodes > 0)
+        {
+            DAAL_CHECK_STATUS(s, mineTree(condTree, minSupport, maxItemsetSize, rankItems, suffix, suffixSize, itemsets));
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::addItemset(const size_t * rankItems, const size_t * suffix,
+                                                                                    size_t suffixSize, size_t support, ItemSetList<cpu> & itemsets)
+{
+    assocrules_itemset<cpu> * itemset = new assocrules_itemset<cpu>(suffixSize, suffix, suffix[suffixSize - 1], support);
+    DAAL_CHECK_MALLOC(itemset);
+    if (!itemset->ok())
+    {
+        services::Status s = itemset->getLastStatus();
+        delete itemset;
+        return s;
+    }
+
+    /* Items of the resulting itemsets are sorted by their identifiers */
+    size_t * items = itemset->items;
+    for (size_t i = 0; i < suffixSize; i++)
+    {
+        const size_t itemID = rankItems[suffix[i]];
+        size_t j            = i;
+        for (; j > 0 && items[j - 1] > itemID; j--)
+        {
+            items[j] = items[j - 1];
+        }
+        items[j] = itemID;
+    }
+
+    if (!itemsets.insert(itemset))
+    {
+        delete itemset;
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+    return services::Status();
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,184 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of the prefix tree used in FP-Growth method
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "src/externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  \brief Prefix tree of the transactions (FP-tree).
+ *  Items are identified by their ranks in the order of decreasing support, so every path from the root
+ *  contains the items in increasing order of the ranks. Nodes of the same item are linked in the list
+ *  started in the header of the item. Nodes are stored in the contiguous array and refer to each other by indices.
+ */
+template <CpuType cpu>
+struct fpgrowth_tree
+{
+    DAAL_NEW_DELETE();
+    static const size_t nil = (size_t)-1;
+
+    struct Node
+    {
+        size_t item;         /*<! Rank of the item */
+        size_t count;        /*<! Number of transactions that share the path from the root to the node */
+        size_t parent;       /*<! Index of the parent node */
+        size_t firstChild;   /*<! Index of the first child node */
+        size_t nextSibling;  /*<! Index of the next child of the parent */
+        size_t nextSameItem; /*<! Index of the next node of the same item */
+    };
+
+    fpgrowth_tree() : nodes(nullptr), nNodes(0), capacity(0), nItems(0), head(nullptr), rootChild(nullptr), support(nullptr) {}
+
+    ~fpgrowth_tree() { release(); }
+
+    /** Initializes the empty tree that can contain the items with ranks less than nItems */
+    services::Status init(size_t _nItems, size_t nodesCapacity)
+    {
+        release();
+        nItems    = _nItems;
+        head      = service_scalable_malloc<size_t, cpu>(nItems ? nItems : 1);
+        rootChild = service_scalable_malloc<size_t, cpu>(nItems ? nItems : 1);
+        support   = service_scalable_malloc<size_t, cpu>(nItems ? nItems : 1);
+        DAAL_CHECK_MALLOC(head && rootChild && support);
+        for (size_t i = 0; i < nItems; i++)
+        {
+            head[i]      = nil;
+            rootChild[i] = nil;
+            support[i]   = 0;
+        }
+        return reserve(nodesCapacity);
+    }
+
+    /** Adds the path of the items sorted by increasing ranks with the given count */
+    services::Status insert(const size_t * items, size_t nItemsInPath, size_t count)
+    {
+        if (nItemsInPath == 0) return services::Status();
+
+        size_t current = rootChild[items[0]];
+        if (current == nil)
+        {
+            current = addNode(items[0], nil);
+            if (current == nil) return services::Status(services::ErrorMemoryAllocationFailed);
+            rootChild[items[0]] = current;
+        }
+        nodes[current].count += count;
+        support[items[0]] += count;
+
+        for (size_t k = 1; k < nItemsInPath; k++)
+        {
+            const size_t item = items[k];
+            size_t child      = nodes[current].firstChild;
+            while (child != nil && nodes[child].item != item)
+            {
+                child = nodes[child].nextSibling;
+            }
+            if (child == nil)
+            {
+                child = addNode(item, current);
+                if (child == nil) return services::Status(services::ErrorMemoryAllocationFailed);
+            }
+            nodes[child].count += count;
+            support[item] += count;
+            current = child;
+        }
+        return services::Status();
+    }
+
+    Node * nodes;       /*<! Array of the nodes */
+    size_t nNodes;      /*<! Number of the nodes */
+    size_t capacity;    /*<! Number of the nodes that can be stored without reallocation */
+    size_t nItems;      /*<! Number of the items the tree can contain */
+    size_t * head;      /*<! Index of the first node of each item */
+    size_t * rootChild; /*<! Index of the child node of the root for each item */
+    size_t * support;   /*<! Support of each item in the tree */
+
+private:
+    services::Status reserve(size_t newCapacity)
+    {
+        if (newCapacity <= capacity) return services::Status();
+        Node * newNodes = service_scalable_malloc<Node, cpu>(newCapacity);
+        DAAL_CHECK_MALLOC(newNodes);
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            newNodes[i] = nodes[i];
+        }
+        service_scalable_free<Node, cpu>(nodes);
+        nodes    = newNodes;
+        capacity = newCapacity;
+        return services::Status();
+    }
+
+    size_t addNode(size_t item, size_t parent)
+    {
+        if (nNodes == capacity && !reserve(capacity ? 2 * capacity : 64)) return nil;
+
+        const size_t index = nNodes++;
+        Node & node        = nodes[index];
+        node.item          = item;
+        node.count         = 0;
+        node.parent        = parent;
+        node.firstChild    = nil;
+        node.nextSibling   = (parent != nil) ? nodes[parent].firstChild : nil;
+        node.nextSameItem  = head[item];
+        head[item]         = index;
+        if (parent != nil) nodes[parent].firstChild = index;
+        return index;
+    }
+
+    void release()
+    {
+        service_scalable_free<Node, cpu>(nodes);
+        service_scalable_free<size_t, cpu>(head);
+        service_scalable_free<size_t, cpu>(rootChild);
+        service_scalable_free<size_t, cpu>(support);
+        nodes     = nullptr;
+        head      = nullptr;
+        rootChild = nullptr;
+        support   = nullptr;
+        nNodes    = 0;
+        capacity  = 0;
+        nItems    = 0;
+    }
+
+    fpgrowth_tree(const fpgrowth_tree &);
+    fpgrowth_tree & operator=(const fpgrowth_tree &);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,161 @@
+/* file: fpgrowth.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the large itemsets found by FP-Growth and Apriori against the brute-force support count
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/association_rules/apriori.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::association_rules::test
+{
+using namespace daal::data_management;
+
+typedef std::map<std::vector<int>, int> ItemsetSupports;
+
+class TransactionSet
+{
+public:
+    TransactionSet(size_t nTransactions, size_t nItems, std::uint32_t seed) : _nItems(nItems), _transactions(nTransactions)
+    {
+        std::mt19937 rng(seed);
+        std::geometric_distribution<int> geometric(0.25);
+        for (size_t t = 0; t < nTransactions; ++t)
+        {
+            const size_t length = 1 + rng() % 8;
+            for (size_t j = 0; j < length; ++j)
+            {
+                _transactions[t].insert(std::min<int>(nItems - 1, geometric(rng)));
+            }
+            for (int item : _transactions[t])
+            {
+                _pairs.push_back(int(t));
+                _pairs.push_back(item);
+            }
+        }
+    }
+
+    NumericTablePtr table() { return HomogenNumericTable<int>::create(_pairs.data(), 2, _pairs.size() / 2); }
+
+    /* Counts the support of every itemset over all the subsets of the items */
+    ItemsetSupports bruteForce(double minSupport, size_t maxItemsetSize) const
+    {
+        const int minCount = int(std::ceil(minSupport * _transactions.size()));
+        ItemsetSupports result;
+        for (std::uint32_t mask = 1; mask < (1u << _nItems); ++mask)
+        {
+            std::vector<int> itemset;
+            for (size_t i = 0; i < _nItems; ++i)
+            {
+                if (mask & (1u << i)) itemset.push_back(int(i));
+            }
+            if (maxItemsetSize && itemset.size() > maxItemsetSize) continue;
+
+            int support = 0;
+            for (const auto & transaction : _transactions)
+            {
+                bool containsAll = true;
+                for (int item : itemset) containsAll = containsAll && transaction.count(item);
+                support += containsAll;
+            }
+            if (support >= minCount) result[itemset] = support;
+        }
+        return result;
+    }
+
+private:
+    size_t _nItems;
+    std::vector<std::set<int> > _transactions;
+    std::vector<int> _pairs;
+};
+
+template <Method method>
+static ItemsetSupports mine(const NumericTablePtr & data, double minSupport, size_t maxItemsetSize)
+{
+    Batch<double, method> algorithm;
+    algorithm.input.set(association_rules::data, data);
+    algorithm.parameter.minSupport     = minSupport;
+    algorithm.parameter.maxItemsetSize = maxItemsetSize;
+    algorithm.parameter.discoverRules  = false;
+    EXPECT_TRUE(algorithm.compute().ok());
+
+    const NumericTablePtr itemsets = algorithm.getResult()->get(largeItemsets);
+    const NumericTablePtr supports = algorithm.getResult()->get(largeItemsetsSupport);
+    BlockDescriptor<int> itemsetsBlock, supportsBlock;
+    itemsets->getBlockOfRows(0, itemsets->getNumberOfRows(), readOnly, itemsetsBlock);
+    supports->getBlockOfRows(0, supports->getNumberOfRows(), readOnly, supportsBlock);
+
+    std::vector<std::vector<int> > items(supports->getNumberOfRows());
+    for (size_t i = 0; i < itemsets->getNumberOfRows(); ++i)
+    {
+        items[itemsetsBlock.getBlockPtr()[2 * i]].push_back(itemsetsBlock.getBlockPtr()[2 * i + 1]);
+    }
+    ItemsetSupports result;
+    for (size_t i = 0; i < supports->getNumberOfRows(); ++i)
+    {
+        std::sort(items[i].begin(), items[i].end());
+        EXPECT_EQ(result.count(items[i]), 0) << "the itemset is reported twice";
+        result[items[i]] = supportsBlock.getBlockPtr()[2 * i + 1];
+    }
+
+    itemsets->releaseBlockOfRows(itemsetsBlock);
+    supports->releaseBlockOfRows(supportsBlock);
+    return result;
+}
+
+struct MiningCase
+{
+    size_t nTransactions;
+    size_t nItems;
+    double minSupport;
+    size_t maxItemsetSize;
+};
+
+class AssociationRulesBruteForceTest : public ::testing::TestWithParam<MiningCase>
+{};
+
+TEST_P(AssociationRulesBruteForceTest, LargeItemsetsMatchBruteForce)
+{
+    const MiningCase & c = GetParam();
+    for (std::uint32_t seed = 1; seed <= 10; ++seed)
+    {
+        TransactionSet transactions(c.nTransactions, c.nItems, seed);
+        const ItemsetSupports expected = transactions.bruteForce(c.minSupport, c.maxItemsetSize);
+
+        EXPECT_EQ(expected, mine<fpGrowth>(transactions.table(), c.minSupport, c.maxItemsetSize)) << "seed = " << seed;
+        EXPECT_EQ(expected, mine<apriori>(transactions.table(), c.minSupport, c.maxItemsetSize)) << "seed = " << seed;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(RandomTransactions, AssociationRulesBruteForceTest,
+                         ::testing::Values(MiningCase { 50, 5, 0.02, 0 }, MiningCase { 200, 12, 0.02, 0 }, MiningCase { 200, 12, 0.05, 3 },
+                                           MiningCase { 250, 15, 0.1, 0 }, MiningCase { 1000, 10, 0.12, 2 }));
+
+} // namespace daal::algorithms::association_rules::test
@@ -42,6 +42,8 @@
 #include "algorithms/weak_learner/weak_learner_model.h"
 #include "algorithms/classifier/classifier_model.h"
 #include "algorithms/boosting/brownboost_model.h"
+#include "algorithms/stump/stump_classification_training_batch.h"
+#include "src/algorithms/stump/stump_train_hist_aux.h"
 #include "src/algorithms/brownboost/brownboost_train_kernel.h"
 
 namespace daal
@@ -155,6 +157,8 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
         ;
 
     services::SharedPtr<classifier::training::Batch> learnerTrain = parameter->weakLearnerTraining->clone();
+    stump::internal::shareBinnedData<stump::classification::training::Batch<algorithmFPType, stump::classification::training::hist>,
+                                     algorithmFPType, cpu>(learnerTrain);
     classifier::training::Input * trainInput                      = learnerTrain->getInput();
     DAAL_CHECK(trainInput, services::ErrorNullInput);
     trainInput->set(classifier::training::data, weakLearnerInputTables[0]);
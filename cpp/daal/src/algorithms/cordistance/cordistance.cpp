@@ -37,6 +37,14 @@ namespace correlation_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID);
+Parameter::Parameter(OutputMode outputMode, size_t k, double threshold) : outputMode(outputMode), k(k), threshold(threshold) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(outputMode != nearestK || k > 0, ErrorIncorrectParameter, ParameterName, kStr());
+    return services::Status();
+}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -66,7 +74,15 @@ void Input::set(InputId id, const data_management::NumericTablePtr & ptr)
 */
 services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
 {
-    return data_management::checkNumericTable(get(data).get(), dataStr());
+    services::Status s;
+    DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(data).get(), dataStr()));
+
+    const Parameter * algPar = static_cast<const Parameter *>(par);
+    if (algPar && algPar->outputMode == nearestK)
+    {
+        DAAL_CHECK_EX(algPar->k < get(data)->getNumberOfRows(), ErrorIncorrectParameter, ParameterName, kStr());
+    }
+    return s;
 }
 
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
@@ -99,12 +115,30 @@ void Result::set(ResultId id, const data_management::NumericTablePtr & ptr)
 */
 services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * algInput = static_cast<const Input *>(input);
+    const Input * algInput   = static_cast<const Input *>(input);
+    const Parameter * algPar = static_cast<const Parameter *>(par);
 
     size_t nVectors       = algInput->get(data)->getNumberOfRows();
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray | (int)data_management::NumericTableIface::upperPackedTriangularMatrix
                             | (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
 
+    const OutputMode outputMode = algPar ? algPar->outputMode : fullMatrix;
+    if (outputMode == nearestK)
+    {
+        unexpectedLayouts |= (int)packed_mask;
+        services::Status s;
+        DAAL_CHECK_STATUS(
+            s, data_management::checkNumericTable(get(nearestIndices).get(), nearestIndicesStr(), unexpectedLayouts, 0, algPar->k, nVectors));
+        return data_management::checkNumericTable(get(nearestDistances).get(), nearestDistancesStr(), unexpectedLayouts, 0, algPar->k, nVectors);
+    }
+    if (outputMode == belowThreshold)
+    {
+        unexpectedLayouts |= (int)packed_mask;
+        services::Status s;
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(pairIndices).get(), pairIndicesStr(), unexpectedLayouts, 0, 2, 0, false));
+        return data_management::checkNumericTable(get(pairDistances).get(), pairDistancesStr(), unexpectedLayouts, 0, 1, 0, false);
+    }
+
     return data_management::checkNumericTable(get(correlationDistance).get(), correlationDistanceStr(), unexpectedLayouts, 0, nVectors, nVectors);
 }
 
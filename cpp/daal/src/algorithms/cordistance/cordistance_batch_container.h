@@ -58,10 +58,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     size_t na = input->size();
     size_t nr = result->size();
 
-    NumericTable * a0                      = static_cast<NumericTable *>(input->get(data).get());
-    NumericTable ** a                      = &a0;
-    NumericTable * r0                      = static_cast<NumericTable *>(result->get(correlationDistance).get());
-    NumericTable ** r                      = &r0;
+    NumericTable * a0 = static_cast<NumericTable *>(input->get(data).get());
+    NumericTable ** a = &a0;
+
+    NumericTable * r[lastResultId + 1];
+    for (size_t i = 0; i < nr; ++i)
+    {
+        r[i] = static_cast<NumericTable *>(result->get(static_cast<ResultId>(i)).get());
+    }
+
     daal::algorithms::Parameter * par      = _par;
     daal::services::Environment::env & env = *_env;
 
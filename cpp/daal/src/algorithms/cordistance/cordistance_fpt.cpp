@@ -42,6 +42,25 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t dim       = algInput->get(data)->getNumberOfRows();
+
+    const Parameter * algPar    = static_cast<const Parameter *>(par);
+    const OutputMode outputMode = algPar ? algPar->outputMode : fullMatrix;
+    services::Status status;
+    if (outputMode == nearestK)
+    {
+        set(nearestIndices, data_management::HomogenNumericTable<int>::create(algPar->k, dim, data_management::NumericTable::doAllocate, &status));
+        set(nearestDistances,
+            data_management::HomogenNumericTable<algorithmFPType>::create(algPar->k, dim, data_management::NumericTable::doAllocate, &status));
+        return status;
+    }
+    if (outputMode == belowThreshold)
+    {
+        /* Number of pairs is known only after the computation, the tables are resized by the kernel */
+        set(pairIndices, data_management::HomogenNumericTable<int>::create(2, 0, data_management::NumericTable::notAllocate, &status));
+        set(pairDistances, data_management::HomogenNumericTable<algorithmFPType>::create(1, 0, data_management::NumericTable::notAllocate, &status));
+        return status;
+    }
+
     Argument::set(correlationDistance,
                   data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
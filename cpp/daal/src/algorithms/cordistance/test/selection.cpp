@@ -0,0 +1,152 @@
+/* file: selection.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the nearestK and belowThreshold output modes of the correlation distance against the full distance matrix
+//--
+*/
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/distance/correlation_distance.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::correlation_distance::test
+{
+using namespace daal::data_management;
+
+class CorrelationDistanceSelectionTest : public ::testing::TestWithParam<size_t>
+{
+protected:
+    static constexpr size_t nCols = 8;
+
+    /* The rows span several blocks of the selection kernel, the last one is incomplete */
+    CorrelationDistanceSelectionTest() : _nRows(GetParam()), _data(_nRows * nCols)
+    {
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(0.5, 1.0);
+        for (auto & value : _data) value = normal(rng);
+    }
+
+    size_t nRows() const { return _nRows; }
+
+    ResultPtr compute(OutputMode outputMode, size_t k, double threshold)
+    {
+        Batch<double> algorithm;
+        algorithm.input.set(correlation_distance::data, HomogenNumericTable<double>::create(_data.data(), nCols, _nRows));
+        algorithm.parameter.outputMode = outputMode;
+        algorithm.parameter.k          = k;
+        algorithm.parameter.threshold  = threshold;
+        EXPECT_TRUE(algorithm.compute().ok());
+        return algorithm.getResult();
+    }
+
+    /* Distance matrix computed in the fullMatrix output mode */
+    std::vector<double> fullDistances() { return values<double>(compute(fullMatrix, 1, 0.0)->get(correlationDistance)); }
+
+    template <typename T>
+    static std::vector<T> values(const NumericTablePtr & table)
+    {
+        std::vector<T> result(table->getNumberOfRows() * table->getNumberOfColumns());
+        if (result.empty()) return result;
+        BlockDescriptor<T> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::copy(block.getBlockPtr(), block.getBlockPtr() + result.size(), result.begin());
+        table->releaseBlockOfRows(block);
+        return result;
+    }
+
+private:
+    size_t _nRows;
+    std::vector<double> _data;
+};
+
+TEST_P(CorrelationDistanceSelectionTest, NearestKMatchesFullMatrix)
+{
+    const std::vector<double> full = fullDistances();
+    const size_t k                 = 7;
+
+    const ResultPtr result              = compute(nearestK, k, 0.0);
+    const std::vector<int> indices      = values<int>(result->get(nearestIndices));
+    const std::vector<double> distances = values<double>(result->get(nearestDistances));
+    ASSERT_EQ(indices.size(), nRows() * k);
+    ASSERT_EQ(distances.size(), nRows() * k);
+
+    for (size_t i = 0; i < nRows(); ++i)
+    {
+        std::vector<std::pair<double, int> > expected;
+        for (size_t j = 0; j < nRows(); ++j)
+        {
+            if (j != i) expected.push_back({ full[i * nRows() + j], int(j) });
+        }
+        std::sort(expected.begin(), expected.end());
+        for (size_t j = 0; j < k; ++j)
+        {
+            EXPECT_EQ(indices[i * k + j], expected[j].second) << "i = " << i << ", j = " << j;
+            EXPECT_NEAR(distances[i * k + j], expected[j].first, 1e-12) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+/* The pairs go in the order of i and then of j across all the blocks of columns */
+TEST_P(CorrelationDistanceSelectionTest, BelowThresholdMatchesFullMatrix)
+{
+    const std::vector<double> full = fullDistances();
+
+    /* The threshold is in the middle of the gap between two distances so the rounding does not change the selection */
+    std::vector<double> upper;
+    for (size_t i = 0; i < nRows(); ++i)
+    {
+        for (size_t j = i + 1; j < nRows(); ++j) upper.push_back(full[i * nRows() + j]);
+    }
+    std::sort(upper.begin(), upper.end());
+    const size_t nSelected = upper.size() / 20;
+    const double threshold = 0.5 * (upper[nSelected - 1] + upper[nSelected]);
+
+    std::vector<int> expectedIndices;
+    std::vector<double> expectedDistances;
+    for (size_t i = 0; i < nRows(); ++i)
+    {
+        for (size_t j = i + 1; j < nRows(); ++j)
+        {
+            if (full[i * nRows() + j] <= threshold)
+            {
+                expectedIndices.push_back(int(i));
+                expectedIndices.push_back(int(j));
+                expectedDistances.push_back(full[i * nRows() + j]);
+            }
+        }
+    }
+    ASSERT_EQ(expectedDistances.size(), nSelected);
+
+    const ResultPtr result              = compute(belowThreshold, 1, threshold);
+    const std::vector<int> indices      = values<int>(result->get(pairIndices));
+    const std::vector<double> distances = values<double>(result->get(pairDistances));
+    ASSERT_EQ(indices, expectedIndices);
+    ASSERT_EQ(distances.size(), expectedDistances.size());
+    for (size_t i = 0; i < distances.size(); ++i) EXPECT_NEAR(distances[i], expectedDistances[i], 1e-12) << "pair = " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(SeveralBlocks, CorrelationDistanceSelectionTest, ::testing::Values(size_t(100), size_t(128), size_t(300), size_t(517)));
+
+} // namespace daal::algorithms::correlation_distance::test
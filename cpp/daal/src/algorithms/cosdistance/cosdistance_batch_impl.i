@@ -27,6 +27,7 @@
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_distance_selection.h"
 
 static const int blockSizeDefault = 128;
 #include "src/algorithms/cosdistance/cosdistance_full_impl.i"
@@ -57,7 +58,21 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
                                                                        NumericTable * r[], const daal::algorithms::Parameter * par)
 {
-    NumericTable * xTable                          = const_cast<NumericTable *>(a[0]); /* Input data */
+    NumericTable * xTable = const_cast<NumericTable *>(a[0]); /* Input data */
+
+    /* Selection modes stream the blocks of the distance matrix and never store it */
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+    if (parameter && parameter->outputMode == nearestK)
+    {
+        return algorithms::internal::computeNearestDistances<algorithmFPType, cpu>(xTable, false, parameter->k, r[nearestIndices],
+                                                                                   r[nearestDistances]);
+    }
+    if (parameter && parameter->outputMode == belowThreshold)
+    {
+        return algorithms::internal::computeDistancesBelowThreshold<algorithmFPType, cpu>(
+            xTable, false, static_cast<algorithmFPType>(parameter->threshold), r[pairIndices], r[pairDistances]);
+    }
+
     NumericTable * rTable                          = const_cast<NumericTable *>(r[0]); /* Output data */
     const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
@@ -163,7 +163,7 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
 
         /* TLS data initialization */
         SafeStatus safeStat;
-        daal::static_tls<tls_data_t<algorithmFPType, cpu> *> tls_data([=, &safeStat]() {
+        daal::reduction_tls<tls_data_t<algorithmFPType, cpu> *> tls_data([=, &safeStat]() {
             auto tlsData = tls_data_t<algorithmFPType, cpu>::create(isNormalized, nFeatures);
             if (!tlsData)
             {
@@ -173,7 +173,7 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
         });
 
         /* Threaded loop with syrk seq calls */
-        daal::static_threader_for(numBlocks, [&](int iBlock, size_t tid) {
+        daal::reduction_static_threader_for(tls_data, numBlocks, [&](int iBlock, size_t tid) {
             struct tls_data_t<algorithmFPType, cpu> * tls_data_local = tls_data.local(tid);
             if (!tls_data_local)
             {
@@ -219,6 +219,28 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
         });
         DAAL_CHECK_SAFE_STATUS();
 
+        /* In the deterministic mode merge the partial results of the blocks in the fixed order */
+        tls_data.combine_pairwise([=](tls_data_t<algorithmFPType, cpu> * to, tls_data_t<algorithmFPType, cpu> * from) {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < (nFeatures * nFeatures); i++)
+            {
+                to->crossProduct[i] += from->crossProduct[i];
+            }
+
+            if (!isNormalized && (method == defaultDense))
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    to->sums[i] += from->sums[i];
+                }
+            }
+
+            delete from;
+        });
+
         /* TLS reduction: sum all partial cross products and sums */
         tls_data.reduce([=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
             DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
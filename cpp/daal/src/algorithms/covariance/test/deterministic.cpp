@@ -0,0 +1,129 @@
+/* file: deterministic.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that the covariance computed in the deterministic reduction mode is bitwise the same for any number of threads
+//--
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/covariance/covariance_batch.h"
+#include "algorithms/covariance/covariance_online.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/env_detect.h"
+
+namespace daal::algorithms::covariance::test
+{
+using namespace daal::data_management;
+
+class CovarianceDeterministicTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows = 20011;
+    static constexpr size_t nCols = 37;
+
+    CovarianceDeterministicTest() : _data(nRows * nCols)
+    {
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(1.0, 3.0);
+        for (auto & value : _data) value = normal(rng);
+    }
+
+    void SetUp() override
+    {
+        _nThreads = services::Environment::getInstance()->getNumberOfThreads();
+        services::Environment::getInstance()->enableDeterministicReductions(true);
+    }
+
+    void TearDown() override
+    {
+        services::Environment::getInstance()->enableDeterministicReductions(false);
+        services::Environment::getInstance()->setNumberOfThreads(_nThreads);
+    }
+
+    NumericTablePtr data(size_t iFirstRow, size_t nRowsInTable)
+    {
+        return HomogenNumericTable<double>::create(_data.data() + iFirstRow * nCols, nCols, nRowsInTable);
+    }
+
+    static std::vector<std::uint64_t> bits(const NumericTablePtr & table)
+    {
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::vector<std::uint64_t> values(table->getNumberOfRows() * table->getNumberOfColumns());
+        std::memcpy(values.data(), block.getBlockPtr(), values.size() * sizeof(double));
+        table->releaseBlockOfRows(block);
+        return values;
+    }
+
+    static std::vector<std::vector<std::uint64_t> > bits(const ResultPtr & result)
+    {
+        return { bits(result->get(covariance::covariance)), bits(result->get(covariance::mean)) };
+    }
+
+    /* Computes the covariance with 1 thread and checks that it is the same with more threads */
+    template <typename Compute>
+    void checkIsReproducible(const Compute & compute)
+    {
+        services::Environment::getInstance()->setNumberOfThreads(1);
+        const std::vector<std::vector<std::uint64_t> > expected = compute();
+        for (size_t nThreads : { size_t(2), size_t(3), _nThreads > 3 ? _nThreads : size_t(4) })
+        {
+            services::Environment::getInstance()->setNumberOfThreads(nThreads);
+            EXPECT_EQ(expected, compute()) << "nThreads = " << nThreads;
+        }
+    }
+
+private:
+    std::vector<double> _data;
+    size_t _nThreads = 1;
+};
+
+TEST_F(CovarianceDeterministicTest, Batch)
+{
+    checkIsReproducible([&]() {
+        Batch<double> algorithm;
+        algorithm.input.set(covariance::data, data(0, nRows));
+        EXPECT_TRUE(algorithm.compute().ok());
+        return bits(algorithm.getResult());
+    });
+}
+
+/* The rows are split into the blocks of the online mode unevenly */
+TEST_F(CovarianceDeterministicTest, Online)
+{
+    checkIsReproducible([&]() {
+        Online<double> algorithm;
+        const size_t blockStarts[] = { 0, 7000, 7013, nRows };
+        for (size_t i = 0; i + 1 < sizeof(blockStarts) / sizeof(blockStarts[0]); ++i)
+        {
+            algorithm.input.set(covariance::data, data(blockStarts[i], blockStarts[i + 1] - blockStarts[i]));
+            EXPECT_TRUE(algorithm.compute().ok());
+        }
+        EXPECT_TRUE(algorithm.finalizeCompute().ok());
+        return bits(algorithm.getResult());
+    });
+}
+
+} // namespace daal::algorithms::covariance::test
@@ -26,6 +26,7 @@
 #include "src/algorithms/service_sort.h"
 #include "src/algorithms/dtrees/service_array.h"
 #include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
 
 namespace daal
 {
@@ -35,25 +36,61 @@ namespace dtrees
 {
 namespace internal
 {
+//Column-wise (CSC) copy of the nonzero values of a CSR table.
+//Row indices of every column are zero-based and go in ascending order
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+struct SparseColumns
+{
+    services::Status init(CSRNumericTableIface & csr, size_t nRows, size_t nCols)
+    {
+        daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(csr, 0, nRows, true);
+        DAAL_CHECK_BLOCK_STATUS(block);
+        const algorithmFPType * const aValues = block.values();
+        const size_t * const aCols            = block.cols();
+        const size_t * const aRows            = block.rows();
+        const size_t nNonZeros                = aRows[nRows] - 1;
+
+        offsets.resize(nCols + 1, 0);
+        rows.reset(nNonZeros);
+        values.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(offsets.get() && (!nNonZeros || (rows.get() && values.get())));
+
+        for (size_t k = 0; k < nNonZeros; ++k) ++offsets[aCols[k]];
+        for (size_t iCol = 0; iCol < nCols; ++iCol) offsets[iCol + 1] += offsets[iCol];
+
+        //offsets[iCol] serves as the insertion position of column iCol and ends up at the start of column iCol + 1,
+        //so the shift below turns the insertion positions back into the column starts
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            for (size_t k = aRows[iRow] - 1; k < aRows[iRow + 1] - 1; ++k)
+            {
+                const size_t iDst = offsets[aCols[k] - 1]++;
+                rows[iDst]        = IndexType(iRow);
+                values[iDst]      = aValues[k];
+            }
+        }
+        for (size_t iCol = nCols; iCol > 0; --iCol) offsets[iCol] = offsets[iCol - 1];
+        offsets[0] = 0;
+        return services::Status();
+    }
+
+    TVector<size_t, cpu, DefaultAllocator<cpu> > offsets;
+    TVector<IndexType, cpu, DefaultAllocator<cpu> > rows;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > values;
+};
+
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
+    typedef SparseColumns<IndexType, algorithmFPType, cpu> SparseColumnsType;
+    ColIndexTask(size_t nRows, const SparseColumnsType * sparseColumns = nullptr)
+        : _index(nRows), _sortBuffer(nRows), _sparseColumns(sparseColumns), maxNumDiffValues(1)
+    {}
     virtual ~ColIndexTask() {}
-    bool isValid() const { return _index.get(); }
+    bool isValid() const { return _index.get() && _sortBuffer.get(); }
 
-    struct FeatureIdx
-    {
-        algorithmFPType key;
-        IndexType val;
-        static int compare(const void * a, const void * b)
-        {
-            if (static_cast<const FeatureIdx *>(a)->key < static_cast<const FeatureIdx *>(b)->key) return -1;
-            return static_cast<const FeatureIdx *>(a)->key > static_cast<const FeatureIdx *>(b)->key;
-        }
-        bool operator<(const FeatureIdx & o) const { return key < o.key; }
-    };
+    typedef daal::KeyValType<algorithmFPType, IndexType> FeatureIdx;
 
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature)
@@ -64,7 +101,7 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        services::Status s = this->getSorted(nt, iCol, nRows);
         if (!s) return s;
         const FeatureIdx * index = _index.get();
         if (index[0].key == index[nRows - 1].key)
@@ -97,8 +134,9 @@ public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    services::Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
     {
+        if (_sparseColumns) return getSortedSparse(iCol, nRows);
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
@@ -107,20 +145,64 @@ protected:
             index[i].key = pBlock[i];
             index[i].val = i;
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
-        return Status();
+        daal::parallel_radix_sort(index, index + nRows, _sortBuffer.get());
+        return services::Status();
+    }
+
+    //Produces the same order as getSorted() while sorting the nonzeros of the column only.
+    //Rows with implicit zeros are placed between the negative and the positive values,
+    //so all zeros of the column form one run of equal keys and never get split between bins
+    services::Status getSortedSparse(size_t iCol, size_t nRows)
+    {
+        const size_t iFirst                = _sparseColumns->offsets[iCol];
+        const size_t nNonZeros             = _sparseColumns->offsets[iCol + 1] - iFirst;
+        const IndexType * const aRows      = _sparseColumns->rows.get() + iFirst;
+        const algorithmFPType * const aVal = _sparseColumns->values.get() + iFirst;
+        FeatureIdx * index                 = _index.get();
+        for (size_t i = 0; i < nNonZeros; ++i)
+        {
+            index[i].key = aVal[i];
+            index[i].val = aRows[i];
+        }
+        if (nNonZeros > 1) daal::parallel_radix_sort(index, index + nNonZeros, _sortBuffer.get());
+
+        size_t iPositive = 0;
+        for (; (iPositive < nNonZeros) && !(index[iPositive].key > algorithmFPType(0)); ++iPositive)
+            ;
+        //move positive values to the end, the ranges may overlap hence copying goes backwards
+        const size_t nPositive = nNonZeros - iPositive;
+        for (size_t i = 1; i <= nPositive; ++i) index[nRows - i] = index[nNonZeros - i];
+
+        size_t iDst = iPositive;
+        for (size_t iRow = 0, j = 0; iRow < nRows; ++iRow)
+        {
+            if ((j < nNonZeros) && (size_t(aRows[j]) == iRow))
+            {
+                ++j;
+                continue;
+            }
+            index[iDst].key = algorithmFPType(0);
+            index[iDst].val = IndexType(iRow);
+            ++iDst;
+        }
+        DAAL_ASSERT(iDst + nPositive == nRows);
+        return services::Status();
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _sortBuffer;
+    const SparseColumnsType * _sparseColumns;
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams & prm) : super(nRows), _prm(prm), _bins(_prm.maxBins) {}
+    ColIndexTaskBins(size_t nRows, const BinParams & prm, const typename super::SparseColumnsType * sparseColumns = nullptr)
+        : super(nRows, sparseColumns), _prm(prm), _bins(_prm.maxBins)
+    {}
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
@@ -174,7 +256,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
 
         entry.binBorders[0] = index[nRows - 1].key;
         _bins[0]            = nRows;
-        return Status();
+        return services::Status();
     }
     entry.numIndices   = nBins;
     services::Status s = entry.allocBorders();
@@ -196,7 +278,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 {
     if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    services::Status s = this->getSorted(nt, iCol, nRows);
     if (!s) return s;
 
     const typename super::FeatureIdx * index = this->_index.get();
@@ -313,9 +395,23 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> DefaultTask;
     typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
 
+    //CSR data is transposed once, so that the columns are indexed in time proportional to the number of nonzeros
+    //instead of extracting every column from the rows.
+    //Only the indexing is sparse: the binned data filled below is nRows x nC for the CSR input too,
+    //and the histograms of DF and GBT training are built over all its rows
+    typename TlsTask::SparseColumnsType sparseColumns;
+    const typename TlsTask::SparseColumnsType * pSparseColumns = nullptr;
+    CSRNumericTableIface * const csr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&nt));
+    if (csr)
+    {
+        s = sparseColumns.init(*csr, nt.getNumberOfRows(), nC);
+        if (!s) return s;
+        pSparseColumns = &sparseColumns;
+    }
+
     daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm, pSparseColumns) : new DefaultTask(nRows, pSparseColumns));
         if (res && !res->isValid())
         {
             delete res;
@@ -94,6 +94,18 @@ void ModelImpl::clear()
     _nTree.set(0);
 }
 
+bool ModelImpl::addTreeTables(const DecisionTreeTablePtr & treeTable, const NumericTablePtr & impurities, const NumericTablePtr & nodeSampleCounts,
+                              const NumericTablePtr & probabilities, size_t iTree)
+{
+    if (!_serializationData.get() || iTree >= _serializationData->size() || !treeTable.get()) return false;
+    _nTree.inc();
+    (*_serializationData)[iTree] = treeTable;
+    (*_impurityTables)[iTree]    = impurities;
+    (*_nNodeSampleTables)[iTree] = nodeSampleCounts;
+    (*_probTbl)[iTree]           = probabilities;
+    return true;
+}
+
 void MemoryManager::destroy()
 {
     for (size_t i = 0; i < _aChunk.size(); ++i)
@@ -60,11 +60,25 @@ class DecisionTreeTable : public data_management::AOSNumericTable
 {
 public:
     DecisionTreeTable(size_t rowCount = 0) : data_management::AOSNumericTable(sizeof(DecisionTreeNode), 3, rowCount)
+    {
+        setFeatures();
+        allocateDataMemory();
+    }
+
+    /* Refers to the nodes stored in the external memory, the memory is not copied */
+    DecisionTreeTable(const services::SharedPtr<byte> & nodes, size_t rowCount)
+        : data_management::AOSNumericTable(sizeof(DecisionTreeNode), 3, rowCount)
+    {
+        setFeatures();
+        setArray(nodes, rowCount);
+    }
+
+private:
+    void setFeatures()
     {
         setFeature<int>(0, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex));
         setFeature<ClassIndexType>(1, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass));
         setFeature<ModelFPType>(2, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
-        allocateDataMemory();
     }
 };
 typedef services::SharedPtr<DecisionTreeTable> DecisionTreeTablePtr;
@@ -476,6 +490,12 @@ public:
     bool resize(const size_t nTrees);
     void clear();
 
+    /* Sets the tables of the tree built elsewhere, for example restored from the external memory.
+       Impurities, node sample counts and class probabilities are optional. */
+    bool addTreeTables(const DecisionTreeTablePtr & treeTable, const data_management::NumericTablePtr & impurities,
+                       const data_management::NumericTablePtr & nodeSampleCounts, const data_management::NumericTablePtr & probabilities,
+                       size_t iTree);
+
     const data_management::DataCollection * serializationData() const { return _serializationData.get(); }
 
     const DecisionTreeTable * at(const size_t i) const { return (const DecisionTreeTable *)(*_serializationData)[i].get(); }
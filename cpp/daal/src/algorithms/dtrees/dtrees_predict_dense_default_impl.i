@@ -29,6 +29,9 @@
 #include "src/services/service_data_utils.h"
 #include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
 #include "src/services/service_environment.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_error_handling.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -133,6 +136,53 @@ struct TileDimensions
     static const size_t nRowsInBlockDefault = 500;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Returns the CSR interface of the data or null for other layouts
+//////////////////////////////////////////////////////////////////////////////////////////
+inline CSRNumericTableIface * getCSRData(const NumericTable & data)
+{
+    return dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&data));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Calls func(iRow, x) for each row of the CSR table, where x is
+// the row expanded to nCols features. Nonzeros of the row are scattered into a per-thread
+// buffer of zeros and reset after the call, so the table is never densified and the cost
+// of a row is proportional to its number of nonzeros
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu, typename Func>
+services::Status predictByCSRRows(CSRNumericTableIface & csr, const size_t nRows, const size_t nCols, const Func & func)
+{
+    const size_t nRowsInBlock = TileDimensions<algorithmFPType>::nRowsInBlockDefault;
+    const size_t nBlocks      = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+
+    daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsRow(nCols);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iStartRow : nRowsInBlock;
+
+        algorithmFPType * const x = tlsRow.local();
+        DAAL_CHECK_MALLOC_THR(x);
+
+        ReadRowsCSR<algorithmFPType, cpu> xBD(&csr, iStartRow, nRowsToProcess, true);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType * const values = xBD.values();
+        const size_t * const cols            = xBD.cols();
+        const size_t * const rows            = xBD.rows();
+
+        for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+        {
+            const size_t begin = rows[iRow] - 1;
+            const size_t end   = rows[iRow + 1] - 1;
+            for (size_t k = begin; k < end; ++k) x[cols[k] - 1] = values[k];
+            func(iStartRow + iRow, x);
+            for (size_t k = begin; k < end; ++k) x[cols[k] - 1] = algorithmFPType(0);
+        }
+    });
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace dtrees */
@@ -163,11 +163,17 @@ protected:
 
     Status predictAllPointsByAllTrees(const size_t nTreesTotal);
 
+    Status predictByAllTreesCSR(const size_t nTreesTotal, CSRNumericTableIface & csr);
+
     Status predictByBlocksOfTrees(services::HostAppIface * const pHostApp, const size_t nTreesTotal, const DimType & dim,
                                   algorithmFPType * const aClsCounters);
 
     Status predictOneRowByAllTrees(const size_t nTreesTotal);
 
+    Status initFeatureTypes();
+
+    Status cacheTrees(const size_t nTreesTotal);
+
     size_t getMaxClass(const algorithmFPType * const counts) const
     {
         return services::internal::getMaxElementIndex<algorithmFPType, cpu>(counts, _nClasses);
@@ -1075,20 +1081,60 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
 }
 
 template <typename algorithmFPType, CpuType cpu>
-Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIface * const pHostApp)
+Status PredictClassificationTask<algorithmFPType, cpu>::predictByAllTreesCSR(const size_t nTreesTotal, CSRNumericTableIface & csr)
+{
+    const size_t nRows(_data->getNumberOfRows());
+    const size_t nCols(_data->getNumberOfColumns());
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(probBD);
+    algorithmFPType * const res     = resBD.get();
+    algorithmFPType * const probPtr = probBD.get();
+    if (probPtr != nullptr)
+    {
+        return dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+            csr, nRows, nCols, [&](const size_t iRow, const algorithmFPType * const x) {
+                algorithmFPType * const prob = probPtr + iRow * _nClasses;
+                services::internal::service_memset_seq<algorithmFPType, cpu>(prob, algorithmFPType(0), _nClasses);
+                predictByTrees(0, nTreesTotal, x, prob, nTreesTotal);
+                if (res)
+                {
+                    res[iRow] = algorithmFPType(getMaxClass(prob));
+                }
+            });
+    }
+
+    const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
+    ClassesCounterTls lsData(_nClasses);
+    return dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+        csr, nRows, nCols, [&](const size_t iRow, const algorithmFPType * const x) {
+            algorithmFPType buf[s_cMaxClassesBufSize];
+            algorithmFPType * const val = bUseTLS ? lsData.local() : buf;
+            for (size_t i = 0; i < _nClasses; ++i) val[i] = 0;
+            predictByTrees(0, nTreesTotal, x, val, nTreesTotal);
+            if (res)
+            {
+                res[iRow] = algorithmFPType(getMaxClass(val));
+            }
+        });
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationTask<algorithmFPType, cpu>::initFeatureTypes()
 {
-    const auto nTreesTotal = _model->size();
     if (_cachedData != _data)
     {
         _featHelper.clearBuf();
         DAAL_CHECK_MALLOC(_featHelper.init(*_data));
         _cachedData = const_cast<NumericTable *>(_data);
     }
-    const bool hasUnorderedFeatures = _featHelper.hasUnorderedFeatures();
-    if (_data->getNumberOfRows() == 1 && !(hasUnorderedFeatures))
-    {
-        return predictOneRowByAllTrees(nTreesTotal);
-    }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationTask<algorithmFPType, cpu>::cacheTrees(const size_t nTreesTotal)
+{
     if (_cachedModel != _model)
     {
         _cachedModel = _model;
@@ -1103,6 +1149,32 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         _averageTreeSize = _averageTreeSize / nTreesTotal;
         _sumTreeSize     = 0;
     }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIface * const pHostApp)
+{
+    const auto nTreesTotal = _model->size();
+    Status s;
+
+    /* CSR rows are scattered one by one into a dense row buffer and go through all the trees,
+       neither the single-row nor the blocked dense paths read such data */
+    CSRNumericTableIface * const csrData = dtrees::prediction::internal::getCSRData(*_data);
+    if (csrData)
+    {
+        DAAL_CHECK_STATUS(s, initFeatureTypes());
+        DAAL_CHECK_STATUS(s, cacheTrees(nTreesTotal));
+        return predictByAllTreesCSR(nTreesTotal, *csrData);
+    }
+
+    DAAL_CHECK_STATUS(s, initFeatureTypes());
+    const bool hasUnorderedFeatures = _featHelper.hasUnorderedFeatures();
+    if (_data->getNumberOfRows() == 1 && !(hasUnorderedFeatures))
+    {
+        return predictOneRowByAllTrees(nTreesTotal);
+    }
+    DAAL_CHECK_STATUS(s, cacheTrees(nTreesTotal));
 
     if (hasUnorderedFeatures
         || (_data->getNumberOfRows() < _averageTreeSize * _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
@@ -145,7 +145,11 @@ public:
 
     TResponse predict(const dtrees::internal::Tree & t, const algorithmFPType * x) const
     {
-        const typename TreeType::NodeType::Base * pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x);
+        return predict(dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x));
+    }
+
+    TResponse predict(const typename TreeType::NodeType::Base * pNode) const
+    {
         DAAL_ASSERT(pNode);
         return TreeType::NodeType::castLeaf(pNode)->response.value;
     }
@@ -0,0 +1,159 @@
+/* file: csr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that decision forest classification predicts the same on CSR and on the same dense data
+//--
+*/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::decision_forest::classification::test
+{
+using namespace daal::data_management;
+
+class DecisionForestCSRTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows    = 1000;
+    static constexpr size_t nCols    = 40;
+    static constexpr size_t nClasses = 3;
+
+    DecisionForestCSRTest() : _dense(nRows * nCols, 0.0), _labels(nRows)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        _rowOffsets.push_back(1);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            double margin = 0.0;
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                if (uniform(rng) < 0.1)
+                {
+                    const double value    = normal(rng);
+                    _dense[i * nCols + j] = value;
+                    _values.push_back(value);
+                    _colIndices.push_back(j + 1);
+                    margin += (j < nCols / 2 ? value : -value);
+                }
+            }
+            _rowOffsets.push_back(_values.size() + 1);
+            _labels[i] = margin < -0.5 ? 0.0 : (margin < 0.5 ? 1.0 : 2.0);
+        }
+    }
+
+    NumericTablePtr dense(size_t iFirstRow, size_t nRowsInTable)
+    {
+        return HomogenNumericTable<double>::create(_dense.data() + iFirstRow * nCols, nCols, nRowsInTable);
+    }
+
+    /* CSR table over the rows [iFirstRow, iFirstRow + nRowsInTable) of the dataset, with its own row offsets */
+    NumericTablePtr csr(size_t iFirstRow, size_t nRowsInTable)
+    {
+        const size_t offset              = _rowOffsets[iFirstRow] - 1;
+        std::vector<size_t> & rowOffsets = _csrRowOffsets[nRowsInTable == 1];
+        rowOffsets.resize(nRowsInTable + 1);
+        for (size_t i = 0; i <= nRowsInTable; ++i)
+        {
+            rowOffsets[i] = _rowOffsets[iFirstRow + i] - offset;
+        }
+        return CSRNumericTablePtr(new CSRNumericTable(_values.data() + offset, _colIndices.data() + offset, rowOffsets.data(), nCols, nRowsInTable));
+    }
+
+    ModelPtr train()
+    {
+        NumericTablePtr labels = HomogenNumericTable<double>::create(_labels.data(), 1, nRows);
+        training::Batch<double> algorithm(nClasses);
+        algorithm.input.set(classifier::training::data, dense(0, nRows));
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter().nTrees = 20;
+        EXPECT_TRUE(algorithm.compute().ok());
+        return algorithm.getResult()->get(classifier::training::model);
+    }
+
+    static void predict(const ModelPtr & model, const NumericTablePtr & data, std::vector<double> & labels, std::vector<double> & probabilities)
+    {
+        prediction::Batch<double> algorithm(nClasses);
+        algorithm.input.set(classifier::prediction::data, data);
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+        ASSERT_TRUE(algorithm.compute().ok());
+        labels        = read(algorithm.getResult()->get(classifier::prediction::prediction));
+        probabilities = read(algorithm.getResult()->get(classifier::prediction::probabilities));
+    }
+
+    static std::vector<double> read(const NumericTablePtr & table)
+    {
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + table->getNumberOfRows() * table->getNumberOfColumns());
+        table->releaseBlockOfRows(block);
+        return values;
+    }
+
+    void checkCSRMatchesDense(const ModelPtr & model, size_t iFirstRow, size_t nRowsInTable)
+    {
+        std::vector<double> denseLabels, denseProbabilities, csrLabels, csrProbabilities;
+        predict(model, dense(iFirstRow, nRowsInTable), denseLabels, denseProbabilities);
+        predict(model, csr(iFirstRow, nRowsInTable), csrLabels, csrProbabilities);
+
+        ASSERT_EQ(denseLabels.size(), nRowsInTable);
+        EXPECT_EQ(denseLabels, csrLabels);
+        ASSERT_EQ(denseProbabilities.size(), csrProbabilities.size());
+        for (size_t i = 0; i < denseProbabilities.size(); ++i)
+        {
+            EXPECT_NEAR(denseProbabilities[i], csrProbabilities[i], 1e-10) << "i = " << i;
+        }
+    }
+
+private:
+    std::vector<double> _dense;
+    std::vector<double> _labels;
+    std::vector<double> _values;
+    std::vector<size_t> _colIndices;
+    std::vector<size_t> _rowOffsets;
+    std::vector<size_t> _csrRowOffsets[2];
+};
+
+TEST_F(DecisionForestCSRTest, MultipleRows)
+{
+    const ModelPtr model = train();
+    checkCSRMatchesDense(model, 0, nRows);
+    checkCSRMatchesDense(model, 100, 37);
+}
+
+TEST_F(DecisionForestCSRTest, SingleRow)
+{
+    const ModelPtr model = train();
+    checkCSRMatchesDense(model, 0, 1);
+    checkCSRMatchesDense(model, 517, 1);
+}
+
+} // namespace daal::algorithms::decision_forest::classification::test
@@ -0,0 +1,240 @@
+/* file: mda.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the mean decrease accuracy variable importance of decision forest classification
+//  against the brute-force permutation of the values of every feature over the out-of-bag rows of each tree
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "algorithms/engines/mt19937/mt19937.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::decision_forest::classification::test
+{
+using namespace daal::data_management;
+
+/* Increase of the out-of-bag error of a tree caused by the permutation of the values of each feature */
+struct PermutationStatistics
+{
+    std::vector<double> mean;
+    std::vector<double> variance;
+};
+
+class DecisionForestMDATest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows            = 500;
+    static constexpr size_t nCols            = 6;
+    static constexpr size_t nClasses         = 3;
+    static constexpr size_t nTrees           = 10;
+    static constexpr size_t featuresPerNode  = 3;
+    static constexpr size_t unusedFeature    = 2;
+    static constexpr unsigned long long seed = 777;
+
+    /* The feature 2 is constant, so no tree can split on it. The feature 4 is noise */
+    DecisionForestMDATest() : _data(nRows * nCols), _labels(nRows)
+    {
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            double * x = &_data[i * nCols];
+            for (size_t j = 0; j < nCols; ++j) x[j] = normal(rng);
+            x[unusedFeature]    = 1.0;
+            const double margin = 2.0 * x[0] - 1.5 * x[1] + 0.7 * x[3] + 0.3 * x[5] + 0.3 * normal(rng);
+            _labels[i]          = margin < -1.0 ? 0.0 : (margin < 1.0 ? 1.0 : 2.0);
+        }
+    }
+
+    /* The tree iTree of the forest is built by the engine skipped ahead as in the training of the forest of nTrees trees,
+       so the forest of a single tree trained with the skipped engine contains the same tree, out-of-bag rows and permutations */
+    training::ResultPtr train(decision_forest::training::VariableImportanceMode varImportance, size_t iTree = nTrees)
+    {
+        engines::EnginePtr engine = engines::mt19937::Batch<>::create(seed);
+        if (iTree < nTrees) EXPECT_TRUE(engine->skipAhead(iTree * nTrees * nRows * (featuresPerNode + 1)).ok());
+
+        training::Batch<double> algorithm(nClasses);
+        algorithm.input.set(classifier::training::data, HomogenNumericTable<double>::create(_data.data(), nCols, nRows));
+        algorithm.input.set(classifier::training::labels, HomogenNumericTable<double>::create(_labels.data(), 1, nRows));
+        algorithm.parameter().nTrees           = (iTree < nTrees) ? 1 : nTrees;
+        algorithm.parameter().featuresPerNode  = featuresPerNode;
+        algorithm.parameter().varImportance    = varImportance;
+        algorithm.parameter().resultsToCompute = decision_forest::training::computeOutOfBagErrorPerObservation;
+        algorithm.parameter().engine           = engine;
+        EXPECT_TRUE(algorithm.compute().ok());
+        return algorithm.getResult();
+    }
+
+    /* Mean and variance of the permuted out-of-bag error minus the out-of-bag error over all the permutations of the out-of-bag rows.
+       The variance of the sum of a(r, perm(r)) is the sum of the squared double-centered a(r, s) divided by n - 1 */
+    PermutationStatistics permute(const training::ResultPtr & result)
+    {
+        const std::vector<double> errorPerRow = read(result->get(training::outOfBagErrorPerObservation));
+        std::vector<size_t> oob;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            if (errorPerRow[i] >= 0.0) oob.push_back(i);
+        }
+        const size_t n = oob.size();
+        EXPECT_GT(n, 100);
+
+        PermutationStatistics statistics;
+        std::vector<double> permuted(n * n * nCols);
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            /* The row r with the value of the feature j taken from the row s */
+            for (size_t r = 0; r < n; ++r)
+            {
+                for (size_t s = 0; s < n; ++s)
+                {
+                    double * x = &permuted[(r * n + s) * nCols];
+                    std::copy(&_data[oob[r] * nCols], &_data[oob[r] * nCols] + nCols, x);
+                    x[j] = _data[oob[s] * nCols + j];
+                }
+            }
+            const std::vector<double> predicted = predict(result->get(classifier::training::model), permuted);
+
+            /* The errors are counted in integers, so the statistics of the feature no tree splits on are exactly 0 */
+            std::vector<long long> a(n * n), rowCount(n, 0), colCount(n, 0);
+            long long count = 0, oobCount = 0;
+            for (size_t r = 0; r < n; ++r)
+            {
+                for (size_t s = 0; s < n; ++s)
+                {
+                    a[r * n + s] = (predicted[r * n + s] != _labels[oob[r]]) ? 1 : 0;
+                    rowCount[r] += a[r * n + s];
+                    colCount[s] += a[r * n + s];
+                    count += a[r * n + s];
+                }
+                oobCount += a[r * n + r];
+            }
+            const long long nn = n;
+            double variance    = 0.0;
+            for (size_t r = 0; r < n; ++r)
+            {
+                for (size_t s = 0; s < n; ++s)
+                {
+                    const double centered = double(nn * nn * a[r * n + s] - nn * rowCount[r] - nn * colCount[s] + count);
+                    variance += centered * centered;
+                }
+            }
+            const double n2 = double(n) * double(n);
+            EXPECT_NEAR(double(oobCount) / n, average(errorPerRow), 1e-12) << "feature = " << j;
+            statistics.mean.push_back(double(count - nn * oobCount) / n2);
+            statistics.variance.push_back(variance / (n2 * n2) / (n - 1) / n2);
+        }
+        return statistics;
+    }
+
+    std::vector<double> predict(const ModelPtr & model, const std::vector<double> & data)
+    {
+        prediction::Batch<double> algorithm(nClasses);
+        algorithm.input.set(classifier::prediction::data, HomogenNumericTable<double>::create(const_cast<double *>(data.data()), nCols,
+                                                                                               data.size() / nCols));
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.parameter().votingMethod = prediction::unweighted;
+        EXPECT_TRUE(algorithm.compute().ok());
+        return read(algorithm.getResult()->get(classifier::prediction::prediction));
+    }
+
+    static double average(const std::vector<double> & errorPerRow)
+    {
+        double sum = 0.0;
+        size_t n   = 0;
+        for (double error : errorPerRow)
+        {
+            if (error >= 0.0)
+            {
+                sum += error;
+                ++n;
+            }
+        }
+        return sum / n;
+    }
+
+    static std::vector<double> read(const NumericTablePtr & table)
+    {
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + table->getNumberOfRows() * table->getNumberOfColumns());
+        table->releaseBlockOfRows(block);
+        return values;
+    }
+
+private:
+    std::vector<double> _data;
+    std::vector<double> _labels;
+};
+
+TEST_F(DecisionForestMDATest, MatchesBruteForcePermutation)
+{
+    std::vector<std::vector<double> > treeImportances;
+    std::vector<double> deviation(nCols, 0.0), variance(nCols, 0.0);
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const training::ResultPtr result       = train(decision_forest::training::MDA_Raw, iTree);
+        const std::vector<double> importance   = read(result->get(training::variableImportance));
+        const PermutationStatistics bruteForce = permute(result);
+        ASSERT_EQ(importance.size(), nCols);
+        EXPECT_EQ(importance[unusedFeature], 0.0) << "iTree = " << iTree;
+        EXPECT_EQ(bruteForce.variance[unusedFeature], 0.0) << "iTree = " << iTree;
+        EXPECT_EQ(bruteForce.mean[unusedFeature], 0.0) << "iTree = " << iTree;
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            deviation[j] += importance[j] - bruteForce.mean[j];
+            variance[j] += bruteForce.variance[j];
+        }
+        treeImportances.push_back(importance);
+    }
+
+    /* The importances of the trees are single draws of the permutation, their sum is compared with the brute-force mean within 4 sigma */
+    for (size_t j = 0; j < nCols; ++j)
+    {
+        if (j == unusedFeature) continue;
+        EXPECT_LT(std::abs(deviation[j]), 4.0 * std::sqrt(variance[j])) << "feature = " << j;
+    }
+
+    /* The forest averages the importances of its trees, the scaled importance is divided by the standard error of the mean */
+    const std::vector<double> raw    = read(train(decision_forest::training::MDA_Raw)->get(training::variableImportance));
+    const std::vector<double> scaled = read(train(decision_forest::training::MDA_Scaled)->get(training::variableImportance));
+    for (size_t j = 0; j < nCols; ++j)
+    {
+        double mean = 0.0, squares = 0.0;
+        for (const auto & importance : treeImportances) mean += importance[j] / nTrees;
+        for (const auto & importance : treeImportances) squares += (importance[j] - mean) * (importance[j] - mean);
+        const double expectedScaled = squares > 0.0 ? mean * nTrees / std::sqrt(squares) : mean;
+        EXPECT_NEAR(raw[j], mean, 1e-12) << "feature = " << j;
+        EXPECT_NEAR(scaled[j], expectedScaled, 1e-9 * std::max(1.0, std::abs(expectedScaled))) << "feature = " << j;
+    }
+    EXPECT_EQ(raw[unusedFeature], 0.0);
+    EXPECT_EQ(scaled[unusedFeature], 0.0);
+    EXPECT_GT(raw[0], 0.1);
+    EXPECT_GT(scaled[0], 3.0);
+}
+
+} // namespace daal::algorithms::decision_forest::classification::test
@@ -604,10 +604,22 @@ protected:
 
     services::Status computeResults(const dtrees::internal::Tree & t);
 
-    algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd);
+    algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, algorithmFPType * aRowError = nullptr);
 
-    algorithmFPType computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, const IndexType * aPerm,
-                                        size_t iPermutedFeature);
+    services::Status computeMDA(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, const algorithmFPType * aRowError,
+                                algorithmFPType oobError);
+
+    services::Status computePermutedOOBErrors(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, const algorithmFPType * aRowError,
+                                              const IndexType * aFeature, size_t nPermutedFeatures, const IndexType * aPerm,
+                                              algorithmFPType * aPermError);
+
+    void addPermutationImportance(size_t iFeature, algorithmFPType diff, algorithmFPType div1)
+    {
+        //_threadCtx.varImp[i] is a mean of diff among all the trees
+        const algorithmFPType delta = diff - _threadCtx.varImp[iFeature]; //old mean
+        _threadCtx.varImp[iFeature] += div1 * delta;
+        if (_threadCtx.varImpVariance) _threadCtx.varImpVariance[iFeature] += delta * (diff - _threadCtx.varImp[iFeature]); //new mean
+    }
 
     void setupHostApp()
     {
@@ -1156,79 +1168,205 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
     const bool bMDA(_par.varImportance == training::MDA_Raw || _par.varImportance == training::MDA_Scaled);
     if (_par.resultsToCompute & (computeOutOfBagError | computeOutOfBagErrorPerObservation) || bMDA)
     {
-        const algorithmFPType oobError = computeOOBError(t, nOOB, oobIndices.get());
-        if (bMDA)
-        {
-            TArray<IndexType, cpu> permutation(nOOB);
-            DAAL_CHECK_MALLOC(permutation.get());
-            for (size_t i = 0; i < nOOB; permutation[i] = i, ++i)
-                ;
-            const size_t nTrees        = _threadCtx.nTrees;
-            const algorithmFPType div1 = algorithmFPType(1) / algorithmFPType(nTrees);
-            for (size_t i = 0, n = nFeatures(); i < n; ++i)
-            {
-                shuffle<cpu>(_engineImpl->getState(), nOOB, permutation.get());
-                const algorithmFPType permOOBError = computeOOBErrorPerm(t, nOOB, oobIndices.get(), permutation.get(), i);
-                const algorithmFPType diff         = (permOOBError - oobError);
-                //_threadCtx.varImp[i] is a mean of diff among all the trees
-                const algorithmFPType delta = diff - _threadCtx.varImp[i]; //old mean
-                _threadCtx.varImp[i] += div1 * delta;
-                if (_threadCtx.varImpVariance) _threadCtx.varImpVariance[i] += delta * (diff - _threadCtx.varImp[i]); //new mean
-            }
-        }
+        TArray<algorithmFPType, cpu> rowErrors(bMDA ? nOOB : 0);
+        DAAL_CHECK_MALLOC(!bMDA || rowErrors.get());
+        const algorithmFPType oobError = computeOOBError(t, nOOB, oobIndices.get(), rowErrors.get());
+        if (bMDA) return computeMDA(t, nOOB, oobIndices.get(), rowErrors.get(), oobError);
     }
     return services::Status();
 }
 
-template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType predictionError(const DataHelper & h, const dtrees::internal::Tree & t, const algorithmFPType * x, const NumericTable * resp,
-                                size_t iRow)
+template <typename NodeType>
+void markSplitFeatures(const typename NodeType::Base * pNode, bool * aUsed)
+{
+    if (!pNode || !pNode->isSplit()) return;
+    const typename NodeType::Split * pSplit = NodeType::castSplit(pNode);
+    aUsed[pSplit->featureIdx]               = true;
+    markSplitFeatures<NodeType>(pSplit->kid[0], aUsed);
+    markSplitFeatures<NodeType>(pSplit->kid[1], aUsed);
+}
+
+//same as the rule used by dtrees::prediction::internal::findNode()
+template <typename algorithmFPType, CpuType cpu, typename SplitType>
+int splitDirection(const SplitType * pSplit, algorithmFPType value, bool bUnorderedSplits)
 {
-    ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable *>(resp), iRow, 1);
-    return h.predictionError(h.predict(t, x), *y.get());
+    if (bUnorderedSplits && pSplit->featureUnordered) return int(value) != int(pSplit->featureValue);
+    return daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - value);
 }
 
+//Mean decrease accuracy: the increase of the OOB error caused by the random permutation of the feature values.
+//The permutation of a feature the tree does not split on changes no predictions, so only the features used by the tree are evaluated.
+//The permutations are generated for all the features in the same order as before, the importances do not depend on the optimization.
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
-algorithmFPType TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t n,
-                                                                                                        const IndexType * aInd,
-                                                                                                        const IndexType * aPerm,
-                                                                                                        size_t iPermutedFeature)
+services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computeMDA(const dtrees::internal::Tree & t, size_t n,
+                                                                                               const IndexType * aInd,
+                                                                                               const algorithmFPType * aRowError,
+                                                                                               algorithmFPType oobError)
 {
-    DAAL_ASSERT(n);
+    typedef typename DataHelper::TreeType::NodeType NodeType;
+    const size_t cMaxPermutedValues = 1024 * 1024; //limits the memory used for the permutations of a group of features
+
+    const size_t dim = nFeatures();
+    TArray<bool, cpu> aUsed(dim);
+    DAAL_CHECK_MALLOC(aUsed.get());
+    services::internal::service_memset_seq<bool, cpu>(aUsed.get(), false, dim);
+    markSplitFeatures<NodeType>(static_cast<const typename DataHelper::TreeType &>(t).top(), aUsed.get());
+
+    size_t nUsed = 0;
+    for (size_t i = 0; i < dim; ++i) nUsed += size_t(aUsed[i]);
+    size_t nGroupMax = cMaxPermutedValues / n;
+    nGroupMax        = nGroupMax < 1 ? 1 : (nGroupMax > nUsed ? nUsed : nGroupMax);
+
+    TArray<IndexType, cpu> permutation(n);
+    TArray<IndexType, cpu> groupFeatures(nGroupMax);
+    TArray<IndexType, cpu> groupPermutations(nGroupMax * n);
+    TArray<algorithmFPType, cpu> groupPermErrors(nGroupMax);
+    DAAL_CHECK_MALLOC(permutation.get() && (!nGroupMax || (groupFeatures.get() && groupPermutations.get() && groupPermErrors.get())));
+    for (size_t i = 0; i < n; permutation[i] = i, ++i)
+        ;
+
+    const size_t nTrees        = _threadCtx.nTrees;
+    const algorithmFPType div1 = algorithmFPType(1) / algorithmFPType(nTrees);
+    size_t nGroup              = 0;
+    for (size_t i = 0; i < dim; ++i)
+    {
+        shuffle<cpu>(_engineImpl->getState(), n, permutation.get());
+        if (!aUsed[i])
+        {
+            //the predictions do not change, so the permuted OOB error is exactly equal to the OOB error
+            addPermutationImportance(i, algorithmFPType(0), div1);
+            continue;
+        }
+        groupFeatures[nGroup] = i;
+        services::internal::tmemcpy<IndexType, cpu>(groupPermutations.get() + nGroup * n, permutation.get(), n);
+        if (++nGroup < nGroupMax && i + 1 < dim) continue;
 
-    const auto dim = nFeatures();
+        services::Status s =
+            computePermutedOOBErrors(t, n, aInd, aRowError, groupFeatures.get(), nGroup, groupPermutations.get(), groupPermErrors.get());
+        DAAL_CHECK_STATUS_VAR(s);
+        for (size_t j = 0; j < nGroup; ++j) addPermutationImportance(groupFeatures[j], groupPermErrors[j] - oobError, div1);
+        nGroup = 0;
+    }
+    return services::Status();
+}
 
-    //compute prediction error on each OOB row and get its mean using online formulae (Welford)
-    //TODO: can be threader_for() block
-    TArray<algorithmFPType, cpu> buf(dim);
-    ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_data), aInd[0], 1);
-    services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.get(), dim);
-    ReadRows<algorithmFPType, cpu> p(const_cast<NumericTable *>(_data), aInd[aPerm[0]], 1);
-    buf[iPermutedFeature] = p.get()[iPermutedFeature];
-    algorithmFPType mean  = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[0]);
+//Computes the OOB error for each of the features with the values permuted by aPerm.
+//Only the rows routed through a node splitting on the feature are predicted again, starting from the topmost such node.
+//The errors are averaged in the order of the rows with the same online formulae as the OOB error, so they are exactly reproducible.
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computePermutedOOBErrors(
+    const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, const algorithmFPType * aRowError, const IndexType * aFeature,
+    size_t nPermutedFeatures, const IndexType * aPerm, algorithmFPType * aPermError)
+{
+    typedef typename DataHelper::TreeType TreeType;
+    typedef typename TreeType::NodeType NodeType;
+    typedef typename NodeType::Base NodeBase;
+    const size_t cBlockSize = 256; //number of OOB rows read at once
+
+    const TreeType & tree       = static_cast<const TreeType &>(t);
+    const bool bUnorderedSplits = tree.hasUnorderedFeatureSplits();
+    const size_t dim            = nFeatures();
+    NumericTable * data         = const_cast<NumericTable *>(_data);
+    NumericTable * resp         = const_cast<NumericTable *>(_resp);
+
+    TArray<int, cpu> aSlot(dim);                                   //position of the feature among the permuted ones, -1 if it is not permuted
+    TArray<algorithmFPType, cpu> aValue(nPermutedFeatures * n);    //values of the permuted features in the OOB rows
+    TArray<const NodeBase *, cpu> aTopNode(nPermutedFeatures);     //topmost node splitting on the feature on the path of the current row
+    TArray<IndexType, cpu> aRouted(nPermutedFeatures);             //permuted features with the nodes on the path of the current row
+    TArray<algorithmFPType, cpu> aRowPermError(nPermutedFeatures); //prediction errors of the current row with the permuted features
+    DAAL_CHECK_MALLOC(aSlot.get() && aValue.get() && aTopNode.get() && aRouted.get() && aRowPermError.get());
+    for (size_t i = 0; i < dim; ++i) aSlot[i] = -1;
+    for (size_t j = 0; j < nPermutedFeatures; ++j)
+    {
+        aSlot[aFeature[j]] = int(j);
+        aTopNode[j]        = nullptr;
+        aPermError[j]      = 0;
+    }
 
-    for (size_t i = 1; i < n; ++i)
+    //the OOB indices are sorted, each block of OOB rows is read as a single range of rows
+    ReadRows<algorithmFPType, cpu> x;
+    ReadRows<algorithmFPType, cpu> y;
+    for (size_t iStart = 0; iStart < n; iStart += cBlockSize)
     {
-        services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.set(const_cast<NumericTable *>(_data), aInd[i], 1), dim);
-        buf[iPermutedFeature] = p.set(const_cast<NumericTable *>(_data), aInd[aPerm[i]], 1)[iPermutedFeature];
-        algorithmFPType val   = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[i]);
-        mean += (val - mean) / algorithmFPType(i + 1);
+        const size_t iEnd         = (iStart + cBlockSize < n) ? iStart + cBlockSize : n;
+        const size_t iFirstRow    = aInd[iStart];
+        const algorithmFPType * b = x.set(data, iFirstRow, aInd[iEnd - 1] - iFirstRow + 1);
+        DAAL_CHECK_BLOCK_STATUS(x);
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const algorithmFPType * row = b + (aInd[i] - iFirstRow) * dim;
+            for (size_t j = 0; j < nPermutedFeatures; ++j) aValue[j * n + i] = row[aFeature[j]];
+        }
     }
-    return mean;
+
+    for (size_t iStart = 0; iStart < n; iStart += cBlockSize)
+    {
+        const size_t iEnd         = (iStart + cBlockSize < n) ? iStart + cBlockSize : n;
+        const size_t iFirstRow    = aInd[iStart];
+        const size_t nRows        = aInd[iEnd - 1] - iFirstRow + 1;
+        const algorithmFPType * b = x.set(data, iFirstRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(x);
+        const algorithmFPType * resb = y.set(resp, iFirstRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(y);
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const algorithmFPType * row = b + (aInd[i] - iFirstRow) * dim;
+
+            size_t nRouted = 0;
+            for (const NodeBase * pNode = tree.top(); pNode && pNode->isSplit();)
+            {
+                const typename NodeType::Split * pSplit = NodeType::castSplit(pNode);
+                const int j                             = aSlot[pSplit->featureIdx];
+                if (j >= 0 && !aTopNode[j])
+                {
+                    aTopNode[j]        = pNode;
+                    aRouted[nRouted++] = j;
+                }
+                pNode = pSplit->kid[splitDirection<algorithmFPType, cpu>(pSplit, row[pSplit->featureIdx], bUnorderedSplits)];
+            }
+
+            for (size_t k = 0; k < nRouted; ++k)
+            {
+                const IndexType j                   = aRouted[k];
+                const IndexType iFeature            = aFeature[j];
+                const algorithmFPType permutedValue = aValue[j * n + aPerm[j * n + i]];
+                const NodeBase * pNode              = aTopNode[j];
+                while (pNode && pNode->isSplit())
+                {
+                    const typename NodeType::Split * pSplit = NodeType::castSplit(pNode);
+                    const algorithmFPType value             = (pSplit->featureIdx == iFeature) ? permutedValue : row[pSplit->featureIdx];
+                    pNode = pSplit->kid[splitDirection<algorithmFPType, cpu>(pSplit, value, bUnorderedSplits)];
+                }
+                aRowPermError[j] = _helper.predictionError(_helper.predict(pNode), resb[aInd[i] - iFirstRow]);
+            }
+
+            for (size_t j = 0; j < nPermutedFeatures; ++j)
+            {
+                const algorithmFPType val = aTopNode[j] ? aRowPermError[j] : aRowError[i];
+                aPermError[j] += (val - aPermError[j]) / algorithmFPType(i + 1);
+            }
+            for (size_t k = 0; k < nRouted; ++k) aTopNode[aRouted[k]] = nullptr;
+        }
+    }
+    return services::Status();
 }
 
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
 algorithmFPType TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computeOOBError(const dtrees::internal::Tree & t, size_t n,
-                                                                                                    const IndexType * aInd)
+                                                                                                    const IndexType * aInd,
+                                                                                                    algorithmFPType * aRowError)
 {
     DAAL_ASSERT(n);
     //compute prediction error on each OOB row and get its mean online formulae (Welford)
     //TODO: can be threader_for() block
     ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_data), aInd[0], 1);
     algorithmFPType mean = _helper.predictionError(t, x.get(), _resp, aInd[0], _threadCtx.oobBuf);
+    if (aRowError) aRowError[0] = mean;
     for (size_t i = 1; i < n; ++i)
     {
         algorithmFPType val = _helper.predictionError(t, x.set(const_cast<NumericTable *>(_data), aInd[i], 1), _resp, aInd[i], _threadCtx.oobBuf);
+        if (aRowError) aRowError[i] = val;
         mean += (val - mean) / algorithmFPType(i + 1);
     }
     return mean;
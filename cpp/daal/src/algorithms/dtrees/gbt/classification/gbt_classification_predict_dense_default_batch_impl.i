@@ -177,6 +177,7 @@ public:
 
 protected:
     services::Status predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim);
+    services::Status predictByAllTreesCSR(size_t nTreesTotal, size_t nClasses, CSRNumericTableIface & csr);
 
     void predictByTrees(algorithmFPType * res, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
     void predictByTreesVector(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
@@ -225,6 +226,12 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
 
+    CSRNumericTableIface * const csrData = dtrees::prediction::internal::getCSRData(*_data);
+    if (csrData)
+    {
+        return predictByAllTreesCSR(nTreesTotal, nClasses, *csrData);
+    }
+
     DimType dim(*_data, nTreesTotal);
 
     return predictByAllTrees(nTreesTotal, nClasses, dim);
@@ -346,6 +353,51 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTreesCSR(size_t nTreesTotal, size_t nClasses, CSRNumericTableIface & csr)
+{
+    const size_t nRows(_data->getNumberOfRows());
+    const size_t nCols(_data->getNumberOfColumns());
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * const res = resBD.get();
+
+    if (_prob)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(probBD);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nClasses);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * nClasses, sizeof(algorithmFPType));
+        TArrayCalloc<algorithmFPType, cpu> valPtr(nRows * nClasses);
+        algorithmFPType * const valFull = valPtr.get();
+        DAAL_CHECK_MALLOC(valFull);
+
+        services::Status s = dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+            csr, nRows, nCols, [&](const size_t iRow, const algorithmFPType * const x) {
+                algorithmFPType * const val = valFull + iRow * nClasses;
+                predictByTrees(val, 0, nTreesTotal, nClasses, x);
+                if (res)
+                {
+                    res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                }
+            });
+        DAAL_CHECK_STATUS_VAR(s);
+        daal::algorithms::optimization_solver::cross_entropy_loss::internal::CrossEntropyLossKernel<
+            algorithmFPType, daal::algorithms::optimization_solver::cross_entropy_loss::defaultDense, cpu>::softmaxThreaded(valFull, probBD.get(),
+                                                                                                                            nRows, nClasses);
+        return s;
+    }
+
+    ClassesRawBoostedTls lsData(nClasses);
+    return dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+        csr, nRows, nCols, [&](const size_t iRow, const algorithmFPType * const x) {
+            algorithmFPType * const val = lsData.local();
+            services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
+            predictByTrees(val, 0, nTreesTotal, nClasses, x);
+            res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+        });
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace classification */
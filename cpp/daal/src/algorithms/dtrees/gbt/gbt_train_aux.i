@@ -733,13 +733,27 @@ struct GlobalStorages
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
     GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal)
-        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures), maxRetainedGHSums(0), nRetainedGHSums(0)
     {}
 
+    // Reserves a place in the pool of parent histograms kept for the sibling subtraction.
+    // Returns false when the pool is full: the caller has to drop the parent histograms
+    // and build the histograms of both children from their rows
+    bool tryRetainGHSums()
+    {
+        if (nRetainedGHSums.inc() <= maxRetainedGHSums) return true;
+        nRetainedGHSums.dec();
+        return false;
+    }
+
+    void releaseRetainedGHSums() { nRetainedGHSums.dec(); }
+
     GroupOfStorages<GHSumType, cpu> singleGHSums;
     GHSumsStorage<TlsType, cpu> GHForCols;
     TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;
     size_t nDiffFeatMax;
+    size_t maxRetainedGHSums;
+    services::Atomic<size_t> nRetainedGHSums;
 
     BinIndexType * newFI;
 };
@@ -433,6 +433,16 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     storage.nUniquesArr  = nUniquesArr;
     storage.nDiffFeatMax = nDiffFeatMax;
 
+    if (inexactWithHistMethod)
+    {
+        // Parent histograms kept for the sibling subtraction may not take more memory than the binned data itself,
+        // but at least one histogram per thread is always allowed to keep the nodes building in parallel
+        const size_t nThreads     = threader_get_threads_number();
+        const size_t histSize     = nDiffFeatMax * sizeof(ghSum<algorithmFPType, cpu>);
+        const size_t binnedSize   = x->getNumberOfRows() * x->getNumberOfColumns() * sizeof(BinIndexType);
+        storage.maxRetainedGHSums = services::internal::max<cpu, size_t>(nThreads, histSize ? binnedSize / histSize : nThreads);
+    }
+
     if (!par.memorySavingMode)
     {
         for (size_t i = 0; i < x->getNumberOfColumns(); ++i)
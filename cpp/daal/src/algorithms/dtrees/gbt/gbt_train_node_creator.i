@@ -195,6 +195,14 @@ public:
 protected:
     virtual void build2nodes(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
     {
+        // Histograms pool is exhausted: drop the parent histograms of this node and build the kids separately.
+        // The deepest nodes are spilled first, they are the cheapest ones to recompute from their rows
+        if (!_data.GH_SUMS_BUF->tryRetainGHSums())
+        {
+            super::build2nodes(newTasks, nTask, res, impRight);
+            return;
+        }
+
         typename super::NodeInfoType node1(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
         typename super::NodeInfoType node2(super::_node.iStart + super::_split.nLeft, super::_node.n - super::_split.nLeft, super::_node.level + 1,
                                            impRight, res->kid[1]);
@@ -302,6 +302,7 @@ public:
         {
             _prevRes->release(_data);
             _prevRes = nullptr;
+            _data.GH_SUMS_BUF->releaseRetainedGHSums();
         }
     }
 
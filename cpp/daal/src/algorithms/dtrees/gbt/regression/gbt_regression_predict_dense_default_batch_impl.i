@@ -110,6 +110,16 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
     gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal);
     WriteOnlyRows<algorithmFPType, cpu> resBD(result, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
+
+    CSRNumericTableIface * const csrData = dtrees::prediction::internal::getCSRData(*this->_data);
+    if (csrData)
+    {
+        algorithmFPType * const res = resBD.get();
+        return dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+            *csrData, this->_data->getNumberOfRows(), this->_data->getNumberOfColumns(),
+            [&](const size_t iRow, const algorithmFPType * const x) { res[iRow] = predictByTrees(0, nTreesTotal, x); });
+    }
+
     services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
     SafeStatus safeStat;
     services::Status s;
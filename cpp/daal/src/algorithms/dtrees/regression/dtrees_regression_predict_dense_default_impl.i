@@ -92,6 +92,17 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
     const auto nTreesTotal = _aTree.size();
     const auto treeSize    = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
 
+    CSRNumericTableIface * const csrData = dtrees::prediction::internal::getCSRData(*_data);
+    if (csrData)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resBD);
+        algorithmFPType * const res = resBD.get();
+        return dtrees::prediction::internal::predictByCSRRows<algorithmFPType, cpu>(
+            *csrData, _data->getNumberOfRows(), _data->getNumberOfColumns(),
+            [&](const size_t iRow, const algorithmFPType * const x) { res[iRow] = factor * predictByTrees(0, nTreesTotal, x); });
+    }
+
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
@@ -69,7 +69,8 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
     double oldLogLikelyhood = 0;
 
     daal::tls<Task<algorithmFPType, cpu> *> threadBuffer([=]() -> Task<algorithmFPType, cpu> * {
-        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get());
+        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, nComponentsInGroup, logAlpha, means, covs.get(),
+                                              shiftPtr.get(), precisionMeansPtr.get(), precisionsPtr.get(), logNormConstsPtr.get());
     });
     int & iterCounter               = iterCounterArray[0];
     algorithmFPType & logLikelyhood = logLikelyhoodArray[0];
@@ -81,6 +82,8 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
 
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha); // inplace: same memory as alpha
 
+        prepareStepE(par.covarianceStorage);
+
         logLikelyhood = 0;
 
         SafeStatus safeStat;
@@ -157,88 +160,194 @@ inline double exp_threshold<double>(void)
 }
 
 /**
- * Function computes t.w values that stores weight of each data point belongs to each cluster.
- * t.s is computed by numeric stable log-sum-exp trick.
+ * Function precomputes the values that do not depend on the data for the E-step of the current iteration:
+ * the common shift of the data, the precision-scaled shifted means and the normalization constants of the components.
+ * For diagonal covariances the log density of the component k is
+ *     c_k + sum_j x_j * m_kj * s_kj - 0.5 * sum_j x_j^2 * s_kj,
+ * where x and m are shifted data point and mean, s_k is the inverse of the diagonal covariance.
+ * For full covariances it is c_k - 0.5 * ||x * V_k - m * V_k||^2, where V_k is the inverse Cholesky factor
+ * of the covariance matrix. In both cases the data-dependent part is computed for all components by GEMM.
  */
 template <typename algorithmFPType, Method method, CpuType cpu>
-void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t,
-                                                       em_gmm::CovarianceStorageId covType)
+void EMKernelTask<algorithmFPType, method, cpu>::prepareStepE(em_gmm::CovarianceStorageId covType)
 {
-    const size_t nComponents = t.nComponents;
-    const size_t nFeatures   = t.nFeatures;
+    algorithmFPType * shift          = shiftPtr.get();
+    algorithmFPType * precisionMeans = precisionMeansPtr.get();
+    algorithmFPType * precisions     = precisionsPtr.get();
+    algorithmFPType * logNormConsts  = logNormConstsPtr.get();
+    algorithmFPType ** invSigma      = covs->getSigma();
+    algorithmFPType * logSqrtInvDet  = covs->getLogSqrtInvDetSigma();
+
+    /* The data is shifted by the average of the means to reduce the cancellation in the expanded quadratic forms */
+    const algorithmFPType invNComponents = algorithmFPType(1.0) / algorithmFPType(nComponents);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        shift[j] = 0;
+    }
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            shift[j] += means[k * nFeatures + j];
+        }
+    }
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        shift[j] *= invNComponents;
+    }
 
     if (covType == diagonal)
     {
         for (size_t k = 0; k < nComponents; k++)
         {
-            const algorithmFPType * curMean  = &t.means[k * nFeatures];
-            const algorithmFPType * invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition   = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
-
-            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            const algorithmFPType * curMean = &means[k * nFeatures];
+            algorithmFPType logNormConst    = logAlpha[k] + logSqrtInvDet[k];
+            for (size_t j = 0; j < nFeatures; j++)
             {
-                algorithmFPType tp = 0;
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nFeatures; j++)
-                {
-                    algorithmFPType x_mu = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp += x_mu * x_mu * invSigma[j];
-                }
-
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
+                const algorithmFPType mu          = curMean[j] - shift[j];
+                precisionMeans[k * nFeatures + j] = mu * invSigma[k][j];
+                precisions[k * nFeatures + j]     = -0.5 * invSigma[k][j];
+                logNormConst -= 0.5 * mu * precisionMeans[k * nFeatures + j];
             }
+            logNormConsts[k] = logNormConst;
         }
     }
     else
     {
-        daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
-
+        const size_t nElementsOnOneCov = nFeatures * nFeatures;
         for (size_t k = 0; k < nComponents; k++)
         {
+            const algorithmFPType * curMean = &means[k * nFeatures];
+            const algorithmFPType * factor  = invSigma[k];
+            algorithmFPType * precision     = &precisions[k * nElementsOnOneCov];
+
+            /* The factor is upper triangular in column-major layout, i.e. factor[j * nFeatures + i] is zero for i > j */
             for (size_t j = 0; j < nFeatures; j++)
             {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+                algorithmFPType sum = 0;
+                for (size_t i = 0; i <= j; i++)
+                {
+                    precision[j * nFeatures + i] = factor[j * nFeatures + i];
+                    sum += factor[j * nFeatures + i] * (curMean[i] - shift[i]);
+                }
+                for (size_t i = j + 1; i < nFeatures; i++)
                 {
-                    t.x_mu[j * nVectorsInCurrentBlock + i] =
-                        t.trans_data[j * nVectorsInCurrentBlock + i] - t.means[k * nFeatures + j]; // transposed x_mu
+                    precision[j * nFeatures + i] = 0;
                 }
+                precisionMeans[k * nFeatures + j] = sum;
             }
+            logNormConsts[k] = logAlpha[k] + logSqrtInvDet[k];
+        }
+    }
+}
+
+/**
+ * Function computes t.w values that stores weight of each data point belongs to each cluster.
+ * Log densities of all components are computed by GEMM against the precomputed precision-scaled means,
+ * then t.w is computed by numeric stable log-sum-exp trick.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t,
+                                                       em_gmm::CovarianceStorageId covType)
+{
+    typedef Blas<algorithmFPType, cpu> blas;
 
-            t.covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, t.x_mu, t.Ax_mu); // Ax_mu is also transposed
+    const size_t nComponents = t.nComponents;
+    const size_t nFeatures   = t.nFeatures;
+
+    for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            t.x_shift[i * nFeatures + j] = t.dataBlock[i * nFeatures + j] - t.shift[j];
+        }
+    }
+
+    const char transa          = 'T';
+    const char transb          = 'N';
+    const DAAL_INT nRows       = nVectorsInCurrentBlock;
+    const DAAL_INT nCols       = nFeatures;
+    const DAAL_INT nClusters   = nComponents;
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+
+    if (covType == diagonal)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectorsInCurrentBlock * nFeatures; i++)
+        {
+            t.x_buff[i] = t.x_shift[i] * t.x_shift[i];
+        }
 
-            algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+        /* p = x_shift * precisionMeans^T - 0.5 * x_shift^2 * invSigma^T, stored by components */
+        blas::xxgemm(&transa, &transb, &nRows, &nClusters, &nCols, &one, t.x_shift, &nCols, t.precisionMeans, &nCols, &zero, t.p, &nRows);
+        blas::xxgemm(&transa, &transb, &nRows, &nClusters, &nCols, &one, t.x_buff, &nCols, t.precisions, &nCols, &one, t.p, &nRows);
 
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType logNormConst = t.logNormConsts[k];
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                t.p[k * nVectorsInCurrentBlock + i] = 0.0;
+                t.p[k * nVectorsInCurrentBlock + i] += logNormConst;
             }
+        }
+    }
+    else
+    {
+        const size_t nElementsOnOneCov = nFeatures * nFeatures;
+        for (size_t k0 = 0; k0 < nComponents; k0 += t.nComponentsInGroup)
+        {
+            const size_t nComponentsInCurrentGroup = (k0 + t.nComponentsInGroup > nComponents) ? nComponents - k0 : t.nComponentsInGroup;
+            const size_t width                     = nComponentsInCurrentGroup * nFeatures;
+            const DAAL_INT nProj                   = width;
 
-            for (size_t j = 0; j < nFeatures; j++)
+            /* proj = x_shift * [V_k0, ..., V_k0+g-1], each row of proj contains the projections for all components of the group */
+            blas::xxgemm(&transa, &transb, &nProj, &nRows, &nCols, &one, &t.precisions[k0 * nElementsOnOneCov], &nCols, t.x_shift, &nCols, &zero,
+                         t.proj, &nProj);
+
+            for (size_t kk = 0; kk < nComponentsInCurrentGroup; kk++)
             {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
+                const size_t k                        = k0 + kk;
+                const algorithmFPType * precisionMean = &t.precisionMeans[k * nFeatures];
+                const algorithmFPType logNormConst    = t.logNormConsts[k];
                 for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
                 {
-                    t.p[k * nVectorsInCurrentBlock + i] += t.x_mu[j * nVectorsInCurrentBlock + i] * t.Ax_mu[j * nVectorsInCurrentBlock + i];
+                    const algorithmFPType * y = &t.proj[i * width + kk * nFeatures];
+                    algorithmFPType dist      = 0;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nFeatures; j++)
+                    {
+                        const algorithmFPType diff = y[j] - precisionMean[j];
+                        dist += diff * diff;
+                    }
+                    t.p[k * nVectorsInCurrentBlock + i] = logNormConst - 0.5 * dist;
                 }
             }
-
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * t.p[k * nVectorsInCurrentBlock + i];
-            }
         }
     }
 
-    t.partLogLikelyhood        = 0;
-    algorithmFPType * maxInRow = t.rowSum;
+    computeResponsibilities(nVectorsInCurrentBlock, t);
+}
+
+/**
+ * Function converts log densities stored in t.p to the responsibilities by log-sum-exp trick.
+ * Shift by the row maximum, exponentiation and row summation are fused in one pass over components.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::computeResponsibilities(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t)
+{
+    const size_t nComponents   = t.nComponents;
+    algorithmFPType * maxInRow = t.maxInRow;
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
@@ -259,43 +368,33 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
         }
     }
 
-    for (size_t k = 0; k < nComponents; k++)
-    {
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-        {
-            t.p[k * nVectorsInCurrentBlock + i] -= maxInRow[i];
-            if (t.p[k * nVectorsInCurrentBlock + i] < exp_threshold<algorithmFPType>())
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = exp_threshold<algorithmFPType>();
-            }
-        }
-    }
-
+    t.partLogLikelyhood = 0;
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
     {
         t.partLogLikelyhood += maxInRow[i];
+        t.rowSum[i] = 0;
     }
 
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+    for (size_t k = 0; k < nComponents; k++)
     {
-        maxInRow[i] = 0; // same memory as t.rowSum, set to zero before computing row sum
-    }
+        algorithmFPType * pk = &t.p[k * nVectorsInCurrentBlock];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            const algorithmFPType value = pk[i] - maxInRow[i];
+            pk[i]                       = (value < exp_threshold<algorithmFPType>()) ? exp_threshold<algorithmFPType>() : value;
+        }
 
-    Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock * nComponents, t.p, t.p);
+        Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock, pk, pk);
 
-    for (size_t k = 0; k < nComponents; k++)
-    {
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            t.rowSum[i] += t.p[k * nVectorsInCurrentBlock + i];
+            t.rowSum[i] += pk[i];
         }
     }
 
@@ -348,38 +447,105 @@ algorithmFPType EMKernelTask<algorithmFPType, method, cpu>::computePartialLogLik
  * 1) sum of weights
  * 2) weighted mean
  * 3) weighted cross product
+ * Weighted sums of all components are computed by one GEMM of the shifted data and the weights.
  * After this computation for current block the results are merged to thread local values
  */
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status EMKernelTask<algorithmFPType, method, cpu>::stepM_partial(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t,
                                                                  em_gmm::CovarianceStorageId covType)
 {
+    typedef Blas<algorithmFPType, cpu> blas;
+
     const size_t nFeatures         = t.nFeatures;
+    const size_t nComponents       = t.nComponents;
     const size_t nElementsOnOneCov = t.covs->getOneCovSize();
-    algorithmFPType * dataBlock    = const_cast<algorithmFPType *>(t.trans_data);
+
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        algorithmFPType wSum = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            wSum += t.w[k * nVectorsInCurrentBlock + i];
+        }
+        t.wSums[k] = wSum;
+    }
+
+    const char trans         = 'N';
+    const DAAL_INT nRows     = nVectorsInCurrentBlock;
+    DAAL_INT nCols           = nFeatures;
+    const DAAL_INT nClusters = nComponents;
+    algorithmFPType one      = 1.0;
+    algorithmFPType zero     = 0.0;
+
+    /* partialMeans = w^T * x_shift, stored by components */
+    blas::xxgemm(&trans, &trans, &nCols, &nClusters, &nRows, &one, t.x_shift, &nCols, t.w, &nRows, &zero, t.partialMeans, &nCols);
     if (covType == diagonal)
     {
-        dataBlock = const_cast<algorithmFPType *>(t.dataBlock);
+        /* partialCP = w^T * x_shift^2, x_buff contains squared shifted data after the E-step */
+        blas::xxgemm(&trans, &trans, &nCols, &nClusters, &nRows, &one, t.x_buff, &nCols, t.w, &nRows, &zero, t.partialCP, &nCols);
     }
 
-    for (size_t k = 0; k < t.nComponents; k++)
+    for (size_t k = 0; k < nComponents; k++)
     {
-        t.wSums[k] = 0;
+        const algorithmFPType wSum = t.wSums[k];
+        if (!(wSum > MinVal<algorithmFPType>::get()))
+        {
+            continue;
+        }
+        const algorithmFPType invWSum = algorithmFPType(1.0) / wSum;
+        algorithmFPType * mean        = &t.partialMeans[k * nFeatures];
+        algorithmFPType * cp          = &t.partialCP[k * nElementsOnOneCov];
 
-        int errcode =
-            t.covs->computeThreadPartialResults(dataBlock, &t.w[k * nVectorsInCurrentBlock], t.nFeatures, nVectorsInCurrentBlock, &t.wSums[k],
-                                                &t.partialMeans[k * nFeatures], &t.partialCP[k * nElementsOnOneCov], t.w_x_buff);
-        if (errcode)
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
         {
-            return Status(Error::create(ErrorEMCovariance, Component, k));
+            mean[j] *= invWSum;
         }
 
-        if (t.wSums[k] > MinVal<algorithmFPType>::get())
+        if (covType == diagonal)
         {
-            stepM_mergePartialSums(&t.mergedPartialCP[k * nElementsOnOneCov], &t.partialCP[k * nElementsOnOneCov],
-                                   &t.mergedPartialMeans[k * nFeatures], &t.partialMeans[k * nFeatures], t.mergedWSums[k], t.wSums[k], nFeatures,
-                                   t.covs);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType value = cp[j] - wSum * mean[j] * mean[j];
+                cp[j]                       = (value < 0) ? 0 : value;
+            }
         }
+        else
+        {
+            /* Cross product of the data centered by the component mean and scaled by the square root of the weights */
+            const algorithmFPType * wk = &t.w[k * nVectorsInCurrentBlock];
+            Math<algorithmFPType, cpu>::vSqrt(nVectorsInCurrentBlock, wk, t.maxInRow);
+            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                const algorithmFPType sqrtW = t.maxInRow[i];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    t.x_buff[i * nFeatures + j] = sqrtW * (t.x_shift[i * nFeatures + j] - mean[j]);
+                }
+            }
+
+            char uplo      = 'U';
+            char transSyrk = 'N';
+            DAAL_INT nK    = nVectorsInCurrentBlock;
+            blas::xxsyrk(&uplo, &transSyrk, &nCols, &nK, &one, t.x_buff, &nCols, &zero, cp, &nCols);
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] += t.shift[j];
+        }
+
+        stepM_mergePartialSums(&t.mergedPartialCP[k * nElementsOnOneCov], cp, &t.mergedPartialMeans[k * nFeatures], mean, t.mergedWSums[k],
+                               t.wSums[k], nFeatures, t.covs);
     }
     return Status();
 }
@@ -438,6 +604,16 @@ EMKernelTask<algorithmFPType, method, cpu>::EMKernelTask(NumericTable & dataTabl
     {
         blockSizeDefault = nVectors;
     }
+
+    /* For full covariances the data block is projected by the inverse Cholesky factors of several components with one GEMM */
+    const size_t projectionWidthDefault = 1024;
+    nComponentsInGroup                  = 0;
+    if (par.covarianceStorage != diagonal)
+    {
+        nComponentsInGroup = projectionWidthDefault / nFeatures;
+        nComponentsInGroup = (nComponentsInGroup < 1) ? 1 : nComponentsInGroup;
+        nComponentsInGroup = (nComponentsInGroup > nComponents) ? nComponents : nComponentsInGroup;
+    }
     covsPtr.reset(nComponents);
 }
 
@@ -489,6 +665,15 @@ Status EMKernelTask<algorithmFPType, method, cpu>::initialize()
     covs = initializeCovariances();
     DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
 
+    shiftPtr.reset(nFeatures);
+    DAAL_CHECK_MALLOC(shiftPtr.get());
+    precisionMeansPtr.reset(nComponents * nFeatures);
+    DAAL_CHECK_MALLOC(precisionMeansPtr.get());
+    precisionsPtr.reset(nComponents * covs->getOneCovSize());
+    DAAL_CHECK_MALLOC(precisionsPtr.get());
+    logNormConstsPtr.reset(nComponents);
+    DAAL_CHECK_MALLOC(logNormConstsPtr.get());
+
     return Status();
 }
 
@@ -649,7 +834,7 @@ ErrorPtr GmmModelFull<algorithmFPType, cpu>::regularizeCovarianceMatrix(algorith
 }
 
 /**
- * Ties to inverse covariance matrices. In case of ill-conditioned matrix try to regularize.
+ * Ties to compute inverse Cholesky factors of covariance matrices. In case of ill-conditioned matrix try to regularize.
  */
 template <typename algorithmFPType, CpuType cpu>
 Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
@@ -725,7 +910,22 @@ Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
         sqrtDetSigma           = infToBigValue<cpu>(sqrtDetSigma);
         sqrtInvDetSigma[iComp] = 1.0 / sqrtDetSigma;
 
-        lapack::xxpotri(&uplo, &nFeaturesLong, pInvSigma, &lda, &info);
+        /* Inverse of the Cholesky factor is computed by solving U * X = I */
+        for (size_t i = 0; i < nFeatures * nFeatures; i++)
+        {
+            sigmaTmpBuff[i] = 0;
+        }
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            sigmaTmpBuff[i * nFeatures + i] = 1;
+        }
+        char trans = 'N';
+        char diag  = 'N';
+        lapack::xxtrtrs(&uplo, &trans, &diag, &nFeaturesLong, &nFeaturesLong, pInvSigma, &lda, sigmaTmpBuff, &lda, &info);
+        for (size_t i = 0; i < nFeatures * nFeatures; i++)
+        {
+            pInvSigma[i] = sigmaTmpBuff[i];
+        }
         if (info != 0)
         {
             ErrorPtr e;
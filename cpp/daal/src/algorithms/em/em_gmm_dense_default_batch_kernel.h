@@ -76,8 +76,10 @@ public:
     services::Status setStartValues();
     void setResultToZero();
     Status stepM_merge(size_t iteration);
+    void prepareStepE(em_gmm::CovarianceStorageId covType);
 
     static void stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
+    static void computeResponsibilities(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t);
     static algorithmFPType computePartialLogLikelyhood(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t);
     static Status stepM_partial(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
     static void stepM_mergePartialSums(algorithmFPType * cp_n, algorithmFPType * cp_m, algorithmFPType * mean_n, algorithmFPType * mean_m,
@@ -91,6 +93,7 @@ public:
 
     size_t blockSizeDefault;
     size_t nBlocks;
+    size_t nComponentsInGroup;
 
     const DAAL_INT nFeatures;
     const DAAL_INT nVectors;
@@ -101,6 +104,11 @@ public:
     TArray<WriteRows<algorithmFPType, cpu, NumericTable>, cpu> covsPtr;
     GmmModelPtr covs;
 
+    TArray<algorithmFPType, cpu> shiftPtr;
+    TArray<algorithmFPType, cpu> precisionMeansPtr;
+    TArray<algorithmFPType, cpu> precisionsPtr;
+    TArray<algorithmFPType, cpu> logNormConstsPtr;
+
     WriteRows<algorithmFPType, cpu, NumericTable> weightsBD;
     WriteRows<algorithmFPType, cpu, NumericTable> meansBD;
     WriteRows<int, cpu, NumericTable> nIterationsBD;
@@ -83,16 +83,12 @@ public:
         }
     }
 
-    virtual size_t getOneCovSize()                                                                                             = 0;
-    virtual size_t getNumberOfRowsInCov()                                                                                      = 0;
-    virtual void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType * X, algorithmFPType * CovX) = 0;
-    virtual Status computeSigmaInverse(size_t iteration)                                                                       = 0;
-    virtual int computeThreadPartialResults(algorithmFPType * data, algorithmFPType * weights, size_t nFeatures, size_t nElements,
-                                            algorithmFPType * sumOfWeights, algorithmFPType * partialMean, algorithmFPType * partialCovs,
-                                            algorithmFPType * w_x_buf)                                                         = 0;
+    virtual size_t getOneCovSize()                                                                           = 0;
+    virtual size_t getNumberOfRowsInCov()                                                                    = 0;
+    virtual Status computeSigmaInverse(size_t iteration)                                                     = 0;
     virtual void stepM_mergeCovs(algorithmFPType * cp_n, algorithmFPType * cp_m, algorithmFPType * mean_n, algorithmFPType * mean_m,
-                                 algorithmFPType & w_n, algorithmFPType & w_m, size_t nFeatures)                               = 0;
-    virtual void finalize(size_t k, algorithmFPType denominator)                                                               = 0;
+                                 algorithmFPType & w_n, algorithmFPType & w_m, size_t nFeatures) = 0;
+    virtual void finalize(size_t k, algorithmFPType denominator)                                             = 0;
     virtual void setCovRegularizer(double _covRegularizer) { covRegularizer = _covRegularizer; }
 
 protected:
@@ -121,27 +117,10 @@ public:
     GmmModelFull(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
     size_t getOneCovSize() { return nFeatures * nFeatures; }
     size_t getNumberOfRowsInCov() { return nFeatures; }
-    Status computeSigmaInverse(size_t iteration);
-    void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType * X, algorithmFPType * CovX)
-    {
-        char side                  = 'R';
-        char uplo                  = 'U';
-        DAAL_INT m                 = nVectorsInCurrentBlock;
-        DAAL_INT n                 = nFeatures;
-        algorithmFPType alphaCoeff = 1.0;
-        algorithmFPType betaCoeff  = 0.0;
-
-        algorithmFPType * invSigma = sigma[k];
-        blas::xxsymm(&side, &uplo, &m, &n, &alphaCoeff, invSigma, &n, X, &m, &betaCoeff, CovX, &m);
-    }
 
-    int computeThreadPartialResults(algorithmFPType * data, algorithmFPType * weights, size_t nFeatures, size_t nElements,
-                                    algorithmFPType * sumOfWeights, algorithmFPType * partialMean, algorithmFPType * partialCovs,
-                                    algorithmFPType * w_x_buf)
-    {
-        Statistics<algorithmFPType, cpu>::xxcp_weight_byrows(weights, data, nElements, nFeatures, w_x_buf, *sumOfWeights, partialMean, partialCovs);
-        return 0;
-    }
+    /* Replaces the covariance matrix with the inverse of its upper Cholesky factor U^-1,
+     * so that the inverse covariance matrix equals U^-1 * U^-T */
+    Status computeSigmaInverse(size_t iteration);
 
     void finalize(size_t k, algorithmFPType denominator)
     {
@@ -176,17 +155,6 @@ public:
     GmmModelDiag(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
     size_t getOneCovSize() { return nFeatures; }
     size_t getNumberOfRowsInCov() { return 1; }
-    void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType * X, algorithmFPType * CovX)
-    {
-        algorithmFPType * invSigma = sigma[k];
-        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-        {
-            for (size_t j = 0; j < nFeatures; j++)
-            {
-                CovX[i * nFeatures + j] = X[i * nFeatures + j] * invSigma[j];
-            }
-        }
-    }
     ErrorPtr regularizeCovarianceMatrix(algorithmFPType * cov)
     {
         TArray<algorithmFPType, cpu> sortedCovsPtr(nFeatures);
@@ -257,16 +225,6 @@ public:
         return Status();
     }
 
-    int computeThreadPartialResults(algorithmFPType * data, algorithmFPType * weights, size_t nFeatures, size_t nElements,
-                                    algorithmFPType * sumOfWeights, algorithmFPType * partialMean, algorithmFPType * partialCovs,
-                                    algorithmFPType * w_x_buf)
-    {
-        __int64 matCompMethod = __DAAL_VSL_SS_METHOD_FAST;
-        int errcode = Statistics<algorithmFPType, cpu>::xxvar_weight(data, nFeatures, nElements, weights, sumOfWeights, partialMean, partialCovs,
-                                                                     matCompMethod);
-        return errcode;
-    }
-
     void finalize(size_t k, algorithmFPType denominator)
     {
         algorithmFPType multplier = 1.0 / denominator;
@@ -285,33 +243,38 @@ struct Task
 {
     DAAL_NEW_DELETE()
 
-    Task(NumericTable & _dataTable, size_t blockSizeDefault, size_t _nFeatures, size_t _nComponents,
+    Task(NumericTable & _dataTable, size_t blockSizeDefault, size_t _nFeatures, size_t _nComponents, size_t _nComponentsInGroup,
          algorithmFPType * _logAlpha, //placed in alpha memory
-         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs)
+         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs, const algorithmFPType * _shift, const algorithmFPType * _precisionMeans,
+         const algorithmFPType * _precisions, const algorithmFPType * _logNormConsts)
         : dataTable(&_dataTable),
           dataBlock(nullptr),
           logAlpha(_logAlpha),
           means(_means),
+          shift(_shift),
+          precisionMeans(_precisionMeans),
+          precisions(_precisions),
+          logNormConsts(_logNormConsts),
           covs(_covs),
-          invSigma(_covs->getSigma()),
           logSqrtInvDetSigma(_covs->getLogSqrtInvDetSigma()),
           nFeatures(_nFeatures),
           nComponents(_nComponents),
+          nComponentsInGroup(_nComponentsInGroup),
           logLikelyhood(0)
     {
         size_t sizeOfOneCov           = covs->getOneCovSize();
-        size_t memorySizeForOneThread = blockSizeDefault * nFeatures +   /* x_mu   */
-                                        blockSizeDefault * nFeatures +   /* Ax_mu  */
-                                        blockSizeDefault * nComponents + /* p      */
-                                        blockSizeDefault +               /* rowSum */
-                                        nComponents +                    /* wSums */
-                                        nComponents * nFeatures +        /* partialMeans */
-                                        nComponents * sizeOfOneCov +     /* partialCP */
-                                        nComponents +                    /* mergedWSums */
-                                        nComponents * nFeatures +        /* mergedPartialMeans */
-                                        nComponents * sizeOfOneCov +     /* mergedPartialCP */
-                                        blockSizeDefault * nFeatures +   /* trans_data */
-                                        blockSizeDefault * nFeatures;    /* w_x buff */
+        size_t memorySizeForOneThread = blockSizeDefault * nFeatures +                      /* x_shift */
+                                        blockSizeDefault * nFeatures +                      /* x_buff */
+                                        blockSizeDefault * nComponentsInGroup * nFeatures + /* proj */
+                                        blockSizeDefault * nComponents +                    /* p      */
+                                        blockSizeDefault +                                  /* rowSum */
+                                        blockSizeDefault +                                  /* maxInRow */
+                                        nComponents +                                       /* wSums */
+                                        nComponents * nFeatures +                           /* partialMeans */
+                                        nComponents * sizeOfOneCov +                        /* partialCP */
+                                        nComponents +                                       /* mergedWSums */
+                                        nComponents * nFeatures +                           /* mergedPartialMeans */
+                                        nComponents * sizeOfOneCov;                         /* mergedPartialCP */
 
         threadBufferPtr.reset(memorySizeForOneThread);
         localBuffer = threadBufferPtr.get();
@@ -320,19 +283,19 @@ struct Task
             return;
         }
 
-        x_mu         = localBuffer;
-        Ax_mu        = &x_mu[blockSizeDefault * nFeatures];
-        p            = &Ax_mu[blockSizeDefault * nFeatures];
+        x_shift      = localBuffer;
+        x_buff       = &x_shift[blockSizeDefault * nFeatures];
+        proj         = &x_buff[blockSizeDefault * nFeatures];
+        p            = &proj[blockSizeDefault * nComponentsInGroup * nFeatures];
         rowSum       = &p[blockSizeDefault * nComponents];
-        wSums        = &rowSum[blockSizeDefault];
+        maxInRow     = &rowSum[blockSizeDefault];
+        wSums        = &maxInRow[blockSizeDefault];
         partialMeans = &wSums[nComponents];
         partialCP    = &partialMeans[nComponents * nFeatures];
 
         mergedWSums        = &partialCP[nComponents * sizeOfOneCov];
         mergedPartialMeans = &mergedWSums[nComponents];
         mergedPartialCP    = &mergedPartialMeans[nComponents * nFeatures];
-        trans_data         = &mergedPartialCP[nComponents * sizeOfOneCov];
-        w_x_buff           = &trans_data[blockSizeDefault * nFeatures];
         setMergedToZero();
     }
 
@@ -368,16 +331,21 @@ struct Task
     TArray<algorithmFPType, cpu> threadBufferPtr;
     algorithmFPType logLikelyhood;
 
-    algorithmFPType * x_mu;
-    algorithmFPType * Ax_mu;
+    algorithmFPType * x_shift; /* data block shifted by the common shift of the components' means */
+    algorithmFPType * x_buff;  /* squared shifted data for diagonal covariances, weighted centered data for full ones */
+    algorithmFPType * proj;    /* shifted data multiplied by the inverse Cholesky factors of a group of components */
     algorithmFPType * w;
     algorithmFPType * p;
     algorithmFPType * rowSum;
     algorithmFPType * rowSumInv;
+    algorithmFPType * maxInRow;
 
     algorithmFPType * logAlpha;
     algorithmFPType * means;
-    algorithmFPType ** invSigma;
+    const algorithmFPType * shift;
+    const algorithmFPType * precisionMeans;
+    const algorithmFPType * precisions;
+    const algorithmFPType * logNormConsts;
     algorithmFPType * logSqrtInvDetSigma;
     algorithmFPType partLogLikelyhood;
 
@@ -389,13 +357,11 @@ struct Task
     algorithmFPType * mergedPartialMeans;
     algorithmFPType * mergedPartialCP;
 
-    algorithmFPType * trans_data;
-    algorithmFPType * w_x_buff;
-
     GmmModel<algorithmFPType, cpu> * covs;
 
     size_t nFeatures;
     size_t nComponents;
+    size_t nComponentsInGroup;
 };
 
 } // namespace internal
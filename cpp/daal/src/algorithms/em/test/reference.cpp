@@ -0,0 +1,310 @@
+/* file: reference.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the EM for GMM algorithm with full and diagonal covariances against a straightforward reference implementation
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/em/em_gmm.h"
+#include "data_management/data/data_collection.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::em_gmm::test
+{
+using namespace daal::data_management;
+
+struct TestCase
+{
+    CovarianceStorageId covarianceStorage;
+    size_t nFeatures;
+    size_t nComponents;
+    size_t nVectors;
+    size_t maxIterations;
+};
+
+std::ostream & operator<<(std::ostream & stream, const TestCase & value)
+{
+    return stream << (value.covarianceStorage == full ? "full" : "diagonal") << ", nFeatures = " << value.nFeatures
+                  << ", nComponents = " << value.nComponents;
+}
+
+/* Parameters of the mixture, the covariance of the component k starts at k * covSize */
+struct Mixture
+{
+    std::vector<double> weights;
+    std::vector<double> means;
+    std::vector<double> covariances;
+    double logLikelihood = 0.0;
+    size_t nIterations   = 0;
+};
+
+class EMReferenceTest : public ::testing::TestWithParam<TestCase>
+{
+protected:
+    static constexpr double accuracyThreshold = 1e-10;
+
+    /* The components overlap, so the responsibilities are not close to 0 or 1 for a part of the points.
+       The covariances are banded, the neighbouring features are correlated */
+    EMReferenceTest() : _case(GetParam()), _data(_case.nVectors * _case.nFeatures)
+    {
+        const size_t p = _case.nFeatures;
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        _initial.weights.assign(_case.nComponents, 1.0 / _case.nComponents);
+        _initial.covariances.assign(_case.nComponents * covSize(), 0.0);
+        for (size_t k = 0; k < _case.nComponents; ++k)
+        {
+            for (size_t j = 0; j < p; ++j) _initial.covariances[k * covSize() + (isFull() ? j * p + j : j)] = 2.0;
+        }
+
+        std::vector<double> centers(_case.nComponents * p);
+        for (auto & value : centers) value = 3.0 * normal(rng) / std::sqrt(double(p));
+        std::vector<double> z(p);
+        for (size_t i = 0; i < _case.nVectors; ++i)
+        {
+            const size_t k     = i % _case.nComponents;
+            const double scale = 0.7 + 0.2 * k;
+            for (auto & value : z) value = normal(rng);
+            for (size_t j = 0; j < p; ++j) _data[i * p + j] = centers[k * p + j] + scale * (z[j] + (j ? 0.5 * z[j - 1] : 0.0));
+        }
+
+        /* The initial means are shifted centers, so every component keeps enough points for a non-singular covariance */
+        _initial.means = centers;
+        for (auto & value : _initial.means) value += 0.3 * normal(rng) / std::sqrt(double(p));
+    }
+
+    bool isFull() const { return _case.covarianceStorage == full; }
+
+    size_t covSize() const { return isFull() ? _case.nFeatures * _case.nFeatures : _case.nFeatures; }
+
+    Mixture compute()
+    {
+        const size_t p = _case.nFeatures;
+        DataCollectionPtr covariances(new DataCollection());
+        for (size_t k = 0; k < _case.nComponents; ++k)
+        {
+            covariances->push_back(HomogenNumericTable<double>::create(&_initial.covariances[k * covSize()], p, isFull() ? p : 1));
+        }
+
+        Batch<double> algorithm(_case.nComponents);
+        algorithm.input.set(data, HomogenNumericTable<double>::create(_data.data(), p, _case.nVectors));
+        algorithm.input.set(inputWeights, HomogenNumericTable<double>::create(_initial.weights.data(), _case.nComponents, 1));
+        algorithm.input.set(inputMeans, HomogenNumericTable<double>::create(_initial.means.data(), p, _case.nComponents));
+        algorithm.input.set(inputCovariances, covariances);
+        algorithm.parameter.maxIterations     = _case.maxIterations;
+        algorithm.parameter.accuracyThreshold = accuracyThreshold;
+        algorithm.parameter.covarianceStorage = _case.covarianceStorage;
+        EXPECT_TRUE(algorithm.compute().ok());
+
+        const ResultPtr result = algorithm.getResult();
+        Mixture mixture;
+        mixture.weights = values<double>(result->get(weights));
+        mixture.means   = values<double>(result->get(means));
+        for (size_t k = 0; k < _case.nComponents; ++k)
+        {
+            const std::vector<double> covariance = values<double>(result->get(em_gmm::covariances, k));
+            mixture.covariances.insert(mixture.covariances.end(), covariance.begin(), covariance.end());
+        }
+        mixture.logLikelihood = values<double>(result->get(goalFunction))[0];
+        mixture.nIterations   = values<int>(result->get(nIterations))[0];
+        return mixture;
+    }
+
+    /* The iterations of the algorithm computed component by component and point by point.
+       The log-likelihood is computed in the E-step, so it corresponds to the parameters before the last M-step */
+    Mixture computeReference() const
+    {
+        const size_t p  = _case.nFeatures;
+        const size_t nK = _case.nComponents;
+        const size_t n  = _case.nVectors;
+        Mixture mixture = _initial;
+
+        std::vector<double> logDensities(n * nK), logDeterminants(nK), factors(nK * covSize()), diff(p);
+        double diffLogLikelihood = 2.0 * accuracyThreshold + 1.0, previousLogLikelihood = 0.0;
+        while (diffLogLikelihood > accuracyThreshold && mixture.nIterations < _case.maxIterations)
+        {
+            for (size_t k = 0; k < nK; ++k) logDeterminants[k] = factorize(&mixture.covariances[k * covSize()], &factors[k * covSize()]);
+
+            double logLikelihood = -0.5 * n * p * std::log(2.0 * 3.1415926535897932384626433);
+            for (size_t i = 0; i < n; ++i)
+            {
+                double maxLogDensity = -INFINITY;
+                for (size_t k = 0; k < nK; ++k)
+                {
+                    for (size_t j = 0; j < p; ++j) diff[j] = _data[i * p + j] - mixture.means[k * p + j];
+                    const double logDensity =
+                        std::log(mixture.weights[k]) - 0.5 * logDeterminants[k] - 0.5 * mahalanobis(&factors[k * covSize()], diff.data());
+                    logDensities[i * nK + k] = logDensity;
+                    maxLogDensity            = std::max(maxLogDensity, logDensity);
+                }
+                double sum = 0.0;
+                for (size_t k = 0; k < nK; ++k) sum += std::exp(logDensities[i * nK + k] - maxLogDensity);
+                for (size_t k = 0; k < nK; ++k) logDensities[i * nK + k] = std::exp(logDensities[i * nK + k] - maxLogDensity) / sum;
+                logLikelihood += maxLogDensity + std::log(sum);
+            }
+            const std::vector<double> & responsibilities = logDensities;
+
+            for (size_t k = 0; k < nK; ++k)
+            {
+                double * mean       = &mixture.means[k * p];
+                double * covariance = &mixture.covariances[k * covSize()];
+                double weightsSum   = 0.0;
+                std::fill(mean, mean + p, 0.0);
+                std::fill(covariance, covariance + covSize(), 0.0);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    weightsSum += responsibilities[i * nK + k];
+                    for (size_t j = 0; j < p; ++j) mean[j] += responsibilities[i * nK + k] * _data[i * p + j];
+                }
+                for (size_t j = 0; j < p; ++j) mean[j] /= weightsSum;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const double w = responsibilities[i * nK + k];
+                    for (size_t j = 0; j < p; ++j) diff[j] = _data[i * p + j] - mean[j];
+                    for (size_t j = 0; j < p; ++j)
+                    {
+                        if (!isFull())
+                        {
+                            covariance[j] += w * diff[j] * diff[j];
+                            continue;
+                        }
+                        for (size_t l = 0; l <= j; ++l) covariance[j * p + l] += w * diff[j] * diff[l];
+                    }
+                }
+                for (size_t j = 0; j < p; ++j)
+                {
+                    if (!isFull())
+                    {
+                        covariance[j] /= weightsSum;
+                        continue;
+                    }
+                    for (size_t l = 0; l <= j; ++l) covariance[l * p + j] = covariance[j * p + l] /= weightsSum;
+                }
+                mixture.weights[k] = weightsSum / n;
+            }
+
+            if (mixture.nIterations > 0) diffLogLikelihood = logLikelihood - previousLogLikelihood;
+            previousLogLikelihood = mixture.logLikelihood = logLikelihood;
+            ++mixture.nIterations;
+        }
+        return mixture;
+    }
+
+    /* Writes the lower Cholesky factor of the full covariance or the copy of the diagonal one,
+       returns the logarithm of the determinant */
+    double factorize(const double * covariance, double * factor) const
+    {
+        const size_t p        = _case.nFeatures;
+        double logDeterminant = 0.0;
+        if (!isFull())
+        {
+            for (size_t j = 0; j < p; ++j) logDeterminant += std::log(factor[j] = covariance[j]);
+            return logDeterminant;
+        }
+        for (size_t j = 0; j < p; ++j)
+        {
+            for (size_t l = 0; l <= j; ++l)
+            {
+                double sum = covariance[j * p + l];
+                for (size_t m = 0; m < l; ++m) sum -= factor[j * p + m] * factor[l * p + m];
+                factor[j * p + l] = (l == j) ? std::sqrt(sum) : sum / factor[l * p + l];
+            }
+            logDeterminant += 2.0 * std::log(factor[j * p + j]);
+        }
+        return logDeterminant;
+    }
+
+    double mahalanobis(const double * factor, double * diff) const
+    {
+        const size_t p = _case.nFeatures;
+        double value   = 0.0;
+        for (size_t j = 0; j < p; ++j)
+        {
+            if (isFull())
+            {
+                for (size_t l = 0; l < j; ++l) diff[j] -= factor[j * p + l] * diff[l];
+                diff[j] /= factor[j * p + j];
+                value += diff[j] * diff[j];
+            }
+            else
+            {
+                value += diff[j] * diff[j] / factor[j];
+            }
+        }
+        return value;
+    }
+
+    template <typename T>
+    static std::vector<T> values(const NumericTablePtr & table)
+    {
+        std::vector<T> result(table->getNumberOfRows() * table->getNumberOfColumns());
+        BlockDescriptor<T> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::copy(block.getBlockPtr(), block.getBlockPtr() + result.size(), result.begin());
+        table->releaseBlockOfRows(block);
+        return result;
+    }
+
+    static void expectNear(const std::vector<double> & actual, const std::vector<double> & expected, double tolerance, const char * name)
+    {
+        ASSERT_EQ(actual.size(), expected.size()) << name;
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], tolerance * std::max(1.0, std::abs(expected[i]))) << name << ", i = " << i;
+        }
+    }
+
+private:
+    TestCase _case;
+    std::vector<double> _data;
+    Mixture _initial;
+};
+
+TEST_P(EMReferenceTest, MatchesReference)
+{
+    const Mixture expected = computeReference();
+    const Mixture actual   = compute();
+
+    EXPECT_EQ(actual.nIterations, expected.nIterations);
+    expectNear(actual.weights, expected.weights, 1e-9, "weights");
+    expectNear(actual.means, expected.means, 1e-9, "means");
+    expectNear(actual.covariances, expected.covariances, 1e-9, "covariances");
+    EXPECT_NEAR(actual.logLikelihood, expected.logLikelihood, 1e-9 * std::abs(expected.logLikelihood));
+}
+
+/* For full covariances the components are projected in groups of 1024 / nFeatures: several groups with the incomplete last one
+   for 300 features, one component in a group for 520 features. The data of 1200 and more points spans several blocks */
+INSTANTIATE_TEST_SUITE_P(Full, EMReferenceTest,
+                         ::testing::Values(TestCase { full, 3, 4, 1300, 20 }, TestCase { full, 300, 5, 3000, 3 },
+                                           TestCase { full, 520, 2, 1200, 2 }));
+
+INSTANTIATE_TEST_SUITE_P(Diagonal, EMReferenceTest,
+                         ::testing::Values(TestCase { diagonal, 3, 4, 1300, 20 }, TestCase { diagonal, 300, 5, 3000, 3 },
+                                           TestCase { diagonal, 520, 2, 1200, 2 }));
+
+} // namespace daal::algorithms::em_gmm::test
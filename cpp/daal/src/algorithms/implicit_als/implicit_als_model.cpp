@@ -54,6 +54,10 @@ services::Status Parameter::check() const
     {
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, preferenceThresholdStr()));
     }
+    if (nCGIterations == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nCGIterationsStr()));
+    }
     return services::Status();
 }
 
@@ -0,0 +1,263 @@
+/* file: implicit_als_train_csr_cg_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of impicit ALS training algorithm with the conjugate gradient solver
+//  for batch processing mode
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_CSR_CG_BATCH_IMPL_I__
+#define __IMPLICIT_ALS_TRAIN_CSR_CG_BATCH_IMPL_I__
+
+#include "src/algorithms/implicit_als/implicit_als_train_dense_default_batch_impl.i"
+#include "src/algorithms/service_threading.h"
+#include "src/services/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+
+/* Computes ax = (XtX + sum_j c1_j * x_j * x_j' + gamma * I) * x without forming the matrix of the system.
+ * XtX is shared by all the rows, the rank-one terms are applied using only the non-zero ratings of the row */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu>::multiplyBySystem(
+    size_t nFactors, const algorithmFPType * data, const size_t * colIndices, size_t startIdx, size_t endIdx, const algorithmFPType * colFactors,
+    algorithmFPType alpha, algorithmFPType gamma, const algorithmFPType * xtx, const algorithmFPType * x, algorithmFPType * ax)
+{
+    const char trans            = 'N';
+    const DAAL_INT iOne         = 1;
+    const algorithmFPType one   = 1.0;
+    const algorithmFPType zero  = 0.0;
+    const DAAL_INT nFactorsBlas = (DAAL_INT)nFactors;
+
+    Blas<algorithmFPType, cpu>::xxgemv(&trans, &nFactorsBlas, &nFactorsBlas, &one, xtx, &nFactorsBlas, x, &iOne, &zero, ax, &iOne);
+
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        ax[k] += gamma * x[k];
+    }
+
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        const algorithmFPType c1 = alpha * data[j];
+        if (c1 == 0.0) continue;
+
+        const algorithmFPType * colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+        algorithmFPType dotProduct            = 0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            dotProduct += colFactorsRow[k] * x[k];
+        }
+        dotProduct *= c1;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ax[k] += dotProduct * colFactorsRow[k];
+        }
+    }
+}
+
+/* Runs a fixed number of conjugate gradient steps for the normal equations of one row
+ * starting from the factors computed on the previous iteration */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu>::solve(size_t nFactors, const algorithmFPType * data,
+                                                                                    const size_t * colIndices, size_t startIdx, size_t endIdx,
+                                                                                    const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                                    algorithmFPType gamma, const algorithmFPType * xtx,
+                                                                                    size_t nCGIterations, algorithmFPType * x,
+                                                                                    algorithmFPType * buffer)
+{
+    algorithmFPType * r  = buffer;
+    algorithmFPType * p  = buffer + nFactors;
+    algorithmFPType * ap = buffer + 2 * nFactors;
+
+    /* r = b - A * x, where b = sum_j (1 + alpha * r_j) * x_j */
+    multiplyBySystem(nFactors, data, colIndices, startIdx, endIdx, colFactors, alpha, gamma, xtx, x, ap);
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] = -ap[k];
+    }
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        const algorithmFPType c1 = alpha * data[j];
+        if (!(c1 > 0.0)) continue;
+
+        const algorithmFPType c               = c1 + 1.0;
+        const algorithmFPType * colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            r[k] += c * colFactorsRow[k];
+        }
+    }
+
+    algorithmFPType rr = 0.0;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        p[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t iter = 0; iter < nCGIterations && rr > services::internal::EpsilonVal<algorithmFPType>::get(); iter++)
+    {
+        multiplyBySystem(nFactors, data, colIndices, startIdx, endIdx, colFactors, alpha, gamma, xtx, p, ap);
+
+        algorithmFPType pap = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            pap += p[k] * ap[k];
+        }
+        if (!(pap > 0.0)) break;
+
+        const algorithmFPType step = rr / pap;
+        algorithmFPType rrNew      = 0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu>::computeFactors(
+    size_t nRows, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+    const algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha, algorithmFPType lambda, const algorithmFPType * xtx,
+    size_t nCGIterations)
+{
+    size_t nBlocks, blockSize, tailSize;
+    getSizes(nRows, nFactors, nBlocks, blockSize, tailSize);
+
+    TlsMem<algorithmFPType, cpu> tlsBuffer(3 * nFactors);
+    SafeStatus safeStat;
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        algorithmFPType * buffer = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(buffer);
+
+        const size_t curBlockSize = (i < tailSize) ? blockSize + 1 : blockSize;
+        const size_t offset       = (i < tailSize) ? i * blockSize + i : i * blockSize + tailSize;
+
+        for (size_t j = offset; j < offset + curBlockSize; j++)
+        {
+            const size_t startIdx       = rowOffsets[j] - 1;
+            const size_t endIdx         = rowOffsets[j + 1] - 1;
+            const algorithmFPType gamma = lambda * (endIdx - startIdx);
+
+            solve(nFactors, data, colIndices, startIdx, endIdx, colFactors, alpha, gamma, xtx, nCGIterations, rowFactors + j * nFactors, buffer);
+        }
+    });
+
+    return safeStat.detach();
+}
+
+/* Makes the upper triangle of the column-major matrix computed by SYRK available in the full matrix */
+template <typename algorithmFPType>
+static void symmetrize(size_t nFactors, algorithmFPType * xtx)
+{
+    for (size_t i = 0; i < nFactors; i++)
+    {
+        for (size_t j = i + 1; j < nFactors; j++)
+        {
+            xtx[i * nFactors + j] = xtx[j * nFactors + i];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu>::compute(const NumericTable * dataTable,
+                                                                                                  implicit_als::Model * initModel,
+                                                                                                  implicit_als::Model * model,
+                                                                                                  const Parameter * parameter)
+{
+    Status s;
+    ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu> task(dataTable, model, parameter);
+    DAAL_CHECK_STATUS(s, task.init(dataTable, initModel, parameter));
+
+    const algorithmFPType alpha(parameter->alpha);
+    const algorithmFPType lambda(parameter->lambda);
+    const size_t nCGIterations = parameter->nCGIterations;
+
+    size_t nItems                  = task.nItems;
+    size_t nUsers                  = task.nUsers;
+    size_t nFactors                = task.nFactors;
+    algorithmFPType * itemsFactors = task.mtItemsFactors.get();
+    algorithmFPType * usersFactors = task.mtUsersFactors.get();
+    algorithmFPType * xtx          = task.xtx.get();
+
+    const algorithmFPType * data  = task.mtData.values();
+    const algorithmFPType * tdata = task.tdata.get();
+    const size_t * colIndices     = task.mtData.cols();
+    const size_t * rowOffsets     = task.mtData.rows();
+    const size_t * rowIndices     = task.rowIndices.get();
+    const size_t * colOffsets     = task.colOffsets.get();
+
+    /* Users factors are not defined by the initial model, the first solve starts from zero */
+    service_memset<algorithmFPType, cpu>(usersFactors, algorithmFPType(0), nUsers * nFactors);
+
+    algorithmFPType beta = 0.0;
+    for (size_t i = 0; i < parameter->maxIterations; i++)
+    {
+        this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
+        symmetrize(nFactors, xtx);
+
+        s = computeFactors(nUsers, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, nCGIterations);
+        if (!s) break;
+
+        this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
+        symmetrize(nFactors, xtx);
+
+        s = computeFactors(nItems, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, nCGIterations);
+        if (!s) break;
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -86,9 +86,9 @@ Status ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>::init(const NumericTa
     const size_t nNonNull = mtData.rows()[nUsers] - mtData.rows()[0];
     tdata.reset(nNonNull);
     rowIndices.reset(nNonNull);
-    colOffsets.reset(nUsers + 1);
+    colOffsets.reset(nItems + 1);
     DAAL_CHECK_MALLOC(tdata.get() && rowIndices.get() && colOffsets.get());
-    return csr2csc<algorithmFPType, cpu>(nUsers, nItems, mtData.values(), mtData.cols(), mtData.rows(), tdata.get(), rowIndices.get(),
+    return csr2csc<algorithmFPType, cpu>(nItems, nUsers, mtData.values(), mtData.cols(), mtData.rows(), tdata.get(), rowIndices.get(),
                                          colOffsets.get());
 }
 
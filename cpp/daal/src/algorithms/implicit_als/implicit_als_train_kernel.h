@@ -133,6 +133,26 @@ public:
     services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu> : public ImplicitALSTrainKernelCommon<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
+
+protected:
+    services::Status computeFactors(size_t nRows, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                    size_t nFactors, const algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
+                                    algorithmFPType lambda, const algorithmFPType * xtx, size_t nCGIterations);
+
+    static void multiplyBySystem(size_t nFactors, const algorithmFPType * data, const size_t * colIndices, size_t startIdx, size_t endIdx,
+                                 const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType gamma, const algorithmFPType * xtx,
+                                 const algorithmFPType * x, algorithmFPType * ax);
+
+    static void solve(size_t nFactors, const algorithmFPType * data, const size_t * colIndices, size_t startIdx, size_t endIdx,
+                      const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType gamma, const algorithmFPType * xtx,
+                      size_t nCGIterations, algorithmFPType * x, algorithmFPType * buffer);
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct ImplicitALSTrainTaskBase
 {
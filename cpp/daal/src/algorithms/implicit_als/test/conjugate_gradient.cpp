@@ -0,0 +1,211 @@
+/* file: conjugate_gradient.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that implicit ALS trained by the conjugate gradient method matches the Cholesky solves of the fastCSR method
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/implicit_als/implicit_als_training_batch.h"
+#include "algorithms/implicit_als/implicit_als_training_init_batch.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal::algorithms::implicit_als::test
+{
+using namespace daal::data_management;
+
+struct Factors
+{
+    std::vector<double> users;
+    std::vector<double> items;
+};
+
+class ImplicitALSConjugateGradientTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nUsers   = 80;
+    static constexpr size_t nItems   = 50;
+    static constexpr size_t nFactors = 8;
+    static constexpr double alpha    = 2.0;
+    static constexpr double lambda   = 0.1;
+
+    /* Every user and every item has at least one positive rating */
+    ImplicitALSConjugateGradientTest() : _ratings(nUsers * nItems, 0.0)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::uniform_int_distribution<int> rating(1, 5);
+
+        _rowOffsets.push_back(1);
+        for (size_t i = 0; i < nUsers; ++i)
+        {
+            for (size_t j = 0; j < nItems; ++j)
+            {
+                if (j == i % nItems || uniform(rng) < 0.15)
+                {
+                    _ratings[i * nItems + j] = rating(rng);
+                    _values.push_back(_ratings[i * nItems + j]);
+                    _colIndices.push_back(j + 1);
+                }
+            }
+            _rowOffsets.push_back(_values.size() + 1);
+        }
+
+        training::init::Batch<double, training::init::fastCSR> init;
+        init.input.set(training::init::data, csr());
+        init.parameter.nFactors = nFactors;
+        EXPECT_TRUE(init.compute().ok());
+        _initModel = init.getResult()->get(training::init::model);
+    }
+
+    NumericTablePtr csr() { return CSRNumericTablePtr(new CSRNumericTable(_values.data(), _colIndices.data(), _rowOffsets.data(), nItems, nUsers)); }
+
+    template <training::Method method>
+    Factors train(size_t maxIterations, size_t nCGIterations = 3)
+    {
+        training::Batch<double, method> algorithm;
+        algorithm.input.set(training::data, csr());
+        algorithm.input.set(training::inputModel, _initModel);
+        algorithm.parameter.nFactors      = nFactors;
+        algorithm.parameter.maxIterations = maxIterations;
+        algorithm.parameter.alpha         = alpha;
+        algorithm.parameter.lambda        = lambda;
+        algorithm.parameter.nCGIterations = nCGIterations;
+        EXPECT_TRUE(algorithm.compute().ok());
+
+        const ModelPtr model = algorithm.getResult()->get(training::model);
+        return { values(model->getUsersFactors()), values(model->getItemsFactors()) };
+    }
+
+    /* Objective minimized by both methods: the confidence weighted error over all the ratings, the missing ones
+       are the zero preferences with unit confidence, and the penalty weighted by the number of the ratings */
+    double objective(const Factors & factors) const
+    {
+        double value = 0.0;
+        std::vector<size_t> nRatingsOfItem(nItems, 0);
+        for (size_t i = 0; i < nUsers; ++i)
+        {
+            size_t nRatingsOfUser = 0;
+            for (size_t j = 0; j < nItems; ++j)
+            {
+                const double rating = _ratings[i * nItems + j];
+                double dotProduct   = 0.0;
+                for (size_t k = 0; k < nFactors; ++k) dotProduct += factors.users[i * nFactors + k] * factors.items[j * nFactors + k];
+                const double error = (rating > 0.0 ? 1.0 : 0.0) - dotProduct;
+                value += (1.0 + alpha * rating) * error * error;
+                nRatingsOfUser += rating > 0.0;
+                nRatingsOfItem[j] += rating > 0.0;
+            }
+            value += lambda * nRatingsOfUser * squaredNorm(factors.users.data() + i * nFactors);
+        }
+        for (size_t j = 0; j < nItems; ++j) value += lambda * nRatingsOfItem[j] * squaredNorm(factors.items.data() + j * nFactors);
+        return value;
+    }
+
+    /* Largest component of the gradient of the objective over the items factors, zero after the exact solve of the items step */
+    double maxItemsGradient(const Factors & factors) const
+    {
+        std::vector<double> gradient(nItems * nFactors, 0.0);
+        for (size_t i = 0; i < nUsers; ++i)
+        {
+            for (size_t j = 0; j < nItems; ++j)
+            {
+                const double rating = _ratings[i * nItems + j];
+                const double * x    = factors.users.data() + i * nFactors;
+                const double * y    = factors.items.data() + j * nFactors;
+                double dotProduct   = 0.0;
+                for (size_t k = 0; k < nFactors; ++k) dotProduct += x[k] * y[k];
+                const double error = (1.0 + alpha * rating) * (dotProduct - (rating > 0.0 ? 1.0 : 0.0));
+                for (size_t k = 0; k < nFactors; ++k) gradient[j * nFactors + k] += error * x[k] + (rating > 0.0 ? lambda * y[k] : 0.0);
+            }
+        }
+        double value = 0.0;
+        for (double component : gradient) value = std::max(value, std::abs(component));
+        return value;
+    }
+
+    static double squaredNorm(const double * x)
+    {
+        double value = 0.0;
+        for (size_t k = 0; k < nFactors; ++k) value += x[k] * x[k];
+        return value;
+    }
+
+    static std::vector<double> values(const NumericTablePtr & table)
+    {
+        std::vector<double> result(table->getNumberOfRows() * table->getNumberOfColumns());
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::copy(block.getBlockPtr(), block.getBlockPtr() + result.size(), result.begin());
+        table->releaseBlockOfRows(block);
+        return result;
+    }
+
+    static void expectNear(const std::vector<double> & actual, const std::vector<double> & expected, double tolerance, const char * name)
+    {
+        ASSERT_EQ(actual.size(), expected.size()) << name;
+        for (size_t i = 0; i < actual.size(); ++i) EXPECT_NEAR(actual[i], expected[i], tolerance) << name << ", i = " << i;
+    }
+
+private:
+    std::vector<double> _ratings;
+    std::vector<double> _values;
+    std::vector<size_t> _colIndices;
+    std::vector<size_t> _rowOffsets;
+    ModelPtr _initModel;
+};
+
+/* The conjugate gradient solves the system of nFactors equations exactly in at most nFactors steps.
+   There are more users than items, so the items step sees the ratings of all the users only if the data is transposed fully */
+TEST_F(ImplicitALSConjugateGradientTest, ConvergedStepsMatchCholesky)
+{
+    for (size_t maxIterations : { size_t(1), size_t(4) })
+    {
+        const Factors expected = train<training::fastCSR>(maxIterations);
+        const Factors actual   = train<training::conjugateGradientCSR>(maxIterations, 4 * nFactors);
+        expectNear(actual.users, expected.users, 1e-6, "users factors");
+        expectNear(actual.items, expected.items, 1e-6, "items factors");
+        EXPECT_NEAR(objective(actual), objective(expected), 1e-6 * objective(expected)) << "maxIterations = " << maxIterations;
+        EXPECT_LT(maxItemsGradient(expected), 1e-9) << "maxIterations = " << maxIterations;
+    }
+}
+
+/* A few steps started from the factors of the previous iteration never increase the objective
+   and approach the objective of the exact solves */
+TEST_F(ImplicitALSConjugateGradientTest, WarmStartedStepsApproachCholesky)
+{
+    double previous = 0.0;
+    for (size_t maxIterations = 1; maxIterations <= 10; ++maxIterations)
+    {
+        const double value = objective(train<training::conjugateGradientCSR>(maxIterations));
+        if (maxIterations > 1) EXPECT_LE(value, previous * (1.0 + 1e-12)) << "maxIterations = " << maxIterations;
+        previous = value;
+    }
+
+    const double expected = objective(train<training::fastCSR>(10));
+    EXPECT_NEAR(previous, expected, 0.01 * expected);
+}
+
+} // namespace daal::algorithms::implicit_als::test
@@ -47,14 +47,28 @@ class KDTreeTable : public data_management::AOSNumericTable
 {
 public:
     KDTreeTable(size_t rowCount, services::Status & st) : data_management::AOSNumericTable(sizeof(KDTreeNode), 4, rowCount, st)
+    {
+        setFeatures();
+        st |= allocateDataMemory();
+    }
+    KDTreeTable(services::Status & st) : KDTreeTable(0, st) {}
+
+    /* Refers to the nodes stored in the external memory, the memory is not copied */
+    KDTreeTable(const services::SharedPtr<byte> & nodes, size_t rowCount, services::Status & st)
+        : data_management::AOSNumericTable(sizeof(KDTreeNode), 4, rowCount, st)
+    {
+        setFeatures();
+        st |= setArray(nodes, rowCount);
+    }
+
+private:
+    void setFeatures()
     {
         setFeature<size_t>(0, DAAL_STRUCT_MEMBER_OFFSET(KDTreeNode, dimension));
         setFeature<size_t>(1, DAAL_STRUCT_MEMBER_OFFSET(KDTreeNode, leftIndex));
         setFeature<size_t>(2, DAAL_STRUCT_MEMBER_OFFSET(KDTreeNode, rightIndex));
         setFeature<double>(3, DAAL_STRUCT_MEMBER_OFFSET(KDTreeNode, cutPoint));
-        st |= allocateDataMemory();
     }
-    KDTreeTable(services::Status & st) : KDTreeTable(0, st) {}
 };
 typedef services::SharedPtr<KDTreeTable> KDTreeTablePtr;
 typedef services::SharedPtr<const KDTreeTable> KDTreeTableConstPtr;
@@ -236,6 +250,12 @@ public:
      */
     data_management::NumericTablePtr getIndices() { return _indices; }
 
+    /**
+     * Sets the indices of the training observations in the order of KD-tree leaves
+     * \param[in]  value  Table of indices
+     */
+    void setIndices(const data_management::NumericTablePtr & value) { _indices = value; }
+
     /**
      * Sets a training data original indices
      * \param[in]  value  Training data
@@ -0,0 +1,316 @@
+/* file: kernel_function_approximation_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Nystroem and random Fourier features approximations
+//  of the kernel functions.
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_APPROXIMATION_IMPL_I__
+#define __KERNEL_FUNCTION_APPROXIMATION_IMPL_I__
+
+#include "src/threading/threading.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_lapack.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_rng.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_data_utils.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/engines/engine_batch_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/* The kernel values are computed by blocks of rows with at most this number of elements */
+const size_t maxKernelBlockSize = 1 << 22;
+
+/* Writes the nX x nY matrix of the kernel values between the rows of x and y into values */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeKernelValues(KernelIface & kernel, const algorithmFPType * x, size_t nX, const algorithmFPType * y, size_t nY,
+                                     size_t nFeatures, algorithmFPType * values)
+{
+    services::Status status;
+    NumericTablePtr xTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(x), nFeatures, nX, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    NumericTablePtr yTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(y), nFeatures, nY, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    NumericTablePtr valuesTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(values, nY, nX, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    kernel.getResult()->set(kernel_function::values, valuesTable);
+    kernel.getInput()->set(kernel_function::X, xTable);
+    kernel.getInput()->set(kernel_function::Y, yTable);
+    kernel.getParameter()->computationMode = kernel_function::matrixMatrix;
+    return kernel.computeNoThrow();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status NystroemKernel<algorithmFPType, cpu>::sampleLandmarks(const NumericTable & data, engines::BatchBase & engine,
+                                                                      NumericTable & landmarks)
+{
+    const size_t nRows      = data.getNumberOfRows();
+    const size_t nFeatures  = data.getNumberOfColumns();
+    const size_t nLandmarks = landmarks.getNumberOfRows();
+    DAAL_ASSERT(nLandmarks <= nRows);
+    DAAL_CHECK(nRows <= services::internal::MaxVal<int>::get(), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, services::ErrorIncorrectEngineParameter);
+
+    TArray<int, cpu> indicesArray(nLandmarks);
+    DAAL_CHECK_MALLOC(indicesArray.get());
+    int * indices = indicesArray.get();
+
+    RNGs<int, cpu> rng;
+    DAAL_CHECK(!rng.uniformWithoutReplacement(nLandmarks, indices, engineImpl->getState(), 0, (int)nRows),
+               services::ErrorIncorrectErrorcodeFromGenerator);
+
+    WriteOnlyRows<algorithmFPType, cpu> landmarksBlock(landmarks, 0, nLandmarks);
+    DAAL_CHECK_BLOCK_STATUS(landmarksBlock);
+    algorithmFPType * landmarksArray = landmarksBlock.get();
+
+    ReadRows<algorithmFPType, cpu> dataRow;
+    for (size_t i = 0; i < nLandmarks; ++i)
+    {
+        const algorithmFPType * row = dataRow.set(const_cast<NumericTable &>(data), indices[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(dataRow);
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            landmarksArray[i * nFeatures + j] = row[j];
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status NystroemKernel<algorithmFPType, cpu>::computeNormalization(const KernelIfacePtr & kernel, const NumericTable & landmarks,
+                                                                           NumericTable & normalization)
+{
+    const size_t nLandmarks = landmarks.getNumberOfRows();
+    const size_t nFeatures  = landmarks.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> landmarksBlock(const_cast<NumericTable &>(landmarks), 0, nLandmarks);
+    DAAL_CHECK_BLOCK_STATUS(landmarksBlock);
+    const algorithmFPType * landmarksArray = landmarksBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nLandmarks, nLandmarks);
+    TArray<algorithmFPType, cpu> kernelValuesArray(nLandmarks * nLandmarks);
+    TArray<algorithmFPType, cpu> eigenvaluesArray(nLandmarks);
+    DAAL_CHECK_MALLOC(kernelValuesArray.get() && eigenvaluesArray.get());
+    algorithmFPType * a           = kernelValuesArray.get();
+    algorithmFPType * eigenvalues = eigenvaluesArray.get();
+
+    services::Status status;
+    KernelIfacePtr kernelCopy = kernel->clone();
+    DAAL_CHECK_MALLOC(kernelCopy.get());
+    DAAL_CHECK_STATUS(status, (computeKernelValues<algorithmFPType, cpu>(*kernelCopy, landmarksArray, nLandmarks, landmarksArray, nLandmarks,
+                                                                         nFeatures, a)));
+
+    /* The kernel matrix is symmetric, its eigenvectors are returned in the columns of the column-major matrix */
+    char jobz = 'V';
+    char uplo = 'U';
+
+    DAAL_INT n      = nLandmarks;
+    DAAL_INT lwork  = 2 * n * n + 6 * n + 1;
+    DAAL_INT liwork = 5 * n + 3;
+    DAAL_INT info;
+
+    TArray<algorithmFPType, cpu> work(lwork);
+    TArray<DAAL_INT, cpu> iwork(liwork);
+    DAAL_CHECK_MALLOC(work.get() && iwork.get());
+
+    Lapack<algorithmFPType, cpu>::xsyevd(&jobz, &uplo, &n, a, &n, eigenvalues, work.get(), &lwork, iwork.get(), &liwork, &info);
+    if (info != 0) return services::Status(services::ErrorKernelApproximationFailedToComputeEigenvalues);
+
+    /* The eigenvalues are sorted in ascending order, the ones below the numerical rank threshold are dropped */
+    const algorithmFPType eps       = services::internal::EpsilonVal<algorithmFPType>::get();
+    const algorithmFPType threshold = eigenvalues[nLandmarks - 1] * algorithmFPType(nLandmarks) * eps;
+
+    WriteOnlyRows<algorithmFPType, cpu> normalizationBlock(normalization, 0, nLandmarks);
+    DAAL_CHECK_BLOCK_STATUS(normalizationBlock);
+    algorithmFPType * normalizationArray = normalizationBlock.get();
+
+    for (size_t j = 0; j < nLandmarks; ++j)
+    {
+        const algorithmFPType invSqrt =
+            (eigenvalues[j] > threshold) ? algorithmFPType(1) / Math<algorithmFPType, cpu>::sSqrt(eigenvalues[j]) : algorithmFPType(0);
+        for (size_t i = 0; i < nLandmarks; ++i)
+        {
+            normalizationArray[i * nLandmarks + j] = a[j * nLandmarks + i] * invSqrt;
+        }
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status NystroemKernel<algorithmFPType, cpu>::computeFeatures(const KernelIfacePtr & kernel, const NumericTable & data,
+                                                                      const NumericTable & landmarks, const NumericTable & normalization,
+                                                                      NumericTable & features)
+{
+    const size_t nRows      = data.getNumberOfRows();
+    const size_t nFeatures  = data.getNumberOfColumns();
+    const size_t nLandmarks = landmarks.getNumberOfRows();
+
+    ReadRows<algorithmFPType, cpu> landmarksBlock(const_cast<NumericTable &>(landmarks), 0, nLandmarks);
+    DAAL_CHECK_BLOCK_STATUS(landmarksBlock);
+    const algorithmFPType * landmarksArray = landmarksBlock.get();
+
+    ReadRows<algorithmFPType, cpu> normalizationBlock(const_cast<NumericTable &>(normalization), 0, nLandmarks);
+    DAAL_CHECK_BLOCK_STATUS(normalizationBlock);
+    const algorithmFPType * normalizationArray = normalizationBlock.get();
+
+    size_t nRowsInBlock = maxKernelBlockSize / nLandmarks;
+    if (nRowsInBlock < 1) nRowsInBlock = 1;
+    if (nRowsInBlock > nRows) nRowsInBlock = nRows;
+
+    TArray<algorithmFPType, cpu> kernelValuesArray(nRowsInBlock * nLandmarks);
+    DAAL_CHECK_MALLOC(kernelValuesArray.get());
+    algorithmFPType * kernelValues = kernelValuesArray.get();
+
+    services::Status status;
+    KernelIfacePtr kernelCopy = kernel->clone();
+    DAAL_CHECK_MALLOC(kernelCopy.get());
+
+    const char notrans = 'N';
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const DAAL_INT m(nLandmarks);
+
+    ReadRows<algorithmFPType, cpu> dataBlock;
+    WriteOnlyRows<algorithmFPType, cpu> featuresBlock;
+    for (size_t startRow = 0; startRow < nRows; startRow += nRowsInBlock)
+    {
+        const size_t nRowsInCurrentBlock = (startRow + nRowsInBlock > nRows) ? nRows - startRow : nRowsInBlock;
+
+        const algorithmFPType * dataArray = dataBlock.set(const_cast<NumericTable &>(data), startRow, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock);
+        algorithmFPType * featuresArray = featuresBlock.set(features, startRow, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS(featuresBlock);
+
+        DAAL_CHECK_STATUS(status, (computeKernelValues<algorithmFPType, cpu>(*kernelCopy, dataArray, nRowsInCurrentBlock, landmarksArray,
+                                                                             nLandmarks, nFeatures, kernelValues)));
+
+        /* Row-major Z = K(X, L) * M is the column-major Z^T = M^T * K(X, L)^T */
+        const DAAL_INT k(nRowsInCurrentBlock);
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &m, &k, &m, &one, normalizationArray, &m, kernelValues, &m, &zero, featuresArray,
+                                          &m);
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomFourierFeaturesKernel<algorithmFPType, cpu>::sample(algorithmFPType sigma, engines::BatchBase & engine,
+                                                                           NumericTable & frequencies, NumericTable & phases)
+{
+    const size_t nComponents = frequencies.getNumberOfRows();
+    const size_t nFeatures   = frequencies.getNumberOfColumns();
+    DAAL_ASSERT(sigma > 0);
+
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, services::ErrorIncorrectEngineParameter);
+
+    WriteOnlyRows<algorithmFPType, cpu> frequenciesBlock(frequencies, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(frequenciesBlock);
+    WriteOnlyRows<algorithmFPType, cpu> phasesBlock(phases, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(phasesBlock);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nComponents, nFeatures);
+    const algorithmFPType twoPi(6.283185307179586);
+
+    RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(nComponents * nFeatures, frequenciesBlock.get(), engineImpl->getState(), algorithmFPType(0),
+                             algorithmFPType(1) / sigma),
+               services::ErrorIncorrectErrorcodeFromGenerator);
+    DAAL_CHECK(!rng.uniform(nComponents, phasesBlock.get(), engineImpl->getState(), algorithmFPType(0), twoPi),
+               services::ErrorIncorrectErrorcodeFromGenerator);
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomFourierFeaturesKernel<algorithmFPType, cpu>::computeFeatures(const NumericTable & data, const NumericTable & frequencies,
+                                                                                    const NumericTable & phases, NumericTable & features)
+{
+    const size_t nRows       = data.getNumberOfRows();
+    const size_t nFeatures   = data.getNumberOfColumns();
+    const size_t nComponents = frequencies.getNumberOfRows();
+
+    ReadRows<algorithmFPType, cpu> frequenciesBlock(const_cast<NumericTable &>(frequencies), 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(frequenciesBlock);
+    const algorithmFPType * frequenciesArray = frequenciesBlock.get();
+
+    ReadRows<algorithmFPType, cpu> phasesBlock(const_cast<NumericTable &>(phases), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(phasesBlock);
+    const algorithmFPType * phasesArray = phasesBlock.get();
+
+    const algorithmFPType scale = Math<algorithmFPType, cpu>::sSqrt(algorithmFPType(2) / algorithmFPType(nComponents));
+
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks      = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow            = iBlock * nRowsInBlock;
+        const size_t nRowsInCurrentBlock = (startRow + nRowsInBlock > nRows) ? nRows - startRow : nRowsInBlock;
+
+        ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(data), startRow, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType * dataArray = dataBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> featuresBlock(features, startRow, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(featuresBlock);
+        algorithmFPType * featuresArray = featuresBlock.get();
+
+        /* Row-major X * W^T is the column-major W * X^T, the row-major W is the column-major W^T */
+        const char trans   = 'T';
+        const char notrans = 'N';
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        const DAAL_INT d(nComponents);
+        const DAAL_INT p(nFeatures);
+        const DAAL_INT k(nRowsInCurrentBlock);
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &d, &k, &p, &one, frequenciesArray, &p, dataArray, &p, &zero, featuresArray, &d);
+
+        for (size_t i = 0; i < nRowsInCurrentBlock; ++i)
+        {
+            algorithmFPType * row = featuresArray + i * nComponents;
+            for (size_t j = 0; j < nComponents; ++j)
+            {
+                row[j] = scale * Math<algorithmFPType, cpu>::sCos(row[j] + phasesArray[j]);
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
+
+#endif
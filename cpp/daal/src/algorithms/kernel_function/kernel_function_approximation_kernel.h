@@ -0,0 +1,85 @@
+/* file: kernel_function_approximation_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template classes that compute explicit feature maps
+//  approximating the kernel functions.
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_APPROXIMATION_KERNEL_H__
+#define __KERNEL_FUNCTION_APPROXIMATION_KERNEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/engines/engine.h"
+#include "algorithms/kernel_function/kernel_function.h"
+#include "src/algorithms/kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+/*
+ * Nystroem approximation of the kernel function. The feature map of the observation x is
+ * z(x) = K(x, L) * U * S^(-1/2), where L are the m landmarks and K(L, L) = U * S * U^T,
+ * so that z(x) * z(y)^T is the projection of K(x, y) onto the span of the landmarks.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class NystroemKernel : public Kernel
+{
+public:
+    /* Selects the landmarks among the observations uniformly without replacement */
+    services::Status sampleLandmarks(const NumericTable & data, engines::BatchBase & engine, NumericTable & landmarks);
+
+    /* Computes the m x m matrix U * S^(-1/2), the directions with negligible eigenvalues are dropped */
+    services::Status computeNormalization(const KernelIfacePtr & kernel, const NumericTable & landmarks, NumericTable & normalization);
+
+    /* Computes the n x m table of the feature maps of the observations */
+    services::Status computeFeatures(const KernelIfacePtr & kernel, const NumericTable & data, const NumericTable & landmarks,
+                                     const NumericTable & normalization, NumericTable & features);
+};
+
+/*
+ * Random Fourier features approximation of the RBF kernel function exp(-||x - y||^2 / (2 * sigma^2)).
+ * The feature map of the observation x is z(x) = sqrt(2 / D) * cos(W * x + b), where the D rows of W
+ * are sampled from N(0, I / sigma^2) and the D phases b are sampled from U[0, 2 * pi).
+ */
+template <typename algorithmFPType, CpuType cpu>
+class RandomFourierFeaturesKernel : public Kernel
+{
+public:
+    /* Samples the D x p frequencies W and the 1 x D phases b */
+    services::Status sample(algorithmFPType sigma, engines::BatchBase & engine, NumericTable & frequencies, NumericTable & phases);
+
+    /* Computes the n x D table of the feature maps of the observations */
+    services::Status computeFeatures(const NumericTable & data, const NumericTable & frequencies, const NumericTable & phases,
+                                     NumericTable & features);
+};
+
+} // namespace internal
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -58,7 +58,7 @@ struct TaskKMeansLloyd
         cCenters = _centroids;
 
         /* Allocate memory for all arrays inside TLS */
-        tls_task = new daal::static_tls<TlsTask<algorithmFPType, cpu> *>([=]() -> TlsTask<algorithmFPType, cpu> * {
+        tls_task = new daal::reduction_tls<TlsTask<algorithmFPType, cpu> *>([=]() -> TlsTask<algorithmFPType, cpu> * {
             return TlsTask<algorithmFPType, cpu>::create(dim, clNum, max_block_size);
         }); /* Allocate memory for all arrays inside TLS: end */
 
@@ -120,11 +120,13 @@ struct TaskKMeansLloyd
 
     void kmeansInsertCandidate(TlsTask<algorithmFPType, cpu> * tt, algorithmFPType value, size_t index);
 
+    void kmeansCombineTlsTasks();
+
     Status kmeansComputeCentroidsCandidates(algorithmFPType * cValues, size_t * cIndices, size_t & cNum);
 
     void kmeansClearClusters(algorithmFPType * goalFunc);
 
-    daal::static_tls<TlsTask<algorithmFPType, cpu> *> * tls_task;
+    daal::reduction_tls<TlsTask<algorithmFPType, cpu> *> * tls_task;
     algorithmFPType * clSq;
     algorithmFPType * cCenters;
 
@@ -144,7 +146,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+    daal::reduction_static_threader_for(*tls_task, nBlocks, [=, &safeStat](const int k, size_t tid) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
@@ -244,6 +246,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
 
         *trg += goal;
     }); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+    kmeansCombineTlsTasks();
     return safeStat.detach();
 }
 
@@ -259,7 +262,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+    daal::reduction_static_threader_for(*tls_task, nBlocks, [=, &safeStat](const int k, size_t tid) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
         DAAL_CHECK_MALLOC_THR(tt);
 
@@ -340,6 +343,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
             }
         }
     });
+    kmeansCombineTlsTasks();
     return safeStat.detach();
 }
 
@@ -435,6 +439,34 @@ void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansInsertCandidate(TlsTask<algori
     }
 }
 
+/* In the deterministic mode merges the partial sums, the goal function and the candidates of the fixed blocks of rows in the fixed order */
+template <typename algorithmFPType, CpuType cpu>
+void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansCombineTlsTasks()
+{
+    tls_task->combine_pairwise([=](TlsTask<algorithmFPType, cpu> * to, TlsTask<algorithmFPType, cpu> * from) -> void {
+        for (size_t k = 0; k < clNum; k++)
+        {
+            to->cS0[k] += from->cS0[k];
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < clNum * dim; i++)
+        {
+            to->cS1[i] += from->cS1[i];
+        }
+
+        to->goalFunc += from->goalFunc;
+
+        for (size_t i = 0; i < from->cNum; i++)
+        {
+            kmeansInsertCandidate(to, from->cValues[i], from->cIndices[i]);
+        }
+
+        delete from;
+    });
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroidsCandidates(algorithmFPType * cValues, size_t * cIndices, size_t & cNum)
 {
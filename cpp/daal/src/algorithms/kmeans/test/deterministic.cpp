@@ -0,0 +1,115 @@
+/* file: deterministic.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that K-Means Lloyd in the deterministic reduction mode gives bitwise the same results for any number of threads
+//--
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/kmeans/kmeans_batch.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/env_detect.h"
+
+namespace daal::algorithms::kmeans::test
+{
+using namespace daal::data_management;
+
+class KMeansDeterministicTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows     = 30011;
+    static constexpr size_t nCols     = 10;
+    static constexpr size_t nClusters = 5;
+
+    /* The rows are drawn around the shifted centers, so the clusters overlap and the centroids move for several iterations */
+    KMeansDeterministicTest() : _data(nRows * nCols)
+    {
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                _data[i * nCols + j] = normal(rng) + double((i * 7 + j) % nClusters);
+            }
+        }
+    }
+
+    void SetUp() override
+    {
+        _nThreads = services::Environment::getInstance()->getNumberOfThreads();
+        services::Environment::getInstance()->enableDeterministicReductions(true);
+    }
+
+    void TearDown() override
+    {
+        services::Environment::getInstance()->enableDeterministicReductions(false);
+        services::Environment::getInstance()->setNumberOfThreads(_nThreads);
+    }
+
+    static std::vector<std::uint64_t> bits(const NumericTablePtr & table)
+    {
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::vector<std::uint64_t> values(table->getNumberOfRows() * table->getNumberOfColumns());
+        std::memcpy(values.data(), block.getBlockPtr(), values.size() * sizeof(double));
+        table->releaseBlockOfRows(block);
+        return values;
+    }
+
+    /* Runs the iterations from the first rows of the data as the initial centroids */
+    std::vector<std::vector<std::uint64_t> > compute()
+    {
+        Batch<double, lloydDense> algorithm(nClusters, 10);
+        algorithm.input.set(kmeans::data, HomogenNumericTable<double>::create(_data.data(), nCols, nRows));
+        algorithm.input.set(kmeans::inputCentroids, HomogenNumericTable<double>::create(_data.data(), nCols, nClusters));
+        algorithm.parameter().accuracyThreshold = 0.0;
+        algorithm.parameter().resultsToEvaluate = computeCentroids | computeAssignments | computeExactObjectiveFunction;
+        EXPECT_TRUE(algorithm.compute().ok());
+
+        const ResultPtr result = algorithm.getResult();
+        return { bits(result->get(centroids)), bits(result->get(assignments)), bits(result->get(objectiveFunction)),
+                 bits(result->get(nIterations)) };
+    }
+
+    size_t defaultNumberOfThreads() const { return _nThreads; }
+
+private:
+    std::vector<double> _data;
+    size_t _nThreads = 1;
+};
+
+TEST_F(KMeansDeterministicTest, Lloyd)
+{
+    services::Environment::getInstance()->setNumberOfThreads(1);
+    const std::vector<std::vector<std::uint64_t> > expected = compute();
+    for (size_t nThreads : { size_t(2), size_t(3), defaultNumberOfThreads() > 3 ? defaultNumberOfThreads() : size_t(4) })
+    {
+        services::Environment::getInstance()->setNumberOfThreads(nThreads);
+        EXPECT_EQ(expected, compute()) << "nThreads = " << nThreads;
+    }
+}
+
+} // namespace daal::algorithms::kmeans::test
@@ -154,6 +154,12 @@ public:
      */
     void reduce(algorithmFPType * xtx, algorithmFPType * xty);
 
+    /**
+     * Reduces thread local partial results into the partial results of other thread local storage
+     * \param[in,out] other Thread local storage that accumulates the partial results
+     */
+    void reduce(ThreadingTask<algorithmFPType, cpu> & other) { reduce(other._xtx, other._xty); }
+
 protected:
     /**
      * Construct thread local storage of the requested size
@@ -170,6 +176,15 @@ protected:
     DAAL_INT _nResponses;      /*!< Ny - number of responses */
 };
 
+/**
+ * Memory limits of the partial results update
+ */
+struct UpdateMemoryLimits
+{
+    size_t maxReplicatedSizeInBytes = 256 * 1024 * 1024; /*!< Maximal total size of the thread local copies of the partial results */
+    size_t chunkSizeInBytes         = 64 * 1024 * 1024;  /*!< Size of the chunk of rows read from the input data set by the blocked update */
+};
+
 /**
  * Implements the common part of the partial results update with new block of input data
  */
@@ -191,10 +206,27 @@ public:
      * \param[in]  interceptFlag    Flag.
      *                              - True if it is required to compute an intercept term and P' = P + 1
      *                              - False otherwis, P' = P
+     * \param[in]  limits   Memory limits that select the update method, the algorithms use the default ones
      * \return Status of the computations
      */
     static Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, bool initializeResult,
-                          bool interceptFlag);
+                          bool interceptFlag, const UpdateMemoryLimits & limits = UpdateMemoryLimits());
+
+protected:
+    /**
+     * Updates the partial results using thread local copies of the matrices \f$X'^T \times X'\f$ and \f$X'^T \times Y\f$
+     * that are reduced into the global partial results once all blocks of rows are processed
+     */
+    static Status computeReplicated(const NumericTable & x, const NumericTable & y, algorithmFPType * xtx, algorithmFPType * xty,
+                                    DAAL_INT nBetasIntercept);
+
+    /**
+     * Updates the partial results in place without thread local copies.
+     * The upper triangle of \f$X'^T \times X'\f$ is split into square tiles, each tile is updated by a single thread.
+     * The input data set is read by chunks of rows of chunkSizeInBytes, so only one chunk is requested from the input tables at a time.
+     */
+    static Status computeBlocked(const NumericTable & x, const NumericTable & y, algorithmFPType * xtx, algorithmFPType * xty,
+                                 DAAL_INT nBetasIntercept, size_t chunkSizeInBytes);
 };
 
 /**
@@ -166,14 +166,14 @@ ThreadingTask<algorithmFPType, cpu>::~ThreadingTask()
 
 template <typename algorithmFPType, CpuType cpu>
 Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable, const NumericTable & yTable, NumericTable & xtxTable,
-                                                   NumericTable & xtyTable, bool initializeResult, bool interceptFlag)
+                                                   NumericTable & xtyTable, bool initializeResult, bool interceptFlag,
+                                                   const UpdateMemoryLimits & limits)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate);
-    DAAL_INT nRows(xTable.getNumberOfRows());         /* observations */
     DAAL_INT nResponses(yTable.getNumberOfColumns()); /* responses */
     DAAL_INT nBetas(xTable.getNumberOfColumns() + 1); /* coefficients */
 
-    size_t nBetasIntercept = (interceptFlag ? nBetas : (nBetas - 1));
+    DAAL_INT nBetasIntercept = (interceptFlag ? nBetas : (nBetas - 1));
 
     WriteRowsType xtxBlock(xtxTable, 0, nBetasIntercept);
     DAAL_CHECK_BLOCK_STATUS(xtxBlock);
@@ -190,6 +190,27 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
         service_memset<algorithmFPType, cpu>(xty, 0, nResponses * nBetasIntercept);
     }
 
+    /* Thread local copies of the partial results take nThreads * P'^2 elements and are reduced serially,
+     * switch to the in-place accumulation by tiles when they do not fit into the memory limit.
+     * In the deterministic mode there is a copy per fixed block of rows, so the choice does not depend on the number of threads */
+    const bool deterministic           = threader_is_deterministic_reductions_enabled();
+    const size_t nReplicas             = deterministic ? deterministicReductionSlots : threader_get_threads_number();
+    const size_t replicatedSizeInBytes = nReplicas * nBetasIntercept * (nBetasIntercept + nResponses) * sizeof(algorithmFPType);
+
+    if (replicatedSizeInBytes > limits.maxReplicatedSizeInBytes)
+    {
+        return computeBlocked(xTable, yTable, xtx, xty, nBetasIntercept, limits.chunkSizeInBytes);
+    }
+    return computeReplicated(xTable, yTable, xtx, xty, nBetasIntercept);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status UpdateKernel<algorithmFPType, cpu>::computeReplicated(const NumericTable & xTable, const NumericTable & yTable, algorithmFPType * xtx,
+                                                             algorithmFPType * xty, DAAL_INT nBetasIntercept)
+{
+    DAAL_INT nRows(xTable.getNumberOfRows());         /* observations */
+    DAAL_INT nResponses(yTable.getNumberOfColumns()); /* responses */
+
     /* Split rows by blocks */
     size_t nRowsInBlock = 128;
 
@@ -200,10 +221,10 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
     }
 
     /* Create TLS */
-    daal::static_tls<ThreadingTaskType *> tls([=]() -> ThreadingTaskType * { return ThreadingTaskType::create(nBetasIntercept, nResponses); });
+    daal::reduction_tls<ThreadingTaskType *> tls([=]() -> ThreadingTaskType * { return ThreadingTaskType::create(nBetasIntercept, nResponses); });
 
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &tls, &xTable, &yTable, &safeStat](int iBlock, size_t tid) {
+    daal::reduction_static_threader_for(tls, nBlocks, [=, &tls, &xTable, &yTable, &safeStat](int iBlock, size_t tid) {
         ThreadingTaskType * tlsLocal = tls.local(tid);
 
         if (!tlsLocal)
@@ -224,6 +245,10 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
     });
 
     Status st = safeStat.detach();
+    tls.combine_pairwise([&st](ThreadingTaskType * to, ThreadingTaskType * from) -> void {
+        if (st) from->reduce(*to);
+        delete from;
+    });
     tls.reduce([=, &st](ThreadingTaskType * tlsLocal) -> void {
         if (!tlsLocal) return;
         if (st) tlsLocal->reduce(xtx, xty);
@@ -233,6 +258,140 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status UpdateKernel<algorithmFPType, cpu>::computeBlocked(const NumericTable & xTable, const NumericTable & yTable, algorithmFPType * xtx,
+                                                          algorithmFPType * xty, DAAL_INT nBetasIntercept, size_t chunkSizeInBytes)
+{
+    const DAAL_INT nRows = xTable.getNumberOfRows();
+    DAAL_INT nFeatures   = xTable.getNumberOfColumns();
+    DAAL_INT nResponses  = yTable.getNumberOfColumns();
+
+    /* Tiles of the upper triangle of X'^T * X' in column-major layout, the tile (iTile, jTile) has iTile <= jTile.
+     * Each tile is a single task, so the tiles are shrunk until there are several tasks per thread.
+     * The elements of X'^T * X' are computed by SYRK or GEMM depending on the tiling,
+     * so in the deterministic mode the tile size is fixed and the results do not depend on the number of threads */
+    const DAAL_INT maxTileSize = 256;
+    const DAAL_INT minTileSize = 64;
+    const size_t minTasks      = 4 * threader_get_threads_number();
+    DAAL_INT tileSize          = maxTileSize;
+    DAAL_INT nTilesInRow       = (nFeatures + tileSize - 1) / tileSize;
+    while (!threader_is_deterministic_reductions_enabled() && tileSize > minTileSize && size_t(nTilesInRow * (nTilesInRow + 1) / 2) < minTasks)
+    {
+        tileSize /= 2;
+        nTilesInRow = (nFeatures + tileSize - 1) / tileSize;
+    }
+    const size_t nTiles = nTilesInRow * (nTilesInRow + 1) / 2;
+
+    TArray<DAAL_INT, cpu> tileRowsArray(nTiles);
+    TArray<DAAL_INT, cpu> tileColsArray(nTiles);
+    DAAL_INT * tileRows = tileRowsArray.get();
+    DAAL_INT * tileCols = tileColsArray.get();
+    DAAL_CHECK_MALLOC(tileRows && tileCols);
+
+    for (DAAL_INT jTile = 0, iTask = 0; jTile < nTilesInRow; jTile++)
+    {
+        for (DAAL_INT iTile = 0; iTile <= jTile; iTile++, iTask++)
+        {
+            tileRows[iTask] = iTile;
+            tileCols[iTask] = jTile;
+        }
+    }
+
+    /* Rows are requested from the input tables by chunks of limited size,
+     * so the tables that fetch the data on demand are never loaded into memory entirely */
+    const DAAL_INT minRowsInChunk = 256;
+    DAAL_INT nRowsInChunk         = chunkSizeInBytes / (nFeatures * sizeof(algorithmFPType));
+    if (nRowsInChunk < minRowsInChunk)
+    {
+        nRowsInChunk = minRowsInChunk;
+    }
+
+    char up      = 'U';
+    char trans   = 'T';
+    char notrans = 'N';
+    algorithmFPType one(1.0);
+
+    ReadRowsType xBlock;
+    ReadRowsType yBlock;
+    for (DAAL_INT startRow = 0; startRow < nRows; startRow += nRowsInChunk)
+    {
+        DAAL_INT nChunkRows = (startRow + nRowsInChunk > nRows) ? nRows - startRow : nRowsInChunk;
+
+        xBlock.set(const_cast<NumericTable &>(xTable), startRow, nChunkRows);
+        DAAL_CHECK_BLOCK_STATUS(xBlock);
+        const algorithmFPType * x = xBlock.get();
+
+        yBlock.set(const_cast<NumericTable &>(yTable), startRow, nChunkRows);
+        DAAL_CHECK_BLOCK_STATUS(yBlock);
+        const algorithmFPType * y = yBlock.get();
+
+        daal::threader_for(nTiles, nTiles, [&](size_t iTask) {
+            const DAAL_INT iStart = tileRows[iTask] * tileSize;
+            const DAAL_INT jStart = tileCols[iTask] * tileSize;
+            DAAL_INT iSize        = (iStart + tileSize > nFeatures) ? nFeatures - iStart : tileSize;
+            DAAL_INT jSize        = (jStart + tileSize > nFeatures) ? nFeatures - jStart : tileSize;
+            algorithmFPType * xtxTile = xtx + jStart * nBetasIntercept + iStart;
+
+            if (iStart != jStart)
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemmX);
+                Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &iSize, &jSize, &nChunkRows, &one, x + iStart, &nFeatures, x + jStart,
+                                                   &nFeatures, &one, xtxTile, &nBetasIntercept);
+                return;
+            }
+
+            /* The diagonal tile also updates the rows of X'^T * Y and the intercept row of X'^T * X' that correspond to its features */
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.syrkX);
+                Blas<algorithmFPType, cpu>::xxsyrk(&up, &notrans, &iSize, &nChunkRows, &one, const_cast<algorithmFPType *>(x + iStart), &nFeatures,
+                                                   &one, xtxTile, &nBetasIntercept);
+            }
+
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemmXY);
+                Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &iSize, &nResponses, &nChunkRows, &one, x + iStart,
+                                                   &nFeatures, y, &nResponses, &one, xty + iStart, &nBetasIntercept);
+            }
+
+            if (nFeatures < nBetasIntercept)
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemm1X);
+                algorithmFPType * xtxPtr     = xtx + nFeatures * nBetasIntercept + iStart;
+                const algorithmFPType * xPtr = x + iStart;
+
+                for (DAAL_INT i = 0; i < nChunkRows; i++, xPtr += nFeatures)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (DAAL_INT j = 0; j < iSize; j++)
+                    {
+                        xtxPtr[j] += xPtr[j];
+                    }
+                }
+            }
+        });
+
+        if (nFeatures < nBetasIntercept)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemm1Y);
+            xtx[nFeatures * nBetasIntercept + nFeatures] += algorithmFPType(nChunkRows);
+
+            const algorithmFPType * yPtr = y;
+            for (DAAL_INT i = 0; i < nChunkRows; i++, yPtr += nResponses)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (DAAL_INT j = 0; j < nResponses; j++)
+                {
+                    xty[j * nBetasIntercept + nFeatures] += yPtr[j];
+                }
+            }
+        }
+    }
+
+    return Status();
+}
+
 } // namespace internal
 } // namespace training
 } // namespace normal_equations
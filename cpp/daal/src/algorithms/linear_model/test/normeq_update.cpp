@@ -0,0 +1,181 @@
+/* file: normeq_update.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that the in-place update of the normal equations by tiles matches the update with thread local copies
+//  and that both are bitwise reproducible in the deterministic reduction mode
+//--
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/env_detect.h"
+#include "src/algorithms/linear_model/linear_model_train_normeq_kernel.h"
+
+namespace daal::algorithms::linear_model::normal_equations::training::internal::test
+{
+using namespace daal::data_management;
+
+typedef UpdateKernel<double, daal::sse2> UpdateKernelType;
+
+class NormEqUpdateTest : public ::testing::TestWithParam<bool>
+{
+protected:
+    static constexpr size_t nRows      = 1500;
+    static constexpr size_t nCols      = 300;
+    static constexpr size_t nResponses = 3;
+
+    NormEqUpdateTest() : _x(nRows * nCols), _y(nRows * nResponses)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        for (auto & value : _x) value = uniform(rng);
+        for (auto & value : _y) value = uniform(rng);
+    }
+
+    /* Updates X'^T * X' and X'^T * Y by the rows [iFirstRow, iFirstRow + nRowsInTable) on top of the previous values */
+    void update(size_t iFirstRow, size_t nRowsInTable, const UpdateMemoryLimits & limits, bool initializeResult, std::vector<double> & xtx,
+                std::vector<double> & xty)
+    {
+        const bool interceptFlag     = GetParam();
+        const size_t nBetasIntercept = nCols + (interceptFlag ? 1 : 0);
+        xtx.resize(nBetasIntercept * nBetasIntercept);
+        xty.resize(nResponses * nBetasIntercept);
+
+        NumericTablePtr x     = HomogenNumericTable<double>::create(_x.data() + iFirstRow * nCols, nCols, nRowsInTable);
+        NumericTablePtr y     = HomogenNumericTable<double>::create(_y.data() + iFirstRow * nResponses, nResponses, nRowsInTable);
+        NumericTablePtr xtxNT = HomogenNumericTable<double>::create(xtx.data(), nBetasIntercept, nBetasIntercept);
+        NumericTablePtr xtyNT = HomogenNumericTable<double>::create(xty.data(), nBetasIntercept, nResponses);
+
+        ASSERT_TRUE(UpdateKernelType::compute(*x, *y, *xtxNT, *xtyNT, initializeResult, interceptFlag, limits).ok());
+    }
+
+    /* Only the upper triangle of X'^T * X' in the column-major layout is computed */
+    static void expectEqual(const std::vector<double> & expectedXtX, const std::vector<double> & expectedXtY, const std::vector<double> & xtx,
+                            const std::vector<double> & xty)
+    {
+        const size_t nBetasIntercept = xty.size() / nResponses;
+        for (size_t j = 0; j < nBetasIntercept; ++j)
+        {
+            for (size_t i = 0; i <= j; ++i)
+            {
+                const double expected = expectedXtX[j * nBetasIntercept + i];
+                EXPECT_NEAR(expected, xtx[j * nBetasIntercept + i], 1e-10 * (1.0 + std::fabs(expected))) << "i = " << i << ", j = " << j;
+            }
+        }
+        for (size_t i = 0; i < xty.size(); ++i)
+        {
+            EXPECT_NEAR(expectedXtY[i], xty[i], 1e-10 * (1.0 + std::fabs(expectedXtY[i]))) << "i = " << i;
+        }
+    }
+
+    static std::vector<std::uint64_t> bits(const std::vector<double> & values)
+    {
+        std::vector<std::uint64_t> result(values.size());
+        std::memcpy(result.data(), values.data(), values.size() * sizeof(double));
+        return result;
+    }
+
+    static UpdateMemoryLimits replicated()
+    {
+        UpdateMemoryLimits limits;
+        limits.maxReplicatedSizeInBytes = std::numeric_limits<size_t>::max();
+        return limits;
+    }
+
+    /* Chunks of the minimal size of 256 rows, so the last chunk is partial */
+    static UpdateMemoryLimits blocked()
+    {
+        UpdateMemoryLimits limits;
+        limits.maxReplicatedSizeInBytes = 0;
+        limits.chunkSizeInBytes         = 1;
+        return limits;
+    }
+
+private:
+    std::vector<double> _x;
+    std::vector<double> _y;
+};
+
+TEST_P(NormEqUpdateTest, BlockedMatchesReplicated)
+{
+    std::vector<double> expectedXtX, expectedXtY, xtx, xty;
+    update(0, nRows, replicated(), true, expectedXtX, expectedXtY);
+    update(0, nRows, blocked(), true, xtx, xty);
+    expectEqual(expectedXtX, expectedXtY, xtx, xty);
+}
+
+TEST_P(NormEqUpdateTest, BlockedSingleChunk)
+{
+    UpdateMemoryLimits limits = blocked();
+    limits.chunkSizeInBytes   = nRows * nCols * sizeof(double);
+
+    std::vector<double> expectedXtX, expectedXtY, xtx, xty;
+    update(0, nRows, replicated(), true, expectedXtX, expectedXtY);
+    update(0, nRows, limits, true, xtx, xty);
+    expectEqual(expectedXtX, expectedXtY, xtx, xty);
+}
+
+/* The online mode accumulates the blocks of rows into the partial results of the previous ones */
+TEST_P(NormEqUpdateTest, BlockedAccumulatesOnline)
+{
+    const size_t nFirstRows = 700;
+
+    std::vector<double> expectedXtX, expectedXtY, xtx, xty;
+    update(0, nRows, replicated(), true, expectedXtX, expectedXtY);
+    update(0, nFirstRows, replicated(), true, xtx, xty);
+    update(nFirstRows, nRows - nFirstRows, blocked(), false, xtx, xty);
+    expectEqual(expectedXtX, expectedXtY, xtx, xty);
+}
+
+/* In the deterministic reduction mode the update is bitwise the same for any number of threads */
+TEST_P(NormEqUpdateTest, DeterministicForAnyNumberOfThreads)
+{
+    services::Environment * const env = services::Environment::getInstance();
+    const size_t defaultNThreads      = env->getNumberOfThreads();
+    env->enableDeterministicReductions(true);
+
+    for (const UpdateMemoryLimits & limits : { UpdateMemoryLimits(), replicated(), blocked() })
+    {
+        std::vector<double> expectedXtX, expectedXtY, xtx, xty;
+        env->setNumberOfThreads(1);
+        update(0, nRows, limits, true, expectedXtX, expectedXtY);
+        for (size_t nThreads : { size_t(2), size_t(3), defaultNThreads > 3 ? defaultNThreads : size_t(4) })
+        {
+            env->setNumberOfThreads(nThreads);
+            update(0, nRows, limits, true, xtx, xty);
+            EXPECT_EQ(bits(expectedXtX), bits(xtx)) << "nThreads = " << nThreads << ", replicated = " << limits.maxReplicatedSizeInBytes;
+            EXPECT_EQ(bits(expectedXtY), bits(xty)) << "nThreads = " << nThreads << ", replicated = " << limits.maxReplicatedSizeInBytes;
+        }
+    }
+
+    env->enableDeterministicReductions(false);
+    env->setNumberOfThreads(defaultNThreads);
+}
+
+INSTANTIATE_TEST_SUITE_P(WithAndWithoutIntercept, NormEqUpdateTest, ::testing::Values(false, true));
+
+} // namespace daal::algorithms::linear_model::normal_equations::training::internal::test
@@ -0,0 +1,147 @@
+/* file: csr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that logistic regression trained on CSR data matches the model trained on the same dense data
+//--
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/logistic_regression/logistic_regression_training_batch.h"
+#include "algorithms/optimization_solver/sgd/sgd_batch.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::logistic_regression::test
+{
+using namespace daal::data_management;
+
+class LogisticRegressionCSRTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows = 2000;
+    static constexpr size_t nCols = 300;
+
+    LogisticRegressionCSRTest() : _dense(nRows * nCols, 0.0), _labels(nRows)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        _rowOffsets.push_back(1);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            double margin = 0.0;
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                if (uniform(rng) < 0.05)
+                {
+                    const double value    = normal(rng);
+                    _dense[i * nCols + j] = value;
+                    _values.push_back(value);
+                    _colIndices.push_back(j + 1);
+                    margin += (j % 2 ? value : -value);
+                }
+            }
+            _rowOffsets.push_back(_values.size() + 1);
+            _labels[i] = double(margin > 0.0) + (margin > 1.0 ? 1.0 : 0.0);
+        }
+    }
+
+    NumericTablePtr dense() { return HomogenNumericTable<double>::create(_dense.data(), nCols, nRows); }
+
+    NumericTablePtr csr() { return CSRNumericTablePtr(new CSRNumericTable(_values.data(), _colIndices.data(), _rowOffsets.data(), nCols, nRows)); }
+
+    NumericTablePtr labels(size_t nClasses)
+    {
+        NumericTablePtr table = HomogenNumericTable<double>::create(1, nRows, NumericTable::doAllocate);
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, nRows, writeOnly, block);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            block.getBlockPtr()[i] = (nClasses == 2 && _labels[i] > 1.0) ? 1.0 : _labels[i];
+        }
+        table->releaseBlockOfRows(block);
+        return table;
+    }
+
+    /* Trains the models on the dense and the CSR data with the solver created by makeSolver and compares their coefficients */
+    template <typename MakeSolver>
+    void checkCSRMatchesDense(size_t nClasses, float penaltyL2, const MakeSolver & makeSolver)
+    {
+        std::vector<double> beta[2];
+        const NumericTablePtr data[2] = { dense(), csr() };
+        for (size_t i = 0; i < 2; ++i)
+        {
+            training::Batch<double> algorithm(nClasses, makeSolver());
+            algorithm.input.set(classifier::training::data, data[i]);
+            algorithm.input.set(classifier::training::labels, labels(nClasses));
+            algorithm.parameter().penaltyL2 = penaltyL2;
+            ASSERT_TRUE(algorithm.compute().ok());
+
+            const NumericTablePtr betaTable = algorithm.getResult()->get(classifier::training::model)->getBeta();
+            BlockDescriptor<double> block;
+            betaTable->getBlockOfRows(0, betaTable->getNumberOfRows(), readOnly, block);
+            beta[i].assign(block.getBlockPtr(), block.getBlockPtr() + betaTable->getNumberOfRows() * betaTable->getNumberOfColumns());
+            betaTable->releaseBlockOfRows(block);
+        }
+
+        ASSERT_EQ(beta[0].size(), beta[1].size());
+        for (size_t j = 0; j < beta[0].size(); ++j)
+        {
+            EXPECT_NEAR(beta[0][j], beta[1][j], 1e-8 * (1.0 + std::fabs(beta[0][j]))) << "j = " << j;
+        }
+    }
+
+private:
+    std::vector<double> _dense;
+    std::vector<double> _labels;
+    std::vector<double> _values;
+    std::vector<size_t> _colIndices;
+    std::vector<size_t> _rowOffsets;
+};
+
+TEST_F(LogisticRegressionCSRTest, BinaryDefaultSolver)
+{
+    checkCSRMatchesDense(2, 0.01f, []() { return optimization_solver::iterative_solver::BatchPtr(); });
+}
+
+TEST_F(LogisticRegressionCSRTest, MulticlassDefaultSolver)
+{
+    checkCSRMatchesDense(3, 0.01f, []() { return optimization_solver::iterative_solver::BatchPtr(); });
+}
+
+/* One term per iteration: the solver takes the lazily regularized path on the CSR data */
+TEST_F(LogisticRegressionCSRTest, BinarySGDLazyL2)
+{
+    checkCSRMatchesDense(2, 0.05f, []() {
+        services::SharedPtr<optimization_solver::sgd::Batch<double> > solver(new optimization_solver::sgd::Batch<double>());
+        solver->parameter.nIterations          = 5000;
+        solver->parameter.accuracyThreshold    = 1e-12;
+        solver->parameter.learningRateSequence = HomogenNumericTable<double>::create(1, 1, NumericTable::doAllocate, 0.05);
+        return solver;
+    });
+}
+
+} // namespace daal::algorithms::logistic_regression::test
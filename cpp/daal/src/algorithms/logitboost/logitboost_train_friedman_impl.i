@@ -44,6 +44,8 @@
 #include "src/services/service_utils.h"
 #include "src/algorithms/service_threading.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/stump/stump_train_hist_aux.h"
+#include "algorithms/stump/stump_regression_training_batch.h"
 #include "src/algorithms/logitboost/logitboost_impl.i"
 #include "src/algorithms/logitboost/logitboost_train_friedman_aux.i"
 
@@ -81,6 +83,9 @@ public:
         {
             _learnerTrain   = train->clone();
             _learnerPredict = predict->clone();
+            /* Each thread trains its own copy of the weak learner, so the copies do not share the bins */
+            stump::internal::shareBinnedData<stump::regression::training::Batch<algorithmFPType, stump::regression::training::hist>, algorithmFPType,
+                                             cpu>(_learnerTrain);
             if (!wArray) wArray = HomogenNT::create(1, _nRows, &status);
             if (!zArray) zArray = HomogenNT::create(1, _nRows, &status);
 
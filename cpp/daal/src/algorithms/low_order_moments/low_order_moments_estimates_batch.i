@@ -249,14 +249,14 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
 
     DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.compute);
     /* TLS buffers initialization */
-    daal::tls<tls_moments_data_t<algorithmFPType, cpu> *> tls_data([&]() { return new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures); });
+    daal::dynamic_reduction_tls<tls_moments_data_t<algorithmFPType, cpu> *> tls_data(
+        [&]() { return new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures); });
 
     SafeStatus safeStat;
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.ProcessBlocks);
         /* Compute partial results for each TLS buffer */
-        daal::threader_for(numRowsBlocks, numRowsBlocks, [&](int iBlock) {
-            struct tls_moments_data_t<algorithmFPType, cpu> * _td = tls_data.local();
+        tls_data.parallel_for(numRowsBlocks, [&](int iBlock, tls_moments_data_t<algorithmFPType, cpu> * _td) {
             if (_td->malloc_errors)
             {
                 return;
@@ -336,7 +336,7 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
 
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.MergeBlocks);
-        /* Merge results by TLS buffers */
+        /* Merge results by TLS buffers in the order of the slots, which is fixed in the deterministic mode */
         tls_data.reduce([&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
             if (_td->malloc_errors)
             {
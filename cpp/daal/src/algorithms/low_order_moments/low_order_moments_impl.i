@@ -503,7 +503,7 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
 
     /* TLS data initialization */
     SafeStatus safeStat;
-    daal::tls<TslData *> tslData([nFeatures, &safeStat]() {
+    daal::dynamic_reduction_tls<TslData *> tslData([nFeatures, &safeStat]() {
         auto tlsData = TslData::create(nFeatures);
         if (!tlsData)
         {
@@ -512,8 +512,7 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
         return tlsData;
     });
 
-    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
-        struct TslData * localTslData = tslData.local();
+    tslData.parallel_for(nBlocks, [&](int iBlock, TslData * localTslData) {
         if (!localTslData)
         {
             return;
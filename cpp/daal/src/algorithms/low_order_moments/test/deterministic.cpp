@@ -0,0 +1,150 @@
+/* file: deterministic.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that the low order moments computed in the deterministic reduction mode are bitwise the same for any number of threads
+//--
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/moments/low_order_moments_batch.h"
+#include "algorithms/moments/low_order_moments_online.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/env_detect.h"
+
+namespace daal::algorithms::low_order_moments::test
+{
+using namespace daal::data_management;
+
+typedef std::vector<std::vector<std::uint64_t> > Moments;
+
+class LowOrderMomentsDeterministicTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows = 30011;
+    static constexpr size_t nCols = 29;
+
+    LowOrderMomentsDeterministicTest() : _data(nRows * nCols)
+    {
+        std::mt19937 rng(777);
+        std::normal_distribution<double> normal(-2.0, 5.0);
+        for (auto & value : _data) value = normal(rng);
+    }
+
+    void SetUp() override
+    {
+        _nThreads = services::Environment::getInstance()->getNumberOfThreads();
+        services::Environment::getInstance()->enableDeterministicReductions(true);
+    }
+
+    void TearDown() override
+    {
+        services::Environment::getInstance()->enableDeterministicReductions(false);
+        services::Environment::getInstance()->setNumberOfThreads(_nThreads);
+    }
+
+    NumericTablePtr data(size_t iFirstRow, size_t nRowsInTable)
+    {
+        return HomogenNumericTable<double>::create(_data.data() + iFirstRow * nCols, nCols, nRowsInTable);
+    }
+
+    static Moments bits(const ResultPtr & result, const std::vector<ResultId> & ids)
+    {
+        Moments moments;
+        for (ResultId id : ids)
+        {
+            const NumericTablePtr table = result->get(id);
+            BlockDescriptor<double> block;
+            table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+            std::vector<std::uint64_t> values(table->getNumberOfRows() * table->getNumberOfColumns());
+            std::memcpy(values.data(), block.getBlockPtr(), values.size() * sizeof(double));
+            table->releaseBlockOfRows(block);
+            moments.push_back(values);
+        }
+        return moments;
+    }
+
+    static std::vector<ResultId> allResults()
+    {
+        std::vector<ResultId> ids;
+        for (int id = 0; id <= lastResultId; ++id) ids.push_back(ResultId(id));
+        return ids;
+    }
+
+    /* Computes the moments with 1 thread and checks that they are the same with more threads */
+    template <typename Compute>
+    void checkIsReproducible(const Compute & compute)
+    {
+        services::Environment::getInstance()->setNumberOfThreads(1);
+        const Moments expected = compute();
+        for (size_t nThreads : { size_t(2), size_t(3), _nThreads > 3 ? _nThreads : size_t(4) })
+        {
+            services::Environment::getInstance()->setNumberOfThreads(nThreads);
+            EXPECT_EQ(expected, compute()) << "nThreads = " << nThreads;
+        }
+    }
+
+private:
+    std::vector<double> _data;
+    size_t _nThreads = 1;
+};
+
+TEST_F(LowOrderMomentsDeterministicTest, Batch)
+{
+    checkIsReproducible([&]() {
+        Batch<double, defaultDense> algorithm;
+        algorithm.input.set(low_order_moments::data, data(0, nRows));
+        EXPECT_TRUE(algorithm.compute().ok());
+        return bits(algorithm.getResult(), allResults());
+    });
+}
+
+/* The rows are split into the blocks of the online mode unevenly */
+TEST_F(LowOrderMomentsDeterministicTest, Online)
+{
+    checkIsReproducible([&]() {
+        Online<double, defaultDense> algorithm;
+        const size_t blockStarts[] = { 0, 9000, 9017, nRows };
+        for (size_t i = 0; i + 1 < sizeof(blockStarts) / sizeof(blockStarts[0]); ++i)
+        {
+            algorithm.input.set(low_order_moments::data, data(blockStarts[i], blockStarts[i + 1] - blockStarts[i]));
+            EXPECT_TRUE(algorithm.compute().ok());
+        }
+        EXPECT_TRUE(algorithm.finalizeCompute().ok());
+        return bits(algorithm.getResult(), allResults());
+    });
+}
+
+/* The other moments of the single-pass method are computed by the library of the vector statistics */
+TEST_F(LowOrderMomentsDeterministicTest, MinMaxAndSumOfSquares)
+{
+    checkIsReproducible([&]() {
+        Batch<double, singlePassDense> algorithm;
+        algorithm.input.set(low_order_moments::data, data(0, nRows));
+        EXPECT_TRUE(algorithm.compute().ok());
+        return bits(algorithm.getResult(), { minimum, maximum, sumSquares });
+    });
+}
+
+} // namespace daal::algorithms::low_order_moments::test
@@ -21,6 +21,7 @@
 //--
 */
 #include "src/externals/service_math.h"
+#include "src/services/service_data_utils.h"
 
 namespace daal
 {
@@ -64,6 +65,322 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/**
+ *  Gathers the rows of the CSR table selected by the batch indices into compact one-based CSR arrays
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status getXYCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT,
+                          TArrayScalable<algorithmFPType, cpu> & aValues, TArrayScalable<size_t, cpu> & aCols, TArrayScalable<size_t, cpu> & aRows,
+                          algorithmFPType * aY, size_t nRows, size_t n)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(getXYCSR);
+    DAAL_ASSERT(indNT != nullptr);
+    DAAL_ASSERT(dataNT != nullptr);
+    DAAL_ASSERT(dependentVariablesNT != nullptr);
+    DAAL_ASSERT(aY != nullptr);
+
+    ReadRows<int, cpu> rInd(*const_cast<NumericTable *>(indNT), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rInd);
+    const int * ind = rInd.get();
+
+    ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+
+    if (aRows.size() < n + 1)
+    {
+        aRows.reset(n + 1);
+        DAAL_CHECK_MALLOC(aRows.get());
+    }
+    size_t * const rows = aRows.get();
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT);
+    rows[0] = 1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.set(dataNT, ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        rows[i + 1] = rows[i] + (xr.rows()[1] - xr.rows()[0]);
+    }
+
+    const size_t nNonZeros = rows[n] - 1;
+    if (aValues.size() < nNonZeros)
+    {
+        aValues.reset(nNonZeros);
+        aCols.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(aValues.get() && aCols.get());
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.set(dataNT, ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        const size_t nNonZerosInRow = rows[i + 1] - rows[i];
+        services::internal::tmemcpy<algorithmFPType, cpu>(aValues.get() + rows[i] - 1, xr.values(), nNonZerosInRow);
+        services::internal::tmemcpy<size_t, cpu>(aCols.get() + rows[i] - 1, xr.cols(), nNonZerosInRow);
+        aY[i] = yr.get()[ind[i]];
+    }
+    return services::Status();
+}
+
+/**
+ *  Computes xb = X * beta for a block of rows in one-based CSR format.
+ *  beta holds nClasses vectors of nCols + 1 coefficients each, the intercept goes first.
+ *  xb is a row-major nRows x nClasses matrix
+ */
+template <typename algorithmFPType, CpuType cpu>
+void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rows, size_t nRows, size_t nClasses, size_t nCols,
+                  const algorithmFPType * beta, algorithmFPType * xb, bool bIntercept)
+{
+    const size_t nBetaPerClass = nCols + 1;
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        const algorithmFPType * const b = beta + iClass * nBetaPerClass;
+        const algorithmFPType b0        = bIntercept ? b[0] : algorithmFPType(0);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            algorithmFPType sum = b0;
+            for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+            {
+                sum += values[k] * b[cols[k]];
+            }
+            xb[i * nClasses + iClass] = sum;
+        }
+    }
+}
+
+/**
+ *  Gradient g += X^T * coeff accumulated over the non-zero elements of the blocks of rows in one-based CSR format.
+ *  g has the same layout as beta in applyBetaCSR, intercept positions are not touched, coeff is a row-major nRows x nClasses matrix.
+ *
+ *  The contributions of a block are sorted by the coordinates of the gradient and summed up, so every block keeps
+ *  only the coordinates it touches instead of a dense copy of the gradient. The blocks are added to the gradient
+ *  in their order in parallel by the ranges of the coordinates, so only the touched coordinates are read and
+ *  the result does not depend on the number of threads.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SparseGradientCSR
+{
+public:
+    /* The number of blocks of rows that are accumulated before they are added to the gradient */
+    static size_t getMaxBlockCount() { return 4 * daal::threader_get_threads_number(); }
+
+    SparseGradientCSR(size_t nBlocks)
+        : _nBlocks(nBlocks),
+          _indices(nBlocks),
+          _values(nBlocks),
+          _sizes(nBlocks),
+          _scratch([]() -> Scratch * { return new Scratch(); })
+    {
+        for (size_t i = 0; i < _nBlocks; ++i)
+        {
+            _indices[i] = nullptr;
+            _values[i]  = nullptr;
+            _sizes[i]   = 0;
+        }
+    }
+
+    ~SparseGradientCSR()
+    {
+        release();
+        _scratch.reduce([](Scratch * scratch) -> void { delete scratch; });
+    }
+
+    bool isValid() const { return (_nBlocks == 0) || (_indices.get() && _values.get() && _sizes.get()); }
+
+    /* Computes the contributions of the block of rows; the blocks with different indices can be added in parallel */
+    services::Status add(size_t iBlock, const algorithmFPType * values, const size_t * cols, const size_t * rows, size_t nRows, size_t nClasses,
+                         size_t nCols, const algorithmFPType * coeff)
+    {
+        DAAL_ASSERT(iBlock < _nBlocks);
+        DAAL_ASSERT(_indices[iBlock] == nullptr);
+        const size_t nBetaPerClass = nCols + 1;
+        DAAL_CHECK(nClasses * nBetaPerClass <= size_t(services::internal::MaxVal<int>::get()), services::ErrorIncorrectNumberOfFeatures);
+
+        Scratch * const scratch = _scratch.local();
+        const size_t nNonZeros  = (rows[nRows] - rows[0]) * nClasses;
+        DAAL_CHECK_MALLOC(scratch && scratch->reserve(nNonZeros));
+        Coordinate * const pairs         = scratch->pairs.get();
+        algorithmFPType * const contribs = scratch->contribs.get();
+
+        size_t n = 0;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t iClass = 0; iClass < nClasses; ++iClass)
+            {
+                const algorithmFPType c = coeff[i * nClasses + iClass];
+                if (c == algorithmFPType(0)) continue;
+                const int offset = int(iClass * nBetaPerClass);
+                for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+                {
+                    pairs[n].key  = offset + int(cols[k]);
+                    pairs[n].val  = n;
+                    contribs[n++] = c * values[k];
+                }
+            }
+        }
+        if (n == 0) return services::Status();
+
+        /* The sort is stable, so the contributions to a coordinate are summed up in the order of the rows */
+        daal::parallel_radix_sort(pairs, pairs + n, scratch->buffer.get());
+
+        size_t nUnique = 1;
+        for (size_t k = 1; k < n; ++k)
+        {
+            nUnique += (pairs[k].key != pairs[k - 1].key);
+        }
+
+        int * const indices              = services::internal::service_scalable_malloc<int, cpu>(nUnique);
+        algorithmFPType * const gradient = services::internal::service_scalable_malloc<algorithmFPType, cpu>(nUnique);
+        if (!indices || !gradient)
+        {
+            services::internal::service_scalable_free<int, cpu>(indices);
+            services::internal::service_scalable_free<algorithmFPType, cpu>(gradient);
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        size_t j    = 0;
+        indices[0]  = pairs[0].key;
+        gradient[0] = contribs[pairs[0].val];
+        for (size_t k = 1; k < n; ++k)
+        {
+            if (pairs[k].key != indices[j])
+            {
+                ++j;
+                indices[j]  = pairs[k].key;
+                gradient[j] = 0;
+            }
+            gradient[j] += contribs[pairs[k].val];
+        }
+
+        _indices[iBlock] = indices;
+        _values[iBlock]  = gradient;
+        _sizes[iBlock]   = nUnique;
+        return services::Status();
+    }
+
+    /* Adds the contributions of the first nBlocks blocks to the gradient g of gradientSize elements and resets the blocks */
+    void reduce(size_t nBlocks, algorithmFPType * g, size_t gradientSize)
+    {
+        DAAL_ASSERT(nBlocks <= _nBlocks);
+        const size_t minRangeSize = 4096;
+        const size_t maxRanges    = 4 * daal::threader_get_threads_number();
+        size_t rangeSize          = gradientSize / maxRanges + !!(gradientSize % maxRanges);
+        if (rangeSize < minRangeSize) rangeSize = minRangeSize;
+        const size_t nRanges = gradientSize / rangeSize + !!(gradientSize % rangeSize);
+
+        daal::threader_for(nRanges, nRanges, [&](size_t iRange) {
+            const int first = int(iRange * rangeSize);
+            const int last  = int((iRange + 1 == nRanges) ? gradientSize : (iRange + 1) * rangeSize);
+            for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                const int * const indices              = _indices[iBlock];
+                const algorithmFPType * const gradient = _values[iBlock];
+                const size_t size                      = _sizes[iBlock];
+
+                /* Lower bound of the range in the sorted coordinates of the block */
+                size_t begin = 0;
+                size_t end   = size;
+                while (begin < end)
+                {
+                    const size_t middle = begin + (end - begin) / 2;
+                    if (indices[middle] < first)
+                    {
+                        begin = middle + 1;
+                    }
+                    else
+                    {
+                        end = middle;
+                    }
+                }
+                for (size_t k = begin; k < size && indices[k] < last; ++k)
+                {
+                    g[indices[k]] += gradient[k];
+                }
+            }
+        });
+        release();
+    }
+
+private:
+    typedef daal::KeyValType<int, size_t> Coordinate;
+
+    struct Scratch
+    {
+        DAAL_NEW_DELETE();
+
+        bool reserve(size_t n)
+        {
+            if (pairs.size() >= n) return true;
+            pairs.reset(n);
+            buffer.reset(n);
+            contribs.reset(n);
+            return pairs.get() && buffer.get() && contribs.get();
+        }
+
+        TArrayScalable<Coordinate, cpu> pairs;
+        TArrayScalable<Coordinate, cpu> buffer;
+        TArrayScalable<algorithmFPType, cpu> contribs;
+    };
+
+    void release()
+    {
+        for (size_t i = 0; i < _nBlocks; ++i)
+        {
+            services::internal::service_scalable_free<int, cpu>(_indices[i]);
+            services::internal::service_scalable_free<algorithmFPType, cpu>(_values[i]);
+            _indices[i] = nullptr;
+            _values[i]  = nullptr;
+            _sizes[i]   = 0;
+        }
+    }
+
+    size_t _nBlocks;
+    TArray<int *, cpu> _indices;
+    TArray<algorithmFPType *, cpu> _values;
+    TArray<size_t, cpu> _sizes;
+    daal::tls<Scratch *> _scratch;
+};
+
+/**
+ *  Returns the maximal squared norm of the rows of a CSR table
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status maxRowNormCSR(CSRNumericTableIface * dataNT, size_t n, algorithmFPType & maxNorm)
+{
+    const size_t blockSize = 256;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        algorithmFPType * const localMaxNorm = tlsData.local();
+        DAAL_CHECK_THR(localMaxNorm, services::ErrorMemoryAllocationFailed);
+        const size_t startRow     = iBlock * blockSize;
+        const size_t nRowsInBlock = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize) - startRow;
+
+        ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xr);
+        const algorithmFPType * const values = xr.values();
+        const size_t * const rows            = xr.rows();
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            algorithmFPType norm = 0;
+            for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+            {
+                norm += values[k] * values[k];
+            }
+            if (norm > *localMaxNorm) *localMaxNorm = norm;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS()
+
+    maxNorm = 0;
+    tlsData.reduce([&](algorithmFPType * localMaxNorm) {
+        if (maxNorm < *localMaxNorm) maxNorm = *localMaxNorm;
+    });
+    return services::Status();
+}
+
 } // namespace internal
 
 } // namespace objective_function
@@ -210,6 +210,8 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
 {
     const size_t nClasses = parameter->nClasses;
 
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT));
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
 
@@ -281,36 +283,44 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
 
         TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
         SafeStatus safeStat;
-        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
-            algorithmFPType & _maxNorm = *tlsData.local();
-            const size_t startRow      = iBlock * blockSize;
-            const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
-            algorithmFPType curentNorm = 0;
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            const algorithmFPType * const x = xr.get();
-            for (size_t i = 0; i < finishRow - startRow; i++)
-            {
-                curentNorm = 0;
-
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < p; j++)
+        if (csrData)
+        {
+            services::Status s = objective_function::internal::maxRowNormCSR<algorithmFPType, cpu>(csrData, n, globalMaxNorm);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+                algorithmFPType & _maxNorm = *tlsData.local();
+                const size_t startRow      = iBlock * blockSize;
+                const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+                algorithmFPType curentNorm = 0;
+                ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const x = xr.get();
+                for (size_t i = 0; i < finishRow - startRow; i++)
                 {
-                    curentNorm += x[i * p + j] * x[i * p + j];
+                    curentNorm = 0;
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        curentNorm += x[i * p + j] * x[i * p + j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
                 }
-                if (curentNorm > _maxNorm)
+            });
+            tlsData.reduce([&](algorithmFPType * maxNorm) {
+                if (globalMaxNorm < *maxNorm)
                 {
-                    _maxNorm = curentNorm;
+                    globalMaxNorm = *maxNorm;
                 }
-            }
-        });
-        tlsData.reduce([&](algorithmFPType * maxNorm) {
-            if (globalMaxNorm < *maxNorm)
-            {
-                globalMaxNorm = *maxNorm;
-            }
-        });
+            });
+        }
 
         algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
         algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
@@ -334,7 +344,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     if (gradientNT)
     {
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataBlocks, nBeta);
-        grads.reset(nDataBlocks * nBeta);
+        grads.reset(csrData ? nDataBlocks * nClasses : nDataBlocks * nBeta);
         DAAL_CHECK_MALLOC(grads.get());
     }
     TlsMem<algorithmFPType, cpu> tlsSoftmaxSum(nClasses);
@@ -345,113 +355,177 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
 
     if (valueNT || gradientNT || hessianNT)
     {
-        SafeStatus safeStat;
-        daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
-            const size_t iStartRow      = iBlock * nRowsInBlock;
-            const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
-
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            const algorithmFPType * const xLocal = xr.get();
-
-            ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(yr);
-            const algorithmFPType * const yLocal = yr.get();
-
-            algorithmFPType * const fPtrLocal = f.get() + iStartRow * nClasses;
-
-            //f = X*b + b0
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
-            }
-
-            //f = softmax(f)
-            algorithmFPType * softmaxSums = nullptr;
+        WriteRows<algorithmFPType, cpu> gr;
+        if (gradientNT)
+        {
+            gr.set(gradientNT, 0, nBeta);
+            DAAL_CHECK_BLOCK_STATUS(gr);
+        }
+        algorithmFPType * const g = gr.get();
+
+        /* Sparse data: the gradients of the blocks of rows keep only the coordinates touched by their non-zero elements,
+           the blocks are processed in waves and every wave is added to the gradient, the intercept terms are kept per block */
+        const bool bSparseGradient    = csrData && gradientNT;
+        const size_t nMaxBlocksInWave = objective_function::internal::SparseGradientCSR<algorithmFPType, cpu>::getMaxBlockCount();
+        const size_t nBlocksInWave    = (bSparseGradient && nMaxBlocksInWave < nDataBlocks) ? nMaxBlocksInWave : nDataBlocks;
+        objective_function::internal::SparseGradientCSR<algorithmFPType, cpu> sparseGrad(bSparseGradient ? nBlocksInWave : 0);
+        DAAL_CHECK_MALLOC(sparseGrad.isValid());
+        if (bSparseGradient)
+        {
+            services::internal::service_memset_seq<algorithmFPType, cpu>(g, algorithmFPType(0), nBeta);
+        }
 
-            if (interceptFlag && gradientNT)
-            {
-                softmaxSums = tlsSoftmaxSum.local();
-                DAAL_CHECK_THR(softmaxSums, services::ErrorMemoryAllocationFailed);
-                softmax(fPtrLocal, fPtrLocal, nRowsToProcess, nClasses, softmaxSums, yLocal);
-            }
-            else
-            {
-                softmax(fPtrLocal, fPtrLocal, nRowsToProcess, nClasses, nullptr, nullptr);
-            }
-            const algorithmFPType * const fixedSoftmaxSums = softmaxSums;
+        SafeStatus safeStat;
+        for (size_t iFirstBlock = 0; iFirstBlock < nDataBlocks; iFirstBlock += nBlocksInWave)
+        {
+            const size_t nBlocksToProcess = (nDataBlocks - iFirstBlock < nBlocksInWave) ? nDataBlocks - iFirstBlock : nBlocksInWave;
+            daal::threader_for(nBlocksToProcess, nBlocksToProcess, [&](size_t iWaveBlock) {
+                const size_t iBlock         = iFirstBlock + iWaveBlock;
+                const size_t iStartRow      = iBlock * nRowsInBlock;
+                const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+
+                ReadRows<algorithmFPType, cpu> xr;
+                ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+                if (csrData)
+                {
+                    xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
+                }
+                else
+                {
+                    xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                }
+                const algorithmFPType * const xLocal = xr.get();
 
-            if (valueNT)
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(crossEntropy.computeValueResult);
+                ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(yr);
+                const algorithmFPType * const yLocal = yr.get();
 
-                algorithmFPType * const logP = tlsLogP.local();
-                DAAL_CHECK_THR(logP, services::ErrorMemoryAllocationFailed);
-                daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess * nClasses, fPtrLocal, logP);
+                algorithmFPType * const fPtrLocal = f.get() + iStartRow * nClasses;
 
-                algorithmFPType localValue(0);
-                for (size_t i = 0; i < nRowsToProcess; ++i)
+                //f = X*b + b0
                 {
-                    const size_t label = static_cast<size_t>(yLocal[i]);
-                    localValue += logP[i * nClasses + label];
+                    DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+                    if (csrData)
+                    {
+                        objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), nRowsToProcess,
+                                                                                          nClasses, p, b, fPtrLocal, interceptFlag);
+                    }
+                    else
+                    {
+                        applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
+                    }
                 }
-                values[iBlock] = localValue;
-            }
-            if (gradientNT)
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
 
-                algorithmFPType * const g = grads.get() + iBlock * nBeta;
+                //f = softmax(f)
+                algorithmFPType * softmaxSums = nullptr;
 
-                for (size_t i = 0; i < nRowsToProcess; ++i)
+                if (interceptFlag && gradientNT)
                 {
-                    algorithmFPType * const fPtrInternal = fPtrLocal + i * nClasses;
-                    --(fPtrInternal[size_t(yLocal[i])]);
+                    softmaxSums = tlsSoftmaxSum.local();
+                    DAAL_CHECK_THR(softmaxSums, services::ErrorMemoryAllocationFailed);
+                    softmax(fPtrLocal, fPtrLocal, nRowsToProcess, nClasses, softmaxSums, yLocal);
                 }
-
-                const char trans           = 'T';
-                const char notrans         = 'N';
-                const algorithmFPType one  = 1.0;
-                const algorithmFPType zero = 0.0;
-                DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT m = static_cast<algorithmFPType>(p);
-                DAAL_ASSERT(nClasses <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT n = static_cast<DAAL_INT>(nClasses);
-                DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT k   = static_cast<DAAL_INT>(nRowsToProcess);
-                const DAAL_INT lda = m;
-                const DAAL_INT ldb = n;
-                DAAL_ASSERT((m + 1) <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT ldc = m + 1;
-
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, xLocal, &lda, fPtrLocal, &ldb, &zero, g + 1,
-                                                                   &ldc);
-
-                if (interceptFlag)
+                else
                 {
-                    for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
-                    {
-                        g[indexClass * nBetaPerClass] = fixedSoftmaxSums[indexClass];
-                    }
+                    softmax(fPtrLocal, fPtrLocal, nRowsToProcess, nClasses, nullptr, nullptr);
                 }
-                else
+                const algorithmFPType * const fixedSoftmaxSums = softmaxSums;
+
+                if (valueNT)
                 {
-                    for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
+                    DAAL_ITTNOTIFY_SCOPED_TASK(crossEntropy.computeValueResult);
+
+                    algorithmFPType * const logP = tlsLogP.local();
+                    DAAL_CHECK_THR(logP, services::ErrorMemoryAllocationFailed);
+                    daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess * nClasses, fPtrLocal, logP);
+
+                    algorithmFPType localValue(0);
+                    for (size_t i = 0; i < nRowsToProcess; ++i)
                     {
-                        g[indexClass * nBetaPerClass] = static_cast<algorithmFPType>(0.0);
+                        const size_t label = static_cast<size_t>(yLocal[i]);
+                        localValue += logP[i * nClasses + label];
                     }
+                    values[iBlock] = localValue;
                 }
-
-                if (hessianNT)
+                if (gradientNT)
                 {
+                    DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+
                     for (size_t i = 0; i < nRowsToProcess; ++i)
                     {
                         algorithmFPType * const fPtrInternal = fPtrLocal + i * nClasses;
-                        ++(fPtrInternal[size_t(yLocal[i])]);
+                        --(fPtrInternal[size_t(yLocal[i])]);
+                    }
+
+                    if (csrData)
+                    {
+                        const services::Status blockStatus =
+                            sparseGrad.add(iWaveBlock, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), nRowsToProcess, nClasses, p, fPtrLocal);
+                        DAAL_CHECK_STATUS_THR(blockStatus);
+
+                        algorithmFPType * const interceptG = grads.get() + iBlock * nClasses;
+                        for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
+                        {
+                            interceptG[indexClass] = interceptFlag ? fixedSoftmaxSums[indexClass] : static_cast<algorithmFPType>(0.0);
+                        }
+                    }
+                    else
+                    {
+                        algorithmFPType * const g = grads.get() + iBlock * nBeta;
+
+                        const char trans           = 'T';
+                        const char notrans         = 'N';
+                        const algorithmFPType one  = 1.0;
+                        const algorithmFPType zero = 0.0;
+                        DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
+                        const DAAL_INT m = static_cast<algorithmFPType>(p);
+                        DAAL_ASSERT(nClasses <= services::internal::MaxVal<DAAL_INT>::get());
+                        const DAAL_INT n = static_cast<DAAL_INT>(nClasses);
+                        DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
+                        const DAAL_INT k   = static_cast<DAAL_INT>(nRowsToProcess);
+                        const DAAL_INT lda = m;
+                        const DAAL_INT ldb = n;
+                        DAAL_ASSERT((m + 1) <= services::internal::MaxVal<DAAL_INT>::get());
+                        const DAAL_INT ldc = m + 1;
+
+                        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, xLocal, &lda, fPtrLocal, &ldb, &zero,
+                                                                           g + 1, &ldc);
+
+                        if (interceptFlag)
+                        {
+                            for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
+                            {
+                                g[indexClass * nBetaPerClass] = fixedSoftmaxSums[indexClass];
+                            }
+                        }
+                        else
+                        {
+                            for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
+                            {
+                                g[indexClass * nBetaPerClass] = static_cast<algorithmFPType>(0.0);
+                            }
+                        }
+                    }
+
+                    if (hessianNT)
+                    {
+                        for (size_t i = 0; i < nRowsToProcess; ++i)
+                        {
+                            algorithmFPType * const fPtrInternal = fPtrLocal + i * nClasses;
+                            ++(fPtrInternal[size_t(yLocal[i])]);
+                        }
                     }
                 }
+            });
+            DAAL_CHECK_SAFE_STATUS();
+
+            if (bSparseGradient)
+            {
+                sparseGrad.reduce(nBlocksToProcess, g, nBeta);
             }
-        });
+        }
 
         if (valueNT)
         {
@@ -502,18 +576,28 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         if (gradientNT)
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
-            WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
-            DAAL_CHECK_BLOCK_STATUS(gr);
-            algorithmFPType * const g              = gr.get();
             const algorithmFPType * const gradsPtr = grads.get();
 
-            int result = services::internal::daal_memcpy_s(g, nBeta * sizeof(algorithmFPType), gradsPtr, nBeta * sizeof(algorithmFPType));
-            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
-            for (size_t indexBlock = 1; indexBlock < nDataBlocks; ++indexBlock)
+            if (csrData)
             {
-                for (size_t i = 0; i < nBeta; ++i)
+                for (size_t indexBlock = 0; indexBlock < nDataBlocks; ++indexBlock)
                 {
-                    g[i] += gradsPtr[indexBlock * nBeta + i];
+                    for (size_t indexClass = 0; indexClass < nClasses; ++indexClass)
+                    {
+                        g[indexClass * nBetaPerClass] += gradsPtr[indexBlock * nClasses + indexClass];
+                    }
+                }
+            }
+            else
+            {
+                int result = services::internal::daal_memcpy_s(g, nBeta * sizeof(algorithmFPType), gradsPtr, nBeta * sizeof(algorithmFPType));
+                DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+                for (size_t indexBlock = 1; indexBlock < nDataBlocks; ++indexBlock)
+                {
+                    for (size_t i = 0; i < nBeta; ++i)
+                    {
+                        g[i] += gradsPtr[indexBlock * nBeta + i];
+                    }
                 }
             }
 
@@ -589,7 +673,27 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
     const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
-    const size_t p = dataNT->getNumberOfColumns();
+    const size_t p                       = dataNT->getNumberOfColumns();
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (ntInd && csrData)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        if (_aY.size() < n)
+        {
+            _aY.reset(n);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+
+        s = objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aXValues, _aXCols, _aXRows,
+                                                                          _aY.get(), nRows, n);
+        DAAL_CHECK_STATUS_VAR(s);
+        auto internalDataNT = CSRNumericTable::create(_aXValues.get(), _aXCols.get(), _aXRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+        return doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), nRows, n, p, betaNT, valueNT, hessianNT, gradientNT,
+                         nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
@@ -67,6 +67,9 @@ protected:
 private:
     TArrayScalable<algorithmFPType, cpu> _aX;
     TArrayScalable<algorithmFPType, cpu> _aY;
+    TArrayScalable<algorithmFPType, cpu> _aXValues;
+    TArrayScalable<size_t, cpu> _aXCols;
+    TArrayScalable<size_t, cpu> _aXRows;
 };
 
 } // namespace internal
@@ -131,6 +131,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
 {
     SafeStatus safeStat;
     const size_t nBeta = p + 1;
+
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT));
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
 
@@ -197,33 +199,41 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
 
         TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
 
-        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
-            algorithmFPType & _maxNorm = *tlsData.local();
-            const size_t startRow      = iBlock * blockSize;
-            const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            const algorithmFPType * const x = xr.get();
-            algorithmFPType curentNorm      = 0;
-            for (size_t i = 0; i < finishRow - startRow; i++)
-            {
-                curentNorm = 0;
-                for (size_t j = 0; j < p; j++)
+        if (csrData)
+        {
+            services::Status s = objective_function::internal::maxRowNormCSR<algorithmFPType, cpu>(csrData, n, globalMaxNorm);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+                algorithmFPType & _maxNorm = *tlsData.local();
+                const size_t startRow      = iBlock * blockSize;
+                const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+                ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const x = xr.get();
+                algorithmFPType curentNorm      = 0;
+                for (size_t i = 0; i < finishRow - startRow; i++)
                 {
-                    curentNorm += x[i * p + j] * x[i * p + j];
+                    curentNorm = 0;
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        curentNorm += x[i * p + j] * x[i * p + j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
                 }
-                if (curentNorm > _maxNorm)
+            });
+            tlsData.reduce([&](algorithmFPType * maxNorm) {
+                if (globalMaxNorm < *maxNorm)
                 {
-                    _maxNorm = curentNorm;
+                    globalMaxNorm = *maxNorm;
                 }
-            }
-        });
-        tlsData.reduce([&](algorithmFPType * maxNorm) {
-            if (globalMaxNorm < *maxNorm)
-            {
-                globalMaxNorm = *maxNorm;
-            }
-        });
+            });
+        }
 
         algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
         algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
@@ -293,7 +303,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             DAAL_CHECK_MALLOC(values.get());
         }
         TArrayScalable<algorithmFPType, cpu> grads;
-        if (gradientNT)
+        if (gradientNT && !csrData)
         {
             DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataBlocks, p);
             grads.reset(nDataBlocks * p);
@@ -307,101 +317,169 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             DAAL_CHECK_MALLOC(interceptGrad.get());
         }
 
-        daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
-            const size_t iStartRow      = iBlock * nRowsInBlock;
-            const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
-
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
-            ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(yr);
-            const algorithmFPType * const xLocal = xr.get();
-            const algorithmFPType * const yLocal = yr.get();
-
-            algorithmFPType * const fPtrLocal  = fPtr + iStartRow;
-            algorithmFPType * const sgPtrLocal = sgPtr + iStartRow;
-
-            //f = X*b + b0
+        algorithmFPType * g = nullptr;
+        HomogenNumericTable<algorithmFPType> * const hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientNT);
+        WriteRows<algorithmFPType, cpu> gr;
+        if (gradientNT)
+        {
+            DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+            if (hmgGrad)
             {
-                DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                g = hmgGrad->getArray();
             }
-
+            else
             {
-                DAAL_ITTNOTIFY_SCOPED_TASK(sigmoids);
-                //s = exp(-f)
-                vexp<algorithmFPType, cpu>(fPtrLocal, sgPtrLocal, nRowsToProcess);
-
-                //s = sigm(f), s1 = 1 - s
-                sigmoids<algorithmFPType, cpu>(sgPtrLocal, nRowsToProcess, n);
+                gr.set(gradientNT, 0, nBeta);
+                DAAL_CHECK_BLOCK_STATUS(gr);
+                g = gr.get();
             }
+        }
 
-            if (valueNT)
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(logLoss.computeValueResult);
-                algorithmFPType * const ls = tlsData.local();
-                DAAL_CHECK_THR(ls, services::ErrorMemoryAllocationFailed);
-                algorithmFPType * const ls1 = ls + nRowsInBlock;
-
-                daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sgPtrLocal, ls);
-                daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sgPtrLocal + n, ls1);
-
-                algorithmFPType localValue(0);
+        /* Sparse data: the gradients of the blocks of rows keep only the coordinates touched by their non-zero elements,
+           the blocks are processed in waves and every wave is added to the gradient */
+        const bool bSparseGradient    = csrData && gradientNT;
+        const size_t nMaxBlocksInWave = objective_function::internal::SparseGradientCSR<algorithmFPType, cpu>::getMaxBlockCount();
+        const size_t nBlocksInWave    = (bSparseGradient && nMaxBlocksInWave < nDataBlocks) ? nMaxBlocksInWave : nDataBlocks;
+        objective_function::internal::SparseGradientCSR<algorithmFPType, cpu> sparseGrad(bSparseGradient ? nBlocksInWave : 0);
+        DAAL_CHECK_MALLOC(sparseGrad.isValid());
+        if (bSparseGradient)
+        {
+            services::internal::service_memset_seq<algorithmFPType, cpu>(g + 1, algorithmFPType(0), p);
+        }
 
-                for (size_t i = 0; i < nRowsToProcess; ++i)
+        for (size_t iFirstBlock = 0; iFirstBlock < nDataBlocks; iFirstBlock += nBlocksInWave)
+        {
+            const size_t nBlocksToProcess = (nDataBlocks - iFirstBlock < nBlocksInWave) ? nDataBlocks - iFirstBlock : nBlocksInWave;
+            daal::threader_for(nBlocksToProcess, nBlocksToProcess, [&](size_t iWaveBlock) {
+                const size_t iBlock         = iFirstBlock + iWaveBlock;
+                const size_t iStartRow      = iBlock * nRowsInBlock;
+                const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+
+                ReadRows<algorithmFPType, cpu> xr;
+                ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+                if (csrData)
                 {
-                    localValue += yLocal[i] * ls[i] + (static_cast<algorithmFPType>(1) - yLocal[i]) * ls1[i];
+                    xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
                 }
-                localValue *= -div;
+                else
+                {
+                    xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                }
+                ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(yr);
+                const algorithmFPType * const xLocal = xr.get();
+                const algorithmFPType * const yLocal = yr.get();
 
-                values[iBlock] = localValue;
-            }
+                algorithmFPType * const fPtrLocal  = fPtr + iStartRow;
+                algorithmFPType * const sgPtrLocal = sgPtr + iStartRow;
 
-            if (gradientNT)
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
-                DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
-
-                const char notrans         = 'N';
-                const algorithmFPType one  = 1.0;
-                const algorithmFPType zero = 0.0;
-                const DAAL_INT yDim        = 1;
-                DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT dim = static_cast<DAAL_INT>(p);
-                DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT nN          = static_cast<DAAL_INT>(nRowsToProcess);
-                algorithmFPType * const pg = grads.get() + iBlock * p;
-
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < nRowsToProcess; ++i)
+                //f = X*b + b0
                 {
-                    sgPtrLocal[i] -= yLocal[i];
+                    DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+                    if (csrData)
+                    {
+                        objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), nRowsToProcess, 1,
+                                                                                          p, b, fPtrLocal, parameter->interceptFlag);
+                    }
+                    else
+                    {
+                        applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                    }
                 }
 
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, xLocal, &dim, sgPtrLocal, &nN, &zero,
-                                                                   pg, &dim);
+                {
+                    DAAL_ITTNOTIFY_SCOPED_TASK(sigmoids);
+                    //s = exp(-f)
+                    vexp<algorithmFPType, cpu>(fPtrLocal, sgPtrLocal, nRowsToProcess);
+
+                    //s = sigm(f), s1 = 1 - s
+                    sigmoids<algorithmFPType, cpu>(sgPtrLocal, nRowsToProcess, n);
+                }
 
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < nRowsToProcess; ++i)
+                if (valueNT)
                 {
-                    sgPtrLocal[i] += yLocal[i];
+                    DAAL_ITTNOTIFY_SCOPED_TASK(logLoss.computeValueResult);
+                    algorithmFPType * const ls = tlsData.local();
+                    DAAL_CHECK_THR(ls, services::ErrorMemoryAllocationFailed);
+                    algorithmFPType * const ls1 = ls + nRowsInBlock;
+
+                    daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sgPtrLocal, ls);
+                    daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess, sgPtrLocal + n, ls1);
+
+                    algorithmFPType localValue(0);
+
+                    for (size_t i = 0; i < nRowsToProcess; ++i)
+                    {
+                        localValue += yLocal[i] * ls[i] + (static_cast<algorithmFPType>(1) - yLocal[i]) * ls1[i];
+                    }
+                    localValue *= -div;
+
+                    values[iBlock] = localValue;
                 }
 
-                if (parameter->interceptFlag)
+                if (gradientNT)
                 {
-                    algorithmFPType interceptGradLocal(0);
+                    DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+                    DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+
+                    const char notrans         = 'N';
+                    const algorithmFPType one  = 1.0;
+                    const algorithmFPType zero = 0.0;
+                    const DAAL_INT yDim        = 1;
+                    DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
+                    const DAAL_INT dim = static_cast<DAAL_INT>(p);
+                    DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
+                    const DAAL_INT nN = static_cast<DAAL_INT>(nRowsToProcess);
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < nRowsToProcess; ++i)
+                    {
+                        sgPtrLocal[i] -= yLocal[i];
+                    }
+
+                    if (csrData)
+                    {
+                        const services::Status blockStatus =
+                            sparseGrad.add(iWaveBlock, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), nRowsToProcess, 1, p, sgPtrLocal);
+                        DAAL_CHECK_STATUS_THR(blockStatus);
+                    }
+                    else
+                    {
+                        algorithmFPType * const pg = grads.get() + iBlock * p;
+                        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, xLocal, &dim, sgPtrLocal, &nN,
+                                                                           &zero, pg, &dim);
+                    }
 
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
                     for (size_t i = 0; i < nRowsToProcess; ++i)
                     {
-                        interceptGradLocal += (sgPtrLocal[i] - yLocal[i]);
+                        sgPtrLocal[i] += yLocal[i];
                     }
 
-                    interceptGrad[iBlock] = interceptGradLocal;
+                    if (parameter->interceptFlag)
+                    {
+                        algorithmFPType interceptGradLocal(0);
+
+                        for (size_t i = 0; i < nRowsToProcess; ++i)
+                        {
+                            interceptGradLocal += (sgPtrLocal[i] - yLocal[i]);
+                        }
+
+                        interceptGrad[iBlock] = interceptGradLocal;
+                    }
                 }
+            });
+            DAAL_CHECK_SAFE_STATUS();
+
+            if (bSparseGradient)
+            {
+                sparseGrad.reduce(nBlocksToProcess, g, nBeta);
             }
-        });
+        }
 
         if (valueNT)
         {
@@ -444,31 +522,20 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
         if (gradientNT)
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
-            algorithmFPType * g;
-            HomogenNumericTable<algorithmFPType> * const hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientNT);
-            WriteRows<algorithmFPType, cpu> gr;
-            if (hmgGrad)
-            {
-                g = hmgGrad->getArray();
-            }
-            else
-            {
-                gr.set(gradientNT, 0, nBeta);
-                DAAL_CHECK_BLOCK_STATUS(gr);
-                g = gr.get();
-            }
-
             const algorithmFPType * const gradsPtr         = grads.get();
             const algorithmFPType * const interceptGradPtr = interceptGrad.get();
 
-            int result = services::internal::daal_memcpy_s(g + 1, p * sizeof(algorithmFPType), gradsPtr, p * sizeof(algorithmFPType));
-            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
-
-            for (size_t i = 1; i < nDataBlocks; i++)
+            if (!csrData)
             {
-                for (size_t j = 0; j < p; j++)
+                int result = services::internal::daal_memcpy_s(g + 1, p * sizeof(algorithmFPType), gradsPtr, p * sizeof(algorithmFPType));
+                DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+                for (size_t i = 1; i < nDataBlocks; i++)
                 {
-                    g[j + 1] += gradsPtr[i * p + j];
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        g[j + 1] += gradsPtr[i * p + j];
+                    }
                 }
             }
 
@@ -574,7 +641,31 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
 
-    const size_t p = dataNT->getNumberOfColumns();
+    const size_t p                       = dataNT->getNumberOfColumns();
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (ntInd && csrData)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        services::Status s;
+        if (_aY.size() < n)
+        {
+            _aY.reset(n);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(getXY);
+            s = objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aXValues, _aXCols, _aXRows,
+                                                                              _aY.get(), nRows, n);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        auto internalDataNT = CSRNumericTable::create(_aXValues.get(), _aXCols.get(), _aXRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+        return doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                         proximalProjection, lipschitzConstant, parameter);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
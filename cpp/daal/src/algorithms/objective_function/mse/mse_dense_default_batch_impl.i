@@ -21,6 +21,11 @@
 //--
 */
 #include "src/externals/service_math.h"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(mse.dense.default.batch);
+
+#include "src/algorithms/objective_function/common/objective_function_utils.i"
 
 namespace daal
 {
@@ -705,6 +710,15 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
         nBlocks += (nBlocks * blockSize != n);
         algorithmFPType globalMaxNorm = 0;
 
+        CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        if (csrData)
+        {
+            services::Status s = objective_function::internal::maxRowNormCSR<algorithmFPType, cpu>(csrData, n, globalMaxNorm);
+            DAAL_CHECK_STATUS_VAR(s);
+            c = 2 * (globalMaxNorm + 1);
+            return s;
+        }
+
         TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
             algorithmFPType & _maxNorm  = *tlsData.local();
@@ -751,14 +765,137 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
         return services::Status();
     }
 
+    /* Hessian of the sparse data is computed on the densified blocks of rows */
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
     if (parameter->batchIndices.get() != NULL && parameter->batchIndices->getNumberOfColumns() != nDataRows)
     {
         MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter,
                                                  blockSizeDefault);
-        return run(task);
+        return (csrData && !task.hessianFlag) ? runCSR(task, csrData, parameter->batchIndices.get()) : run(task);
     }
     MSETaskAll<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter, blockSizeDefault);
-    return (!result) ? run(task) : services::Status(services::ErrorMemoryCopyFailedInternal);
+    if (result) return services::Status(services::ErrorMemoryCopyFailedInternal);
+    return (csrData && !task.hessianFlag) ? runCSR(task, csrData, nullptr) : run(task);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status MSEKernel<algorithmFPType, method, cpu>::runCSR(MSETask<algorithmFPType, cpu> & task, CSRNumericTableIface * csrData,
+                                                                 const NumericTable * ntInd)
+{
+    const size_t nRows        = task.batchSize;
+    const size_t argumentSize = task.argumentSize;
+
+    const algorithmFPType * values = nullptr;
+    const size_t * cols            = nullptr;
+    const size_t * rows            = nullptr;
+    const algorithmFPType * y      = nullptr;
+
+    Status s;
+    ReadRowsCSR<algorithmFPType, cpu> xr;
+    ReadRows<algorithmFPType, cpu> yr;
+    if (ntInd)
+    {
+        if (_aY.size() < nRows)
+        {
+            _aY.reset(nRows);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+        s = objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, task.ntDependentVariables, ntInd, _aXValues, _aXCols, _aXRows,
+                                                                          _aY.get(), task.ntDependentVariables->getNumberOfRows(), nRows);
+        DAAL_CHECK_STATUS_VAR(s);
+        values = _aXValues.get();
+        cols   = _aXCols.get();
+        rows   = _aXRows.get();
+        y      = _aY.get();
+    }
+    else
+    {
+        xr.set(csrData, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        yr.set(task.ntDependentVariables, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(yr);
+        values = xr.values();
+        cols   = xr.cols();
+        rows   = xr.rows();
+        y      = yr.get();
+    }
+
+    algorithmFPType * argumentArray = nullptr;
+    s                               = task.init(argumentArray);
+    if (!s) return s;
+    algorithmFPType *value = nullptr, *gradient = nullptr, *hessian = nullptr;
+    DAAL_CHECK_STATUS(s, task.getResultValues(value, gradient, hessian));
+    task.setResultValuesToZero(value, gradient, hessian);
+
+    const bool valueFlag    = task.valueFlag;
+    const bool gradientFlag = task.gradientFlag;
+    const size_t nBlocks    = nRows / blockSizeDefault + !!(nRows % blockSizeDefault);
+
+    /* The value and the intercept term of the gradient are kept per block of rows, the gradients of the blocks keep
+       only the coordinates touched by their non-zero elements, the blocks are processed in waves and every wave
+       is added to the gradient */
+    TArrayScalable<algorithmFPType, cpu> blockValues(nBlocks);
+    TArrayScalable<algorithmFPType, cpu> blockIntercepts(nBlocks);
+    DAAL_CHECK_MALLOC(blockValues.get() && blockIntercepts.get());
+
+    const size_t nMaxBlocksInWave = objective_function::internal::SparseGradientCSR<algorithmFPType, cpu>::getMaxBlockCount();
+    const size_t nBlocksInWave    = (gradientFlag && nMaxBlocksInWave < nBlocks) ? nMaxBlocksInWave : nBlocks;
+    objective_function::internal::SparseGradientCSR<algorithmFPType, cpu> sparseGrad(gradientFlag ? nBlocksInWave : 0);
+    DAAL_CHECK_MALLOC(sparseGrad.isValid());
+    TlsMem<algorithmFPType, cpu> tlsResiduals(blockSizeDefault);
+
+    SafeStatus safeStat;
+    for (size_t iFirstBlock = 0; s && iFirstBlock < nBlocks; iFirstBlock += nBlocksInWave)
+    {
+        const size_t nBlocksToProcess = (nBlocks - iFirstBlock < nBlocksInWave) ? nBlocks - iFirstBlock : nBlocksInWave;
+        daal::threader_for(nBlocksToProcess, nBlocksToProcess, [&](const size_t iWaveBlock) {
+            algorithmFPType * const residuals = tlsResiduals.local();
+            DAAL_CHECK_THR(residuals, services::ErrorMemoryAllocationFailed);
+            const size_t iBlock   = iFirstBlock + iWaveBlock;
+            const size_t startRow = iBlock * blockSizeDefault;
+            const size_t endRow   = (iBlock + 1 == nBlocks) ? nRows : startRow + blockSizeDefault;
+
+            algorithmFPType localValue     = 0;
+            algorithmFPType localIntercept = 0;
+            for (size_t i = startRow; i < endRow; ++i)
+            {
+                algorithmFPType residual = argumentArray[0] - y[i];
+                for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+                {
+                    residual += values[k] * argumentArray[cols[k]];
+                }
+                localValue += residual * residual;
+                localIntercept += residual;
+                residuals[i - startRow] = residual;
+            }
+            blockValues[iBlock]     = localValue;
+            blockIntercepts[iBlock] = localIntercept;
+
+            if (gradientFlag)
+            {
+                const services::Status blockStatus =
+                    sparseGrad.add(iWaveBlock, values, cols, rows + startRow, endRow - startRow, 1, argumentSize - 1, residuals);
+                DAAL_CHECK_STATUS_THR(blockStatus);
+            }
+        });
+        s = safeStat.detach();
+        if (s && gradientFlag)
+        {
+            sparseGrad.reduce(nBlocksToProcess, gradient, argumentSize);
+        }
+    }
+
+    if (s)
+    {
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            if (valueFlag) value[0] += blockValues[iBlock];
+            if (gradientFlag) gradient[0] += blockIntercepts[iBlock];
+        }
+        normalizeResults(task, value, gradient, hessian);
+    }
+    task.releaseResultValues();
+    return s;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -222,6 +222,8 @@ private:
 
     Status run(MSETask<algorithmFPType, cpu> & task);
 
+    Status runCSR(MSETask<algorithmFPType, cpu> & task, CSRNumericTableIface * csrData, const NumericTable * ntInd);
+
     TArray<algorithmFPType, cpu> residual;
     TArray<algorithmFPType, cpu> gramMatrix;
     TArray<algorithmFPType, cpu> XY;
@@ -263,6 +265,11 @@ private:
 
     SOANumericTable * soaPtr;
     algorithmFPType * X;
+
+    TArrayScalable<algorithmFPType, cpu> _aXValues;
+    TArrayScalable<size_t, cpu> _aXCols;
+    TArrayScalable<size_t, cpu> _aXRows;
+    TArrayScalable<algorithmFPType, cpu> _aY;
 };
 
 } // namespace internal
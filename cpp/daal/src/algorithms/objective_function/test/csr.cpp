@@ -0,0 +1,222 @@
+/* file: csr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that the objective functions computed on CSR data match the ones computed on the same dense data
+//--
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/mse_batch.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::optimization_solver::test
+{
+using namespace daal::data_management;
+
+class SparseDataset
+{
+public:
+    SparseDataset(size_t nRows, size_t nCols, double density, std::uint32_t seed) : _nRows(nRows), _nCols(nCols), _dense(nRows * nCols, 0.0)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        _rowOffsets.push_back(1);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                if (uniform(rng) < density)
+                {
+                    const double value     = normal(rng);
+                    _dense[i * nCols + j] = value;
+                    _values.push_back(value);
+                    _colIndices.push_back(j + 1);
+                }
+            }
+            _rowOffsets.push_back(_values.size() + 1);
+        }
+    }
+
+    NumericTablePtr dense() { return HomogenNumericTable<double>::create(_dense.data(), _nCols, _nRows); }
+
+    NumericTablePtr csr()
+    {
+        return CSRNumericTablePtr(new CSRNumericTable(_values.data(), _colIndices.data(), _rowOffsets.data(), _nCols, _nRows));
+    }
+
+    size_t nRows() const { return _nRows; }
+    size_t nCols() const { return _nCols; }
+
+private:
+    size_t _nRows;
+    size_t _nCols;
+    std::vector<double> _dense;
+    std::vector<double> _values;
+    std::vector<size_t> _colIndices;
+    std::vector<size_t> _rowOffsets;
+};
+
+static NumericTablePtr makeColumn(const std::vector<double> & values)
+{
+    NumericTablePtr table = HomogenNumericTable<double>::create(1, values.size(), NumericTable::doAllocate);
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, values.size(), writeOnly, block);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        block.getBlockPtr()[i] = values[i];
+    }
+    table->releaseBlockOfRows(block);
+    return table;
+}
+
+static std::vector<double> readColumn(const NumericTablePtr & table)
+{
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + table->getNumberOfRows() * table->getNumberOfColumns());
+    table->releaseBlockOfRows(block);
+    return values;
+}
+
+static std::vector<double> randomVector(size_t n, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 0.1);
+    std::vector<double> values(n);
+    for (auto & value : values) value = normal(rng);
+    return values;
+}
+
+static NumericTablePtr makeBatchIndices(size_t nRows)
+{
+    NumericTablePtr table = HomogenNumericTable<int>::create(nRows / 2, 1, NumericTable::doAllocate);
+    BlockDescriptor<int> block;
+    table->getBlockOfRows(0, 1, writeOnly, block);
+    for (size_t i = 0; i < nRows / 2; ++i)
+    {
+        block.getBlockPtr()[i] = static_cast<int>((7 * i + 3) % nRows);
+    }
+    table->releaseBlockOfRows(block);
+    return table;
+}
+
+static void expectEqual(const std::vector<double> & expected, const std::vector<double> & actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(expected[i], actual[i], 1e-10 * (1.0 + std::fabs(expected[i]))) << "i = " << i;
+    }
+}
+
+/* Computes the value and the gradient of the function for the dense and the CSR representation of the data */
+template <typename MakeFunction>
+static void checkCSRMatchesDense(SparseDataset & dataset, bool useBatchIndices, const MakeFunction & makeFunction)
+{
+    std::vector<double> result[2][2];
+    const NumericTablePtr data[2]      = { dataset.dense(), dataset.csr() };
+    const NumericTablePtr batchIndices = useBatchIndices ? makeBatchIndices(dataset.nRows()) : NumericTablePtr();
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto function                    = makeFunction(data[i]);
+        function->parameter().resultsToCompute = objective_function::value | objective_function::gradient;
+        function->parameter().batchIndices     = batchIndices;
+
+        ASSERT_TRUE(function->compute().ok());
+        result[i][0] = readColumn(function->getResult()->get(objective_function::valueIdx));
+        result[i][1] = readColumn(function->getResult()->get(objective_function::gradientIdx));
+    }
+    expectEqual(result[0][0], result[1][0]);
+    expectEqual(result[0][1], result[1][1]);
+}
+
+class ObjectiveFunctionCSRTest : public ::testing::TestWithParam<bool>
+{
+protected:
+    ObjectiveFunctionCSRTest() : dataset(600, 1000, 0.02, 777) {}
+    SparseDataset dataset;
+};
+
+TEST_P(ObjectiveFunctionCSRTest, LogisticLoss)
+{
+    std::vector<double> labels(dataset.nRows());
+    for (size_t i = 0; i < labels.size(); ++i) labels[i] = double(i % 3 == 0);
+    const NumericTablePtr y        = makeColumn(labels);
+    const NumericTablePtr argument = makeColumn(randomVector(dataset.nCols() + 1, 1));
+
+    checkCSRMatchesDense(dataset, GetParam(), [&](const NumericTablePtr & x) {
+        services::SharedPtr<logistic_loss::Batch<double> > function(new logistic_loss::Batch<double>(dataset.nRows()));
+        function->input.set(logistic_loss::argument, argument);
+        function->input.set(logistic_loss::data, x);
+        function->input.set(logistic_loss::dependentVariables, y);
+        function->parameter().penaltyL2     = 0.3f;
+        function->parameter().interceptFlag = true;
+        return function;
+    });
+}
+
+TEST_P(ObjectiveFunctionCSRTest, CrossEntropyLoss)
+{
+    const size_t nClasses = 4;
+    std::vector<double> labels(dataset.nRows());
+    for (size_t i = 0; i < labels.size(); ++i) labels[i] = double(i % nClasses);
+    const NumericTablePtr y        = makeColumn(labels);
+    const NumericTablePtr argument = makeColumn(randomVector(nClasses * (dataset.nCols() + 1), 2));
+
+    checkCSRMatchesDense(dataset, GetParam(), [&](const NumericTablePtr & x) {
+        services::SharedPtr<cross_entropy_loss::Batch<double> > function(new cross_entropy_loss::Batch<double>(nClasses, dataset.nRows()));
+        function->input.set(cross_entropy_loss::argument, argument);
+        function->input.set(cross_entropy_loss::data, x);
+        function->input.set(cross_entropy_loss::dependentVariables, y);
+        function->parameter().penaltyL2     = 0.3f;
+        function->parameter().interceptFlag = true;
+        return function;
+    });
+}
+
+TEST_P(ObjectiveFunctionCSRTest, MSE)
+{
+    const NumericTablePtr y        = makeColumn(randomVector(dataset.nRows(), 3));
+    const NumericTablePtr argument = makeColumn(randomVector(dataset.nCols() + 1, 4));
+
+    checkCSRMatchesDense(dataset, GetParam(), [&](const NumericTablePtr & x) {
+        services::SharedPtr<mse::Batch<double> > function(new mse::Batch<double>(dataset.nRows()));
+        function->input.set(mse::argument, argument);
+        function->input.set(mse::data, x);
+        function->input.set(mse::dependentVariables, y);
+        function->parameter().penaltyL2     = HomogenNumericTable<double>::create(1, 1, NumericTable::doAllocate, 0.3);
+        function->parameter().interceptFlag = true;
+        return function;
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(AllAndBatchOfTerms, ObjectiveFunctionCSRTest, ::testing::Values(false, true));
+
+} // namespace daal::algorithms::optimization_solver::test
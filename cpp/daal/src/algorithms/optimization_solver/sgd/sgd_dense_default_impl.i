@@ -31,6 +31,7 @@
 #include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
 #include "src/threading/threading.h"
 #include "src/services/service_data_utils.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -46,6 +47,151 @@ namespace sgd
 {
 namespace internal
 {
+/**
+ *  \brief SGD iterations over the logistic loss of CSR data.
+ *         The coefficients are stored as w = scale * v, so the L2 decay of all the coefficients is one multiplication of the scale,
+ *         and an iteration touches only the non-zero elements of the selected row instead of all the coefficients
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SparseLogLossSGD
+{
+public:
+    SparseLogLossSGD(sum_of_functions::Batch & function) : _parameter(nullptr), _csrData(nullptr), _yNT(nullptr)
+    {
+        logistic_loss::Input * const input = dynamic_cast<logistic_loss::Input *>(function.sumOfFunctionsInput);
+        _parameter                         = dynamic_cast<logistic_loss::Parameter *>(function.sumOfFunctionsParameter);
+        if (input && _parameter)
+        {
+            _csrData = dynamic_cast<CSRNumericTableIface *>(input->get(logistic_loss::data).get());
+            _yNT     = input->get(logistic_loss::dependentVariables).get();
+        }
+    }
+
+    bool isApplicable() const { return _csrData && _yNT; }
+
+    services::Status init(NumericTable & minimum)
+    {
+        const size_t nTerms = _yNT->getNumberOfRows();
+        _nBeta              = minimum.getNumberOfRows();
+        _w.set(minimum, 0, _nBeta);
+        DAAL_CHECK_BLOCK_STATUS(_w);
+        _dataBD.set(_csrData, 0, nTerms, true);
+        DAAL_CHECK_BLOCK_STATUS(_dataBD);
+        _yBD.set(_yNT, 0, nTerms);
+        DAAL_CHECK_BLOCK_STATUS(_yBD);
+
+        _scale                    = algorithmFPType(1);
+        _vNorm2                   = algorithmFPType(0);
+        const algorithmFPType * v = _w.get() + 1;
+        for (size_t j = 0; j < _nBeta - 1; ++j)
+        {
+            _vNorm2 += v[j] * v[j];
+        }
+        return services::Status();
+    }
+
+    /* Returns true if the gradient at the current point is below the threshold and no step is made */
+    bool step(size_t iRow, algorithmFPType learningRate, bool bCheckAccuracy, algorithmFPType accuracyThreshold)
+    {
+        const algorithmFPType zero(0.0), one(1.0), two(2.0);
+        algorithmFPType * const w            = _w.get();
+        algorithmFPType * const v            = w + 1;
+        const algorithmFPType * const values = _dataBD.values();
+        const size_t * const cols            = _dataBD.cols();
+        const size_t rowBegin                = _dataBD.rows()[iRow] - 1;
+        const size_t rowEnd                  = _dataBD.rows()[iRow + 1] - 1;
+        const algorithmFPType l2             = _parameter->penaltyL2;
+
+        algorithmFPType xv(0);
+        for (size_t k = rowBegin; k < rowEnd; ++k)
+        {
+            xv += values[k] * v[cols[k] - 1];
+        }
+        const algorithmFPType f = (_parameter->interceptFlag ? w[0] : zero) + _scale * xv;
+
+        /* derivative of the loss in f: sigmoid(f) - y */
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        algorithmFPType expArg             = (-f < expThreshold) ? expThreshold : -f;
+        daal::internal::Math<algorithmFPType, cpu>::vExp(1, &expArg, &expArg);
+        const algorithmFPType d = one / (one + expArg) - _yBD.get()[iRow];
+
+        if (bCheckAccuracy)
+        {
+            /* |g|^2 = g_0^2 + sum over the row of (d * x_j + 2 * l2 * w_j)^2 + (2 * l2 * scale)^2 * (|v|^2 - sum over the row of v_j^2) */
+            const algorithmFPType l2Scaled = two * l2 * _scale;
+            const algorithmFPType g0       = _parameter->interceptFlag ? d : zero;
+            algorithmFPType gradientNorm2  = g0 * g0;
+            algorithmFPType rowNorm2(0);
+            for (size_t k = rowBegin; k < rowEnd; ++k)
+            {
+                const algorithmFPType vj = v[cols[k] - 1];
+                const algorithmFPType gj = d * values[k] + l2Scaled * vj;
+                gradientNorm2 += gj * gj;
+                rowNorm2 += vj * vj;
+            }
+            const algorithmFPType restNorm2 = _vNorm2 - rowNorm2;
+            gradientNorm2 += l2Scaled * l2Scaled * (restNorm2 > zero ? restNorm2 : zero);
+
+            const algorithmFPType pointNorm         = daal::internal::Math<algorithmFPType, cpu>::sSqrt(w[0] * w[0] + _scale * _scale * _vNorm2);
+            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+            if (daal::internal::Math<algorithmFPType, cpu>::sSqrt(gradientNorm2) < gradientThreshold) return true;
+        }
+
+        if (_parameter->interceptFlag) w[0] -= learningRate * d;
+
+        /* w = (1 - 2 * learningRate * l2) * w - learningRate * d * x */
+        _scale *= one - two * learningRate * l2;
+        if (_scale < minScale() && _scale > -minScale())
+        {
+            normalize();
+        }
+
+        const algorithmFPType stepScaled = learningRate * d / _scale;
+        for (size_t k = rowBegin; k < rowEnd; ++k)
+        {
+            algorithmFPType & vj       = v[cols[k] - 1];
+            const algorithmFPType vNew = vj - stepScaled * values[k];
+            _vNorm2 += vNew * vNew - vj * vj;
+            vj = vNew;
+        }
+        return false;
+    }
+
+    /* Writes the coefficients w = scale * v to the minimum */
+    void finalize()
+    {
+        normalize();
+        _w.release();
+        _dataBD.release();
+        _yBD.release();
+    }
+
+private:
+    static algorithmFPType minScale() { return algorithmFPType(1e-6); }
+
+    void normalize()
+    {
+        algorithmFPType * const v = _w.get() + 1;
+        _vNorm2                   = algorithmFPType(0);
+        for (size_t j = 0; j < _nBeta - 1; ++j)
+        {
+            v[j] *= _scale;
+            _vNorm2 += v[j] * v[j];
+        }
+        _scale = algorithmFPType(1);
+    }
+
+    logistic_loss::Parameter * _parameter;
+    CSRNumericTableIface * _csrData;
+    NumericTable * _yNT;
+    WriteRows<algorithmFPType, cpu, NumericTable> _w;
+    ReadRowsCSR<algorithmFPType, cpu> _dataBD;
+    ReadRows<algorithmFPType, cpu, NumericTable> _yBD;
+    size_t _nBeta;
+    algorithmFPType _scale;
+    algorithmFPType _vNorm2;
+};
+
 /**
  *  \brief Kernel for SGD calculation
  */
@@ -134,22 +280,45 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
         startIteration                      = lastIterationInputArray[0];
     }
 
+    /* Logistic loss on CSR data: the iterations are done without the dense gradient */
+    SparseLogLossSGD<algorithmFPType, cpu> sparseLogLoss(*function);
+    const bool bSparseLogLoss = sparseLogLoss.isApplicable();
+    if (bSparseLogLoss)
+    {
+        s = sparseLogLoss.init(*minimum);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
     services::internal::HostAppHelper host(pHost, 10);
     for (epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
     {
         const int * pValues = nullptr;
         s                   = rngTask.get(pValues);
-        if (s)
+        if (s && !bSparseLogLoss)
         {
             ntBatchIndices->setArray(const_cast<int *>(pValues), ntBatchIndices->getNumberOfRows());
             s = function->computeNoThrow();
         }
         if (!s || host.isCancelled(s, 1))
         {
+            if (bSparseLogLoss) sparseLogLoss.finalize();
             nProceededIterations[0] = nProceededIters;
             return s;
         }
 
+        if (bSparseLogLoss)
+        {
+            const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
+            if (sparseLogLoss.step(pValues[0], learningRate, nIter != 1, accuracyThreshold))
+            {
+                DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
+                nProceededIterations[0] = (int)nProceededIters;
+                break;
+            }
+            nProceededIters++;
+            continue;
+        }
+
         NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
         if (nIter != 1)
         {
@@ -189,6 +358,7 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
         if (!safeStat) s |= safeStat.detach();
         nProceededIters++;
     }
+    if (bSparseLogLoss) sparseLogLoss.finalize();
     if (lastIterationResult)
     {
         WriteRows<int, cpu, NumericTable> lastIterationResultBD(lastIterationResult, 0, 1);
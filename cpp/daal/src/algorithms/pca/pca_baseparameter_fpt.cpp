@@ -36,6 +36,7 @@ DAAL_EXPORT BaseParameter<algorithmFPType, method>::BaseParameter() {};
 
 template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, correlationDense>::BaseParameter();
 template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, svdDense>::BaseParameter();
+template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, randomizedDense>::BaseParameter();
 
 } // namespace interface1
 } // namespace pca
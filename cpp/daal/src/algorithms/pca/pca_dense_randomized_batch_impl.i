@@ -0,0 +1,158 @@
+/* file: pca_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized SVD algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "src/externals/service_blas.h"
+#include "src/externals/service_memory.h"
+#include "src/externals/service_rng.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/engines/engine_batch_impl.h"
+#include "src/algorithms/svd/svd_dense_default_impl.i"
+#include "src/algorithms/pca/pca_dense_svd_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::data_management;
+using namespace daal::internal;
+
+/* Replaces the column-major nRows x nCols matrix with the orthonormal basis of its columns */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBatchKernel<algorithmFPType, cpu>::orthonormalize(size_t nRows, size_t nCols, algorithmFPType * a, algorithmFPType * r)
+{
+    return svd::internal::compute_QR_on_one_node<algorithmFPType, cpu>((DAAL_INT)nRows, (DAAL_INT)nCols, a, (DAAL_INT)nRows, r,
+                                                                       (DAAL_INT)nCols);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBatchKernel<algorithmFPType, cpu>::decompose(const NumericTable * normalizedDataTable, const ParameterType * parameter,
+                                                                          NumericTable & eigenvalues, NumericTable & eigenvectors)
+{
+    const size_t nObservations = normalizedDataTable->getNumberOfRows();
+    const size_t nFeatures     = normalizedDataTable->getNumberOfColumns();
+    const size_t nComponents   = eigenvalues.getNumberOfColumns();
+
+    /* Sampling is useless if the subspace is as wide as the data, the exact decomposition is computed then */
+    const size_t nSamples = nComponents + parameter->oversampling;
+    if (nSamples >= nFeatures || nSamples >= nObservations)
+    {
+        return super::decompose(normalizedDataTable, eigenvalues, eigenvectors);
+    }
+
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(parameter->engine.get());
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nObservations, nSamples);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nObservations * nSamples, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nSamples);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * nSamples, sizeof(algorithmFPType));
+
+    /* Column-major bases of the sampled column space (nObservations x nSamples) and row space (nFeatures x nSamples) */
+    TArray<algorithmFPType, cpu> rangeArray(nObservations * nSamples);
+    TArray<algorithmFPType, cpu> coRangeArray(nFeatures * nSamples);
+    TArray<algorithmFPType, cpu> rArray(nSamples * nSamples);
+    TArray<algorithmFPType, cpu> sigmaArray(nSamples);
+    TArray<algorithmFPType, cpu> uArray(nFeatures * nSamples);
+    TArray<algorithmFPType, cpu> vtArray(nSamples * nSamples);
+    DAAL_CHECK_MALLOC(rangeArray.get() && coRangeArray.get() && rArray.get() && sigmaArray.get() && uArray.get() && vtArray.get());
+
+    algorithmFPType * y     = rangeArray.get();
+    algorithmFPType * z     = coRangeArray.get();
+    algorithmFPType * r     = rArray.get();
+    algorithmFPType * sigma = sigmaArray.get();
+    algorithmFPType * u     = uArray.get();
+    algorithmFPType * vt    = vtArray.get();
+
+    ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable *>(normalizedDataTable), 0, nObservations);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock);
+    const algorithmFPType * a = dataBlock.get();
+
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(nFeatures * nSamples, z, engineImpl->getState(), algorithmFPType(0), algorithmFPType(1)),
+               ErrorIncorrectErrorcodeFromGenerator);
+
+    /* Row-major data is the column-major nFeatures x nObservations matrix A^T for BLAS */
+    const DAAL_INT m(nObservations);
+    const DAAL_INT p(nFeatures);
+    const DAAL_INT l(nSamples);
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char trans   = 'T';
+    const char notrans = 'N';
+
+    services::Status status;
+
+    /* Y = A * Omega samples the column space of the data */
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &m, &l, &p, &one, a, &p, z, &p, &zero, y, &m);
+    DAAL_CHECK_STATUS(status, orthonormalize(nObservations, nSamples, y, r));
+
+    /* Power iterations, the basis is orthonormalized after every product to keep the small directions from vanishing */
+    for (size_t i = 0; i < parameter->nPowerIterations; ++i)
+    {
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &m, &one, a, &p, y, &m, &zero, z, &p);
+        DAAL_CHECK_STATUS(status, orthonormalize(nFeatures, nSamples, z, r));
+
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &m, &l, &p, &one, a, &p, z, &p, &zero, y, &m);
+        DAAL_CHECK_STATUS(status, orthonormalize(nObservations, nSamples, y, r));
+    }
+
+    /* B^T = A^T * Y projects the data onto the sampled subspace, A ~ Y * B */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &m, &one, a, &p, y, &m, &zero, z, &p);
+
+    /* B^T = U * S * W^T gives A ~ (Y * W) * S * U^T, the left singular vectors of B^T are the principal directions */
+    DAAL_CHECK_STATUS(status, (svd::internal::compute_svd_on_one_node<algorithmFPType, cpu>(p, l, z, p, sigma, u, p, vt, l)));
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    algorithmFPType * eigenvaluesArray = eigenvaluesBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+    algorithmFPType * eigenvectorsArray = eigenvectorsBlock.get();
+
+    for (size_t i = 0; i < nComponents; ++i)
+    {
+        eigenvaluesArray[i] = sigma[i];
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            eigenvectorsArray[i * nFeatures + j] = u[i * nFeatures + j];
+        }
+    }
+
+    return status;
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,63 @@
+/* file: pca_dense_randomized_batch_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA with randomized SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_H__
+#define __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_H__
+
+#include "src/algorithms/pca/pca_dense_svd_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+/*
+ * Computes the leading principal components with the randomized range finder
+ * (Halko, Martinsson, Tropp): the normalized data set is projected onto a few random
+ * directions, the sampled subspace is refined with power iterations, and the full SVD
+ * is computed only for the small projection of the data onto that subspace.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedBatchKernel : public PCASVDBatchKernel<algorithmFPType, interface3::BatchParameter<algorithmFPType, randomizedDense>, cpu>
+{
+public:
+    typedef interface3::BatchParameter<algorithmFPType, randomizedDense> ParameterType;
+    typedef PCASVDBatchKernel<algorithmFPType, ParameterType, cpu> super;
+
+    PCARandomizedBatchKernel() {}
+
+protected:
+    services::Status decompose(const NumericTable * normalizedDataTable, const ParameterType * parameter,
+                               data_management::NumericTable & eigenvalues, data_management::NumericTable & eigenvectors) DAAL_C11_OVERRIDE;
+
+    services::Status orthonormalize(size_t nRows, size_t nCols, algorithmFPType * a, algorithmFPType * r);
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -56,6 +56,13 @@ protected:
 
     services::Status decompose(const NumericTable * normalizedDataTable, data_management::NumericTable & eigenvalues,
                                data_management::NumericTable & eigenvectors);
+
+    /* Decomposition of the normalized data set used by the batch computations, the full SVD by default */
+    virtual services::Status decompose(const NumericTable * normalizedDataTable, const ParameterType * parameter,
+                                       data_management::NumericTable & eigenvalues, data_management::NumericTable & eigenvectors)
+    {
+        return decompose(normalizedDataTable, eigenvalues, eigenvectors);
+    }
 };
 
 } // namespace internal
@@ -0,0 +1,49 @@
+/* file: pca_onlineparameter_randomized_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+/** Constructs PCA parameters */
+template <typename algorithmFPType>
+DAAL_EXPORT OnlineParameter<algorithmFPType, randomizedDense>::OnlineParameter()
+{}
+
+/* The power iterations need several passes over the whole data set, the method is available in the batch mode only */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status OnlineParameter<algorithmFPType, randomizedDense>::check() const
+{
+    return services::Status(services::ErrorMethodNotSupported);
+}
+
+template DAAL_EXPORT OnlineParameter<DAAL_FPTYPE, randomizedDense>::OnlineParameter();
+template DAAL_EXPORT services::Status OnlineParameter<DAAL_FPTYPE, randomizedDense>::check() const;
+
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
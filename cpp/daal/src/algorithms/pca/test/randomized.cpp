@@ -0,0 +1,60 @@
+/* file: randomized.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks that the PCA randomized SVD method is rejected in the online and distributed modes
+//--
+*/
+
+#include "gtest/gtest.h"
+
+#include "algorithms/pca/pca_types.h"
+
+namespace daal::algorithms::pca::test
+{
+static services::ErrorID getErrorId(const services::Status & status)
+{
+    return status.getCollection()->getErrors()->at(0)->id();
+}
+
+template <typename Parameter>
+static void expectMethodNotSupported(const Parameter & parameter)
+{
+    const services::Status status = parameter.check();
+    ASSERT_FALSE(status.ok());
+    EXPECT_EQ(getErrorId(status), services::ErrorMethodNotSupported);
+}
+
+TEST(PCARandomizedTest, BatchParameterIsValid)
+{
+    EXPECT_TRUE((BatchParameter<double, randomizedDense>().check().ok()));
+}
+
+TEST(PCARandomizedTest, OnlineModeIsRejected)
+{
+    expectMethodNotSupported(OnlineParameter<float, randomizedDense>());
+    expectMethodNotSupported(OnlineParameter<double, randomizedDense>());
+}
+
+TEST(PCARandomizedTest, DistributedModeIsRejected)
+{
+    expectMethodNotSupported(DistributedParameter<step1Local, double, randomizedDense>());
+    expectMethodNotSupported(DistributedParameter<step2Master, double, randomizedDense>());
+}
+
+} // namespace daal::algorithms::pca::test
@@ -37,7 +37,8 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+Parameter::Parameter(const NumericTablePtr quantileOrders, double rankError, const engines::EnginePtr & engine)
+    : daal::algorithms::Parameter(), quantileOrders(quantileOrders), rankError(rankError), engine(engine)
 {
     Status s;
     if (quantileOrders.get() == NULL)
@@ -47,8 +48,27 @@ Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::P
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(rankError > 0 && rankError < 1, ErrorIncorrectParameter, ParameterName, rankErrorStr());
+    DAAL_CHECK(engine, ErrorIncorrectEngineParameter);
+    return Status();
+}
+
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+Status Input::getNumberOfColumns(size_t & nCols) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    nCols                     = (s ? dataTable->getNumberOfColumns() : 0);
+    return s;
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -115,20 +135,38 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  */
 Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * input         = static_cast<const Input *>(in);
+    const Input * input = static_cast<const Input *>(in);
+    return checkImpl(input->get(data)->getNumberOfColumns(), par);
+}
+
+/**
+ * Checks the correctness of the Result object in the online or distributed processing mode
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameters structure
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, par);
+}
+
+Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const
+{
     const Parameter * parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
                             | (int)NumericTableIface::lowerPackedTriangularMatrix | (int)NumericTableIface::upperPackedSymmetricMatrix
                             | (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures);
     return s;
 }
 
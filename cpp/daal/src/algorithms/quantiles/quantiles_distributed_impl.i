@@ -0,0 +1,143 @@
+/* file: quantiles_distributed_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_IMPL__
+#define __QUANTILES_DISTRIBUTED_IMPL__
+
+#include "src/algorithms/quantiles/quantiles_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection & partialResults, PartialResult & partialResult,
+                                                                                   const Parameter & parameter)
+{
+    NumericTable & itemsTable = *partialResult.get(partialSketchItems);
+    const size_t nFeatures    = itemsTable.getNumberOfRows();
+    const size_t capacity     = itemsTable.getNumberOfColumns();
+    const size_t k            = getSketchTopCapacity(parameter.rankError);
+
+    WriteOnlyRows<algorithmFPType, cpu> itemsBlock(itemsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock)
+    algorithmFPType * items = itemsBlock.get();
+
+    WriteOnlyRows<int, cpu> levelsBlock(*partialResult.get(partialSketchLevels), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = levelsBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> minimumBlock(*partialResult.get(partialMinimum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    algorithmFPType * minimum = minimumBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> maximumBlock(*partialResult.get(partialMaximum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+    algorithmFPType * maximum = maximumBlock.get();
+
+    /* The number of observations is an integer, the double block represents it exactly */
+    WriteOnlyRows<double, cpu> nObservationsBlock(*partialResult.get(nObservations), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    double * nObservationsValue = nObservationsBlock.get();
+
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(parameter.engine.get());
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    /* Seeds of the generators that choose the items kept by the compactions of the merged sketches, one per feature */
+    TArray<unsigned int, cpu> seeds(nFeatures);
+    DAAL_CHECK_MALLOC(seeds.get());
+    daal::internal::RNGs<unsigned int, cpu> rng;
+
+    size_t nObservationsTotal = 0;
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        KllSketch<algorithmFPType, cpu>(items + j * capacity, levels + j * sketchLevelsSize, capacity, k).reset();
+        minimum[j] = services::internal::MaxVal<algorithmFPType>::get();
+        maximum[j] = -services::internal::MaxVal<algorithmFPType>::get();
+    }
+
+    for (size_t i = 0; i < partialResults.size(); ++i)
+    {
+        const PartialResult * localPartialResult = static_cast<const PartialResult *>(partialResults[i].get());
+
+        NumericTable & localItemsTable = *localPartialResult->get(partialSketchItems);
+        const size_t localCapacity     = localItemsTable.getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu> localItemsBlock(localItemsTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(localItemsBlock)
+        algorithmFPType * localItems = const_cast<algorithmFPType *>(localItemsBlock.get());
+
+        ReadRows<int, cpu> localLevelsBlock(*localPartialResult->get(partialSketchLevels), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(localLevelsBlock)
+        int * localLevels = const_cast<int *>(localLevelsBlock.get());
+
+        ReadRows<algorithmFPType, cpu> localMinimumBlock(*localPartialResult->get(partialMinimum), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localMinimumBlock)
+        const algorithmFPType * localMinimum = localMinimumBlock.get();
+
+        ReadRows<algorithmFPType, cpu> localMaximumBlock(*localPartialResult->get(partialMaximum), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localMaximumBlock)
+        const algorithmFPType * localMaximum = localMaximumBlock.get();
+
+        ReadRows<double, cpu> localNObservationsBlock(*localPartialResult->get(nObservations), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localNObservationsBlock)
+        nObservationsTotal += size_t(localNObservationsBlock.get()[0]);
+
+        DAAL_CHECK(!rng.uniformBits32(nFeatures, seeds.get(), engineImpl->getState()), ErrorIncorrectErrorcodeFromGenerator);
+
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+            KllSketch<algorithmFPType, cpu> sketch(items + j * capacity, levels + j * sketchLevelsSize, capacity, k);
+            const KllSketch<algorithmFPType, cpu> localSketch(localItems + j * localCapacity, localLevels + j * sketchLevelsSize, localCapacity, k);
+            DAAL_CHECK_THR(localSketch.isValid(), services::ErrorIncorrectElementInPartialResultCollection);
+
+            /* The union of the sketches is compacted in the temporary storage and copied back */
+            const size_t mergedCapacity = sketch.size() + localSketch.size();
+            TArray<algorithmFPType, cpu> mergedItems(mergedCapacity + 1);
+            TArray<int, cpu> mergedLevels(sketchLevelsSize);
+            DAAL_CHECK_MALLOC_THR(mergedItems.get() && mergedLevels.get());
+
+            KllSketch<algorithmFPType, cpu> mergedSketch(mergedItems.get(), mergedLevels.get(), mergedCapacity, k, seeds[j]);
+            services::Status s = mergedSketch.merge(sketch, localSketch);
+            DAAL_CHECK_STATUS_THR(s);
+            mergedSketch.copyTo(sketch);
+
+            minimum[j] = (localMinimum[j] < minimum[j] ? localMinimum[j] : minimum[j]);
+            maximum[j] = (localMaximum[j] > maximum[j] ? localMaximum[j] : maximum[j]);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    nObservationsValue[0] = double(nObservationsTotal);
+    return Status();
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,141 @@
+/* file: quantiles_distributed_input.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles algorithm input in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+template <>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master> & other) : InputIface(other)
+{}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+template <>
+Status DistributedInput<step2Master>::getNumberOfColumns(size_t & nCols) const
+{
+    DataCollectionPtr collectionOfPartialResults = staticPointerCast<DataCollection, SerializationIface>(Argument::get(partialResults));
+
+    DAAL_CHECK(collectionOfPartialResults, ErrorNullInputDataCollection);
+    DAAL_CHECK(collectionOfPartialResults->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collectionOfPartialResults)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+    return partialResult->getNumberOfColumns(nCols);
+}
+
+/**
+ * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode.
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+template <>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr & partialResult)
+{
+    DataCollectionPtr collection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets input object for the quantiles algorithm in the distributed processing mode.
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+template <>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of distributed input objects
+ */
+template <>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the partial results computed on local nodes. The sketches of the local nodes may have different
+ * rank errors, the merged sketch is compacted to the rank error set in the parameters of the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, static_cast<const Parameter *>(parameter)->check());
+
+    DataCollectionPtr collectionPtr = DataCollection::cast(Argument::get(partialResults));
+    DAAL_CHECK(collectionPtr, ErrorNullInputDataCollection);
+    const size_t nBlocks = collectionPtr->size();
+    DAAL_CHECK(nBlocks != 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+
+    const int unexpectedLayouts = (int)packed_mask;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collectionPtr)[i]);
+        DAAL_CHECK(partialResult.get() != 0, ErrorIncorrectElementInPartialResultCollection);
+
+        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(partialMinimum).get(), partialMinimumStr(), unexpectedLayouts, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(partialMaximum).get(), partialMaximumStr(), unexpectedLayouts, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(partialSketchItems).get(), partialSketchItemsStr(), unexpectedLayouts, 0, 0,
+                                               nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(partialSketchLevels).get(), partialSketchLevelsStr(), unexpectedLayouts, 0,
+                                               internal::sketchLevelsSize, nFeatures));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
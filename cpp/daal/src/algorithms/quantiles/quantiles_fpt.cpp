@@ -22,6 +22,11 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_data_utils.h"
+
+using namespace daal::internal;
 
 namespace daal
 {
@@ -52,8 +57,103 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms in the online or distributed processing mode
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store partial results of the quantiles algorithm. The size of the sketch of one feature
+ * is defined by the rank error and does not depend on the number of observations
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+    DAAL_CHECK_STATUS(s, par->check());
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+    const size_t storageSize = internal::getSketchStorageSize(internal::getSketchTopCapacity(par->rankError));
+
+    using data_management::HomogenNumericTable;
+    using data_management::NumericTable;
+    set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+    set(partialMinimum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialMaximum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialSketchItems, HomogenNumericTable<algorithmFPType>::create(storageSize, nFeatures, NumericTable::doAllocate, &s));
+    set(partialSketchLevels, HomogenNumericTable<int>::create(internal::sketchLevelsSize, nFeatures, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes the partial results of the quantiles algorithm with the empty sketches
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ * \return Status of initialization
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    const algorithmFPType maxValue = services::internal::MaxVal<algorithmFPType>::get();
+
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign(algorithmFPType(0)))
+    DAAL_CHECK_STATUS(s, get(partialMinimum)->assign(maxValue))
+    DAAL_CHECK_STATUS(s, get(partialMaximum)->assign(-maxValue))
+
+    data_management::NumericTable * levelsTable = get(partialSketchLevels).get();
+    const size_t nFeatures                      = levelsTable->getNumberOfRows();
+    const int storageSize                       = int(get(partialSketchItems)->getNumberOfColumns());
+
+    WriteOnlyRows<int, sse2> levelsBlock(levelsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = levelsBlock.get();
+
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        /* One empty level, all offsets point to the end of the storage */
+        levels[j * internal::sketchLevelsSize] = 1;
+        for (size_t h = 1; h < internal::sketchLevelsSize; ++h)
+        {
+            levels[j * internal::sketchLevelsSize + h] = storageSize;
+        }
+    }
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * par, const int method);
 
 } // namespace interface1
 } // namespace quantiles
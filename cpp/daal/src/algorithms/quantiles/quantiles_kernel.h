@@ -26,6 +26,8 @@
 
 #include "data_management/data/numeric_table.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "src/services/service_defines.h"
 #include "src/data_management/service_micro_table.h"
@@ -47,6 +49,23 @@ struct QuantilesKernel : public Kernel
     services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
 };
 
+/* Computes the quantiles approximately using the mergeable sketches stored in the partial result */
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, PartialResult & partialResult, const Parameter & parameter);
+    services::Status finalizeCompute(const PartialResult & partialResult, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public QuantilesOnlineKernel<method, algorithmFPType, cpu>
+{
+    virtual ~QuantilesDistributedKernel() {}
+    using QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute;
+    services::Status compute(DataCollection & partialResults, PartialResult & partialResult, const Parameter & parameter);
+};
+
 } // namespace internal
 
 } // namespace quantiles
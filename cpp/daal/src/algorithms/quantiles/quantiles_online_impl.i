@@ -0,0 +1,182 @@
+/* file: quantiles_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the online processing mode
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_IMPL__
+#define __QUANTILES_ONLINE_IMPL__
+
+#include "src/algorithms/engines/engine_batch_impl.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/externals/service_rng.h"
+#include "src/threading/threading.h"
+#include "src/services/service_data_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Number of observations added to the sketches in one parallel pass over the features */
+const size_t onlineBlockSize = 4096;
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, PartialResult & partialResult,
+                                                                              const Parameter & parameter)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t k         = getSketchTopCapacity(parameter.rankError);
+
+    NumericTable & itemsTable = *partialResult.get(partialSketchItems);
+    const size_t capacity     = itemsTable.getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsBlock(itemsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock)
+    algorithmFPType * items = itemsBlock.get();
+
+    WriteRows<int, cpu> levelsBlock(*partialResult.get(partialSketchLevels), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = levelsBlock.get();
+
+    WriteRows<algorithmFPType, cpu> minimumBlock(*partialResult.get(partialMinimum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    algorithmFPType * minimum = minimumBlock.get();
+
+    WriteRows<algorithmFPType, cpu> maximumBlock(*partialResult.get(partialMaximum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+    algorithmFPType * maximum = maximumBlock.get();
+
+    /* The number of observations is an integer, the double block represents it exactly */
+    WriteRows<double, cpu> nObservationsBlock(*partialResult.get(nObservations), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    double * nObservationsValue = nObservationsBlock.get();
+
+    auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(parameter.engine.get());
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    /* Seeds of the generators that choose the items kept by the compactions of the sketches, one per feature */
+    TArray<unsigned int, cpu> seeds(nFeatures);
+    DAAL_CHECK_MALLOC(seeds.get());
+    daal::internal::RNGs<unsigned int, cpu> rng;
+
+    const size_t nBlocks = nVectors / onlineBlockSize + !!(nVectors % onlineBlockSize);
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        const size_t startRow = iBlock * onlineBlockSize;
+        const size_t nRows    = (iBlock + 1 == nBlocks ? nVectors - startRow : onlineBlockSize);
+
+        ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock)
+        const algorithmFPType * data = dataBlock.get();
+
+        DAAL_CHECK(!rng.uniformBits32(nFeatures, seeds.get(), engineImpl->getState()), ErrorIncorrectErrorcodeFromGenerator);
+
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+            KllSketch<algorithmFPType, cpu> sketch(items + j * capacity, levels + j * sketchLevelsSize, capacity, k, seeds[j]);
+            DAAL_CHECK_THR(sketch.isValid(), services::ErrorQuantilesInternal);
+
+            services::Status s = sketch.update(data + j, nRows, nFeatures);
+            DAAL_CHECK_STATUS_THR(s);
+
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const algorithmFPType value = data[i * nFeatures + j];
+                minimum[j]                  = (value < minimum[j] ? value : minimum[j]);
+                maximum[j]                  = (value > maximum[j] ? value : maximum[j]);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    nObservationsValue[0] = double(size_t(nObservationsValue[0]) + nVectors);
+    return Status();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const PartialResult & partialResult,
+                                                                                      const NumericTable & quantileOrdersTable,
+                                                                                      NumericTable & quantilesTable)
+{
+    NumericTable & itemsTable    = *partialResult.get(partialSketchItems);
+    const size_t nFeatures       = itemsTable.getNumberOfRows();
+    const size_t capacity        = itemsTable.getNumberOfColumns();
+    const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock)
+    const algorithmFPType * quantileOrders = quantileOrdersBlock.get();
+
+    for (size_t q = 0; q < nQuantileOrders; ++q)
+    {
+        DAAL_CHECK(quantileOrders[q] >= algorithmFPType(0) && quantileOrders[q] <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    ReadRows<algorithmFPType, cpu> itemsBlock(itemsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock)
+    algorithmFPType * items = const_cast<algorithmFPType *>(itemsBlock.get());
+
+    ReadRows<int, cpu> levelsBlock(*partialResult.get(partialSketchLevels), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = const_cast<int *>(levelsBlock.get());
+
+    ReadRows<algorithmFPType, cpu> minimumBlock(*partialResult.get(partialMinimum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    const algorithmFPType * minimum = minimumBlock.get();
+
+    ReadRows<algorithmFPType, cpu> maximumBlock(*partialResult.get(partialMaximum), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+    const algorithmFPType * maximum = maximumBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType * quantiles = quantilesBlock.get();
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        const KllSketch<algorithmFPType, cpu> sketch(items + j * capacity, levels + j * sketchLevelsSize, capacity, 0);
+        DAAL_CHECK_THR(sketch.isValid(), services::ErrorQuantilesInternal);
+
+        TArray<algorithmFPType, cpu> values(sketch.size() + 1);
+        TArray<size_t, cpu> weights(sketch.size() + 1);
+        DAAL_CHECK_MALLOC_THR(values.get() && weights.get());
+
+        sketch.query(quantileOrders, nQuantileOrders, minimum[j], maximum[j], quantiles + j * nQuantileOrders, values.get(), weights.get());
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
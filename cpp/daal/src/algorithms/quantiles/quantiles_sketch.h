@@ -0,0 +1,319 @@
+/* file: quantiles_sketch.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the mergeable quantile sketch used in the online and
+//  distributed processing modes of the quantiles algorithm
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_H__
+#define __QUANTILES_SKETCH_H__
+
+#include "services/error_handling.h"
+#include "src/algorithms/service_sort.h"
+#include "src/services/service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Maximal number of levels of the sketch, the items of the level h have the weight 2^h */
+const size_t sketchMaxLevels = 48;
+
+/* Minimal number of items the level of the sketch holds before it is compacted */
+const size_t sketchMinLevelCapacity = 8;
+
+/* Number of columns in the table with the levels of the sketches: the number of levels and the offsets of the levels */
+const size_t sketchLevelsSize = sketchMaxLevels + 2;
+
+/* Capacity of the top level of the sketch that provides the requested normalized rank error */
+inline size_t getSketchTopCapacity(double rankError)
+{
+    const size_t k = size_t(2.0 / rankError) + 1;
+    return (k < sketchMinLevelCapacity ? sketchMinLevelCapacity : k);
+}
+
+/* Capacity of the level h of the sketch with nLevels levels, k * (2/3)^(nLevels - 1 - h) */
+inline size_t getSketchLevelCapacity(size_t k, size_t nLevels, size_t h)
+{
+    double capacity = double(k);
+    for (size_t depth = nLevels - 1 - h; depth > 0 && capacity >= sketchMinLevelCapacity; --depth)
+    {
+        capacity *= 2.0 / 3.0;
+    }
+    const size_t result = size_t(capacity);
+    return (result < sketchMinLevelCapacity ? sketchMinLevelCapacity : result);
+}
+
+inline size_t getSketchTotalCapacity(size_t k, size_t nLevels)
+{
+    size_t capacity = 0;
+    for (size_t h = 0; h < nLevels; ++h)
+    {
+        capacity += getSketchLevelCapacity(k, nLevels, h);
+    }
+    return capacity;
+}
+
+/* Number of items the storage of the sketch holds for any number of levels */
+inline size_t getSketchStorageSize(size_t k)
+{
+    size_t size = 0;
+    for (size_t nLevels = 1; nLevels <= sketchMaxLevels; ++nLevels)
+    {
+        const size_t capacity = getSketchTotalCapacity(k, nLevels);
+        size                  = (capacity > size ? capacity : size);
+    }
+    return size;
+}
+
+/*
+ * KLL sketch of the values of one feature [Karnin, Lang, Liberty. Optimal Quantile Approximation in Streams, 2016].
+ * The items are stored right-aligned in the array of the given capacity: the level h occupies [levels[h], levels[h + 1]),
+ * levels[nLevels] == capacity and the free space is [0, levels[0]). Compaction of the level sorts it and promotes every
+ * other item to the next level doubling its weight, so the total weight of the items is the number of the observations.
+ * Whether the items at the even or at the odd positions are promoted is chosen at random for every compaction, the random
+ * bits come from the generator seeded by the caller from the engine of the algorithm.
+ * The sketch does not own the memory, the number of levels is stored in header[0] and the offsets in header[1..].
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KllSketch
+{
+public:
+    KllSketch(algorithmFPType * items, int * header, size_t capacity, size_t k, unsigned int seed = 1)
+        : _items(items), _nLevels(header), _levels(header + 1), _capacity(capacity), _k(k), _random(seed ? seed : 1)
+    {}
+
+    void reset()
+    {
+        *_nLevels  = 1;
+        _levels[0] = int(_capacity);
+        _levels[1] = int(_capacity);
+    }
+
+    /* Checks the layout of the sketch restored from the partial result */
+    bool isValid() const
+    {
+        if (*_nLevels < 1 || size_t(*_nLevels) > sketchMaxLevels || _levels[0] < 0 || size_t(_levels[*_nLevels]) != _capacity) return false;
+        for (int h = 0; h < *_nLevels; ++h)
+        {
+            if (_levels[h] > _levels[h + 1]) return false;
+        }
+        return true;
+    }
+
+    size_t nLevels() const { return size_t(*_nLevels); }
+    size_t size() const { return _capacity - size_t(_levels[0]); }
+    size_t levelSize(size_t h) const { return size_t(_levels[h + 1] - _levels[h]); }
+    const algorithmFPType * level(size_t h) const { return _items + _levels[h]; }
+
+    /* Total weight of the items, that is the number of observations summarized by the sketch */
+    size_t weight() const
+    {
+        size_t result = 0;
+        for (size_t h = 0; h < nLevels(); ++h)
+        {
+            result += levelSize(h) << h;
+        }
+        return result;
+    }
+
+    /* Adds n values x[0], x[stride], ... to the sketch */
+    services::Status update(const algorithmFPType * x, size_t n, size_t stride)
+    {
+        services::Status s;
+        size_t totalCapacity = getSketchTotalCapacity(_k, nLevels());
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (size() >= totalCapacity)
+            {
+                DAAL_CHECK_STATUS(s, compactOnce());
+                totalCapacity = getSketchTotalCapacity(_k, nLevels());
+            }
+            _items[--_levels[0]] = x[i * stride];
+        }
+        return s;
+    }
+
+    /* Replaces the sketch with the union of the sketches a and b compacted to fit the capacity of this sketch */
+    services::Status merge(const KllSketch & a, const KllSketch & b)
+    {
+        DAAL_ASSERT(a.size() + b.size() <= _capacity)
+        const size_t nMergedLevels = (a.nLevels() > b.nLevels() ? a.nLevels() : b.nLevels());
+
+        size_t end             = _capacity;
+        *_nLevels              = int(nMergedLevels);
+        _levels[nMergedLevels] = int(_capacity);
+        for (size_t h = nMergedLevels; h-- > 0;)
+        {
+            const size_t aSize = (h < a.nLevels() ? a.levelSize(h) : 0);
+            const size_t bSize = (h < b.nLevels() ? b.levelSize(h) : 0);
+            end -= aSize + bSize;
+            _levels[h] = int(end);
+            for (size_t i = 0; i < aSize; ++i) _items[end + i] = a.level(h)[i];
+            for (size_t i = 0; i < bSize; ++i) _items[end + aSize + i] = b.level(h)[i];
+        }
+
+        services::Status s;
+        while (size() > getSketchTotalCapacity(_k, nLevels()))
+        {
+            DAAL_CHECK_STATUS(s, compactOnce());
+        }
+        return s;
+    }
+
+    /* Copies the sketch to another one with the capacity not less than the size of this sketch */
+    void copyTo(KllSketch & other) const
+    {
+        DAAL_ASSERT(size() <= other._capacity)
+        *other._nLevels = *_nLevels;
+        for (size_t h = 0; h <= nLevels(); ++h)
+        {
+            other._levels[h] = int(other._capacity - (_capacity - _levels[h]));
+        }
+        const size_t n = size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            other._items[other._levels[0] + i] = _items[_levels[0] + i];
+        }
+    }
+
+    /*
+     * Computes the quantiles of the given orders. The value of the quantile of the order q is the smallest item
+     * which rank is not less than q * weight(). The orders 0 and 1 return the exact minimum and maximum.
+     * The buffers hold size() elements each
+     */
+    void query(const algorithmFPType * orders, size_t nOrders, algorithmFPType minimum, algorithmFPType maximum, algorithmFPType * quantiles,
+               algorithmFPType * values, size_t * weights) const
+    {
+        const size_t n = size();
+        for (size_t h = 0, i = 0; h < nLevels(); ++h)
+        {
+            for (size_t j = 0; j < levelSize(h); ++j, ++i)
+            {
+                values[i]  = level(h)[j];
+                weights[i] = size_t(1) << h;
+            }
+        }
+        if (n > 1) daal::algorithms::internal::qSort<algorithmFPType, size_t, cpu>(n, values, weights);
+
+        const double totalWeight = double(weight());
+        for (size_t q = 0; q < nOrders; ++q)
+        {
+            if (orders[q] <= algorithmFPType(0) || n == 0)
+            {
+                quantiles[q] = minimum;
+                continue;
+            }
+            if (orders[q] >= algorithmFPType(1))
+            {
+                quantiles[q] = maximum;
+                continue;
+            }
+
+            const double rank = double(orders[q]) * totalWeight;
+            size_t cumulative = 0;
+            size_t i          = 0;
+            for (; i + 1 < n; ++i)
+            {
+                cumulative += weights[i];
+                if (double(cumulative) >= rank) break;
+            }
+            quantiles[q] = values[i];
+        }
+    }
+
+private:
+    /* Compacts the lowest level that reached its capacity */
+    services::Status compactOnce()
+    {
+        const size_t nCurrentLevels = nLevels();
+        for (size_t h = 0; h < nCurrentLevels; ++h)
+        {
+            if (levelSize(h) >= getSketchLevelCapacity(_k, nCurrentLevels, h))
+            {
+                return compactLevel(h, nextRandomBit());
+            }
+        }
+        return services::Status();
+    }
+
+    /* Xorshift generator, its state never becomes zero */
+    size_t nextRandomBit()
+    {
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        return size_t(_random >> 31);
+    }
+
+    services::Status compactLevel(size_t h, size_t offset)
+    {
+        if (h + 1 == nLevels())
+        {
+            DAAL_CHECK(nLevels() < sketchMaxLevels, services::ErrorQuantilesInternal);
+            _levels[nLevels() + 1] = _levels[nLevels()];
+            ++(*_nLevels);
+        }
+
+        const size_t begin = _levels[h];
+        const size_t end   = _levels[h + 1];
+        const size_t odd   = (end - begin) & 1;
+        const size_t pairs = (end - begin) / 2;
+
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(end - begin, _items + begin);
+
+        /* Every other item of the sorted level moves to the tail of the level, that becomes the head of the next level */
+        const size_t first = begin + odd;
+        for (size_t i = pairs; i-- > 0;)
+        {
+            _items[end - pairs + i] = _items[first + 2 * i + offset];
+        }
+        /* The unpaired item stays on the level h, the lower levels shift to close the gap */
+        if (odd) _items[end - pairs - 1] = _items[begin];
+        for (size_t i = begin; i-- > size_t(_levels[0]);)
+        {
+            _items[i + pairs] = _items[i];
+        }
+        for (size_t j = 0; j <= h; ++j)
+        {
+            _levels[j] += int(pairs);
+        }
+        _levels[h + 1] = int(end - pairs);
+        return services::Status();
+    }
+
+    algorithmFPType * _items;
+    int * _nLevels;
+    int * _levels;
+    size_t _capacity;
+    size_t _k;
+    unsigned int _random;
+};
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,174 @@
+/* file: modes.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the quantiles computed in the online and distributed processing modes against the exact ones
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::quantiles::test
+{
+using namespace daal::data_management;
+
+class QuantilesModesTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t nRows     = 200000;
+    static constexpr size_t nCols     = 3;
+    static constexpr double rankError = 0.01;
+
+    QuantilesModesTest() : _data(nRows * nCols), _orders({ 0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0 })
+    {
+        std::mt19937 rng(777);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            /* Uniform, skewed and sorted features */
+            const double u       = double(rng()) / 4294967296.0;
+            _data[i * nCols]     = u;
+            _data[i * nCols + 1] = u * u * u;
+            _data[i * nCols + 2] = double(i);
+        }
+    }
+
+    NumericTablePtr rows(size_t iFirstRow, size_t nRowsInTable)
+    {
+        return HomogenNumericTable<double>::create(_data.data() + iFirstRow * nCols, nCols, nRowsInTable);
+    }
+
+    NumericTablePtr orders() { return HomogenNumericTable<double>::create(_orders.data(), _orders.size(), 1); }
+
+    static std::vector<double> read(const NumericTablePtr & table)
+    {
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+        std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + table->getNumberOfRows() * table->getNumberOfColumns());
+        table->releaseBlockOfRows(block);
+        return values;
+    }
+
+    /* The normalized ranks of the quantiles differ from the orders by rankError at most, the orders 0 and 1 are exact */
+    void checkRankError(const NumericTablePtr & quantilesTable)
+    {
+        const std::vector<double> quantiles = read(quantilesTable);
+        ASSERT_EQ(quantiles.size(), nCols * _orders.size());
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            std::vector<double> column(nRows);
+            for (size_t i = 0; i < nRows; ++i) column[i] = _data[i * nCols + j];
+            std::sort(column.begin(), column.end());
+
+            for (size_t q = 0; q < _orders.size(); ++q)
+            {
+                const double value = quantiles[j * _orders.size() + q];
+                if (_orders[q] == 0.0 || _orders[q] == 1.0)
+                {
+                    EXPECT_EQ(value, _orders[q] == 0.0 ? column.front() : column.back()) << "j = " << j;
+                    continue;
+                }
+                const double rank = double(std::upper_bound(column.begin(), column.end(), value) - column.begin()) / nRows;
+                EXPECT_LE(std::fabs(rank - _orders[q]), rankError) << "j = " << j << ", order = " << _orders[q];
+            }
+        }
+    }
+
+    static void checkNObservations(const PartialResultPtr & partialResult, size_t expected)
+    {
+        const std::vector<double> value = read(partialResult->get(nObservations));
+        ASSERT_EQ(value.size(), 1);
+        EXPECT_EQ(value[0], double(expected));
+    }
+
+    NumericTablePtr computeOnline(std::uint32_t seed)
+    {
+        Online<double> algorithm;
+        algorithm.parameter.quantileOrders = orders();
+        algorithm.parameter.rankError      = rankError;
+        algorithm.parameter.engine         = engines::mt19937::Batch<>::create(seed);
+
+        /* Blocks of different sizes */
+        for (size_t iFirstRow = 0, blockSize = 1000; iFirstRow < nRows; iFirstRow += blockSize, blockSize *= 2)
+        {
+            algorithm.input.set(data, rows(iFirstRow, std::min(blockSize, nRows - iFirstRow)));
+            EXPECT_TRUE(algorithm.compute().ok());
+        }
+        EXPECT_TRUE(algorithm.finalizeCompute().ok());
+        checkNObservations(algorithm.getPartialResult(), nRows);
+        return algorithm.getResult()->get(quantiles);
+    }
+
+private:
+    std::vector<double> _data;
+    std::vector<double> _orders;
+};
+
+TEST_F(QuantilesModesTest, Online)
+{
+    checkRankError(computeOnline(7));
+}
+
+TEST_F(QuantilesModesTest, OnlineIsReproducibleWithSameEngine)
+{
+    EXPECT_EQ(read(computeOnline(7)), read(computeOnline(7)));
+}
+
+TEST_F(QuantilesModesTest, Distributed)
+{
+    const size_t nNodes       = 4;
+    const size_t nRowsPerNode = nRows / nNodes;
+
+    Distributed<step2Master, double> master;
+    master.parameter.quantileOrders = orders();
+    master.parameter.rankError      = rankError;
+
+    for (size_t node = 0; node < nNodes; ++node)
+    {
+        Distributed<step1Local, double> local;
+        local.parameter.rankError = rankError;
+        local.parameter.engine    = engines::mt19937::Batch<>::create(100 + node);
+
+        /* Every node processes its part of the data in two blocks */
+        const size_t iFirstRow = node * nRowsPerNode;
+        local.input.set(data, rows(iFirstRow, nRowsPerNode / 3));
+        ASSERT_TRUE(local.compute().ok());
+        local.input.set(data, rows(iFirstRow + nRowsPerNode / 3, nRowsPerNode - nRowsPerNode / 3));
+        ASSERT_TRUE(local.compute().ok());
+        checkNObservations(local.getPartialResult(), nRowsPerNode);
+
+        master.input.add(partialResults, local.getPartialResult());
+    }
+
+    ASSERT_TRUE(master.compute().ok());
+    ASSERT_TRUE(master.finalizeCompute().ok());
+    checkNObservations(master.getPartialResult(), nRows);
+    checkRankError(master.getResult()->get(quantiles));
+}
+
+} // namespace daal::algorithms::quantiles::test
@@ -0,0 +1,163 @@
+/* file: sketch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the rank error of the quantile sketch used in the online and distributed processing modes
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+
+namespace daal::algorithms::quantiles::test
+{
+using namespace daal::algorithms::quantiles::internal;
+
+typedef KllSketch<double, daal::sse2> Sketch;
+
+/* Sketch together with the memory it summarizes the values in */
+struct SketchStorage
+{
+    SketchStorage(size_t capacity, size_t k, unsigned int seed)
+        : items(capacity), header(sketchLevelsSize), sketch(items.data(), header.data(), capacity, k, seed)
+    {
+        sketch.reset();
+    }
+
+    std::vector<double> items;
+    std::vector<int> header;
+    Sketch sketch;
+};
+
+class QuantilesSketchTest : public ::testing::Test
+{
+protected:
+    static constexpr double rankError = 0.01;
+
+    QuantilesSketchTest() : k(getSketchTopCapacity(rankError)), capacity(getSketchStorageSize(k)) {}
+
+    /* The raw output of the generator keeps the data the same with any standard library */
+    static std::vector<double> random(size_t n, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<double> values(n);
+        for (auto & value : values) value = double(rng());
+        return values;
+    }
+
+    static void update(Sketch & sketch, const std::vector<double> & values, size_t begin, size_t end)
+    {
+        const size_t blockSize = 1000;
+        for (size_t i = begin; i < end; i += blockSize)
+        {
+            ASSERT_TRUE(sketch.update(values.data() + i, std::min(blockSize, end - i), 1).ok());
+        }
+    }
+
+    /* Maximal difference between the requested orders and the normalized ranks of the quantiles computed by the sketch */
+    static double maxRankError(const Sketch & sketch, std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        std::vector<double> orders;
+        for (size_t i = 1; i < 100; ++i) orders.push_back(0.01 * i);
+
+        std::vector<double> quantiles(orders.size());
+        std::vector<double> buffer(sketch.size() + 1);
+        std::vector<size_t> weights(sketch.size() + 1);
+        sketch.query(orders.data(), orders.size(), values.front(), values.back(), quantiles.data(), buffer.data(), weights.data());
+
+        double result = 0.0;
+        for (size_t q = 0; q < orders.size(); ++q)
+        {
+            const double rank = double(std::upper_bound(values.begin(), values.end(), quantiles[q]) - values.begin()) / values.size();
+            result            = std::max(result, std::fabs(rank - orders[q]));
+        }
+        return result;
+    }
+
+    const size_t k;
+    const size_t capacity;
+};
+
+TEST_F(QuantilesSketchTest, OnlineRankErrorIsBounded)
+{
+    const std::vector<double> values = random(1000000, 777);
+    SketchStorage storage(capacity, k, 1);
+    update(storage.sketch, values, 0, values.size());
+
+    EXPECT_EQ(storage.sketch.weight(), values.size());
+    EXPECT_LE(storage.sketch.size(), capacity);
+    EXPECT_LE(maxRankError(storage.sketch, values), rankError);
+}
+
+TEST_F(QuantilesSketchTest, SortedInputRankErrorIsBounded)
+{
+    std::vector<double> values = random(500000, 778);
+    std::sort(values.begin(), values.end());
+    SketchStorage storage(capacity, k, 2);
+    update(storage.sketch, values, 0, values.size());
+
+    EXPECT_EQ(storage.sketch.weight(), values.size());
+    EXPECT_LE(maxRankError(storage.sketch, values), rankError);
+}
+
+/* Every node summarizes its part of the data, the master merges the sketches of the nodes one by one */
+TEST_F(QuantilesSketchTest, MergedRankErrorIsBounded)
+{
+    const size_t nNodes = 8;
+    const size_t nRows  = 250000;
+    const std::vector<double> values = random(nNodes * nRows, 779);
+
+    SketchStorage merged(capacity, k, 3);
+    for (size_t node = 0; node < nNodes; ++node)
+    {
+        SketchStorage local(capacity, k, 10 + node);
+        update(local.sketch, values, node * nRows, (node + 1) * nRows);
+
+        SketchStorage work(merged.sketch.size() + local.sketch.size(), k, 20 + node);
+        ASSERT_TRUE(work.sketch.merge(merged.sketch, local.sketch).ok());
+        work.sketch.copyTo(merged.sketch);
+    }
+
+    EXPECT_EQ(merged.sketch.weight(), values.size());
+    EXPECT_LE(merged.sketch.size(), capacity);
+    EXPECT_LE(maxRankError(merged.sketch, values), rankError);
+}
+
+/* The compactions choose the kept items with the generator seeded by the caller */
+TEST_F(QuantilesSketchTest, CompactionsDependOnSeed)
+{
+    const std::vector<double> values = random(100000, 780);
+    SketchStorage first(capacity, k, 5), second(capacity, k, 5), third(capacity, k, 6);
+    update(first.sketch, values, 0, values.size());
+    update(second.sketch, values, 0, values.size());
+    update(third.sketch, values, 0, values.size());
+
+    const auto items = [](const Sketch & sketch) { return std::vector<double>(sketch.level(0), sketch.level(0) + sketch.size()); };
+    EXPECT_EQ(items(first.sketch), items(second.sketch));
+    EXPECT_NE(items(first.sketch), items(third.sketch));
+}
+
+} // namespace daal::algorithms::quantiles::test
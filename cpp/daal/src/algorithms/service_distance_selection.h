@@ -0,0 +1,420 @@
+/* file: service_distance_selection.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Selection of the nearest observations and of the close pairs of observations
+//  for the cosine and correlation distances without materializing the distance matrix.
+//--
+*/
+
+#ifndef __SERVICE_DISTANCE_SELECTION_H__
+#define __SERVICE_DISTANCE_SELECTION_H__
+
+#include "services/daal_defines.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_defines.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_heap.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::data_management;
+
+/* Number of rows in the blocks of the distance matrix computed at once */
+const size_t distanceSelectionBlockSize = 128;
+
+template <typename algorithmFPType>
+struct DistanceNeighbor
+{
+    algorithmFPType distance;
+    int index;
+};
+
+template <typename algorithmFPType>
+struct DistanceNeighborLess
+{
+    bool operator()(const DistanceNeighbor<algorithmFPType> & a, const DistanceNeighbor<algorithmFPType> & b) const
+    {
+        return (a.distance < b.distance) || (a.distance == b.distance && a.index < b.index);
+    }
+};
+
+template <typename algorithmFPType>
+struct DistancePair
+{
+    int first;
+    int second;
+    algorithmFPType distance;
+};
+
+/**
+ *  Growing list of the pairs of observations found for one block of rows
+ */
+template <typename algorithmFPType, CpuType cpu>
+class DistancePairList
+{
+public:
+    DistancePairList() : _data(nullptr), _size(0), _capacity(0) {}
+    ~DistancePairList() { services::internal::service_scalable_free<DistancePair<algorithmFPType>, cpu>(_data); }
+
+    DistancePairList(const DistancePairList &) = delete;
+    DistancePairList & operator=(const DistancePairList &) = delete;
+
+    bool push(size_t first, size_t second, algorithmFPType distance)
+    {
+        if (_size == _capacity && !grow()) return false;
+        _data[_size].first    = static_cast<int>(first);
+        _data[_size].second   = static_cast<int>(second);
+        _data[_size].distance = distance;
+        ++_size;
+        return true;
+    }
+
+    size_t size() const { return _size; }
+    const DistancePair<algorithmFPType> * get() const { return _data; }
+
+private:
+    bool grow()
+    {
+        const size_t capacity               = _capacity ? 2 * _capacity : distanceSelectionBlockSize;
+        DistancePair<algorithmFPType> * ptr = services::internal::service_scalable_malloc<DistancePair<algorithmFPType>, cpu>(capacity);
+        if (!ptr) return false;
+        services::internal::tmemcpy<DistancePair<algorithmFPType>, cpu>(ptr, _data, _size);
+        services::internal::service_scalable_free<DistancePair<algorithmFPType>, cpu>(_data);
+        _data     = ptr;
+        _capacity = capacity;
+        return true;
+    }
+
+    DistancePair<algorithmFPType> * _data;
+    size_t _size;
+    size_t _capacity;
+};
+
+/**
+ *  Computes the sums of the elements and the inverse norms of the observations.
+ *  For the correlation distance the norms are computed for the centered observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeDistanceRowStatistics(const NumericTable * xTable, bool centered, algorithmFPType * sums, algorithmFPType * invNorms)
+{
+    const size_t p       = xTable->getNumberOfColumns();
+    const size_t n       = xTable->getNumberOfRows();
+    const size_t nBlocks = n / distanceSelectionBlockSize + !!(n % distanceSelectionBlockSize);
+
+    const algorithmFPType zero(0.0);
+    const algorithmFPType one(1.0);
+    const algorithmFPType invP = centered ? one / static_cast<algorithmFPType>(p) : zero;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow     = iBlock * distanceSelectionBlockSize;
+        const size_t nRowsInBlock = (iBlock + 1 == nBlocks) ? n - startRow : distanceSelectionBlockSize;
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock);
+        const algorithmFPType * const x = xBlock.get();
+
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            algorithmFPType sum = zero, sumSq = zero;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; ++j)
+            {
+                sum += x[i * p + j];
+                sumSq += x[i * p + j] * x[i * p + j];
+            }
+            sumSq -= sum * sum * invP;
+
+            sums[startRow + i]     = sum;
+            invNorms[startRow + i] = (sumSq > zero) ? one / daal::internal::Math<algorithmFPType, cpu>::sSqrt(sumSq) : zero;
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  Computes the block of distances between the rows x1 and x2, buf is a row-major blockSize1 x blockSize2 matrix
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeDistanceBlock(const algorithmFPType * x1, size_t shift1, size_t blockSize1, const algorithmFPType * x2, size_t shift2, size_t blockSize2,
+                          size_t p, bool centered, const algorithmFPType * sums, const algorithmFPType * invNorms, algorithmFPType * buf)
+{
+    algorithmFPType alpha = 1.0, beta = 0.0;
+    char transa = 'T', transb = 'N';
+    DAAL_INT m = blockSize2, k = p, nn = blockSize1;
+    DAAL_INT lda = k, ldb = k, ldc = m;
+
+    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, x2, &lda, x1, &ldb, &beta, buf, &ldc);
+
+    const algorithmFPType one(1.0);
+    const algorithmFPType invP          = centered ? one / static_cast<algorithmFPType>(p) : algorithmFPType(0.0);
+    const algorithmFPType * const sums2 = sums + shift2;
+    const algorithmFPType * const inv2  = invNorms + shift2;
+    for (size_t i = 0; i < blockSize1; ++i)
+    {
+        const algorithmFPType sum1 = sums[shift1 + i] * invP;
+        const algorithmFPType inv1 = invNorms[shift1 + i];
+        algorithmFPType * const b  = buf + i * blockSize2;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < blockSize2; ++j)
+        {
+            b[j] = one - (b[j] - sum1 * sums2[j]) * inv1 * inv2[j];
+        }
+    }
+}
+
+/**
+ *  Finds k nearest observations for every observation of the data set, the observation itself is excluded.
+ *  Blocks of the distance matrix are computed by GEMM and merged into per-row heaps right away,
+ *  so the memory footprint is O(n * k) for the result plus O(blockSize * (blockSize + k)) per thread.
+ *  Neighbors are sorted by increasing distance, ties are resolved by the index of the neighbor
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeNearestDistances(const NumericTable * xTable, bool centered, size_t k, NumericTable * indicesTable,
+                                         NumericTable * distancesTable)
+{
+    typedef DistanceNeighbor<algorithmFPType> Neighbor;
+
+    const size_t p         = xTable->getNumberOfColumns();
+    const size_t n         = xTable->getNumberOfRows();
+    const size_t blockSize = distanceSelectionBlockSize;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+    DAAL_ASSERT(k > 0 && k < n);
+
+    services::internal::TArray<algorithmFPType, cpu> sums(n);
+    services::internal::TArray<algorithmFPType, cpu> invNorms(n);
+    DAAL_CHECK_MALLOC(sums.get() && invNorms.get());
+
+    services::Status s = computeDistanceRowStatistics<algorithmFPType, cpu>(xTable, centered, sums.get(), invNorms.get());
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSize, k);
+    TlsMem<algorithmFPType, cpu> tlsBuf(blockSize * blockSize);
+    TlsMem<Neighbor, cpu> tlsHeaps(blockSize * k);
+    const DistanceNeighborLess<algorithmFPType> less;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t k1) {
+        algorithmFPType * const buf = tlsBuf.local();
+        Neighbor * const heaps      = tlsHeaps.local();
+        DAAL_CHECK_THR(buf && heaps, services::ErrorMemoryAllocationFailed);
+
+        const size_t shift1     = k1 * blockSize;
+        const size_t blockSize1 = (k1 + 1 == nBlocks) ? n - shift1 : blockSize;
+
+        ReadRows<algorithmFPType, cpu> xBlock1(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock1);
+        const algorithmFPType * const x1 = xBlock1.get();
+
+        size_t heapSizes[distanceSelectionBlockSize];
+        for (size_t i = 0; i < blockSize1; ++i) heapSizes[i] = 0;
+
+        ReadRows<algorithmFPType, cpu> xBlock2;
+        for (size_t k2 = 0; k2 < nBlocks; ++k2)
+        {
+            const size_t shift2     = k2 * blockSize;
+            const size_t blockSize2 = (k2 + 1 == nBlocks) ? n - shift2 : blockSize;
+
+            const algorithmFPType * x2 = x1;
+            if (k2 != k1)
+            {
+                x2 = xBlock2.set(const_cast<NumericTable *>(xTable), shift2, blockSize2);
+                DAAL_CHECK_BLOCK_STATUS_THR(xBlock2);
+            }
+
+            computeDistanceBlock<algorithmFPType, cpu>(x1, shift1, blockSize1, x2, shift2, blockSize2, p, centered, sums.get(), invNorms.get(), buf);
+
+            for (size_t i = 0; i < blockSize1; ++i)
+            {
+                Neighbor * const heap              = heaps + i * k;
+                size_t & heapSize                  = heapSizes[i];
+                const algorithmFPType * const dist = buf + i * blockSize2;
+                for (size_t j = 0; j < blockSize2; ++j)
+                {
+                    if (shift1 + i == shift2 + j) continue;
+
+                    const Neighbor candidate = { dist[j], static_cast<int>(shift2 + j) };
+                    if (heapSize < k)
+                    {
+                        heap[heapSize++] = candidate;
+                        if (heapSize == k) makeMaxHeap<cpu>(heap, heap + k, less);
+                    }
+                    else if (less(candidate, heap[0]))
+                    {
+                        heap[0] = candidate;
+                        internalAdjustMaxHeap<cpu>(heap, heap + k, k, size_t(0), less);
+                    }
+                }
+            }
+        }
+
+        WriteOnlyRows<int, cpu> indicesBlock(indicesTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesBlock);
+        WriteOnlyRows<algorithmFPType, cpu> distancesBlock(distancesTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesBlock);
+        int * const indices               = indicesBlock.get();
+        algorithmFPType * const distances = distancesBlock.get();
+
+        for (size_t i = 0; i < blockSize1; ++i)
+        {
+            Neighbor * const heap = heaps + i * k;
+            sortMaxHeap<cpu>(heap, heap + k, less);
+            for (size_t j = 0; j < k; ++j)
+            {
+                indices[i * k + j]   = heap[j].index;
+                distances[i * k + j] = heap[j].distance;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  Finds all pairs of observations (i, j), i < j, with the distance not greater than the threshold.
+ *  Every block of rows streams over the blocks of the upper triangle of the distance matrix
+ *  and keeps only the selected pairs, so the memory footprint is proportional to the number of pairs.
+ *  Pairs are ordered by i and then by j
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeDistancesBelowThreshold(const NumericTable * xTable, bool centered, algorithmFPType threshold, NumericTable * indicesTable,
+                                                NumericTable * distancesTable)
+{
+    const size_t p         = xTable->getNumberOfColumns();
+    const size_t n         = xTable->getNumberOfRows();
+    const size_t blockSize = distanceSelectionBlockSize;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    services::internal::TArray<algorithmFPType, cpu> sums(n);
+    services::internal::TArray<algorithmFPType, cpu> invNorms(n);
+    DAAL_CHECK_MALLOC(sums.get() && invNorms.get());
+
+    services::Status s = computeDistanceRowStatistics<algorithmFPType, cpu>(xTable, centered, sums.get(), invNorms.get());
+    DAAL_CHECK_STATUS_VAR(s);
+
+    services::internal::TArray<DistancePairList<algorithmFPType, cpu>, cpu> blockPairs(nBlocks);
+    DAAL_CHECK_MALLOC(blockPairs.get());
+    TlsMem<algorithmFPType, cpu> tlsBuf(blockSize * blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t k1) {
+        algorithmFPType * const buf = tlsBuf.local();
+        DAAL_CHECK_THR(buf, services::ErrorMemoryAllocationFailed);
+
+        const size_t shift1     = k1 * blockSize;
+        const size_t blockSize1 = (k1 + 1 == nBlocks) ? n - shift1 : blockSize;
+
+        ReadRows<algorithmFPType, cpu> xBlock1(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock1);
+        const algorithmFPType * const x1 = xBlock1.get();
+
+        DistancePairList<algorithmFPType, cpu> & pairs = blockPairs[k1];
+        ReadRows<algorithmFPType, cpu> xBlock2;
+        for (size_t k2 = k1; k2 < nBlocks; ++k2)
+        {
+            const size_t shift2     = k2 * blockSize;
+            const size_t blockSize2 = (k2 + 1 == nBlocks) ? n - shift2 : blockSize;
+
+            const algorithmFPType * x2 = x1;
+            if (k2 != k1)
+            {
+                x2 = xBlock2.set(const_cast<NumericTable *>(xTable), shift2, blockSize2);
+                DAAL_CHECK_BLOCK_STATUS_THR(xBlock2);
+            }
+
+            computeDistanceBlock<algorithmFPType, cpu>(x1, shift1, blockSize1, x2, shift2, blockSize2, p, centered, sums.get(), invNorms.get(), buf);
+
+            for (size_t i = 0; i < blockSize1; ++i)
+            {
+                const algorithmFPType * const dist = buf + i * blockSize2;
+                for (size_t j = (k2 == k1 ? i + 1 : 0); j < blockSize2; ++j)
+                {
+                    if (dist[j] <= threshold)
+                    {
+                        DAAL_CHECK_THR(pairs.push(shift1 + i, shift2 + j, dist[j]), services::ErrorMemoryAllocationFailed);
+                    }
+                }
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS()
+
+    services::internal::TArray<size_t, cpu> offsets(nBlocks + 1);
+    DAAL_CHECK_MALLOC(offsets.get());
+    offsets[0] = 0;
+    for (size_t k1 = 0; k1 < nBlocks; ++k1)
+    {
+        offsets[k1 + 1] = offsets[k1] + blockPairs[k1].size();
+    }
+
+    const size_t nPairs = offsets[nBlocks];
+    if (nPairs == 0)
+    {
+        return services::Status();
+    }
+    DAAL_CHECK_STATUS(s, indicesTable->resize(nPairs));
+    DAAL_CHECK_STATUS(s, distancesTable->resize(nPairs));
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t k1) {
+        const size_t nPairsInBlock = blockPairs[k1].size();
+        if (!nPairsInBlock) return;
+        const DistancePair<algorithmFPType> * const pairs = blockPairs[k1].get();
+
+        WriteOnlyRows<int, cpu> indicesBlock(indicesTable, offsets[k1], nPairsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesBlock);
+        WriteOnlyRows<algorithmFPType, cpu> distancesBlock(distancesTable, offsets[k1], nPairsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesBlock);
+        int * const indices               = indicesBlock.get();
+        algorithmFPType * const distances = distancesBlock.get();
+
+        /* The pairs of the block are grouped by the blocks of columns, the stable counting sort by the row
+           puts them in the order of i and then of j */
+        const size_t shift1 = k1 * blockSize;
+        size_t rowOffsets[distanceSelectionBlockSize + 1];
+        for (size_t i = 0; i <= blockSize; ++i) rowOffsets[i] = 0;
+        for (size_t i = 0; i < nPairsInBlock; ++i) ++rowOffsets[pairs[i].first - shift1 + 1];
+        for (size_t i = 0; i < blockSize; ++i) rowOffsets[i + 1] += rowOffsets[i];
+
+        for (size_t i = 0; i < nPairsInBlock; ++i)
+        {
+            const size_t iPair     = rowOffsets[pairs[i].first - shift1]++;
+            indices[2 * iPair]     = pairs[i].first;
+            indices[2 * iPair + 1] = pairs[i].second;
+            distances[iPair]       = pairs[i].distance;
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -100,9 +100,9 @@ void makeMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare
 template <CpuType cpu, typename RandomAccessIterator, typename Compare>
 DAAL_FORCEINLINE void sortMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
-    while (1 < last - first)
+    for (; 1 < last - first; --last)
     {
-        popMaxHeap<cpu>(first, --last, compare);
+        popMaxHeap<cpu>(first, last, compare);
     }
 }
 
@@ -0,0 +1,50 @@
+/* file: stump_classification_train_hist_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the histogram method of the decision stump classification training.
+//--
+*/
+
+#include "src/algorithms/stump/stump_classification_train_batch_container.h"
+#include "src/algorithms/stump/stump_classification_train_kernel.h"
+#include "src/algorithms/stump/stump_classification_train_hist_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
+}
+namespace internal
+{
+template class StumpTrainKernel<hist, DAAL_FPTYPE, DAAL_CPU>;
+}
+} // namespace training
+} // namespace classification
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
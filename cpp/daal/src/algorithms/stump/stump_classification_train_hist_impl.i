@@ -0,0 +1,328 @@
+/* file: stump_classification_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram method of the decision stump classification training.
+//  The split is searched among the borders of the bins using the weighted
+//  histograms of the classes computed in parallel over the features and the rows.
+//--
+*/
+
+#ifndef __STUMP_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+#define __STUMP_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+
+#include "src/algorithms/stump/stump_train_hist_aux.i"
+#include "src/algorithms/decision_tree/decision_tree_classification_model_impl.h"
+#include "src/externals/service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/**
+ *  \brief Returns the impurity of the node multiplied by the total weight of its observations
+ */
+template <typename algorithmFPtype, CpuType cpu>
+algorithmFPtype weightedImpurity(const algorithmFPtype * classWeights, size_t nClasses, decision_tree::classification::SplitCriterion criterion)
+{
+    algorithmFPtype total = 0;
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        total += classWeights[iClass];
+    }
+    if (!(total > 0)) return algorithmFPtype(0);
+
+    if (criterion == decision_tree::classification::gini)
+    {
+        algorithmFPtype sumSq = 0;
+        for (size_t iClass = 0; iClass < nClasses; ++iClass)
+        {
+            sumSq += classWeights[iClass] * classWeights[iClass];
+        }
+        return total - sumSq / total;
+    }
+
+    algorithmFPtype entropy = total * Math<algorithmFPtype, cpu>::sLog(total);
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        if (classWeights[iClass] > 0) entropy -= classWeights[iClass] * Math<algorithmFPtype, cpu>::sLog(classWeights[iClass]);
+    }
+    return entropy;
+}
+
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<hist, algorithmFPtype, cpu>::compute(size_t n, const NumericTable * const * a,
+                                                                       stump::classification::Model * stumpModel, const Parameter * par)
+{
+    Status s;
+
+    const NumericTable * xTable = a[0];
+    const NumericTable * yTable = a[1];
+    const NumericTable * wTable = (n >= 3 ? a[2] : 0);
+
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t nVectors  = xTable->getNumberOfRows();
+    const size_t nClasses  = par->nClasses;
+    stumpModel->setNFeatures(nFeatures);
+
+    /* The bins are reused by the trainings that share the cache, i.e. by the iterations of one boosting run.
+       Without the cache the features are binned by every training */
+    BinnedDataType localBinnedData;
+    BinnedDataType * const binnedDataCache = dynamic_cast<BinnedDataType *>(par->binnedDataCache.get());
+    BinnedDataType & binnedData            = binnedDataCache ? *binnedDataCache : localBinnedData;
+    DAAL_CHECK_STATUS(s, binnedData.init(*xTable, par->maxBins, par->minBinSize));
+
+    ReadColumns<algorithmFPtype, cpu> yBlock(const_cast<NumericTable *>(yTable), 0, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(yBlock);
+    const algorithmFPtype * const y = yBlock.get();
+
+    /* Binary labels are -1 and 1, the multiclass labels are 0, ..., nClasses - 1 */
+    TArray<int, cpu> aClass(nVectors);
+    DAAL_CHECK_MALLOC(aClass.get());
+    int * const classIdx = aClass.get();
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        classIdx[i] = (nClasses == 2) ? (y[i] == algorithmFPtype(-1) ? 0 : 1) : int(y[i]);
+    }
+
+    ReadColumns<algorithmFPtype, cpu> wBlock;
+    TArray<algorithmFPtype, cpu> aUnitWeights;
+    const algorithmFPtype * w = nullptr;
+    if (wTable)
+    {
+        wBlock.set(const_cast<NumericTable *>(wTable), 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(wBlock);
+        w = wBlock.get();
+    }
+    else
+    {
+        aUnitWeights.reset(nVectors);
+        DAAL_CHECK_MALLOC(aUnitWeights.get());
+        service_memset<algorithmFPtype, cpu>(aUnitWeights.get(), algorithmFPtype(1), nVectors);
+        w = aUnitWeights.get();
+    }
+
+    TArray<algorithmFPtype, cpu> aTotal(nClasses);
+    DAAL_CHECK_MALLOC(aTotal.get());
+    algorithmFPtype * const total = aTotal.get();
+    service_memset_seq<algorithmFPtype, cpu>(total, algorithmFPtype(0), nClasses);
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        total[classIdx[i]] += w[i];
+    }
+
+    DAAL_CHECK_STATUS(s, _histograms.compute(binnedData, nClasses,
+                                             [=](size_t i, algorithmFPtype * binStats) -> void { binStats[classIdx[i]] += w[i]; }));
+
+    /* Search for the best split of every feature in parallel */
+    TArray<algorithmFPtype, cpu> aBestImpurity(nFeatures);
+    TArray<size_t, cpu> aBestBin(nFeatures);
+    DAAL_CHECK_MALLOC(aBestImpurity.get() && aBestBin.get());
+    algorithmFPtype * const bestImpurity = aBestImpurity.get();
+    size_t * const bestBin               = aBestBin.get();
+
+    const algorithmFPtype maxVal                                  = MaxVal<algorithmFPtype>::get();
+    const decision_tree::classification::SplitCriterion criterion = par->splitCriterion;
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        bestImpurity[iFeature] = maxVal;
+        bestBin[iFeature]      = 0;
+
+        const size_t nBins = binnedData.nBins(iFeature);
+        if (nBins < 2) return;
+
+        TNArray<algorithmFPtype, 16, cpu> aLeft(nClasses);
+        TNArray<algorithmFPtype, 16, cpu> aRight(nClasses);
+        DAAL_CHECK_MALLOC_THR(aLeft.get() && aRight.get());
+        algorithmFPtype * const left  = aLeft.get();
+        algorithmFPtype * const right = aRight.get();
+
+        const algorithmFPtype * const featureHist = _histograms.get(iFeature);
+        const bool isCategorical                  = binnedData.isCategorical(iFeature);
+        service_memset_seq<algorithmFPtype, cpu>(left, algorithmFPtype(0), nClasses);
+
+        /* Ordered features are split between the neighboring bins,
+           categorical features are split into one category and the rest */
+        const size_t nSplits = isCategorical ? nBins : nBins - 1;
+        for (size_t iBin = 0; iBin < nSplits; ++iBin)
+        {
+            const algorithmFPtype * const binStats = featureHist + iBin * nClasses;
+            for (size_t iClass = 0; iClass < nClasses; ++iClass)
+            {
+                left[iClass]  = isCategorical ? binStats[iClass] : left[iClass] + binStats[iClass];
+                right[iClass] = total[iClass] - left[iClass];
+            }
+            const algorithmFPtype impurity = weightedImpurity<algorithmFPtype, cpu>(left, nClasses, criterion)
+                                             + weightedImpurity<algorithmFPtype, cpu>(right, nClasses, criterion);
+            if (impurity < bestImpurity[iFeature])
+            {
+                bestImpurity[iFeature] = impurity;
+                bestBin[iFeature]      = iBin;
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The ties are resolved in favor of the feature with the smallest index */
+    size_t iBestFeature = nFeatures;
+    for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        if (bestImpurity[iFeature] < maxVal && (iBestFeature == nFeatures || bestImpurity[iFeature] < bestImpurity[iBestFeature]))
+        {
+            iBestFeature = iFeature;
+        }
+    }
+
+    const size_t iBestBin = (iBestFeature < nFeatures) ? bestBin[iBestFeature] : 0;
+    return buildModel(binnedData, iBestFeature, iBestBin, total, stumpModel, par);
+}
+
+/**
+ *  \brief Writes the tree of the stump split by the feature iFeature after the bin iBin to the model.
+ *         The model consists of one leaf if iFeature is equal to the number of features.
+ */
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<hist, algorithmFPtype, cpu>::buildModel(const BinnedDataType & binnedData, size_t iFeature, size_t iBin,
+                                                                          const algorithmFPtype * total, stump::classification::Model * stumpModel,
+                                                                          const Parameter * par)
+{
+    using decision_tree::classification::DecisionTreeNode;
+    using decision_tree::classification::DecisionTreeTable;
+    using decision_tree::classification::DecisionTreeTablePtr;
+
+    const size_t nClasses  = par->nClasses;
+    const size_t nFeatures = binnedData.nFeatures();
+    const bool isLeaf      = (iFeature == nFeatures);
+    const size_t nNodes    = isLeaf ? 1 : 3;
+    const size_t nLeaves   = isLeaf ? 1 : 2;
+
+    services::Status status;
+    DecisionTreeTablePtr treeTable(new DecisionTreeTable(nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<double, cpu> > impTbl(new HomogenNumericTableCPU<double, cpu>(1, nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<int, cpu> > smplCntTbl(new HomogenNumericTableCPU<int, cpu>(1, nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<int, cpu> > probIndicesTbl(new HomogenNumericTableCPU<int, cpu>(1, nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<double, cpu> > probTbl(new HomogenNumericTableCPU<double, cpu>(nClasses, nLeaves, status));
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DecisionTreeNode * const nodes = static_cast<DecisionTreeNode *>(treeTable->getArray());
+    double * const impVals         = impTbl->getArray();
+    int * const smplCntVals        = smplCntTbl->getArray();
+    int * const probIndices        = probIndicesTbl->getArray();
+    double * const probs           = probTbl->getArray();
+
+    /* Class weights of the nodes in the order: root, left child, right child */
+    TArray<algorithmFPtype, cpu> aNodeStats(nClasses * nNodes);
+    DAAL_CHECK_MALLOC(aNodeStats.get());
+    algorithmFPtype * const nodeStats = aNodeStats.get();
+    for (size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        nodeStats[iClass] = total[iClass];
+    }
+    smplCntVals[0] = int(binnedData.nRows());
+
+    if (!isLeaf)
+    {
+        const bool isCategorical                  = binnedData.isCategorical(iFeature);
+        const size_t iFirstBin                    = isCategorical ? iBin : 0;
+        const algorithmFPtype * const featureHist = _histograms.get(iFeature);
+        algorithmFPtype * const left              = nodeStats + nClasses;
+        algorithmFPtype * const right             = nodeStats + 2 * nClasses;
+
+        size_t leftCount = 0;
+        service_memset_seq<algorithmFPtype, cpu>(left, algorithmFPtype(0), nClasses);
+        for (size_t j = iFirstBin; j <= iBin; ++j)
+        {
+            for (size_t iClass = 0; iClass < nClasses; ++iClass)
+            {
+                left[iClass] += featureHist[j * nClasses + iClass];
+            }
+            leftCount += binnedData.binSize(iFeature, j);
+        }
+        for (size_t iClass = 0; iClass < nClasses; ++iClass)
+        {
+            right[iClass] = total[iClass] - left[iClass];
+        }
+
+        nodes[0].dimension        = iFeature;
+        nodes[0].leftIndexOrClass = 1;
+        nodes[0].cutPoint         = isCategorical ? binnedData.binMin(iFeature, iBin) : binnedData.cutPoint(iFeature, iBin);
+        probIndices[0]            = -1;
+        smplCntVals[1]            = int(leftCount);
+        smplCntVals[2]            = int(binnedData.nRows() - leftCount);
+    }
+
+    const size_t iFirstLeaf = isLeaf ? 0 : 1;
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        const algorithmFPtype * const stats = nodeStats + iNode * nClasses;
+        algorithmFPtype nodeWeight          = 0;
+        size_t iMaxClass                    = 0;
+        for (size_t iClass = 0; iClass < nClasses; ++iClass)
+        {
+            nodeWeight += stats[iClass];
+            if (stats[iClass] > stats[iMaxClass]) iMaxClass = iClass;
+        }
+        impVals[iNode] = (nodeWeight > 0) ? double(weightedImpurity<algorithmFPtype, cpu>(stats, nClasses, par->splitCriterion) / nodeWeight) : 0.0;
+
+        if (iNode < iFirstLeaf) continue;
+
+        const size_t iLeaf            = iNode - iFirstLeaf;
+        nodes[iNode].dimension        = static_cast<size_t>(-1);
+        nodes[iNode].leftIndexOrClass = iMaxClass;
+        nodes[iNode].cutPoint         = 0;
+        probIndices[iNode]            = int(iLeaf);
+        for (size_t iClass = 0; iClass < nClasses; ++iClass)
+        {
+            probs[iLeaf * nClasses + iClass] = (nodeWeight > 0) ? double(stats[iClass] / nodeWeight) : 1.0 / double(nClasses);
+        }
+    }
+
+    stumpModel->impl()->setTreeTable(treeTable);
+    stumpModel->impl()->setImpTable(impTbl);
+    stumpModel->impl()->setNodeSmplCntTable(smplCntTbl);
+    stumpModel->impl()->setProbIndicesTable(probIndicesTbl);
+    stumpModel->impl()->setProbTable(probTbl);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -27,6 +27,7 @@
 #include "algorithms/stump/stump_classification_training_types.h"
 #include "algorithms/stump/stump_classification_model.h"
 #include "src/algorithms/kernel.h"
+#include "src/algorithms/stump/stump_train_hist_aux.h"
 #include "data_management/data/numeric_table.h"
 
 using namespace daal::data_management;
@@ -53,6 +54,21 @@ private:
     services::Status changeMinusOneToZero(const algorithmFPtype * yArray, algorithmFPtype * yZeroOne, size_t nVectors);
 };
 
+template <typename algorithmFPtype, CpuType cpu>
+class StumpTrainKernel<hist, algorithmFPtype, cpu> : public Kernel
+{
+public:
+    services::Status compute(size_t n, const NumericTable * const * a, Model * r, const Parameter * par);
+
+private:
+    typedef stump::internal::BinnedData<algorithmFPtype, cpu> BinnedDataType;
+
+    services::Status buildModel(const BinnedDataType & binnedData, size_t iFeature, size_t iBin, const algorithmFPtype * total, Model * r,
+                                const Parameter * par);
+
+    stump::internal::FeatureHistograms<algorithmFPtype, cpu> _histograms;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace classification
@@ -0,0 +1,277 @@
+/* file: stump_regression_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram method of the decision stump regression training.
+//  The split is searched among the borders of the bins using the histograms of
+//  the weighted sums of the responses computed in parallel over the features and the rows.
+//--
+*/
+
+#ifndef __STUMP_REGRESSION_TRAIN_HIST_IMPL_I__
+#define __STUMP_REGRESSION_TRAIN_HIST_IMPL_I__
+
+#include "src/algorithms/stump/stump_train_hist_aux.i"
+#include "src/algorithms/decision_tree/decision_tree_regression_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/* Statistics accumulated in the bins: sum of the weights, weighted sum of the responses and of their squares */
+enum HistStats
+{
+    sumW   = 0,
+    sumWY  = 1,
+    sumWY2 = 2,
+    nHistStats
+};
+
+/**
+ *  \brief Returns the weighted sum of the squared deviations of the responses from their mean
+ */
+template <typename algorithmFPtype>
+inline algorithmFPtype weightedSSE(const algorithmFPtype * stats)
+{
+    return (stats[sumW] > 0) ? stats[sumWY2] - stats[sumWY] * stats[sumWY] / stats[sumW] : algorithmFPtype(0);
+}
+
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<hist, algorithmFPtype, cpu>::compute(size_t n, const NumericTable * const * a,
+                                                                       stump::regression::Model * stumpModel, const Parameter * par)
+{
+    Status s;
+
+    const NumericTable * xTable = a[0];
+    const NumericTable * yTable = a[1];
+    const NumericTable * wTable = (n >= 3 ? a[2] : 0);
+
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t nVectors  = xTable->getNumberOfRows();
+
+    /* The bins are reused by the trainings that share the cache, i.e. by the iterations of one boosting run.
+       Without the cache the features are binned by every training */
+    BinnedDataType localBinnedData;
+    BinnedDataType * const binnedDataCache = dynamic_cast<BinnedDataType *>(par->binnedDataCache.get());
+    BinnedDataType & binnedData            = binnedDataCache ? *binnedDataCache : localBinnedData;
+    DAAL_CHECK_STATUS(s, binnedData.init(*xTable, par->maxBins, par->minBinSize));
+
+    ReadColumns<algorithmFPtype, cpu> yBlock(const_cast<NumericTable *>(yTable), 0, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(yBlock);
+    const algorithmFPtype * const y = yBlock.get();
+
+    ReadColumns<algorithmFPtype, cpu> wBlock;
+    const algorithmFPtype * w = nullptr;
+    if (wTable)
+    {
+        wBlock.set(const_cast<NumericTable *>(wTable), 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(wBlock);
+        w = wBlock.get();
+    }
+
+    algorithmFPtype total[nHistStats] = { 0, 0, 0 };
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        const algorithmFPtype wi = w ? w[i] : algorithmFPtype(1);
+        total[sumW] += wi;
+        total[sumWY] += wi * y[i];
+        total[sumWY2] += wi * y[i] * y[i];
+    }
+
+    if (w)
+    {
+        DAAL_CHECK_STATUS(s, _histograms.compute(binnedData, nHistStats, [=](size_t i, algorithmFPtype * binStats) -> void {
+            binStats[sumW] += w[i];
+            binStats[sumWY] += w[i] * y[i];
+            binStats[sumWY2] += w[i] * y[i] * y[i];
+        }));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, _histograms.compute(binnedData, nHistStats, [=](size_t i, algorithmFPtype * binStats) -> void {
+            binStats[sumW] += algorithmFPtype(1);
+            binStats[sumWY] += y[i];
+            binStats[sumWY2] += y[i] * y[i];
+        }));
+    }
+
+    /* Search for the best split of every feature in parallel */
+    TArray<algorithmFPtype, cpu> aBestSSE(nFeatures);
+    TArray<size_t, cpu> aBestBin(nFeatures);
+    DAAL_CHECK_MALLOC(aBestSSE.get() && aBestBin.get());
+    algorithmFPtype * const bestSSE = aBestSSE.get();
+    size_t * const bestBin          = aBestBin.get();
+
+    const algorithmFPtype maxVal = MaxVal<algorithmFPtype>::get();
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        bestSSE[iFeature] = maxVal;
+        bestBin[iFeature] = 0;
+
+        const size_t nBins = binnedData.nBins(iFeature);
+        if (nBins < 2) return;
+
+        const algorithmFPtype * const featureHist = _histograms.get(iFeature);
+        const bool isCategorical                  = binnedData.isCategorical(iFeature);
+        algorithmFPtype left[nHistStats]          = { 0, 0, 0 };
+        algorithmFPtype right[nHistStats];
+
+        /* Ordered features are split between the neighboring bins,
+           categorical features are split into one category and the rest */
+        const size_t nSplits = isCategorical ? nBins : nBins - 1;
+        for (size_t iBin = 0; iBin < nSplits; ++iBin)
+        {
+            const algorithmFPtype * const binStats = featureHist + iBin * nHistStats;
+            for (size_t iStat = 0; iStat < nHistStats; ++iStat)
+            {
+                left[iStat]  = isCategorical ? binStats[iStat] : left[iStat] + binStats[iStat];
+                right[iStat] = total[iStat] - left[iStat];
+            }
+            const algorithmFPtype sse = weightedSSE(left) + weightedSSE(right);
+            if (sse < bestSSE[iFeature])
+            {
+                bestSSE[iFeature] = sse;
+                bestBin[iFeature] = iBin;
+            }
+        }
+    });
+
+    /* The ties are resolved in favor of the feature with the smallest index */
+    size_t iBestFeature = nFeatures;
+    for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        if (bestSSE[iFeature] < maxVal && (iBestFeature == nFeatures || bestSSE[iFeature] < bestSSE[iBestFeature]))
+        {
+            iBestFeature = iFeature;
+        }
+    }
+
+    const size_t iBestBin = (iBestFeature < nFeatures) ? bestBin[iBestFeature] : 0;
+    return buildModel(binnedData, iBestFeature, iBestBin, total, stumpModel);
+}
+
+/**
+ *  \brief Writes the tree of the stump split by the feature iFeature after the bin iBin to the model.
+ *         The model consists of one leaf if iFeature is equal to the number of features.
+ */
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<hist, algorithmFPtype, cpu>::buildModel(const BinnedDataType & binnedData, size_t iFeature, size_t iBin,
+                                                                          const algorithmFPtype * total, stump::regression::Model * stumpModel)
+{
+    using decision_tree::regression::DecisionTreeNode;
+    using decision_tree::regression::DecisionTreeTable;
+    using decision_tree::regression::DecisionTreeTablePtr;
+
+    const size_t nFeatures = binnedData.nFeatures();
+    const bool isLeaf      = (iFeature == nFeatures);
+    const size_t nNodes    = isLeaf ? 1 : 3;
+
+    services::Status status;
+    DecisionTreeTablePtr treeTable(new DecisionTreeTable(nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<double, cpu> > impTbl(new HomogenNumericTableCPU<double, cpu>(1, nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SharedPtr<HomogenNumericTableCPU<int, cpu> > smplCntTbl(new HomogenNumericTableCPU<int, cpu>(1, nNodes, status));
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DecisionTreeNode * const nodes = static_cast<DecisionTreeNode *>(treeTable->getArray());
+    double * const impVals         = impTbl->getArray();
+    int * const smplCntVals        = smplCntTbl->getArray();
+
+    /* Statistics of the nodes in the order: root, left child, right child */
+    algorithmFPtype nodeStats[3 * nHistStats];
+    for (size_t iStat = 0; iStat < nHistStats; ++iStat)
+    {
+        nodeStats[iStat] = total[iStat];
+    }
+    smplCntVals[0] = int(binnedData.nRows());
+
+    if (!isLeaf)
+    {
+        const bool isCategorical                  = binnedData.isCategorical(iFeature);
+        const size_t iFirstBin                    = isCategorical ? iBin : 0;
+        const algorithmFPtype * const featureHist = _histograms.get(iFeature);
+        algorithmFPtype * const left              = nodeStats + nHistStats;
+        algorithmFPtype * const right             = nodeStats + 2 * nHistStats;
+
+        size_t leftCount = 0;
+        for (size_t iStat = 0; iStat < nHistStats; ++iStat)
+        {
+            left[iStat] = 0;
+        }
+        for (size_t j = iFirstBin; j <= iBin; ++j)
+        {
+            for (size_t iStat = 0; iStat < nHistStats; ++iStat)
+            {
+                left[iStat] += featureHist[j * nHistStats + iStat];
+            }
+            leftCount += binnedData.binSize(iFeature, j);
+        }
+        for (size_t iStat = 0; iStat < nHistStats; ++iStat)
+        {
+            right[iStat] = total[iStat] - left[iStat];
+        }
+
+        nodes[0].dimension                   = iFeature;
+        nodes[0].leftIndex                   = 1;
+        nodes[0].cutPointOrDependantVariable = isCategorical ? binnedData.binMin(iFeature, iBin) : binnedData.cutPoint(iFeature, iBin);
+        smplCntVals[1]                       = int(leftCount);
+        smplCntVals[2]                       = int(binnedData.nRows() - leftCount);
+    }
+
+    const size_t iFirstLeaf = isLeaf ? 0 : 1;
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        const algorithmFPtype * const stats = nodeStats + iNode * nHistStats;
+        impVals[iNode]                      = (stats[sumW] > 0) ? double(weightedSSE(stats) / stats[sumW]) : 0.0;
+
+        if (iNode < iFirstLeaf) continue;
+
+        nodes[iNode].dimension                   = static_cast<size_t>(-1);
+        nodes[iNode].leftIndex                   = 0;
+        nodes[iNode].cutPointOrDependantVariable = (stats[sumW] > 0) ? double(stats[sumWY] / stats[sumW]) : 0.0;
+    }
+
+    stumpModel->impl()->setTreeTable(treeTable);
+    stumpModel->impl()->setImpTable(impTbl);
+    stumpModel->impl()->setNodeSmplCntTable(smplCntTbl);
+    stumpModel->impl()->setNumberOfFeatures(nFeatures);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -27,6 +27,7 @@
 #include "algorithms/stump/stump_regression_training_types.h"
 #include "algorithms/stump/stump_regression_model.h"
 #include "src/algorithms/kernel.h"
+#include "src/algorithms/stump/stump_train_hist_aux.h"
 #include "data_management/data/numeric_table.h"
 
 using namespace daal::data_management;
@@ -50,6 +51,20 @@ public:
     services::Status compute(size_t n, const NumericTable * const * a, Model * r, const Parameter * par);
 };
 
+template <typename algorithmFPtype, CpuType cpu>
+class StumpTrainKernel<hist, algorithmFPtype, cpu> : public Kernel
+{
+public:
+    services::Status compute(size_t n, const NumericTable * const * a, Model * r, const Parameter * par);
+
+private:
+    typedef stump::internal::BinnedData<algorithmFPtype, cpu> BinnedDataType;
+
+    services::Status buildModel(const BinnedDataType & binnedData, size_t iFeature, size_t iBin, const algorithmFPtype * total, Model * r);
+
+    stump::internal::FeatureHistograms<algorithmFPtype, cpu> _histograms;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace regression
@@ -0,0 +1,157 @@
+/* file: stump_train_hist_aux.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the binned data set and the histograms used by
+//  the histogram method of the decision stump training
+//--
+*/
+
+#ifndef __STUMP_TRAIN_HIST_AUX_H__
+#define __STUMP_TRAIN_HIST_AUX_H__
+
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace internal
+{
+using daal::services::internal::TArray;
+
+/**
+ *  \brief Training data set with the features mapped to bins.
+ *         Passed to the stump as binnedDataCache parameter, the data set is binned by the first training
+ *         and the bins are reused by the following trainings on the same data table
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BinnedData : public daal::Base
+{
+public:
+    typedef dtrees::internal::IndexedFeatures::IndexType IndexType;
+
+    DAAL_NEW_DELETE();
+
+    BinnedData() : _table(nullptr), _nRows(0), _nFeatures(0), _maxNumBins(0), _maxBins(0), _minBinSize(0) {}
+
+    /**
+     *  \brief Maps the features of the data set to bins if the data set differs from the one binned before
+     *
+     *  \param[in] x          Training data set
+     *  \param[in] maxBins    Maximal number of bins of the continuous feature
+     *  \param[in] minBinSize Minimal number of observations in the bin
+     */
+    services::Status init(const data_management::NumericTable & x, size_t maxBins, size_t minBinSize);
+
+    size_t nRows() const { return _nRows; }
+    size_t nFeatures() const { return _nFeatures; }
+
+    /* Maximal number of bins among all features */
+    size_t maxNumBins() const { return _maxNumBins; }
+
+    size_t nBins(size_t iFeature) const { return _indexedFeatures.numIndices(iFeature); }
+
+    /* Indices of the bins of all observations for the feature */
+    const IndexType * bins(size_t iFeature) const { return _indexedFeatures.data(iFeature); }
+
+    bool isCategorical(size_t iFeature) const { return _categorical[iFeature]; }
+
+    /* Number of observations in the bin */
+    size_t binSize(size_t iFeature, size_t iBin) const { return _binSize[iFeature * _maxNumBins + iBin]; }
+
+    /* The smallest and the largest values of the feature among the observations in the bin */
+    algorithmFPType binMin(size_t iFeature, size_t iBin) const { return _binMin[iFeature * _maxNumBins + iBin]; }
+    algorithmFPType binMax(size_t iFeature, size_t iBin) const { return _binMax[iFeature * _maxNumBins + iBin]; }
+
+    /* Cut point between the bins iBin and iBin + 1 of the ordered feature.
+       The observations with the feature value not greater than the cut point go to the left child */
+    algorithmFPType cutPoint(size_t iFeature, size_t iBin) const { return (binMax(iFeature, iBin) + binMin(iFeature, iBin + 1)) / 2; }
+
+private:
+    services::Status computeBinBorders(const data_management::NumericTable & x);
+
+    const data_management::NumericTable * _table;
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _maxNumBins;
+    size_t _maxBins;
+    size_t _minBinSize;
+    dtrees::internal::IndexedFeatures _indexedFeatures;
+    TArray<bool, cpu> _categorical;
+    TArray<size_t, cpu> _binSize;
+    TArray<algorithmFPType, cpu> _binMin;
+    TArray<algorithmFPType, cpu> _binMax;
+};
+
+/**
+ *  \brief Histograms of the statistics of the observations in the bins of every feature
+ */
+template <typename algorithmFPType, CpuType cpu>
+class FeatureHistograms
+{
+public:
+    FeatureHistograms() : _featureStride(0) {}
+
+    /**
+     *  \brief Accumulates the histograms in parallel over the features and the blocks of rows
+     *
+     *  \param[in] data     Binned data set
+     *  \param[in] nStats   Number of the statistics accumulated in each bin
+     *  \param[in] addStats Functor that adds the statistics of the i-th observation to the bin,
+     *                      called as addStats(i, binStats)
+     */
+    template <typename AddStats>
+    services::Status compute(const BinnedData<algorithmFPType, cpu> & data, size_t nStats, const AddStats & addStats);
+
+    /* Statistics of the bins of the feature, nStats values per bin */
+    const algorithmFPType * get(size_t iFeature) const { return _hist.get() + iFeature * _featureStride; }
+
+private:
+    size_t _featureStride;
+    TArray<algorithmFPType, cpu> _hist;
+};
+
+/**
+ *  \brief Makes the trainings of the weak learner share the binned data if it is the stump trained by the hist method.
+ *         Used by the boosting algorithms for their own copy of the weak learner, so the bins live for one boosting run only.
+ *         The trainings sharing the bins must use the same data table that is not modified in between and must not run concurrently
+ *
+ *  \tparam StumpBatch Batch algorithm of the stump training by the hist method
+ *  \param[in] learner Training algorithm of the weak learner
+ */
+template <typename StumpBatch, typename algorithmFPType, CpuType cpu, typename LearnerPtr>
+void shareBinnedData(const LearnerPtr & learner)
+{
+    StumpBatch * const stumpLearner = dynamic_cast<StumpBatch *>(learner.get());
+    if (stumpLearner)
+    {
+        stumpLearner->parameter().binnedDataCache.reset(new BinnedData<algorithmFPType, cpu>());
+    }
+}
+
+} // namespace internal
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,198 @@
+/* file: stump_train_hist_aux.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the binned data set and the histograms used by
+//  the histogram method of the decision stump training
+//--
+*/
+
+#ifndef __STUMP_TRAIN_HIST_AUX_I__
+#define __STUMP_TRAIN_HIST_AUX_I__
+
+#include "src/algorithms/stump/stump_train_hist_aux.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.i"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+
+/* Minimal number of rows in the block processed by one task of the histogram computation */
+const size_t histRowBlockSize = 4096;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BinnedData<algorithmFPType, cpu>::init(const NumericTable & x, size_t maxBins, size_t minBinSize)
+{
+    const size_t nRows     = x.getNumberOfRows();
+    const size_t nFeatures = x.getNumberOfColumns();
+    if (_table == &x && _nRows == nRows && _nFeatures == nFeatures && _maxBins == maxBins && _minBinSize == minBinSize)
+    {
+        return services::Status();
+    }
+
+    /* The cached bins are not valid until the binning of the new data set succeeds */
+    _table = nullptr;
+
+    dtrees::internal::FeatureTypes featureTypes;
+    DAAL_CHECK_MALLOC(featureTypes.init(x));
+
+    const dtrees::internal::BinParams binParams(maxBins, minBinSize);
+    services::Status s = _indexedFeatures.init<algorithmFPType, cpu>(x, &featureTypes, &binParams);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _categorical.reset(nFeatures);
+    DAAL_CHECK_MALLOC(_categorical.get());
+    for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        _categorical[iFeature] = featureTypes.isUnordered(iFeature);
+    }
+
+    _nRows      = nRows;
+    _nFeatures  = nFeatures;
+    _maxNumBins = _indexedFeatures.maxNumIndices();
+    DAAL_CHECK_STATUS(s, computeBinBorders(x));
+
+    _table      = &x;
+    _maxBins    = maxBins;
+    _minBinSize = minBinSize;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BinnedData<algorithmFPType, cpu>::computeBinBorders(const NumericTable & x)
+{
+    const size_t nBinsTotal = _nFeatures * _maxNumBins;
+    _binSize.reset(nBinsTotal);
+    _binMin.reset(nBinsTotal);
+    _binMax.reset(nBinsTotal);
+    DAAL_CHECK_MALLOC(_binSize.get() && _binMin.get() && _binMax.get());
+
+    const algorithmFPType maxVal = services::internal::MaxVal<algorithmFPType>::get();
+
+    SafeStatus safeStat;
+    daal::threader_for(_nFeatures, _nFeatures, [&](size_t iFeature) {
+        ReadColumns<algorithmFPType, cpu> column(const_cast<NumericTable &>(x), iFeature, 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(column);
+        const algorithmFPType * const values = column.get();
+        const IndexType * const aBin         = bins(iFeature);
+
+        size_t * const aSize         = _binSize.get() + iFeature * _maxNumBins;
+        algorithmFPType * const aMin = _binMin.get() + iFeature * _maxNumBins;
+        algorithmFPType * const aMax = _binMax.get() + iFeature * _maxNumBins;
+        for (size_t iBin = 0; iBin < _maxNumBins; ++iBin)
+        {
+            aSize[iBin] = 0;
+            aMin[iBin]  = maxVal;
+            aMax[iBin]  = -maxVal;
+        }
+
+        for (size_t i = 0; i < _nRows; ++i)
+        {
+            const IndexType iBin = aBin[i];
+            ++aSize[iBin];
+            if (values[i] < aMin[iBin]) aMin[iBin] = values[i];
+            if (values[i] > aMax[iBin]) aMax[iBin] = values[i];
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename AddStats>
+services::Status FeatureHistograms<algorithmFPType, cpu>::compute(const BinnedData<algorithmFPType, cpu> & data, size_t nStats,
+                                                                  const AddStats & addStats)
+{
+    typedef typename BinnedData<algorithmFPType, cpu>::IndexType IndexType;
+
+    const size_t nRows     = data.nRows();
+    const size_t nFeatures = data.nFeatures();
+    const size_t histSize  = data.maxNumBins() * nStats;
+
+    /* The rows are split into blocks when there are not enough features to load all threads */
+    const size_t nThreads = threader_get_threads_number();
+    size_t nBlocks        = 1;
+    if (nFeatures < nThreads)
+    {
+        const size_t maxBlocks = nRows / histRowBlockSize;
+        nBlocks                = (nThreads + nFeatures - 1) / nFeatures;
+        if (nBlocks > maxBlocks) nBlocks = (maxBlocks ? maxBlocks : 1);
+    }
+    const size_t blockSize = (nRows + nBlocks - 1) / nBlocks;
+
+    _featureStride         = nBlocks * histSize;
+    const size_t totalSize = nFeatures * _featureStride;
+    if (_hist.size() < totalSize)
+    {
+        _hist.reset(totalSize);
+        DAAL_CHECK_MALLOC(_hist.get());
+    }
+    algorithmFPType * const hist = _hist.get();
+
+    const size_t nTasks = nFeatures * nBlocks;
+    daal::threader_for(nTasks, nTasks, [&](size_t iTask) {
+        const size_t iFeature = iTask / nBlocks;
+        const size_t iStart   = (iTask % nBlocks) * blockSize;
+        const size_t iEnd     = (iStart + blockSize < nRows) ? iStart + blockSize : nRows;
+
+        algorithmFPType * const blockHist = hist + iTask * histSize;
+        services::internal::service_memset_seq<algorithmFPType, cpu>(blockHist, algorithmFPType(0), histSize);
+
+        const IndexType * const aBin = data.bins(iFeature);
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            addStats(i, blockHist + aBin[i] * nStats);
+        }
+    });
+
+    if (nBlocks > 1)
+    {
+        daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+            algorithmFPType * const featureHist = hist + iFeature * _featureStride;
+            for (size_t iBlock = 1; iBlock < nBlocks; ++iBlock)
+            {
+                const algorithmFPType * const blockHist = featureHist + iBlock * histSize;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < histSize; ++j)
+                {
+                    featureHist[j] += blockHist[j];
+                }
+            }
+        });
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,260 @@
+/* file: hist.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the histogram training method of the decision stump against the default one
+//  on the data sets where the bins are exactly the unique values of the features,
+//  and its use as the weak learner of the boosting algorithms
+//--
+*/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithms/boosting/adaboost_predict.h"
+#include "algorithms/boosting/adaboost_training_batch.h"
+#include "algorithms/boosting/brownboost_predict.h"
+#include "algorithms/boosting/brownboost_training_batch.h"
+#include "algorithms/stump/stump_classification_predict.h"
+#include "algorithms/stump/stump_classification_training_batch.h"
+#include "algorithms/stump/stump_regression_predict.h"
+#include "algorithms/stump/stump_regression_training_batch.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal::algorithms::stump::test
+{
+using namespace daal::data_management;
+
+/* Features take nValues integer values, so every value has its own bin */
+class FewUniqueValuesDataset
+{
+public:
+    static constexpr size_t nRows   = 2000;
+    static constexpr size_t nCols   = 6;
+    static constexpr size_t nValues = 10;
+
+    explicit FewUniqueValuesDataset(std::uint32_t seed) : _x(nRows * nCols), _labels(nRows), _responses(nRows), _weights(nRows)
+    {
+        std::mt19937 rng(seed);
+        for (auto & value : _x) value = double(rng() % nValues);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            /* The label depends on the feature 3 with 10% of noise, the response depends on the feature 1 */
+            const bool isNoise = (rng() % 10 == 0);
+            _labels[i]         = ((_x[i * nCols + 3] >= 6.0) != isNoise) ? 1.0 : -1.0;
+            _responses[i]      = 2.0 * double(_x[i * nCols + 1] >= 4.0) + double(rng() % 1000) / 1000.0;
+            _weights[i]        = 0.5 + double(rng() % 1000) / 1000.0;
+        }
+    }
+
+    NumericTablePtr x() { return HomogenNumericTable<double>::create(_x.data(), nCols, nRows); }
+    NumericTablePtr labels() { return HomogenNumericTable<double>::create(_labels.data(), 1, nRows); }
+    NumericTablePtr responses() { return HomogenNumericTable<double>::create(_responses.data(), 1, nRows); }
+    NumericTablePtr weights() { return HomogenNumericTable<double>::create(_weights.data(), 1, nRows); }
+
+    std::vector<double> & rawX() { return _x; }
+    const std::vector<double> & rawLabels() const { return _labels; }
+
+private:
+    std::vector<double> _x;
+    std::vector<double> _labels;
+    std::vector<double> _responses;
+    std::vector<double> _weights;
+};
+
+static std::vector<double> readColumn(const NumericTablePtr & table)
+{
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, table->getNumberOfRows(), readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + table->getNumberOfRows());
+    table->releaseBlockOfRows(block);
+    return values;
+}
+
+template <classification::training::Method method>
+static std::vector<double> trainAndPredictClassification(classification::training::Batch<double, method> & training, const NumericTablePtr & x,
+                                                         const NumericTablePtr & labels, const NumericTablePtr & weights)
+{
+    training.input.set(classifier::training::data, x);
+    training.input.set(classifier::training::labels, labels);
+    if (weights) training.input.set(classifier::training::weights, weights);
+    EXPECT_TRUE(training.compute().ok());
+
+    classification::prediction::Batch<double> prediction;
+    prediction.input.set(classifier::prediction::data, x);
+    prediction.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+    EXPECT_TRUE(prediction.compute().ok());
+    return readColumn(prediction.getResult()->get(classifier::prediction::prediction));
+}
+
+template <regression::training::Method method>
+static std::vector<double> trainAndPredictRegression(const NumericTablePtr & x, const NumericTablePtr & responses, const NumericTablePtr & weights)
+{
+    regression::training::Batch<double, method> training;
+    training.input.set(algorithms::regression::training::data, x);
+    training.input.set(algorithms::regression::training::dependentVariables, responses);
+    if (weights) training.input.set(algorithms::regression::training::weights, weights);
+    EXPECT_TRUE(training.compute().ok());
+
+    regression::prediction::Batch<double> prediction;
+    prediction.input.set(algorithms::regression::prediction::data, x);
+    prediction.input.set(algorithms::regression::prediction::model, training.getResult()->get(algorithms::regression::training::model));
+    EXPECT_TRUE(prediction.compute().ok());
+    return readColumn(prediction.getResult()->get(regression::prediction::prediction));
+}
+
+static double accuracy(const std::vector<double> & predicted, const std::vector<double> & expected)
+{
+    size_t nCorrect = 0;
+    for (size_t i = 0; i < expected.size(); ++i) nCorrect += (predicted[i] == expected[i]);
+    return double(nCorrect) / double(expected.size());
+}
+
+class StumpHistTest : public ::testing::TestWithParam<bool>
+{
+protected:
+    StumpHistTest() : dataset(777) {}
+
+    NumericTablePtr weights() { return GetParam() ? dataset.weights() : NumericTablePtr(); }
+
+    FewUniqueValuesDataset dataset;
+};
+
+TEST_P(StumpHistTest, ClassificationMatchesDefault)
+{
+    classification::training::Batch<double, classification::training::defaultDense> exact;
+    classification::training::Batch<double, classification::training::hist> hist;
+    const std::vector<double> expected = trainAndPredictClassification(exact, dataset.x(), dataset.labels(), weights());
+    const std::vector<double> actual   = trainAndPredictClassification(hist, dataset.x(), dataset.labels(), weights());
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_P(StumpHistTest, RegressionMatchesDefault)
+{
+    const std::vector<double> expected = trainAndPredictRegression<regression::training::defaultDense>(dataset.x(), dataset.responses(), weights());
+    const std::vector<double> actual   = trainAndPredictRegression<regression::training::hist>(dataset.x(), dataset.responses(), weights());
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(expected[i], actual[i], 1e-10) << "i = " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(WithAndWithoutWeights, StumpHistTest, ::testing::Values(false, true));
+
+/* The same algorithm object retrained on the data modified in place must not reuse the bins of the old data */
+TEST(StumpHistRetrainTest, RetrainOnModifiedDataBinsAgain)
+{
+    FewUniqueValuesDataset dataset(777);
+    const NumericTablePtr x      = dataset.x();
+    const NumericTablePtr labels = dataset.labels();
+
+    classification::training::Batch<double, classification::training::hist> hist;
+    trainAndPredictClassification(hist, x, labels, NumericTablePtr());
+
+    /* Move the signal from the feature 3 to the feature 0 in place */
+    std::vector<double> & rawX = dataset.rawX();
+    for (size_t i = 0; i < FewUniqueValuesDataset::nRows; ++i)
+    {
+        std::swap(rawX[i * FewUniqueValuesDataset::nCols], rawX[i * FewUniqueValuesDataset::nCols + 3]);
+        rawX[i * FewUniqueValuesDataset::nCols] *= 10.0;
+    }
+
+    classification::training::Batch<double, classification::training::hist> fresh;
+    const std::vector<double> expected = trainAndPredictClassification(fresh, x, labels, NumericTablePtr());
+    const std::vector<double> actual   = trainAndPredictClassification(hist, x, labels, NumericTablePtr());
+    EXPECT_EQ(expected, actual);
+    EXPECT_GT(accuracy(actual, dataset.rawLabels()), 0.85);
+}
+
+/* The class is 1 for the category 2 of the feature 0 only, so no split of the ordered feature separates the classes */
+TEST(StumpHistCategoricalTest, SplitsOneCategoryFromTheRest)
+{
+    const size_t nRows = 1000, nCols = 3, nCategories = 4;
+    std::vector<double> rawX(nRows * nCols), rawLabels(nRows);
+    std::mt19937 rng(777);
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        rawX[i * nCols]     = double(rng() % nCategories);
+        rawX[i * nCols + 1] = double(rng() % 1000);
+        rawX[i * nCols + 2] = double(rng() % 1000);
+        rawLabels[i]        = (rawX[i * nCols] == 2.0) ? 1.0 : -1.0;
+    }
+    const NumericTablePtr labels = HomogenNumericTable<double>::create(rawLabels.data(), 1, nRows);
+
+    const NumericTablePtr ordered = HomogenNumericTable<double>::create(rawX.data(), nCols, nRows);
+    classification::training::Batch<double, classification::training::hist> orderedTraining;
+    EXPECT_LT(accuracy(trainAndPredictClassification(orderedTraining, ordered, labels, NumericTablePtr()), rawLabels), 1.0);
+
+    const NumericTablePtr categorical = HomogenNumericTable<double>::create(rawX.data(), nCols, nRows);
+    (*categorical->getDictionary())[0].featureType = features::DAAL_CATEGORICAL;
+    classification::training::Batch<double, classification::training::hist> categoricalTraining;
+    EXPECT_EQ(accuracy(trainAndPredictClassification(categoricalTraining, categorical, labels, NumericTablePtr()), rawLabels), 1.0);
+}
+
+/* Trains the boosting algorithm with the stumps trained by the given method and returns the predictions on the training data */
+template <classification::training::Method method, typename TrainingBatch, typename PredictionBatch>
+static std::vector<double> trainAndPredictBoosting(TrainingBatch & training, PredictionBatch & prediction, FewUniqueValuesDataset & dataset)
+{
+    training.parameter().weakLearnerTraining.reset(new classification::training::Batch<double, method>());
+    training.parameter().weakLearnerPrediction.reset(new classification::prediction::Batch<double>());
+    training.parameter().maxIterations = 10;
+    training.input.set(classifier::training::data, dataset.x());
+    training.input.set(classifier::training::labels, dataset.labels());
+    EXPECT_TRUE(training.compute().ok());
+
+    prediction.parameter().weakLearnerPrediction.reset(new classification::prediction::Batch<double>());
+    prediction.input.set(classifier::prediction::data, dataset.x());
+    prediction.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+    EXPECT_TRUE(prediction.compute().ok());
+    return readColumn(prediction.getResult()->get(classifier::prediction::prediction));
+}
+
+/* The weights of the observations change between the iterations of boosting and every iteration bins the data again
+   unless the stumps share the bins, so the predictions of both methods must agree on the data with few unique values */
+template <typename MakeTraining, typename MakePrediction>
+static void checkBoostingMatchesDefault(const MakeTraining & makeTraining, const MakePrediction & makePrediction)
+{
+    FewUniqueValuesDataset dataset(777);
+
+    auto exactTraining                 = makeTraining();
+    auto exactPrediction               = makePrediction();
+    const std::vector<double> expected = trainAndPredictBoosting<classification::training::defaultDense>(exactTraining, exactPrediction, dataset);
+
+    auto histTraining                = makeTraining();
+    auto histPrediction              = makePrediction();
+    const std::vector<double> actual = trainAndPredictBoosting<classification::training::hist>(histTraining, histPrediction, dataset);
+
+    EXPECT_GT(accuracy(actual, expected), 0.99);
+    EXPECT_GT(accuracy(actual, dataset.rawLabels()), 0.85);
+}
+
+TEST(StumpHistBoostingTest, AdaBoostMatchesDefault)
+{
+    checkBoostingMatchesDefault([]() { return adaboost::training::Batch<double>(2); }, []() { return adaboost::prediction::Batch<double>(2); });
+}
+
+TEST(StumpHistBoostingTest, BrownBoostMatchesDefault)
+{
+    checkBoostingMatchesDefault([]() { return brownboost::training::Batch<double>(); }, []() { return brownboost::prediction::Batch<double>(); });
+}
+
+} // namespace daal::algorithms::stump::test
@@ -37,8 +37,9 @@ services::Status rocAucScoreImpl(const NumericTablePtr & truePrediction, const N
     services::Status s;
     SafeStatus safeStat;
     const size_t nElements = truePrediction->getNumberOfRows();
-    TArrayScalable<IdxValType<double>, cpu> predict(nElements);
-    DAAL_CHECK_MALLOC(predict.get());
+    TArrayScalable<KeyValType<double, size_t>, cpu> predict(nElements);
+    TArrayScalable<KeyValType<double, size_t>, cpu> sortBuffer(nElements);
+    DAAL_CHECK_MALLOC(predict.get() && sortBuffer.get());
 
     const size_t blockSizeDefault = 256;
     const size_t nBlocks          = nElements / blockSizeDefault + !!(nElements % blockSizeDefault);
@@ -53,13 +54,13 @@ services::Status rocAucScoreImpl(const NumericTablePtr & truePrediction, const N
 
         for (size_t i = 0; i < blockSize; ++i)
         {
-            const size_t idx   = blockBegin + i;
-            predict[idx].value = testPredictionPtr[i];
-            predict[idx].index = idx;
+            const size_t idx = blockBegin + i;
+            predict[idx].key = testPredictionPtr[i];
+            predict[idx].val = idx;
         }
     });
 
-    daal::parallel_sort<double>(predict.get(), predict.get() + nElements);
+    daal::parallel_radix_sort(predict.get(), predict.get() + nElements, sortBuffer.get());
 
     size_t rank            = 1;
     size_t elementsInBlock = 1;
@@ -69,7 +70,7 @@ services::Status rocAucScoreImpl(const NumericTablePtr & truePrediction, const N
     while (i < nElements)
     {
         size_t j = i;
-        while ((j < (nElements - 1)) && (predict[j].value == predict[j + 1].value))
+        while ((j < (nElements - 1)) && (predict[j].key == predict[j + 1].key))
         {
             j++;
         }
@@ -79,7 +80,7 @@ services::Status rocAucScoreImpl(const NumericTablePtr & truePrediction, const N
         PRAGMA_VECTOR_ALWAYS
         for (size_t j = 0; j < elementsInBlock; ++j)
         {
-            const size_t idx   = predict[i + j].index;
+            const size_t idx   = predict[i + j].val;
             predictedRank[idx] = static_cast<double>(rank) + ((static_cast<double>(elementsInBlock) - double(1.0)) * double(0.5));
         }
         rank += elementsInBlock;
@@ -0,0 +1,93 @@
+/* file: roc_auc_score.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the ROC AUC score on the predictions with the tied scores
+//--
+*/
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/internal/roc_auc_score.h"
+
+namespace daal::data_management::internal::test
+{
+static double score(std::vector<int> labels, std::vector<double> predictions)
+{
+    const size_t n = labels.size();
+    return rocAucScore(HomogenNumericTable<int>::create(labels.data(), 1, n), HomogenNumericTable<double>::create(predictions.data(), 1, n));
+}
+
+/* Probability that a positive has the higher score than a negative, the ties count as one half */
+static double expectedScore(const std::vector<int> & labels, const std::vector<double> & predictions)
+{
+    std::map<double, std::pair<double, double> > counts;
+    double nPos = 0.0, nNeg = 0.0;
+    for (size_t i = 0; i < labels.size(); ++i)
+    {
+        (labels[i] ? counts[predictions[i]].first : counts[predictions[i]].second) += 1.0;
+        (labels[i] ? nPos : nNeg) += 1.0;
+    }
+
+    double pairs = 0.0, nNegBelow = 0.0;
+    for (const auto & count : counts)
+    {
+        pairs += count.second.first * (nNegBelow + 0.5 * count.second.second);
+        nNegBelow += count.second.second;
+    }
+    return pairs / (nPos * nNeg);
+}
+
+TEST(RocAucScoreTest, DistinctScores)
+{
+    EXPECT_DOUBLE_EQ(score({ 0, 0, 1, 1 }, { 0.1, 0.4, 0.35, 0.8 }), 0.75);
+}
+
+TEST(RocAucScoreTest, TiedScores)
+{
+    EXPECT_DOUBLE_EQ(score({ 0, 1, 0, 1, 1 }, { 0.2, 0.2, 0.7, 0.7, 0.9 }), 4.0 / 6.0);
+    EXPECT_DOUBLE_EQ(score({ 1, 0, 0, 1, 0 }, { 0.5, 0.5, 0.5, 0.5, 0.5 }), 0.5);
+    EXPECT_DOUBLE_EQ(score({ 0, 1, 1, 0 }, { -0.0, 0.0, -0.0, 0.0 }), 0.5);
+}
+
+/* Many rows with few distinct scores, so the tied scores come from all the blocks of the sort */
+TEST(RocAucScoreTest, ManyTiedScores)
+{
+    std::mt19937 rng(777);
+    std::uniform_int_distribution<int> level(-5, 5);
+    std::bernoulli_distribution coin(0.5);
+    for (size_t n : { size_t(1000), size_t(100003) })
+    {
+        std::vector<int> labels(n);
+        std::vector<double> predictions(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int l    = level(rng);
+            predictions[i] = l == 0 ? (coin(rng) ? 0.0 : -0.0) : 0.1 * l;
+            labels[i]      = std::bernoulli_distribution(0.5 + 0.04 * l)(rng);
+        }
+        EXPECT_NEAR(score(labels, predictions), expectedScore(labels, predictions), 1e-12) << "n = " << n;
+    }
+}
+
+} // namespace daal::data_management::internal::test
@@ -288,6 +288,10 @@ typedef bool (*_daal_is_in_parallel_t)();
 typedef void (*_daal_tbb_task_scheduler_free_t)(void *& globalControl);
 typedef size_t (*_setNumberOfThreads_t)(const size_t, void **);
 typedef void * (*_daal_threader_env_t)();
+typedef void (*_daal_set_numa_affinity_t)(bool);
+typedef bool (*_daal_is_numa_affinity_enabled_t)();
+typedef void (*_daal_set_deterministic_reductions_t)(bool);
+typedef bool (*_daal_is_deterministic_reductions_enabled_t)();
 
 typedef void (*_daal_parallel_sort_int32_t)(int *, int *);
 typedef void (*_daal_parallel_sort_uint64_t)(size_t *, size_t *);
@@ -352,6 +356,11 @@ static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr                     = NULL;
 static _daal_threader_env_t _daal_threader_env_ptr                       = NULL;
 
+static _daal_set_numa_affinity_t _daal_set_numa_affinity_ptr                                     = NULL;
+static _daal_is_numa_affinity_enabled_t _daal_is_numa_affinity_enabled_ptr                       = NULL;
+static _daal_set_deterministic_reductions_t _daal_set_deterministic_reductions_ptr               = NULL;
+static _daal_is_deterministic_reductions_enabled_t _daal_is_deterministic_reductions_enabled_ptr = NULL;
+
 static _daal_parallel_sort_int32_t _daal_parallel_sort_int32_ptr                         = NULL;
 static _daal_parallel_sort_uint64_t _daal_parallel_sort_uint64_ptr                       = NULL;
 static _daal_parallel_sort_pair_int32_uint64_t _daal_parallel_sort_pair_int32_uint64_ptr = NULL;
@@ -491,6 +500,57 @@ DAAL_EXPORT void _daal_parallel_sort_pair_fp64_uint64(daal::IdxValType<double> *
     _daal_parallel_sort_pair_fp64_uint64_ptr(begin_ptr, end_ptr);
 }
 
+#define CALL_THR_VOID_FUNC_FROM_DLL(fn_name, argdecl, argcall)         \
+    typedef void(*fn_name##_t) argdecl;                                \
+    static fn_name##_t fn_name##_ptr = NULL;                           \
+    DAAL_EXPORT void fn_name argdecl                                   \
+    {                                                                  \
+        load_daal_thr_dll();                                           \
+        if (fn_name##_ptr == NULL)                                     \
+        {                                                              \
+            fn_name##_ptr = (fn_name##_t)load_daal_thr_func(#fn_name); \
+        }                                                              \
+        fn_name##_ptr argcall;                                         \
+    }
+
+#define CALL_THR_RADIX_SORT_FROM_DLL(TYPE, NAMESUFFIX)                                                                         \
+    CALL_THR_VOID_FUNC_FROM_DLL(_daal_parallel_radix_sort_##NAMESUFFIX, (TYPE * begin_ptr, TYPE * end_ptr, TYPE * buffer_ptr), \
+                                (begin_ptr, end_ptr, buffer_ptr))
+
+#define CALL_THR_RADIX_SORT_PAIR_FROM_DLL(KEYTYPE, VALTYPE, NAMESUFFIX)                                                        \
+    CALL_THR_VOID_FUNC_FROM_DLL(_daal_parallel_radix_sort_##NAMESUFFIX,                                                        \
+                                (daal::KeyValType<KEYTYPE, VALTYPE> * begin_ptr, daal::KeyValType<KEYTYPE, VALTYPE> * end_ptr, \
+                                 daal::KeyValType<KEYTYPE, VALTYPE> * buffer_ptr),                                             \
+                                (begin_ptr, end_ptr, buffer_ptr))
+
+#define CALL_THR_SEGMENTED_SORT_FROM_DLL(TYPE, NAMESUFFIX)                                                                                  \
+    CALL_THR_VOID_FUNC_FROM_DLL(_daal_parallel_segmented_sort_##NAMESUFFIX, (TYPE * data_ptr, const int64_t * offsets, int64_t n_segments), \
+                                (data_ptr, offsets, n_segments))
+
+CALL_THR_RADIX_SORT_FROM_DLL(int, int32)
+CALL_THR_RADIX_SORT_FROM_DLL(int64_t, int64)
+CALL_THR_RADIX_SORT_FROM_DLL(float, fp32)
+CALL_THR_RADIX_SORT_FROM_DLL(double, fp64)
+
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(int, int, pair_int32_int32)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(int64_t, int, pair_int64_int32)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(float, int, pair_fp32_int32)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(double, int, pair_fp64_int32)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(int, size_t, pair_int32_uint64)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(int64_t, size_t, pair_int64_uint64)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(float, size_t, pair_fp32_uint64)
+CALL_THR_RADIX_SORT_PAIR_FROM_DLL(double, size_t, pair_fp64_uint64)
+
+CALL_THR_SEGMENTED_SORT_FROM_DLL(int, int32)
+CALL_THR_SEGMENTED_SORT_FROM_DLL(int64_t, int64)
+CALL_THR_SEGMENTED_SORT_FROM_DLL(float, fp32)
+CALL_THR_SEGMENTED_SORT_FROM_DLL(double, fp64)
+
+#undef CALL_THR_SEGMENTED_SORT_FROM_DLL
+#undef CALL_THR_RADIX_SORT_PAIR_FROM_DLL
+#undef CALL_THR_RADIX_SORT_FROM_DLL
+#undef CALL_THR_VOID_FUNC_FROM_DLL
+
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func)
 {
     load_daal_thr_dll();
@@ -798,6 +858,47 @@ DAAL_EXPORT void * _daal_threader_env()
     return _daal_threader_env_ptr();
 }
 
+DAAL_EXPORT void _daal_set_numa_affinity(bool enable)
+{
+    load_daal_thr_dll();
+    if (_daal_set_numa_affinity_ptr == NULL)
+    {
+        _daal_set_numa_affinity_ptr = (_daal_set_numa_affinity_t)load_daal_thr_func("_daal_set_numa_affinity");
+    }
+    _daal_set_numa_affinity_ptr(enable);
+}
+
+DAAL_EXPORT bool _daal_is_numa_affinity_enabled()
+{
+    load_daal_thr_dll();
+    if (_daal_is_numa_affinity_enabled_ptr == NULL)
+    {
+        _daal_is_numa_affinity_enabled_ptr = (_daal_is_numa_affinity_enabled_t)load_daal_thr_func("_daal_is_numa_affinity_enabled");
+    }
+    return _daal_is_numa_affinity_enabled_ptr();
+}
+
+DAAL_EXPORT void _daal_set_deterministic_reductions(bool enable)
+{
+    load_daal_thr_dll();
+    if (_daal_set_deterministic_reductions_ptr == NULL)
+    {
+        _daal_set_deterministic_reductions_ptr = (_daal_set_deterministic_reductions_t)load_daal_thr_func("_daal_set_deterministic_reductions");
+    }
+    _daal_set_deterministic_reductions_ptr(enable);
+}
+
+DAAL_EXPORT bool _daal_is_deterministic_reductions_enabled()
+{
+    load_daal_thr_dll();
+    if (_daal_is_deterministic_reductions_enabled_ptr == NULL)
+    {
+        _daal_is_deterministic_reductions_enabled_ptr =
+            (_daal_is_deterministic_reductions_enabled_t)load_daal_thr_func("_daal_is_deterministic_reductions_enabled");
+    }
+    return _daal_is_deterministic_reductions_enabled_ptr();
+}
+
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 DAAL_EXPORT void _thread_pinner_thread_pinner_init()
 {
@@ -107,7 +107,7 @@ private:
 
     #define DAAL_ITTNOTIFY_DOMAIN(name)
     #define DAAL_ITTNOTIFY_SCOPED_TASK(name) \
-        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = daal::internal::Profiler::startTask(#name);
+        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_task__, DAAL_ITTNOTIFY_UNIQUE_ID)(#name)
 
 #endif // __DAAL_ITTNOTIFY_ENABLE__
 #endif // __SERVICE_ITTNOTIFY_H__
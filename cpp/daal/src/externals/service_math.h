@@ -47,6 +47,8 @@ struct Math
 
     static fpType sSqrt(fpType in) { return _impl<fpType, cpu>::sSqrt(in); }
 
+    static fpType sCos(fpType in) { return _impl<fpType, cpu>::sCos(in); }
+
     static fpType sPowx(fpType in, fpType in1) { return _impl<fpType, cpu>::sPowx(in, in1); }
 
     static fpType sCeil(fpType in) { return _impl<fpType, cpu>::sCeil(in); }
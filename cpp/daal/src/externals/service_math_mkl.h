@@ -157,6 +157,8 @@ struct MklMath<double, cpu>
 
     static double sSqrt(double in) { return sqrt(in); }
 
+    static double sCos(double in) { return cos(in); }
+
     static double sPowx(double in, double in1)
     {
         double r;
@@ -239,6 +241,8 @@ struct MklMath<float, cpu>
 
     static float sSqrt(float in) { return sqrt(in); }
 
+    static float sCos(float in) { return cosf(in); }
+
     static float sPowx(float in, float in1)
     {
         float r;
@@ -23,9 +23,17 @@
 
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
+#include "src/services/service_host_arena.h"
+#include "src/threading/threading.h"
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
+    daal::services::internal::HostArena * const arena = daal::services::internal::getCurrentHostArena();
+    if (arena)
+    {
+        void * const ptr = arena->allocate(size, alignment);
+        if (ptr) return ptr;
+    }
     return daal::internal::Service<>::serv_malloc(size, alignment);
 }
 
@@ -47,8 +55,23 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
     return ptr;
 }
 
+void daal::services::daal_first_touch(void * ptr, size_t size)
+{
+    /* Smaller blocks fit into the caches, so their placement does not matter */
+    const size_t pageSize     = 4096;
+    const size_t minTouchSize = (size_t)1 << 22;
+    if (!ptr || size < minTouchSize || !daal::threader_is_numa_affinity_enabled()) return;
+
+    /* The pages are split among the threads the same way as the blocks of rows in static_threader_for;
+       each page is rewritten with its own content, so the data in the block stays intact */
+    volatile char * const data = (volatile char *)ptr;
+    const size_t nPages        = (size + pageSize - 1) / pageSize;
+    daal::static_threader_for(nPages, [&](size_t iPage, size_t) { data[iPage * pageSize] = data[iPage * pageSize]; });
+}
+
 void daal::services::daal_free(void * ptr)
 {
+    if (daal::services::internal::HostArena::release(ptr)) return;
     daal::internal::Service<>::serv_free(ptr);
 }
 
@@ -28,6 +28,7 @@
 #include "services/daal_memory.h"
 #include "src/services/service_defines.h"
 #include "src/threading/threading.h"
+#include "src/services/service_host_arena.h"
 
 namespace daal
 {
@@ -67,10 +68,28 @@ void service_free(T * ptr)
     daal::services::daal_free(ptr);
 }
 
+/* The scalable allocations take the memory from the current host arena if it is set */
+inline void * scalableMalloc(size_t size, size_t alignment)
+{
+    HostArena * const arena = getCurrentHostArena();
+    if (arena)
+    {
+        void * const ptr = arena->allocate(size, alignment);
+        if (ptr) return ptr;
+    }
+    return threaded_scalable_malloc(size, alignment);
+}
+
+inline void scalableFree(void * ptr)
+{
+    if (HostArena::release(ptr)) return;
+    threaded_scalable_free(ptr);
+}
+
 template <typename T, CpuType cpu>
 T * service_scalable_calloc(size_t size, size_t alignment = 64)
 {
-    T * ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    T * ptr = (T *)scalableMalloc(size * sizeof(T), alignment);
 
     if (ptr == NULL)
     {
@@ -91,13 +110,13 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
 template <typename T, CpuType cpu>
 T * service_scalable_malloc(size_t size, size_t alignment = 64)
 {
-    return (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    return (T *)scalableMalloc(size * sizeof(T), alignment);
 }
 
 template <typename T, CpuType cpu>
 void service_scalable_free(T * ptr)
 {
-    threaded_scalable_free(ptr);
+    scalableFree(ptr);
 }
 
 template <typename T, CpuType cpu>
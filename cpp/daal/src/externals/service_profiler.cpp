@@ -15,25 +15,585 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <Windows.h>
+#else
+    #include <time.h>
+#endif
+
+#include "services/kernel_profiler.h"
 #include "src/externals/service_profiler.h"
 
 namespace daal
 {
 namespace internal
 {
-ProfilerTask Profiler::startTask(const char * taskName)
+namespace profiler
+{
+/*
+ * The buffers of the profiler are allocated with the C runtime allocator: the report
+ * is written during the static destruction, when the library allocator may be unavailable.
+ */
+
+typedef unsigned long long TimeType;
+
+const size_t noNode        = size_t(-1);
+const size_t maxDepth      = 128;
+const size_t nodeChunkSize = 256;
+const size_t maxNodeChunks = 256;
+
+TimeType now()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    static LARGE_INTEGER frequency = { 0 };
+    if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return TimeType(double(counter.QuadPart) * 1e9 / double(frequency.QuadPart));
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return TimeType(ts.tv_sec) * 1000000000ull + TimeType(ts.tv_nsec);
+#endif
+}
+
+template <typename T>
+bool compareAndSwap(T * volatile * ptr, T * oldValue, T * newValue)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return InterlockedCompareExchangePointer((PVOID volatile *)ptr, newValue, oldValue) == oldValue;
+#else
+    return __sync_bool_compare_and_swap(ptr, oldValue, newValue);
+#endif
+}
+
+/* Node of the tree of nested tasks recorded by one thread */
+struct Node
+{
+    const char * name;
+    size_t parent;
+    size_t count;
+    TimeType total;
+    TimeType max;
+};
+
+struct Frame
+{
+    size_t node;
+    TimeType start;
+};
+
+/*
+ * Buffer of the tasks recorded by one thread. Only the owning thread modifies the buffer,
+ * so recording does not need any synchronization. The nodes are allocated in chunks
+ * that never move, thus the report can be built while the buffer grows.
+ */
+class ThreadBuffer
+{
+public:
+    ThreadBuffer() : next(NULL), _nNodes(0), _table(NULL), _tableSize(0), _depth(0), _skippedDepth(0)
+    {
+        for (size_t i = 0; i < maxNodeChunks; ++i) _chunks[i] = NULL;
+    }
+
+    void start(const char * name)
+    {
+        if (_depth == maxDepth)
+        {
+            ++_skippedDepth;
+            return;
+        }
+        const size_t parent = _depth ? _stack[_depth - 1].node : noNode;
+        const size_t node   = findOrAddNode(parent, name);
+        if (node == noNode)
+        {
+            ++_skippedDepth;
+            return;
+        }
+        _stack[_depth].node = node;
+        ++_depth;
+        _stack[_depth - 1].start = now();
+    }
+
+    void end()
+    {
+        const TimeType finish = now();
+        if (_skippedDepth)
+        {
+            --_skippedDepth;
+            return;
+        }
+        if (!_depth) return;
+        --_depth;
+        Node & node          = getMutableNode(_stack[_depth].node);
+        const TimeType value = finish - _stack[_depth].start;
+        ++node.count;
+        node.total += value;
+        if (node.max < value) node.max = value;
+    }
+
+    void reset()
+    {
+        const size_t nNodes = _nNodes;
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            Node & node = getMutableNode(i);
+            node.count  = 0;
+            node.total  = 0;
+            node.max    = 0;
+        }
+    }
+
+    size_t getNumberOfNodes() const { return _nNodes; }
+
+    const Node & getNode(size_t i) const { return _chunks[i / nodeChunkSize][i % nodeChunkSize]; }
+
+    ThreadBuffer * next;
+
+private:
+    Node & getMutableNode(size_t i) { return _chunks[i / nodeChunkSize][i % nodeChunkSize]; }
+
+    static size_t hash(size_t parent, const char * name) { return (size_t(name) >> 3) * 31 + parent; }
+
+    size_t findOrAddNode(size_t parent, const char * name)
+    {
+        if (_tableSize)
+        {
+            for (size_t i = hash(parent, name) & (_tableSize - 1);; i = (i + 1) & (_tableSize - 1))
+            {
+                const size_t node = _table[i];
+                if (node == noNode) break;
+                const Node & value = getNode(node);
+                if (value.name == name && value.parent == parent) return node;
+            }
+        }
+        return addNode(parent, name);
+    }
+
+    size_t addNode(size_t parent, const char * name)
+    {
+        const size_t node = _nNodes;
+        if (node == maxNodeChunks * nodeChunkSize) return noNode;
+        if (2 * (node + 1) > _tableSize && !rehash(_tableSize ? 2 * _tableSize : 2 * nodeChunkSize)) return noNode;
+
+        Node *& chunk = _chunks[node / nodeChunkSize];
+        if (!chunk)
+        {
+            chunk = static_cast<Node *>(malloc(sizeof(Node) * nodeChunkSize));
+            if (!chunk) return noNode;
+        }
+
+        Node & value = chunk[node % nodeChunkSize];
+        value.name   = name;
+        value.parent = parent;
+        value.count  = 0;
+        value.total  = 0;
+        value.max    = 0;
+        insert(node);
+        _nNodes = node + 1;
+        return node;
+    }
+
+    bool rehash(size_t tableSize)
+    {
+        size_t * table = static_cast<size_t *>(malloc(sizeof(size_t) * tableSize));
+        if (!table) return false;
+        for (size_t i = 0; i < tableSize; ++i) table[i] = noNode;
+        free(_table);
+        _table     = table;
+        _tableSize = tableSize;
+        for (size_t i = 0; i < _nNodes; ++i) insert(i);
+        return true;
+    }
+
+    void insert(size_t node)
+    {
+        const Node & value = getNode(node);
+        size_t i           = hash(value.parent, value.name) & (_tableSize - 1);
+        while (_table[i] != noNode) i = (i + 1) & (_tableSize - 1);
+        _table[i] = node;
+    }
+
+    Node * _chunks[maxNodeChunks];
+    volatile size_t _nNodes;
+    size_t * _table;
+    size_t _tableSize;
+    Frame _stack[maxDepth];
+    size_t _depth;
+    size_t _skippedDepth;
+};
+
+volatile int isProfilerEnabled               = 0;
+ThreadBuffer * volatile threadBuffers        = NULL;
+static thread_local ThreadBuffer * tlsBuffer = NULL;
+
+ThreadBuffer * getThreadBuffer()
+{
+    if (tlsBuffer) return tlsBuffer;
+
+    void * memory = malloc(sizeof(ThreadBuffer));
+    if (!memory) return NULL;
+    ThreadBuffer * buffer = new (memory) ThreadBuffer();
+
+    /* The buffers are never released: the report includes the tasks of the finished threads */
+    do
+    {
+        buffer->next = threadBuffers;
+    } while (!compareAndSwap(&threadBuffers, buffer->next, buffer));
+
+    tlsBuffer = buffer;
+    return buffer;
+}
+
+/* Task statistics merged over the threads */
+struct Record
+{
+    const char * name;
+    size_t parent;
+    size_t depth;
+    size_t count;
+    TimeType total;
+    TimeType self;
+    TimeType max;
+};
+
+class RecordArray
+{
+public:
+    RecordArray() : _data(NULL), _size(0), _capacity(0) {}
+    ~RecordArray() { free(_data); }
+
+    size_t size() const { return _size; }
+    Record & operator[](size_t i) { return _data[i]; }
+
+    /* Returns the record with the given name and parent, the record is added if not found */
+    Record * find(const char * name, size_t parent, size_t depth)
+    {
+        for (size_t i = 0; i < _size; ++i)
+        {
+            if (_data[i].parent == parent && !strcmp(_data[i].name, name)) return _data + i;
+        }
+        if (_size == _capacity)
+        {
+            const size_t capacity = _capacity ? 2 * _capacity : 64;
+            Record * data         = static_cast<Record *>(realloc(_data, sizeof(Record) * capacity));
+            if (!data) return NULL;
+            _data     = data;
+            _capacity = capacity;
+        }
+        Record & record = _data[_size++];
+        record.name     = name;
+        record.parent   = parent;
+        record.depth    = depth;
+        record.count    = 0;
+        record.total    = 0;
+        record.self     = 0;
+        record.max      = 0;
+        return &record;
+    }
+
+private:
+    Record * _data;
+    size_t _size;
+    size_t _capacity;
+};
+
+void merge(Record & record, const Node & node, TimeType self)
+{
+    record.count += node.count;
+    record.total += node.total;
+    record.self += self;
+    if (record.max < node.max) record.max = node.max;
+}
+
+/* Merges the trees of all threads by the task paths, and the tasks of all threads by the names */
+bool mergeThreadBuffers(RecordArray & tree, RecordArray & tasks, size_t & nThreads)
+{
+    nThreads = 0;
+    for (ThreadBuffer * buffer = threadBuffers; buffer; buffer = buffer->next)
+    {
+        ++nThreads;
+        const size_t nNodes = buffer->getNumberOfNodes();
+        if (!nNodes) continue;
+
+        size_t * records     = static_cast<size_t *>(malloc(sizeof(size_t) * nNodes));
+        TimeType * childTime = static_cast<TimeType *>(malloc(sizeof(TimeType) * nNodes));
+        if (!records || !childTime)
+        {
+            free(records);
+            free(childTime);
+            return false;
+        }
+
+        /* The parent of a node is always added before the node itself */
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            const Node & node = buffer->getNode(i);
+            childTime[i]      = 0;
+            if (node.parent != noNode) childTime[node.parent] += node.total;
+        }
+
+        bool isOk = true;
+        for (size_t i = 0; i < nNodes && isOk; ++i)
+        {
+            const Node & node   = buffer->getNode(i);
+            const TimeType self = node.total > childTime[i] ? node.total - childTime[i] : 0;
+            const size_t parent = node.parent == noNode ? noNode : records[node.parent];
+            const size_t depth  = parent == noNode ? 0 : tree[parent].depth + 1;
+            Record * treeRecord = tree.find(node.name, parent, depth);
+            Record * taskRecord = tasks.find(node.name, noNode, 0);
+            isOk                = treeRecord && taskRecord;
+            if (!isOk) break;
+            records[i] = size_t(treeRecord - &tree[0]);
+            merge(*treeRecord, node, self);
+            merge(*taskRecord, node, self);
+        }
+
+        free(records);
+        free(childTime);
+        if (!isOk) return false;
+    }
+    return true;
+}
+
+/* Appends formatted text to the buffer and counts the full size of the text */
+class ReportWriter
+{
+public:
+    ReportWriter(char * buffer, size_t bufferSize) : _buffer(buffer), _bufferSize(bufferSize), _size(0)
+    {
+        if (_bufferSize) _buffer[0] = '\0';
+    }
+
+    void write(const char * format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        char * position    = _size < _bufferSize ? _buffer + _size : NULL;
+        const size_t space = _size < _bufferSize ? _bufferSize - _size : 0;
+        const int nWritten = vsnprintf(position, space, format, args);
+        va_end(args);
+        if (nWritten > 0) _size += size_t(nWritten);
+    }
+
+    void writeString(const char * value)
+    {
+        write("\"");
+        for (; *value; ++value)
+        {
+            const char c = *value;
+            if (c == '"' || c == '\\')
+                write("\\%c", c);
+            else if ((unsigned char)c < 0x20)
+                write("\\u%04x", (unsigned)c);
+            else
+                write("%c", c);
+        }
+        write("\"");
+    }
+
+    /* Returns the size of the full report including the terminating null character */
+    size_t getSize() const { return _size + 1; }
+
+private:
+    char * _buffer;
+    size_t _bufferSize;
+    size_t _size;
+};
+
+void writeStatistics(ReportWriter & writer, const Record & record)
 {
-    return ProfilerTask(taskName);
+    writer.write(", \"count\": %llu, \"total_ns\": %llu, \"self_ns\": %llu, \"max_ns\": %llu}", (unsigned long long)record.count, record.total,
+                 record.self, record.max);
+}
+
+void writePath(ReportWriter & writer, RecordArray & tree, size_t i)
+{
+    if (tree[i].parent != noNode)
+    {
+        writePath(writer, tree, tree[i].parent);
+        writer.write("/");
+    }
+    writer.write("%s", tree[i].name);
+}
+
+void writeSubtree(ReportWriter & writer, RecordArray & tree, size_t parent, bool & isFirst)
+{
+    for (size_t i = 0; i < tree.size(); ++i)
+    {
+        if (tree[i].parent != parent) continue;
+
+        ReportWriter path(NULL, 0);
+        writePath(path, tree, i);
+        char * pathBuffer = static_cast<char *>(malloc(path.getSize()));
+        if (pathBuffer)
+        {
+            ReportWriter pathWriter(pathBuffer, path.getSize());
+            writePath(pathWriter, tree, i);
+        }
+
+        writer.write(isFirst ? "\n    {\"path\": " : ",\n    {\"path\": ");
+        writer.writeString(pathBuffer ? pathBuffer : tree[i].name);
+        writer.write(", \"name\": ");
+        writer.writeString(tree[i].name);
+        writer.write(", \"depth\": %llu", (unsigned long long)tree[i].depth);
+        writeStatistics(writer, tree[i]);
+        free(pathBuffer);
+        isFirst = false;
+
+        writeSubtree(writer, tree, i, isFirst);
+    }
 }
 
-void Profiler::endTask(const char * taskName) {}
+size_t writeReport(char * buffer, size_t bufferSize)
+{
+    ReportWriter writer(buffer, bufferSize);
+    RecordArray tree, tasks;
+    size_t nThreads = 0;
+    const bool isOk = mergeThreadBuffers(tree, tasks, nThreads);
+
+    writer.write("{\n  \"enabled\": %s,\n  \"complete\": %s,\n  \"threads\": %llu,\n  \"tasks\": [", isProfilerEnabled ? "true" : "false",
+                 isOk ? "true" : "false", (unsigned long long)nThreads);
+
+    /* The tasks are listed in the decreasing order of the self time */
+    bool * isWritten = static_cast<bool *>(calloc(tasks.size() ? tasks.size() : 1, sizeof(bool)));
+    for (size_t n = 0; n < tasks.size() && isWritten; ++n)
+    {
+        size_t best = noNode;
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            if (!isWritten[i] && (best == noNode || tasks[best].self < tasks[i].self)) best = i;
+        }
+        isWritten[best] = true;
+        writer.write(n ? ",\n    {\"name\": " : "\n    {\"name\": ");
+        writer.writeString(tasks[best].name);
+        writeStatistics(writer, tasks[best]);
+    }
+    free(isWritten);
+    writer.write(tasks.size() ? "\n  ],\n  \"tree\": [" : "],\n  \"tree\": [");
+
+    bool isFirst = true;
+    writeSubtree(writer, tree, noNode, isFirst);
+    writer.write(isFirst ? "]\n}\n" : "\n  ]\n}\n");
+    return writer.getSize();
+}
+
+bool writeReportToFile(const char * fileName)
+{
+    const size_t size = writeReport(NULL, 0);
+    char * buffer     = static_cast<char *>(malloc(size));
+    if (!buffer) return false;
+    writeReport(buffer, size);
+
+    FILE * file = fileName ? fopen(fileName, "w") : stderr;
+    bool isOk   = (file != NULL);
+    if (isOk)
+    {
+        const size_t length = strlen(buffer);
+        isOk                = (fwrite(buffer, 1, length, file) == length);
+        if (fileName)
+            isOk = (fclose(file) == 0) && isOk;
+        else
+            fflush(file);
+    }
+    free(buffer);
+    return isOk;
+}
+
+/* Enables the profiler at load and writes the report at exit if DAAL_PROFILER is set */
+class ProfilerEnvironment
+{
+public:
+    ProfilerEnvironment() : _isEnabledByEnvironment(false)
+    {
+        const char * value = getenv("DAAL_PROFILER");
+        if (value && value[0] && strcmp(value, "0"))
+        {
+            _isEnabledByEnvironment = true;
+            isProfilerEnabled       = 1;
+        }
+    }
+
+    ~ProfilerEnvironment()
+    {
+        if (!_isEnabledByEnvironment) return;
+        isProfilerEnabled = 0;
+        writeReportToFile(getenv("DAAL_PROFILER_OUTPUT"));
+    }
+
+private:
+    bool _isEnabledByEnvironment;
+};
+
+static ProfilerEnvironment profilerEnvironment;
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+} // namespace profiler
+
+bool Profiler::startTask(const char * taskName)
+{
+    if (!profiler::isProfilerEnabled) return false;
+    profiler::ThreadBuffer * buffer = profiler::getThreadBuffer();
+    if (!buffer) return false;
+    buffer->start(taskName);
+    return true;
+}
+
+void Profiler::endTask(const char * taskName)
+{
+    /* The task is closed even if the profiler was disabled after the task had started */
+    profiler::ThreadBuffer * buffer = profiler::tlsBuffer;
+    if (buffer) buffer->end();
+}
+
+ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName), _isStarted(Profiler::startTask(taskName)) {}
 
 ProfilerTask::~ProfilerTask()
 {
-    Profiler::endTask(_taskName);
+    if (_isStarted) Profiler::endTask(_taskName);
 }
 
 } // namespace internal
+
+namespace services
+{
+namespace interface1
+{
+void KernelProfiler::enable()
+{
+    daal::internal::profiler::isProfilerEnabled = 1;
+}
+
+void KernelProfiler::disable()
+{
+    daal::internal::profiler::isProfilerEnabled = 0;
+}
+
+bool KernelProfiler::isEnabled()
+{
+    return daal::internal::profiler::isProfilerEnabled != 0;
+}
+
+void KernelProfiler::reset()
+{
+    for (daal::internal::profiler::ThreadBuffer * buffer = daal::internal::profiler::threadBuffers; buffer; buffer = buffer->next) buffer->reset();
+}
+
+size_t KernelProfiler::getReport(char * buffer, size_t bufferSize)
+{
+    return daal::internal::profiler::writeReport(buffer, bufferSize);
+}
+
+bool KernelProfiler::writeReport(const char * fileName)
+{
+    return daal::internal::profiler::writeReportToFile(fileName);
+}
+
+} // namespace interface1
+} // namespace services
 } // namespace daal
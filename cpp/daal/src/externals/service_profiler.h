@@ -21,6 +21,9 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
 namespace daal
 {
 namespace internal
@@ -32,16 +35,24 @@ public:
     ~ProfilerTask();
 
 private:
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask & operator=(const ProfilerTask &);
+
     const char * _taskName;
+    bool _isStarted;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+// Records the nested task timings of the calling thread while profiling is enabled,
+// see services::KernelProfiler for the switches and the report
 class Profiler
 {
 public:
-    static ProfilerTask startTask(const char * taskName);
+    // Returns true if the task was recorded, endTask must be called for such tasks only
+    static bool startTask(const char * taskName);
     static void endTask(const char * taskName);
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif // __SERVICE_PROFILER_H__
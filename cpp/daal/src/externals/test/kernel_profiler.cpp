@@ -0,0 +1,296 @@
+/* file: kernel_profiler.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the aggregation of the nested tasks and the report of the kernel profiler
+//--
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "services/kernel_profiler.h"
+#include "src/externals/service_profiler.h"
+
+namespace daal::internal::test
+{
+using daal::services::KernelProfiler;
+
+struct TaskStatistics
+{
+    size_t depth             = 0;
+    unsigned long long count = 0, total = 0, self = 0, max = 0;
+};
+
+struct Report
+{
+    bool enabled    = false;
+    bool complete   = false;
+    size_t nThreads = 0;
+    std::map<std::string, TaskStatistics> tasks;
+    std::map<std::string, TaskStatistics> tree;
+};
+
+static std::string getReport()
+{
+    const size_t size = KernelProfiler::getReport(NULL, 0);
+    std::vector<char> buffer(size);
+    EXPECT_EQ(KernelProfiler::getReport(buffer.data(), size), size);
+    EXPECT_EQ(buffer[size - 1], '\0');
+    return std::string(buffer.data());
+}
+
+/* Parses the report line by line, every task is written on a line of its own */
+static Report parseReport(const std::string & text)
+{
+    static const std::regex header("\\{\\n  \"enabled\": (true|false),\\n  \"complete\": (true|false),\\n  \"threads\": (\\d+),\\n  \"tasks\": \\[");
+    static const std::regex task("    \\{\"name\": \"((?:[^\"\\\\]|\\\\.)*)\", \"count\": (\\d+), \"total_ns\": (\\d+), \"self_ns\": (\\d+), "
+                                 "\"max_ns\": (\\d+)\\},?");
+    static const std::regex node("    \\{\"path\": \"((?:[^\"\\\\]|\\\\.)*)\", \"name\": \"(?:[^\"\\\\]|\\\\.)*\", \"depth\": (\\d+), "
+                                 "\"count\": (\\d+), \"total_ns\": (\\d+), \"self_ns\": (\\d+), \"max_ns\": (\\d+)\\},?");
+
+    Report report;
+    std::smatch match;
+    EXPECT_TRUE(std::regex_search(text, match, header, std::regex_constants::match_continuous)) << text;
+    if (match.empty()) return report;
+    report.enabled  = match[1] == "true";
+    report.complete = match[2] == "true";
+    report.nThreads = std::stoul(match[3]);
+
+    std::istringstream lines(text.substr(match.length()));
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (std::regex_match(line, match, task))
+        {
+            TaskStatistics & value = report.tasks[match[1]];
+            value.count            = std::stoull(match[2]);
+            value.total            = std::stoull(match[3]);
+            value.self             = std::stoull(match[4]);
+            value.max              = std::stoull(match[5]);
+        }
+        else if (std::regex_match(line, match, node))
+        {
+            TaskStatistics & value = report.tree[match[1]];
+            value.depth            = std::stoul(match[2]);
+            value.count            = std::stoull(match[3]);
+            value.total            = std::stoull(match[4]);
+            value.self             = std::stoull(match[5]);
+            value.max              = std::stoull(match[6]);
+        }
+        else
+        {
+            static const std::vector<std::string> separators = { "", "],", "  ],", "  \"tree\": [", "  \"tree\": []", "  ]", "}" };
+            EXPECT_NE(std::find(separators.begin(), separators.end(), line), separators.end()) << "Unexpected line of the report: " << line;
+        }
+    }
+    return report;
+}
+
+static bool startsWith(const std::string & text, const std::string & prefix)
+{
+    return text.compare(0, prefix.size(), prefix) == 0;
+}
+
+static bool endsWith(const std::string & text, const std::string & suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static void sleepTask(const char * name)
+{
+    ProfilerTask task(name);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+
+class KernelProfilerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        KernelProfiler::enable();
+        KernelProfiler::reset();
+    }
+
+    void TearDown() override { KernelProfiler::disable(); }
+};
+
+TEST_F(KernelProfilerTest, AggregatesNestedTasks)
+{
+    {
+        ProfilerTask outer("nested.outer");
+        sleepTask("nested.inner");
+        sleepTask("nested.inner");
+        {
+            ProfilerTask middle("nested.middle");
+            sleepTask("nested.inner");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const Report report = parseReport(getReport());
+    EXPECT_TRUE(report.enabled);
+    EXPECT_TRUE(report.complete);
+
+    const TaskStatistics outer       = report.tree.at("nested.outer");
+    const TaskStatistics inner       = report.tree.at("nested.outer/nested.inner");
+    const TaskStatistics middle      = report.tree.at("nested.outer/nested.middle");
+    const TaskStatistics middleInner = report.tree.at("nested.outer/nested.middle/nested.inner");
+    EXPECT_EQ(outer.depth, 0);
+    EXPECT_EQ(inner.depth, 1);
+    EXPECT_EQ(middle.depth, 1);
+    EXPECT_EQ(middleInner.depth, 2);
+    EXPECT_EQ(outer.count, 1);
+    EXPECT_EQ(inner.count, 2);
+    EXPECT_EQ(middle.count, 1);
+    EXPECT_EQ(middleInner.count, 1);
+
+    /* The self time is the total time without the total time of the children */
+    EXPECT_EQ(outer.self, outer.total - inner.total - middle.total);
+    EXPECT_EQ(middle.self, middle.total - middleInner.total);
+    EXPECT_EQ(inner.self, inner.total);
+    EXPECT_GE(outer.self, 2000000);
+    EXPECT_GE(inner.total, 4000000);
+    EXPECT_GE(inner.total, inner.max);
+    EXPECT_GE(2 * inner.max, inner.total);
+    EXPECT_EQ(outer.max, outer.total);
+
+    /* The tasks with the same name are merged over all the paths */
+    const TaskStatistics innerTask = report.tasks.at("nested.inner");
+    EXPECT_EQ(innerTask.count, 3);
+    EXPECT_EQ(innerTask.total, inner.total + middleInner.total);
+    EXPECT_EQ(innerTask.self, inner.self + middleInner.self);
+    EXPECT_EQ(innerTask.max, std::max(inner.max, middleInner.max));
+    EXPECT_EQ(report.tasks.at("nested.outer").self, outer.self);
+}
+
+TEST_F(KernelProfilerTest, MergesThreads)
+{
+    const Report before = parseReport(getReport());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        threads.emplace_back([] {
+            ProfilerTask outer("threads.outer");
+            sleepTask("threads.inner");
+        });
+    }
+    for (auto & thread : threads) thread.join();
+
+    const Report report = parseReport(getReport());
+    EXPECT_EQ(report.nThreads, before.nThreads + 3);
+    EXPECT_EQ(report.tree.at("threads.outer").count, 3);
+    EXPECT_EQ(report.tree.at("threads.outer/threads.inner").count, 3);
+    EXPECT_EQ(report.tasks.at("threads.inner").count, 3);
+}
+
+TEST_F(KernelProfilerTest, ResetDiscardsRecordedTasks)
+{
+    sleepTask("reset.task");
+    EXPECT_EQ(parseReport(getReport()).tasks.at("reset.task").count, 1);
+
+    KernelProfiler::reset();
+    const TaskStatistics task = parseReport(getReport()).tasks.at("reset.task");
+    EXPECT_EQ(task.count, 0);
+    EXPECT_EQ(task.total, 0);
+    EXPECT_EQ(task.self, 0);
+    EXPECT_EQ(task.max, 0);
+
+    sleepTask("reset.task");
+    EXPECT_EQ(parseReport(getReport()).tasks.at("reset.task").count, 1);
+}
+
+TEST_F(KernelProfilerTest, SkipsTasksWhileDisabled)
+{
+    sleepTask("disabled.task");
+    KernelProfiler::disable();
+    EXPECT_FALSE(KernelProfiler::isEnabled());
+    {
+        /* The task started before the profiler was disabled is still closed */
+        ProfilerTask outer("disabled.outer");
+        KernelProfiler::enable();
+        sleepTask("disabled.task");
+        KernelProfiler::disable();
+    }
+    sleepTask("disabled.task");
+    KernelProfiler::enable();
+    sleepTask("disabled.task");
+
+    const Report report = parseReport(getReport());
+    EXPECT_EQ(report.tree.count("disabled.outer"), 0);
+    EXPECT_EQ(report.tree.at("disabled.task").count, 3);
+}
+
+/* The tasks nested deeper than the recorded depth are skipped without breaking the tree */
+TEST_F(KernelProfilerTest, SkipsTooDeepTasks)
+{
+    struct Recursion
+    {
+        static void run(size_t depth)
+        {
+            ProfilerTask task("deep.task");
+            if (depth) run(depth - 1);
+        }
+    };
+    Recursion::run(200);
+    sleepTask("deep.after");
+
+    const Report report = parseReport(getReport());
+    EXPECT_EQ(report.tasks.at("deep.task").count, 128);
+    EXPECT_EQ(report.tree.at("deep.after").depth, 0);
+    EXPECT_EQ(report.tree.at("deep.after").count, 1);
+}
+
+TEST_F(KernelProfilerTest, WritesReport)
+{
+    sleepTask("report.\"quoted\\name\"");
+
+    const std::string text = getReport();
+    EXPECT_TRUE(startsWith(text, "{\n  \"enabled\": true,\n  \"complete\": true,\n")) << text;
+    EXPECT_TRUE(endsWith(text, "\n  ]\n}\n")) << text;
+    EXPECT_EQ(parseReport(text).tasks.count("report.\\\"quoted\\\\name\\\""), 1) << text;
+
+    /* The report is truncated to the buffer and the size of the full report is returned */
+    std::vector<char> buffer(16, 'x');
+    EXPECT_EQ(KernelProfiler::getReport(buffer.data(), buffer.size()), text.size() + 1);
+    EXPECT_EQ(std::string(buffer.data()), text.substr(0, buffer.size() - 1));
+
+    KernelProfiler::disable();
+    const std::string fileName = ::testing::TempDir() + "kernel_profiler_report.json";
+    ASSERT_TRUE(KernelProfiler::writeReport(fileName.c_str()));
+    std::ifstream file(fileName);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::remove(fileName.c_str());
+
+    const std::string disabledText = getReport();
+    EXPECT_EQ(content.str(), disabledText);
+    EXPECT_TRUE(startsWith(disabledText, "{\n  \"enabled\": false,\n")) << disabledText;
+}
+
+} // namespace daal::internal::test
@@ -68,8 +68,15 @@
     DECLARE_DAAL_STRING_CONST(dataDimension)                     \
     DECLARE_DAAL_STRING_CONST(correlationDistance)               \
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
+    DECLARE_DAAL_STRING_CONST(nearestIndices)                    \
+    DECLARE_DAAL_STRING_CONST(nearestDistances)                  \
+    DECLARE_DAAL_STRING_CONST(pairIndices)                       \
+    DECLARE_DAAL_STRING_CONST(pairDistances)                     \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(rankError)                         \
+    DECLARE_DAAL_STRING_CONST(partialSketchItems)                \
+    DECLARE_DAAL_STRING_CONST(partialSketchLevels)               \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -239,6 +246,7 @@
     DECLARE_DAAL_STRING_CONST(featuresPerNode)                   \
     DECLARE_DAAL_STRING_CONST(lambda)                            \
     DECLARE_DAAL_STRING_CONST(preferenceThreshold)               \
+    DECLARE_DAAL_STRING_CONST(nCGIterations)                     \
     DECLARE_DAAL_STRING_CONST(pyramidHeight)                     \
     DECLARE_DAAL_STRING_CONST(itemsFactors)                      \
     DECLARE_DAAL_STRING_CONST(partialModels)                     \
@@ -197,3 +197,14 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+DAAL_EXPORT void daal::services::Environment::enableNumaAffinity(const bool enableNumaAffinityFlag)
+{
+    initNumberOfThreads();
+    daal::threader_set_numa_affinity(enableNumaAffinityFlag);
+}
+
+DAAL_EXPORT void daal::services::Environment::enableDeterministicReductions(const bool enableDeterministicReductionsFlag)
+{
+    daal::threader_set_deterministic_reductions(enableDeterministicReductionsFlag);
+}
@@ -840,6 +840,7 @@ void ErrorMessageCollection::parseResourceFile()
 
     // SVM errors: -8600..-8799
     add(ErrorSVMPredictKernerFunctionCall, "SVM predict: error in kernel function call. Details are as follows.");
+    add(ErrorKernelApproximationFailedToComputeEigenvalues, "Failed to compute eigenvalues of the kernel matrix of the landmarks");
 
     // WeakLearner errors: -8800..-8999
     add(ErrorIncorrectWeakLearnerClassificationAlgorithm, "Weak learner can not be casted to classifier algorithm");
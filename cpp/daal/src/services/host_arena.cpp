@@ -0,0 +1,566 @@
+/* file: host_arena.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the arena of the host memory reused by the consecutive operations
+//--
+*/
+
+#include <atomic>
+#include <new>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+#include "src/services/service_host_arena.h"
+#include "src/externals/service_service.h"
+#include "src/algorithms/service_threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+const size_t chunkMask = hostArenaChunkSize - 1;
+
+/* Blocks larger than this size get the dedicated chunks */
+const size_t maxBlockInSharedChunk = hostArenaChunkSize / 4;
+
+/* The blocks of the chunk start after its header */
+const size_t chunkHeaderSize = 128;
+
+/* Every block of the shared chunk is preceded by its header aligned by this value.
+   The offset of the header is also stored in the last 4 bytes before the block */
+const size_t blockHeaderAlignment = 16;
+const size_t blockHeaderSpace     = 16;
+
+inline size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/* The blocks follow each other in the chunk, so their headers form the chain over its allocated part */
+struct BlockHeader
+{
+    explicit BlockHeader(size_t blockEnd, bool isLive = true) : end(uint32_t(blockEnd)), live(isLive) {}
+
+    uint32_t end;               /* Offset of the end of the block in the chunk */
+    std::atomic<uint32_t> live; /* The block is not freed yet */
+};
+
+static_assert(sizeof(BlockHeader) + sizeof(uint32_t) <= blockHeaderSpace, "The header of the block does not fit into the reserved space");
+
+struct Chunk
+{
+    Chunk(size_t chunkSize, bool isDedicated)
+        : size(chunkSize),
+          offset(chunkHeaderSize),
+          limit(chunkSize),
+          top(chunkHeaderSize),
+          dedicated(isDedicated),
+          reused(true),
+          owned(false),
+          next(nullptr),
+          nRefs(1)
+    {}
+
+    size_t size;    /* Size of the chunk in bytes, multiple of hostArenaChunkSize */
+    size_t offset;  /* Offset of the first free byte of the region the blocks are allocated from */
+    size_t limit;   /* End of that region, less than the size if the region lies between the live blocks */
+    size_t top;     /* End of the chain of the block headers */
+    bool dedicated; /* The chunk holds one large block without the header */
+    bool reused;    /* The dedicated chunk was allocated from since the last reset */
+    bool owned;     /* The blocks are allocated from the shared chunk by one thread or under the lock of the arena */
+    Chunk * next;
+
+    /* Number of the live blocks plus one while the chunk belongs to the arena.
+       The chunk is returned to the system when it drops to zero */
+    std::atomic<size_t> nRefs;
+};
+
+static_assert(sizeof(Chunk) <= chunkHeaderSize, "The header of the chunk does not fit into the reserved space");
+
+/* Set of the addresses of the chunks of all arenas. The addresses are kept in the two-level
+   bit map over the 48-bit address space, so the membership of any pointer is tested
+   without locks and without reading the memory it points to */
+class ChunkRegistry
+{
+public:
+    bool insert(const void * chunk)
+    {
+        const uintptr_t index = uintptr_t(chunk) >> chunkBits;
+        if (index >> (addressBits - chunkBits)) return false;
+
+        AUTOLOCK(_mutex);
+        std::atomic<uint64_t> * leaf = _leaves[index >> leafBits].load(std::memory_order_acquire);
+        if (!leaf)
+        {
+            void * const leafMemory = daal::internal::Service<>::serv_malloc(leafWords * sizeof(std::atomic<uint64_t>), 64);
+            if (!leafMemory) return false;
+            leaf = static_cast<std::atomic<uint64_t> *>(leafMemory);
+            for (size_t i = 0; i < leafWords; ++i)
+            {
+                new (leaf + i) std::atomic<uint64_t>(0);
+            }
+            _leaves[index >> leafBits].store(leaf, std::memory_order_release);
+        }
+        leaf[(index & leafMask) >> 6].fetch_or(uint64_t(1) << (index & 63), std::memory_order_release);
+        _size.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    void erase(const void * chunk)
+    {
+        const uintptr_t index = uintptr_t(chunk) >> chunkBits;
+        AUTOLOCK(_mutex);
+        std::atomic<uint64_t> * const leaf = _leaves[index >> leafBits].load(std::memory_order_acquire);
+        leaf[(index & leafMask) >> 6].fetch_and(~(uint64_t(1) << (index & 63)), std::memory_order_release);
+        _size.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool contains(const void * ptr) const
+    {
+        if (_size.load(std::memory_order_acquire) == 0) return false;
+
+        const uintptr_t index = uintptr_t(ptr) >> chunkBits;
+        if (index >> (addressBits - chunkBits)) return false;
+
+        const std::atomic<uint64_t> * const leaf = _leaves[index >> leafBits].load(std::memory_order_acquire);
+        if (!leaf) return false;
+        return (leaf[(index & leafMask) >> 6].load(std::memory_order_acquire) >> (index & 63)) & 1;
+    }
+
+private:
+    static const size_t addressBits = 48;
+    static const size_t chunkBits   = 21;
+    static const size_t leafBits    = 14;
+    static const size_t leafMask    = (size_t(1) << leafBits) - 1;
+    static const size_t leafWords   = (size_t(1) << leafBits) / 64;
+    static const size_t nLeaves     = size_t(1) << (addressBits - chunkBits - leafBits);
+
+    std::atomic<std::atomic<uint64_t> *> _leaves[nLeaves];
+    std::atomic<size_t> _size;
+    Mutex _mutex;
+};
+
+/* The registry is never destroyed, since the blocks may be freed during the exit of the program */
+ChunkRegistry & chunkRegistry()
+{
+    static ChunkRegistry * const registry = new ChunkRegistry();
+    return *registry;
+}
+
+static_assert(hostArenaChunkSize == (size_t(1) << 21), "The registry assumes 2 MB chunks");
+
+void * mapChunk(size_t size, bool useHugePages)
+{
+#if defined(__linux__)
+    /* Over-allocate to align the chunk by its size and unmap the excess */
+    const size_t mapSize = size + hostArenaChunkSize;
+    void * const mapped  = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) return nullptr;
+
+    char * const begin = static_cast<char *>(mapped);
+    char * const chunk = reinterpret_cast<char *>(alignUp(uintptr_t(begin), hostArenaChunkSize));
+    if (chunk > begin) munmap(begin, chunk - begin);
+    const size_t tailSize = (begin + mapSize) - (chunk + size);
+    if (tailSize) munmap(chunk + size, tailSize);
+
+    #if defined(MADV_HUGEPAGE)
+    if (useHugePages) madvise(chunk, size, MADV_HUGEPAGE);
+    #endif
+    return chunk;
+#else
+    return daal::internal::Service<>::serv_malloc(size, hostArenaChunkSize);
+#endif
+}
+
+void unmapChunk(void * chunk, size_t size)
+{
+#if defined(__linux__)
+    munmap(chunk, size);
+#else
+    daal::internal::Service<>::serv_free(chunk);
+#endif
+}
+
+Chunk * createChunk(size_t size, bool dedicated, bool useHugePages)
+{
+    void * const memory = mapChunk(size, useHugePages);
+    if (!memory) return nullptr;
+    if (!chunkRegistry().insert(memory))
+    {
+        unmapChunk(memory, size);
+        return nullptr;
+    }
+    return new (memory) Chunk(size, dedicated);
+}
+
+void destroyChunk(Chunk * chunk)
+{
+    const size_t size = chunk->size;
+    chunk->~Chunk();
+    chunkRegistry().erase(chunk);
+    unmapChunk(chunk, size);
+}
+
+/* Drops one reference to the chunk */
+void releaseChunk(Chunk * chunk)
+{
+    if (chunk->nRefs.fetch_sub(1, std::memory_order_acq_rel) == 1) destroyChunk(chunk);
+}
+
+void releaseChunks(Chunk * chunk)
+{
+    while (chunk)
+    {
+        Chunk * const next = chunk->next;
+        releaseChunk(chunk);
+        chunk = next;
+    }
+}
+
+struct HostArenaImpl
+{
+    explicit HostArenaImpl(bool hugePages)
+        : useHugePages(hugePages), sharedChunks(nullptr), sharedTail(nullptr), current(nullptr), dedicatedChunks(nullptr), reservedSize(0)
+    {}
+
+    Mutex mutex;
+    bool useHugePages;
+    Chunk * sharedChunks; /* Chunks shared by the small blocks */
+    Chunk * sharedTail;
+    Chunk * current; /* Shared chunk the small blocks are allocated from under the lock */
+    Chunk * dedicatedChunks;
+    size_t reservedSize;
+};
+
+/* Arena set as the current one on the thread and the shared chunk the thread allocates from without the lock */
+struct ThreadState
+{
+    HostArena * arena;
+    size_t depth;
+    Chunk * chunk;
+};
+
+thread_local ThreadState threadState = { nullptr, 0, nullptr };
+
+/* Allocates the block from the region of the shared chunk, called by the only thread that allocates from the chunk */
+void * takeBlock(Chunk * chunk, size_t size, size_t alignment)
+{
+    const size_t headerOffset = alignUp(chunk->offset, blockHeaderAlignment);
+    const size_t blockOffset  = alignUp(headerOffset + blockHeaderSpace, alignment);
+    if (blockOffset + size > chunk->limit) return nullptr;
+
+    char * const base = reinterpret_cast<char *>(chunk);
+    new (base + headerOffset) BlockHeader(blockOffset + size);
+    *reinterpret_cast<uint32_t *>(base + blockOffset - sizeof(uint32_t)) = uint32_t(headerOffset);
+    chunk->offset = blockOffset + size;
+    chunk->nRefs.fetch_add(1, std::memory_order_relaxed);
+    return base + blockOffset;
+}
+
+/* Makes the shared chunk without the live blocks empty, called by the only thread that allocates from the chunk */
+bool rewindIfFree(Chunk * chunk)
+{
+    if (chunk->nRefs.load(std::memory_order_acquire) != 1) return false;
+    chunk->offset = chunkHeaderSize;
+    chunk->limit  = chunk->size;
+    chunk->top    = chunkHeaderSize;
+    return true;
+}
+
+/* Closes the region the blocks were allocated from, so the chain of the headers covers the allocated part of the chunk */
+void sealRegion(Chunk * chunk)
+{
+    const size_t end = alignUp(chunk->offset, blockHeaderAlignment);
+    if (chunk->limit == chunk->size)
+    {
+        chunk->top = end;
+    }
+    else if (end < chunk->limit)
+    {
+        /* The rest of the region between the live blocks is covered by the freed block */
+        new (reinterpret_cast<char *>(chunk) + end) BlockHeader(chunk->limit, false);
+    }
+    chunk->offset = chunk->limit;
+}
+
+/* Makes the largest free space of the shared chunk with the live blocks the region of the following allocations,
+   so the blocks that outlive the operation do not keep the rest of their chunk from being reused.
+   Called under the lock of the arena for the chunk no thread allocates from */
+void rewindAroundLiveBlocks(Chunk * chunk)
+{
+    sealRegion(chunk);
+
+    const char * const base = reinterpret_cast<const char *>(chunk);
+    size_t bestBegin        = 0;
+    size_t bestEnd          = 0;
+    size_t runBegin         = 0;
+    bool inRun              = false;
+    for (size_t headerOffset = chunkHeaderSize; headerOffset < chunk->top;)
+    {
+        const BlockHeader * const header = reinterpret_cast<const BlockHeader *>(base + headerOffset);
+        if (header->live.load(std::memory_order_acquire))
+        {
+            if (inRun && headerOffset - runBegin > bestEnd - bestBegin)
+            {
+                bestBegin = runBegin;
+                bestEnd   = headerOffset;
+            }
+            inRun = false;
+        }
+        else if (!inRun)
+        {
+            runBegin = headerOffset;
+            inRun    = true;
+        }
+        headerOffset = alignUp(header->end, blockHeaderAlignment);
+    }
+
+    /* The freed blocks at the end of the chain join the free tail of the chunk */
+    if (inRun) chunk->top = runBegin;
+    if (chunk->size - chunk->top >= bestEnd - bestBegin)
+    {
+        bestBegin = chunk->top;
+        bestEnd   = chunk->size;
+    }
+    chunk->offset = bestBegin;
+    chunk->limit  = bestEnd;
+}
+
+/* Replaces the chunk the blocks are allocated from by the shared chunk the block fits into, called under the lock of the arena */
+void * allocateFromNextChunk(HostArenaImpl & impl, Chunk *& chunk, size_t size, size_t alignment)
+{
+    if (chunk) chunk->owned = false;
+    chunk = nullptr;
+
+    /* The blocks freed during the operation make their chunks available before the new chunk is taken */
+    for (Chunk * candidate = impl.sharedChunks; candidate; candidate = candidate->next)
+    {
+        if (candidate->owned) continue;
+        rewindIfFree(candidate);
+        void * const ptr = takeBlock(candidate, size, alignment);
+        if (ptr)
+        {
+            candidate->owned = true;
+            chunk            = candidate;
+            return ptr;
+        }
+    }
+
+    Chunk * const created = createChunk(hostArenaChunkSize, false, impl.useHugePages);
+    if (!created) return nullptr;
+    if (impl.sharedTail)
+    {
+        impl.sharedTail->next = created;
+    }
+    else
+    {
+        impl.sharedChunks = created;
+    }
+    impl.sharedTail = created;
+    impl.reservedSize += hostArenaChunkSize;
+    created->owned = true;
+    chunk          = created;
+    return takeBlock(created, size, alignment);
+}
+
+void * allocateDedicated(HostArenaImpl & impl, size_t size, size_t alignment)
+{
+    const size_t blockOffset = alignUp(chunkHeaderSize, alignment);
+    if (size > size_t(-1) - blockOffset - hostArenaChunkSize) return nullptr;
+    const size_t chunkSize = alignUp(blockOffset + size, hostArenaChunkSize);
+
+    /* Reuse the smallest free chunk that is not too large for the block */
+    Chunk * best = nullptr;
+    for (Chunk * chunk = impl.dedicatedChunks; chunk; chunk = chunk->next)
+    {
+        if (chunk->nRefs.load(std::memory_order_acquire) == 1 && chunk->size >= chunkSize && chunk->size / 2 <= chunkSize
+            && (!best || chunk->size < best->size))
+        {
+            best = chunk;
+        }
+    }
+
+    if (!best)
+    {
+        best = createChunk(chunkSize, true, impl.useHugePages);
+        if (!best) return nullptr;
+        best->next           = impl.dedicatedChunks;
+        impl.dedicatedChunks = best;
+        impl.reservedSize += chunkSize;
+    }
+    best->reused = true;
+    best->nRefs.fetch_add(1, std::memory_order_relaxed);
+    return reinterpret_cast<char *>(best) + blockOffset;
+}
+
+} // namespace
+
+HostArena::HostArena(bool useHugePages) : _impl(new HostArenaImpl(useHugePages)) {}
+
+HostArena::~HostArena()
+{
+    ThreadState & state = threadState;
+    if (state.arena == this)
+    {
+        state.arena = nullptr;
+        state.depth = 0;
+        state.chunk = nullptr;
+    }
+
+    /* The chunks with the live blocks are returned to the system when their last block is freed */
+    HostArenaImpl * const impl = static_cast<HostArenaImpl *>(_impl);
+    releaseChunks(impl->sharedChunks);
+    releaseChunks(impl->dedicatedChunks);
+    delete impl;
+}
+
+void * HostArena::allocate(size_t size, size_t alignment)
+{
+    if (!alignment || (alignment & (alignment - 1)) || alignment > maxBlockInSharedChunk / 2) return nullptr;
+    if (!size) size = 1;
+
+    HostArenaImpl & impl = *static_cast<HostArenaImpl *>(_impl);
+    if (size > maxBlockInSharedChunk - alignment - blockHeaderSpace)
+    {
+        AUTOLOCK(impl.mutex);
+        return allocateDedicated(impl, size, alignment);
+    }
+
+    /* The thread the arena is current on allocates from its own chunk without the lock */
+    ThreadState & state = threadState;
+    if (state.arena == this)
+    {
+        if (state.chunk)
+        {
+            rewindIfFree(state.chunk);
+            void * const ptr = takeBlock(state.chunk, size, alignment);
+            if (ptr) return ptr;
+        }
+        AUTOLOCK(impl.mutex);
+        return allocateFromNextChunk(impl, state.chunk, size, alignment);
+    }
+
+    AUTOLOCK(impl.mutex);
+    if (impl.current)
+    {
+        rewindIfFree(impl.current);
+        void * const ptr = takeBlock(impl.current, size, alignment);
+        if (ptr) return ptr;
+    }
+    return allocateFromNextChunk(impl, impl.current, size, alignment);
+}
+
+void HostArena::reset()
+{
+    HostArenaImpl & impl = *static_cast<HostArenaImpl *>(_impl);
+    AUTOLOCK(impl.mutex);
+
+    if (impl.current)
+    {
+        impl.current->owned = false;
+        impl.current        = nullptr;
+    }
+
+    /* The shared chunks stay mapped, the blocks are allocated from the beginning of the free ones
+       and from the largest free space of the ones with the live blocks */
+    for (Chunk * chunk = impl.sharedChunks; chunk; chunk = chunk->next)
+    {
+        if (chunk->owned || rewindIfFree(chunk)) continue;
+        rewindAroundLiveBlocks(chunk);
+    }
+
+    /* The free dedicated chunks are kept only if they were used by the last operation */
+    for (Chunk ** link = &impl.dedicatedChunks; *link;)
+    {
+        Chunk * const chunk = *link;
+        if (chunk->nRefs.load(std::memory_order_acquire) == 1 && !chunk->reused)
+        {
+            *link = chunk->next;
+            impl.reservedSize -= chunk->size;
+            releaseChunk(chunk);
+            continue;
+        }
+        chunk->reused = false;
+        link          = &chunk->next;
+    }
+}
+
+void HostArena::detachThread()
+{
+    ThreadState & state = threadState;
+    if (state.arena != this || !state.chunk) return;
+
+    HostArenaImpl & impl = *static_cast<HostArenaImpl *>(_impl);
+    AUTOLOCK(impl.mutex);
+    state.chunk->owned = false;
+    state.chunk        = nullptr;
+}
+
+size_t HostArena::getReservedSize() const
+{
+    HostArenaImpl & impl = *static_cast<HostArenaImpl *>(_impl);
+    AUTOLOCK(impl.mutex);
+    return impl.reservedSize;
+}
+
+bool HostArena::release(void * ptr)
+{
+    if (!ptr || !chunkRegistry().contains(ptr)) return false;
+
+    Chunk * const chunk = reinterpret_cast<Chunk *>(uintptr_t(ptr) & ~uintptr_t(chunkMask));
+    if (!chunk->dedicated)
+    {
+        const uint32_t headerOffset = *reinterpret_cast<const uint32_t *>(static_cast<const char *>(ptr) - sizeof(uint32_t));
+        reinterpret_cast<BlockHeader *>(reinterpret_cast<char *>(chunk) + headerOffset)->live.store(0, std::memory_order_release);
+    }
+    releaseChunk(chunk);
+    return true;
+}
+
+bool setCurrentHostArena(HostArena * arena)
+{
+    ThreadState & state = threadState;
+    if (state.arena && state.arena != arena) return false;
+    state.arena = arena;
+    ++state.depth;
+    return true;
+}
+
+void unsetCurrentHostArena(HostArena * arena)
+{
+    ThreadState & state = threadState;
+    if (state.arena != arena || --state.depth) return;
+    arena->detachThread();
+    state.arena = nullptr;
+}
+
+HostArena * getCurrentHostArena()
+{
+    return threadState.arena;
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
@@ -0,0 +1,118 @@
+/* file: service_host_arena.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the arena of the host memory reused by the consecutive operations
+//--
+*/
+
+#ifndef __SERVICE_HOST_ARENA_H__
+#define __SERVICE_HOST_ARENA_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/* Size and alignment of the chunks the arena takes from the system, equal to the size of the transparent huge page */
+const size_t hostArenaChunkSize = (size_t)1 << 21;
+
+/**
+ *  \brief Arena of the host memory reused by the consecutive operations.
+ *
+ *  The blocks are allocated by bumping the offset inside the chunks of hostArenaChunkSize bytes,
+ *  the large blocks get the dedicated chunks. The chunks are aligned by their size, so the chunk
+ *  of any block is found from its address. The thread the arena is current on bumps the offset
+ *  of its own chunk without the lock. reset() makes the chunks without live blocks available
+ *  for the allocation again without returning them to the system, and the chunks with the live
+ *  blocks are reused from their largest free space, so the repeated operations neither call
+ *  the system allocator nor page-fault on the fresh memory.
+ *
+ *  While the arena is set as the current one on the thread, daal_malloc and the scalable allocation
+ *  functions of the library called on this thread take the memory from it. The blocks that outlive
+ *  the operation, e.g. the results, stay valid: their memory is not reused until the blocks are freed,
+ *  and the chunks are returned to the system when the last block is freed even if the arena is destroyed before.
+ */
+class DAAL_EXPORT HostArena
+{
+public:
+    /**
+     *  \param[in] useHugePages Whether to advise the system to back the chunks by the transparent huge pages
+     */
+    explicit HostArena(bool useHugePages = true);
+    ~HostArena();
+
+    /**
+     *  \brief Allocates the block of memory from the arena
+     *  \return Pointer to the block, or NULL if the block cannot be taken from the arena
+     */
+    void * allocate(size_t size, size_t alignment);
+
+    /**
+     *  \brief Makes the free memory of the chunks no thread allocates from available for the following allocations
+     */
+    void reset();
+
+    /**
+     *  \brief Stops the allocations of the calling thread from the chunk it owns
+     */
+    void detachThread();
+
+    /**
+     *  \brief Returns the number of bytes taken by the arena from the system
+     */
+    size_t getReservedSize() const;
+
+    /**
+     *  \brief Frees the block allocated by any arena
+     *  \return false if the block does not belong to an arena and is left intact
+     */
+    static bool release(void * ptr);
+
+private:
+    HostArena(const HostArena &);
+    HostArena & operator=(const HostArena &);
+
+    void * _impl;
+};
+
+/**
+ *  \brief Sets the arena used by the allocation functions of the library on the calling thread.
+ *  The calls nest: the arena stays current until unsetCurrentHostArena is called as many times
+ *  \return false if another arena is current on the calling thread
+ */
+DAAL_EXPORT bool setCurrentHostArena(HostArena * arena);
+
+/**
+ *  \brief Stops using the arena by the allocation functions of the library on the calling thread if it is the current one
+ */
+DAAL_EXPORT void unsetCurrentHostArena(HostArena * arena);
+
+/**
+ *  \brief Returns the arena used by the allocation functions of the library on the calling thread, or NULL
+ */
+DAAL_EXPORT HostArena * getCurrentHostArena();
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
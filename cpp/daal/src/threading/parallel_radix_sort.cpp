@@ -0,0 +1,347 @@
+/* file: parallel_radix_sort.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the radix sort and the segmented sort of the threading layer.
+//--
+*/
+
+#include "src/threading/threading.h"
+
+#include <string.h> // memcpy
+#include <algorithm>
+#include <limits>
+
+namespace daal
+{
+namespace internal
+{
+namespace
+{
+/* The keys are sorted by the digits of radixBits bits starting from the least significant one */
+const size_t radixBits = 8;
+const size_t radixSize = size_t(1) << radixBits;
+
+/* Arrays of at most insertionSortMaxSize elements are sorted by the insertion sort */
+const int64_t insertionSortMaxSize = 64;
+
+/* The radix sort splits the array into at most maxRadixBlocks blocks of at least minRadixBlockSize elements
+   that are counted and scattered in parallel */
+const int64_t minRadixBlockSize = 16384;
+const int64_t maxRadixBlocks    = 64;
+
+/* The segments of at least largeSegmentSize elements are sorted one by one by the parallel radix sort */
+const int64_t largeSegmentSize = 4 * minRadixBlockSize;
+
+/* Maps the keys to the unsigned integers of the same order */
+template <typename KeyType>
+struct RadixKey;
+
+template <>
+struct RadixKey<int>
+{
+    typedef uint32_t BitsType;
+    static BitsType bits(int key) { return BitsType(key) ^ (BitsType(1) << 31); }
+};
+
+template <>
+struct RadixKey<int64_t>
+{
+    typedef uint64_t BitsType;
+    static BitsType bits(int64_t key) { return BitsType(key) ^ (BitsType(1) << 63); }
+};
+
+/* Negative floating point keys have all the bits inverted, non-negative ones have the sign bit set.
+   -0 is mapped as +0 and all the NaNs are mapped after +inf, so the keys that compare equal keep their order */
+template <typename BitsType, typename FPType>
+inline BitsType floatingPointBits(FPType key)
+{
+    const BitsType signBit = BitsType(1) << (sizeof(BitsType) * 8 - 1);
+    const FPType infinity  = std::numeric_limits<FPType>::infinity();
+
+    BitsType result, infinityBits;
+    memcpy(&result, &key, sizeof(result));
+    memcpy(&infinityBits, &infinity, sizeof(infinityBits));
+
+    const BitsType magnitude = result & ~signBit;
+    if (magnitude > infinityBits)
+    {
+        return ~BitsType(0);
+    }
+    if (magnitude == 0)
+    {
+        return signBit;
+    }
+    return (result & signBit) ? ~result : (result | signBit);
+}
+
+template <>
+struct RadixKey<float>
+{
+    typedef uint32_t BitsType;
+    static BitsType bits(float key) { return floatingPointBits<BitsType>(key); }
+};
+
+template <>
+struct RadixKey<double>
+{
+    typedef uint64_t BitsType;
+    static BitsType bits(double key) { return floatingPointBits<BitsType>(key); }
+};
+
+/* Extracts the key of the sorted element */
+template <typename ElementType>
+struct ElementKey
+{
+    typedef ElementType KeyType;
+    static KeyType get(const ElementType & element) { return element; }
+};
+
+template <typename KeyType_, typename ValueType>
+struct ElementKey<KeyValType<KeyType_, ValueType> >
+{
+    typedef KeyType_ KeyType;
+    static KeyType get(const KeyValType<KeyType_, ValueType> & element) { return element.key; }
+};
+
+template <typename ElementType>
+inline typename RadixKey<typename ElementKey<ElementType>::KeyType>::BitsType radixBitsOf(const ElementType & element)
+{
+    return RadixKey<typename ElementKey<ElementType>::KeyType>::bits(ElementKey<ElementType>::get(element));
+}
+
+/* Order of the radix sort for the comparison-based sorts */
+template <typename ElementType>
+struct RadixLess
+{
+    bool operator()(const ElementType & a, const ElementType & b) const { return radixBitsOf(a) < radixBitsOf(b); }
+};
+
+/* Stable sort of the short arrays in the order of the radix sort */
+template <typename ElementType>
+void insertionSort(ElementType * data, int64_t n)
+{
+    for (int64_t i = 1; i < n; ++i)
+    {
+        const ElementType element = data[i];
+        const auto bits           = radixBitsOf(element);
+
+        int64_t j = i;
+        for (; j > 0 && bits < radixBitsOf(data[j - 1]); --j)
+        {
+            data[j] = data[j - 1];
+        }
+        data[j] = element;
+    }
+}
+
+template <typename ElementType>
+void radixSort(ElementType * data, ElementType * buffer, int64_t n)
+{
+    if (n <= insertionSortMaxSize)
+    {
+        insertionSort(data, n);
+        return;
+    }
+
+    typedef typename RadixKey<typename ElementKey<ElementType>::KeyType>::BitsType BitsType;
+    const size_t nPasses = sizeof(BitsType) * 8 / radixBits;
+
+    int64_t nBlocks = n / minRadixBlockSize;
+    nBlocks         = nBlocks < 1 ? 1 : (nBlocks > maxRadixBlocks ? maxRadixBlocks : nBlocks);
+
+    /* counts[iBlock * radixSize + digit] is the number of the elements of the block with the digit,
+       then the position in the output of the next such element */
+    int64_t localCounts[radixSize];
+    int64_t * counts = localCounts;
+    if (nBlocks > 1)
+    {
+        counts = static_cast<int64_t *>(_threaded_scalable_malloc(nBlocks * radixSize * sizeof(int64_t), 64));
+        if (!counts)
+        {
+            nBlocks = 1;
+            counts  = localCounts;
+        }
+    }
+    const int64_t blockSize = n / nBlocks + !!(n % nBlocks);
+
+    ElementType * src = data;
+    ElementType * dst = buffer;
+    for (size_t iPass = 0; iPass < nPasses; ++iPass)
+    {
+        const size_t shift = iPass * radixBits;
+
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+            int64_t * blockCounts = counts + iBlock * radixSize;
+            for (size_t digit = 0; digit < radixSize; ++digit)
+            {
+                blockCounts[digit] = 0;
+            }
+
+            const int64_t begin = iBlock * blockSize;
+            const int64_t end   = n < begin + blockSize ? n : begin + blockSize;
+            for (int64_t i = begin; i < end; ++i)
+            {
+                ++blockCounts[(radixBitsOf(src[i]) >> shift) & (radixSize - 1)];
+            }
+        });
+
+        /* The pass does not change the order if all the keys have the same digit */
+        bool isSameDigit = false;
+        for (size_t digit = 0; digit < radixSize && !isSameDigit; ++digit)
+        {
+            int64_t total = 0;
+            for (int64_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                total += counts[iBlock * radixSize + digit];
+            }
+            isSameDigit = (total == n);
+        }
+        if (isSameDigit)
+        {
+            continue;
+        }
+
+        /* The elements of each digit are placed in the order of the blocks, which keeps the sort stable */
+        int64_t offset = 0;
+        for (size_t digit = 0; digit < radixSize; ++digit)
+        {
+            for (int64_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                const int64_t count                = counts[iBlock * radixSize + digit];
+                counts[iBlock * radixSize + digit] = offset;
+                offset += count;
+            }
+        }
+
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+            int64_t * blockOffsets = counts + iBlock * radixSize;
+
+            const int64_t begin = iBlock * blockSize;
+            const int64_t end   = n < begin + blockSize ? n : begin + blockSize;
+            for (int64_t i = begin; i < end; ++i)
+            {
+                dst[blockOffsets[(radixBitsOf(src[i]) >> shift) & (radixSize - 1)]++] = src[i];
+            }
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+    {
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+            const int64_t begin = iBlock * blockSize;
+            const int64_t end   = n < begin + blockSize ? n : begin + blockSize;
+            if (begin < end)
+            {
+                memcpy(data + begin, src + begin, (end - begin) * sizeof(ElementType));
+            }
+        });
+    }
+
+    if (counts != localCounts)
+    {
+        _threaded_scalable_free(counts);
+    }
+}
+
+template <typename KeyType>
+void segmentedSort(KeyType * data, const int64_t * offsets, int64_t nSegments)
+{
+    daal::threader_for_int64(nSegments, [&](int64_t iSegment) {
+        KeyType * begin    = data + offsets[iSegment];
+        const int64_t size = offsets[iSegment + 1] - offsets[iSegment];
+        if (size <= insertionSortMaxSize)
+        {
+            insertionSort(begin, size);
+        }
+        else if (size < largeSegmentSize)
+        {
+            std::stable_sort(begin, begin + size, RadixLess<KeyType>());
+        }
+    });
+
+    for (int64_t iSegment = 0; iSegment < nSegments; ++iSegment)
+    {
+        KeyType * begin    = data + offsets[iSegment];
+        const int64_t size = offsets[iSegment + 1] - offsets[iSegment];
+        if (size < largeSegmentSize)
+        {
+            continue;
+        }
+
+        KeyType * buffer = static_cast<KeyType *>(_threaded_scalable_malloc(size * sizeof(KeyType), 64));
+        if (buffer)
+        {
+            radixSort(begin, buffer, size);
+            _threaded_scalable_free(buffer);
+        }
+        else
+        {
+            std::stable_sort(begin, begin + size, RadixLess<KeyType>());
+        }
+    }
+}
+} // namespace
+} // namespace internal
+} // namespace daal
+
+#define DAAL_PARALLEL_RADIX_SORT_IMPL(TYPE, NAMESUFFIX)                                                          \
+    DAAL_EXPORT void _daal_parallel_radix_sort_##NAMESUFFIX(TYPE * begin_ptr, TYPE * end_ptr, TYPE * buffer_ptr) \
+    {                                                                                                            \
+        daal::internal::radixSort<TYPE>(begin_ptr, buffer_ptr, end_ptr - begin_ptr);                             \
+    }
+
+DAAL_PARALLEL_RADIX_SORT_IMPL(int, int32)
+DAAL_PARALLEL_RADIX_SORT_IMPL(int64_t, int64)
+DAAL_PARALLEL_RADIX_SORT_IMPL(float, fp32)
+DAAL_PARALLEL_RADIX_SORT_IMPL(double, fp64)
+
+#undef DAAL_PARALLEL_RADIX_SORT_IMPL
+
+#define DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(KEYTYPE, VALTYPE, NAMESUFFIX)                                            \
+    DAAL_EXPORT void _daal_parallel_radix_sort_##NAMESUFFIX(daal::KeyValType<KEYTYPE, VALTYPE> * begin_ptr,         \
+                                                            daal::KeyValType<KEYTYPE, VALTYPE> * end_ptr,           \
+                                                            daal::KeyValType<KEYTYPE, VALTYPE> * buffer_ptr)        \
+    {                                                                                                               \
+        daal::internal::radixSort<daal::KeyValType<KEYTYPE, VALTYPE> >(begin_ptr, buffer_ptr, end_ptr - begin_ptr); \
+    }
+
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(int, int, pair_int32_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(int64_t, int, pair_int64_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(float, int, pair_fp32_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(double, int, pair_fp64_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(int, size_t, pair_int32_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(int64_t, size_t, pair_int64_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(float, size_t, pair_fp32_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL(double, size_t, pair_fp64_uint64)
+
+#undef DAAL_PARALLEL_RADIX_SORT_PAIR_IMPL
+
+#define DAAL_PARALLEL_SEGMENTED_SORT_IMPL(TYPE, NAMESUFFIX)                                                                   \
+    DAAL_EXPORT void _daal_parallel_segmented_sort_##NAMESUFFIX(TYPE * data_ptr, const int64_t * offsets, int64_t n_segments) \
+    {                                                                                                                         \
+        daal::internal::segmentedSort<TYPE>(data_ptr, offsets, n_segments);                                                   \
+    }
+
+DAAL_PARALLEL_SEGMENTED_SORT_IMPL(int, int32)
+DAAL_PARALLEL_SEGMENTED_SORT_IMPL(int64_t, int64)
+DAAL_PARALLEL_SEGMENTED_SORT_IMPL(float, fp32)
+DAAL_PARALLEL_SEGMENTED_SORT_IMPL(double, fp64)
+
+#undef DAAL_PARALLEL_SEGMENTED_SORT_IMPL
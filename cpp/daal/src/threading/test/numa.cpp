@@ -0,0 +1,152 @@
+/* file: numa.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the split of the blocks among the NUMA nodes in the NUMA affinity mode of static_threader_for
+//  on the arenas that fake the nodes, and that the first touch of the tables keeps their content
+//--
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+
+#include <tbb/version.h>
+#if TBB_INTERFACE_VERSION >= 12002
+    #include "src/threading/threading_numa.h"
+#endif
+
+namespace daal::internal::test
+{
+#if TBB_INTERFACE_VERSION >= 12002
+/* Unconstrained arenas of the given concurrencies that stand for the NUMA nodes,
+   the concurrencies are distinct so the node of a thread is recognized by the concurrency of its arena */
+static std::vector<tbb::task_arena::constraints> fakeNodes(const std::vector<int> & concurrencies)
+{
+    std::vector<tbb::task_arena::constraints> constraints;
+    for (int concurrency : concurrencies) constraints.push_back(tbb::task_arena::constraints(tbb::task_arena::automatic, concurrency));
+    return constraints;
+}
+
+class NumaStaticThreaderForTest : public ::testing::TestWithParam<std::vector<int> >
+{
+protected:
+    NumaStaticThreaderForTest() : arenas(fakeNodes(GetParam())) {}
+
+    /* Node that runs the thread tid of static_threader_for */
+    size_t nodeOfThread(size_t tid, size_t nthreads) const
+    {
+        size_t iNode = 0;
+        while (arenas.threadBegin(iNode + 1, nthreads) <= tid) ++iNode;
+        return iNode;
+    }
+
+    NumaArenas arenas;
+};
+
+TEST_P(NumaStaticThreaderForTest, ThreadsOfNodeAreContiguous)
+{
+    for (size_t nthreads : { 1, 2, 3, 8, 13, 64 })
+    {
+        EXPECT_EQ(arenas.threadBegin(0, nthreads), size_t(0));
+        EXPECT_EQ(arenas.threadBegin(arenas.size(), nthreads), nthreads);
+        for (size_t iNode = 0; iNode < arenas.size(); ++iNode)
+        {
+            /* The share of the threads of a node differs from the share of its concurrency by less than one thread */
+            const size_t begin = arenas.threadBegin(iNode, nthreads);
+            const size_t end   = arenas.threadBegin(iNode + 1, nthreads);
+            ASSERT_LE(begin, end) << "nthreads = " << nthreads;
+            const double share = double(nthreads * arenas.concurrency(iNode)) / double(arenas.totalConcurrency());
+            EXPECT_LT(double(end - begin), share + 1.0) << "nthreads = " << nthreads << ", node = " << iNode;
+            EXPECT_GT(double(end - begin), share - 1.0) << "nthreads = " << nthreads << ", node = " << iNode;
+        }
+    }
+}
+
+TEST_P(NumaStaticThreaderForTest, ProcessesEveryBlockOnceOnItsNode)
+{
+    for (size_t nthreads : { 1, 2, 3, 8, 13 })
+    {
+        for (size_t n : { 0, 1, 7, 100, 1003 })
+        {
+            std::vector<std::atomic<int> > hits(n);
+            std::vector<size_t> tids(n), concurrencies(n);
+            numaStaticThreaderFor(arenas, n, nthreads, [&](size_t i, size_t tid) {
+                ++hits[i];
+                tids[i]          = tid;
+                concurrencies[i] = size_t(tbb::this_task_arena::max_concurrency());
+            });
+
+            const size_t nblocksPerThread = n / nthreads + !!(n % nthreads);
+            for (size_t i = 0; i < n; ++i)
+            {
+                ASSERT_EQ(hits[i].load(), 1) << "nthreads = " << nthreads << ", n = " << n << ", i = " << i;
+                ASSERT_EQ(tids[i], i / nblocksPerThread) << "nthreads = " << nthreads << ", n = " << n << ", i = " << i;
+                ASSERT_EQ(concurrencies[i], arenas.concurrency(nodeOfThread(tids[i], nthreads)))
+                    << "nthreads = " << nthreads << ", n = " << n << ", i = " << i;
+            }
+        }
+    }
+}
+
+TEST_P(NumaStaticThreaderForTest, RunsNestedLoops)
+{
+    const size_t n = 64;
+    std::vector<int64_t> sums(n, 0);
+    numaStaticThreaderFor(arenas, n, 8, [&](size_t i, size_t) {
+        std::atomic<int64_t> sum(0);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, 1000), [&](const tbb::blocked_range<size_t> & r) {
+            for (size_t j = r.begin(); j < r.end(); ++j) sum += int64_t(j);
+        });
+        sums[i] = sum.load();
+    });
+    for (size_t i = 0; i < n; ++i) EXPECT_EQ(sums[i], 499500) << "i = " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(FakeNodes, NumaStaticThreaderForTest,
+                         ::testing::Values(std::vector<int> { 1, 2 }, std::vector<int> { 3, 2 }, std::vector<int> { 1, 4, 2 }));
+#endif
+
+/* The first touch rewrites every page of the block with its own content, on any number of NUMA nodes */
+TEST(NumaFirstTouchTest, KeepsContent)
+{
+    daal::services::Environment::getInstance()->enableNumaAffinity(true);
+    for (size_t size : { size_t(1000), size_t(1) << 22, (size_t(1) << 24) + 123 })
+    {
+        unsigned char * const data = static_cast<unsigned char *>(daal::services::daal_malloc(size));
+        ASSERT_NE(data, nullptr);
+        for (size_t i = 0; i < size; ++i) data[i] = static_cast<unsigned char>(i * 31 + 7);
+
+        daal::services::daal_first_touch(data, size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(data[i], static_cast<unsigned char>(i * 31 + 7)) << "size = " << size << ", i = " << i;
+        }
+        daal::services::daal_free(data);
+    }
+    daal::services::daal_first_touch(nullptr, size_t(1) << 24);
+    daal::services::Environment::getInstance()->enableNumaAffinity(false);
+}
+
+} // namespace daal::internal::test
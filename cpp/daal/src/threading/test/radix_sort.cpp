@@ -0,0 +1,225 @@
+/* file: radix_sort.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the radix sort and the segmented sort of the threading layer against std::stable_sort
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/threading/threading.h"
+
+namespace daal::internal::test
+{
+/* Sizes sorted by the insertion sort, by one block and by several blocks of the radix sort */
+static const std::vector<size_t> sizes = { 0, 1, 2, 64, 65, 1000, 32767, 32768, 100003 };
+
+template <typename KeyType>
+KeyType keyOf(const KeyType & element)
+{
+    return element;
+}
+
+template <typename KeyType, typename ValueType>
+KeyType keyOf(const KeyValType<KeyType, ValueType> & element)
+{
+    return element.key;
+}
+
+/* Order of the sorts of the threading layer: NaNs are equal to each other and go after all the other keys */
+template <typename KeyType>
+bool keyLess(KeyType a, KeyType b)
+{
+    if constexpr (std::is_floating_point<KeyType>::value)
+    {
+        if (std::isnan(b)) return !std::isnan(a);
+    }
+    return a < b;
+}
+
+template <typename KeyType>
+std::uint64_t keyBits(KeyType key)
+{
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &key, sizeof(key));
+    return bits;
+}
+
+/* The keys are compared bitwise, so the order of -0 and +0 and of the different NaNs is checked too */
+template <typename ElementType>
+void expectSorted(const std::vector<ElementType> & input, const std::vector<ElementType> & result, const char * name)
+{
+    std::vector<ElementType> expected = input;
+    std::stable_sort(expected.begin(), expected.end(), [](const ElementType & a, const ElementType & b) { return keyLess(keyOf(a), keyOf(b)); });
+
+    ASSERT_EQ(expected.size(), result.size()) << name;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(keyBits(keyOf(expected[i])), keyBits(keyOf(result[i]))) << name << ", n = " << expected.size() << ", i = " << i;
+        if constexpr (!std::is_arithmetic<ElementType>::value)
+        {
+            ASSERT_EQ(expected[i].val, result[i].val) << name << ", n = " << expected.size() << ", i = " << i;
+        }
+    }
+}
+
+template <typename ElementType>
+std::vector<ElementType> radixSorted(std::vector<ElementType> data)
+{
+    std::vector<ElementType> buffer(data.size());
+    parallel_radix_sort(data.data(), data.data() + data.size(), buffer.data());
+    return data;
+}
+
+/* Random keys from the whole range of the type, floating point ones with all the special values among them */
+template <typename KeyType>
+std::vector<KeyType> randomKeys(size_t n, std::mt19937 & rng)
+{
+    std::vector<KeyType> keys(n);
+    if constexpr (std::is_floating_point<KeyType>::value)
+    {
+        typedef std::numeric_limits<KeyType> Limits;
+        const KeyType specials[] = { KeyType(0),         -KeyType(0),      Limits::infinity(),  -Limits::infinity(), Limits::quiet_NaN(),
+                                     -Limits::quiet_NaN(), Limits::min(),  -Limits::min(),      Limits::denorm_min(), -Limits::denorm_min(),
+                                     Limits::max(),      -Limits::max(),   KeyType(1),          KeyType(-1) };
+        const size_t nSpecials = sizeof(specials) / sizeof(specials[0]);
+        std::normal_distribution<KeyType> normal(KeyType(0), KeyType(1000));
+        std::uniform_int_distribution<size_t> pick(0, 2 * nSpecials - 1);
+        for (auto & key : keys)
+        {
+            const size_t i = pick(rng);
+            key            = i < nSpecials ? specials[i] : normal(rng);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<KeyType> uniform(std::numeric_limits<KeyType>::min(), std::numeric_limits<KeyType>::max());
+        for (auto & key : keys) key = uniform(rng);
+    }
+    return keys;
+}
+
+template <typename KeyType>
+class RadixSortTest : public ::testing::Test
+{};
+
+typedef ::testing::Types<int, int64_t, float, double> KeyTypes;
+TYPED_TEST_SUITE(RadixSortTest, KeyTypes);
+
+TYPED_TEST(RadixSortTest, SortsKeys)
+{
+    std::mt19937 rng(777);
+    for (size_t n : sizes)
+    {
+        const std::vector<TypeParam> keys = randomKeys<TypeParam>(n, rng);
+        expectSorted(keys, radixSorted(keys), "keys");
+    }
+}
+
+/* Few distinct keys, so the elements with the same key come from all the blocks */
+TYPED_TEST(RadixSortTest, KeepsOrderOfEqualKeys)
+{
+    std::mt19937 rng(777);
+    for (size_t n : sizes)
+    {
+        const std::vector<TypeParam> keys = randomKeys<TypeParam>(n, rng);
+        std::vector<KeyValType<TypeParam, int> > pairs(n);
+        std::vector<KeyValType<TypeParam, size_t> > widePairs(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            pairs[i]     = { keys[i % 16], int(i) };
+            widePairs[i] = { keys[i], i };
+        }
+        expectSorted(pairs, radixSorted(pairs), "pairs");
+        expectSorted(widePairs, radixSorted(widePairs), "wide pairs");
+    }
+}
+
+/* All the elements of the floating point types that compare equal keep their order */
+TYPED_TEST(RadixSortTest, KeepsOrderOfZerosAndNaNs)
+{
+    if constexpr (std::is_floating_point<TypeParam>::value)
+    {
+        typedef std::numeric_limits<TypeParam> Limits;
+        const TypeParam keys[] = { TypeParam(0), -TypeParam(0), Limits::quiet_NaN(), -Limits::quiet_NaN(), Limits::infinity(), -Limits::infinity() };
+        for (size_t n : sizes)
+        {
+            std::vector<KeyValType<TypeParam, int> > pairs(n);
+            for (size_t i = 0; i < n; ++i) pairs[i] = { keys[(i * 7) % 6], int(i) };
+            expectSorted(pairs, radixSorted(pairs), "zeros and NaNs");
+        }
+    }
+}
+
+/* The keys differ in some of the digits only, the passes over the other digits are skipped.
+   An odd number of the done passes leaves the result in the buffer and it is copied back */
+TYPED_TEST(RadixSortTest, SkipsSameDigits)
+{
+    std::mt19937 rng(777);
+    for (size_t n : { size_t(1000), size_t(100003) })
+    {
+        for (int nBits : { 0, 8, 16 })
+        {
+            std::uniform_int_distribution<int> uniform(0, (1 << nBits) - 1);
+            std::vector<KeyValType<TypeParam, int> > pairs(n);
+            for (size_t i = 0; i < n; ++i) pairs[i] = { TypeParam(uniform(rng)), int(i) };
+            expectSorted(pairs, radixSorted(pairs), "same digits");
+        }
+    }
+}
+
+TEST(RadixSortTest, SplitsIntoMaxNumberOfBlocks)
+{
+    std::mt19937 rng(777);
+    const std::vector<int> keys = randomKeys<int>((size_t(1) << 20) + 7, rng);
+    std::vector<KeyValType<int, int> > pairs(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) pairs[i] = { keys[i] % 1000, int(i) };
+    expectSorted(pairs, radixSorted(pairs), "max blocks");
+}
+
+/* The segments are sorted by the insertion sort, by the comparison-based sort in parallel and by the radix sort one by one */
+TYPED_TEST(RadixSortTest, SortsSegments)
+{
+    std::mt19937 rng(777);
+    const size_t segmentSizes[] = { 0, 1, 5, 64, 65, 1000, 0, 65535, 65536, 70000, 3, 0 };
+    std::vector<int64_t> offsets(1, 0);
+    for (size_t size : segmentSizes) offsets.push_back(offsets.back() + int64_t(size));
+
+    const std::vector<TypeParam> keys = randomKeys<TypeParam>(size_t(offsets.back()), rng);
+    std::vector<TypeParam> result     = keys;
+    parallel_segmented_sort(result.data(), offsets.data(), int64_t(offsets.size() - 1));
+
+    for (size_t iSegment = 0; iSegment + 1 < offsets.size(); ++iSegment)
+    {
+        const std::vector<TypeParam> segment(keys.begin() + offsets[iSegment], keys.begin() + offsets[iSegment + 1]);
+        const std::vector<TypeParam> sortedSegment(result.begin() + offsets[iSegment], result.begin() + offsets[iSegment + 1]);
+        expectSorted(segment, sortedSegment, "segment");
+    }
+}
+
+} // namespace daal::internal::test
@@ -0,0 +1,257 @@
+/* file: tls.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Checks the reduction of the thread-local storage on the backends of the threading layer
+//  and that the backend is not changed while the storage or the parallel loop is live
+//--
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
+
+#include "gtest/gtest.h"
+
+#include "src/threading/threading.h"
+
+namespace daal::internal::test
+{
+/* Runs the loops in the calling thread */
+struct SerialExecutor
+{
+    static int getMaxThreads(void *) { return 1; }
+    static int getCurrentThreadIndex(void *) { return 0; }
+    static void parallelFor(void *, int64_t n, const void * a, executor_range_functype func) { func(0, n, a); }
+};
+
+#if defined(_OPENMP)
+/* Runs the loops on the OpenMP threads */
+struct OmpExecutor
+{
+    static int getMaxThreads(void *) { return omp_get_max_threads(); }
+    static int getCurrentThreadIndex(void *) { return omp_get_thread_num(); }
+    static void parallelFor(void *, int64_t n, const void * a, executor_range_functype func)
+    {
+    #pragma omp parallel for schedule(dynamic, 1)
+        for (int64_t i = 0; i < n; ++i)
+        {
+            func(i, i + 1, a);
+        }
+    }
+};
+#endif
+
+/* Runs the loops on the calling thread and the threads started for every loop */
+struct ThreadsExecutor
+{
+    static const int nThreads = 4;
+    static thread_local int threadIndex;
+
+    static int getMaxThreads(void *) { return nThreads; }
+    static int getCurrentThreadIndex(void *) { return threadIndex; }
+    static void parallelFor(void *, int64_t n, const void * a, executor_range_functype func)
+    {
+        std::atomic<int64_t> next(0);
+        const auto work = [&]() {
+            for (int64_t i = next++; i < n; i = next++)
+            {
+                func(i, i + 1, a);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int iThread = 1; iThread < nThreads; ++iThread)
+        {
+            threads.emplace_back([&, iThread]() {
+                threadIndex = iThread;
+                work();
+            });
+        }
+        work();
+        for (auto & thread : threads) thread.join();
+    }
+};
+
+thread_local int ThreadsExecutor::threadIndex = 0;
+
+template <typename Executor>
+ThreadingExecutor makeExecutor()
+{
+    ThreadingExecutor executor;
+    executor.context               = nullptr;
+    executor.getMaxThreads         = Executor::getMaxThreads;
+    executor.getCurrentThreadIndex = Executor::getCurrentThreadIndex;
+    executor.parallelFor           = Executor::parallelFor;
+    return executor;
+}
+
+/* The executor to install, or NULL for the backend selected when the library is loaded */
+typedef const ThreadingExecutor * (*GetExecutor)();
+
+const ThreadingExecutor * defaultBackend()
+{
+    return nullptr;
+}
+
+const ThreadingExecutor * serialExecutor()
+{
+    static const ThreadingExecutor executor = makeExecutor<SerialExecutor>();
+    return &executor;
+}
+
+#if defined(_OPENMP)
+const ThreadingExecutor * ompExecutor()
+{
+    static const ThreadingExecutor executor = makeExecutor<OmpExecutor>();
+    return &executor;
+}
+#endif
+
+const ThreadingExecutor * threadsExecutor()
+{
+    static const ThreadingExecutor executor = makeExecutor<ThreadsExecutor>();
+    return &executor;
+}
+
+class ThreadingBackendTest : public ::testing::TestWithParam<GetExecutor>
+{
+protected:
+    void SetUp() override
+    {
+        /* The sequential threading layer has no backends to switch between */
+        if (!_daal_set_threading_executor(nullptr)) GTEST_SKIP();
+        ASSERT_TRUE(_daal_set_threading_executor(GetParam()()));
+    }
+
+    void TearDown() override { _daal_set_threading_executor(nullptr); }
+};
+
+static const int64_t nIterations = 10000;
+
+/* Sums [0, nIterations) through the per-thread partial sums */
+template <typename Reduce>
+static int64_t sumByTls(const Reduce & reduce)
+{
+    daal::tls<int64_t *> partialSums([]() { return new int64_t(0); });
+    daal::threader_for(int(nIterations), int(nIterations), [&](int i) { *partialSums.local() += i; });
+
+    int64_t sum = 0;
+    reduce(partialSums, [&](int64_t * partialSum) {
+        sum += *partialSum;
+        delete partialSum;
+    });
+    return sum;
+}
+
+TEST_P(ThreadingBackendTest, ReducesTls)
+{
+    const int64_t sum = sumByTls([](daal::tls<int64_t *> & tls, const auto & func) { tls.reduce(func); });
+    EXPECT_EQ(sum, nIterations * (nIterations - 1) / 2);
+}
+
+TEST_P(ThreadingBackendTest, ReducesTlsInParallel)
+{
+    std::mutex mutex;
+    const int64_t sum = sumByTls([&](daal::tls<int64_t *> & tls, const auto & func) {
+        tls.parallel_reduce([&](int64_t * partialSum) {
+            std::lock_guard<std::mutex> lock(mutex);
+            func(partialSum);
+        });
+    });
+    EXPECT_EQ(sum, nIterations * (nIterations - 1) / 2);
+}
+
+TEST_P(ThreadingBackendTest, KeepsBackendWhileTlsIsLive)
+{
+    const int backend = _daal_get_threading_backend();
+    {
+        daal::tls<int64_t *> partialSums([]() { return new int64_t(0); });
+        EXPECT_FALSE(_daal_set_threading_executor(threadsExecutor()));
+        EXPECT_EQ(_daal_get_threading_backend(), backend);
+        partialSums.reduce([](int64_t * partialSum) { delete partialSum; });
+    }
+    EXPECT_TRUE(_daal_set_threading_executor(threadsExecutor()));
+}
+
+TEST_P(ThreadingBackendTest, KeepsBackendWhileLoopRuns)
+{
+    std::atomic<int> nChanged(0);
+    daal::threader_for(64, 64, [&](int) {
+        if (_daal_set_threading_executor(serialExecutor())) ++nChanged;
+    });
+    EXPECT_EQ(nChanged.load(), 0);
+}
+
+/* The storage is created by one thread and destroyed by another one */
+TEST_P(ThreadingBackendTest, KeepsBackendWhileTlsOfOtherThreadIsLive)
+{
+    daal::tls<int64_t *> * partialSums = nullptr;
+    std::thread([&]() { partialSums = new daal::tls<int64_t *>([]() { return new int64_t(0); }); }).join();
+    EXPECT_FALSE(_daal_set_threading_executor(threadsExecutor()));
+
+    partialSums->reduce([](int64_t * partialSum) { delete partialSum; });
+    delete partialSums;
+    EXPECT_TRUE(_daal_set_threading_executor(threadsExecutor()));
+}
+
+/* The loops and the storage are started by many threads while the backend is being changed */
+TEST_P(ThreadingBackendTest, CountsUsersOfManyThreads)
+{
+    std::atomic<bool> isDone(false);
+    std::atomic<int> nWrongSums(0);
+    std::vector<std::thread> threads;
+    for (int iThread = 0; iThread < 8; ++iThread)
+    {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 50; ++i)
+            {
+                const int64_t sum = sumByTls([](daal::tls<int64_t *> & tls, const auto & func) { tls.reduce(func); });
+                if (sum != nIterations * (nIterations - 1) / 2) ++nWrongSums;
+            }
+        });
+    }
+    std::thread switcher([&]() {
+        for (int i = 0; i < 1000 && !isDone.load(); ++i)
+        {
+            _daal_set_threading_executor(GetParam()());
+            std::this_thread::yield();
+        }
+    });
+
+    for (auto & thread : threads) thread.join();
+    isDone = true;
+    switcher.join();
+    EXPECT_EQ(nWrongSums.load(), 0);
+    EXPECT_TRUE(_daal_set_threading_executor(threadsExecutor()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, ThreadingBackendTest,
+                         ::testing::Values(defaultBackend, serialExecutor,
+#if defined(_OPENMP)
+                                           ompExecutor,
+#endif
+                                           threadsExecutor));
+
+} // namespace daal::internal::test
@@ -22,7 +22,9 @@
 */
 
 #include "src/threading/threading.h"
+#include "src/threading/threading_backend.h"
 #include "services/daal_memory.h"
+#include <atomic>
 
 #if defined(__DO_TBB_LAYER__)
     #define TBB_PREVIEW_GLOBAL_CONTROL 1
@@ -38,9 +40,12 @@
 
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
         #include <tbb/task.h>
+        #include "src/threading/threading_numa.h"
+        #define DAAL_TBB_NUMA_ARENAS
     #endif
 
 using namespace daal::services;
+using namespace daal::internal;
 #else
     #include "src/externals/service_service.h"
     #include "src/algorithms/service_qsort.h"
@@ -82,6 +87,12 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalCo
     tbb::spin_mutex::scoped_lock lock(mt);
     if (numThreads != 0)
     {
+        if (ThreadingBackendImpl * backend = getThreadingBackend())
+        {
+            const size_t backendNumThreads = backend->setNumberOfThreads(numThreads);
+            daal::threader_env()->setNumberOfThreads(backendNumThreads);
+            return backendNumThreads;
+        }
         _daal_tbb_task_scheduler_free(*globalControl);
         *globalControl = reinterpret_cast<void *>(new tbb::global_control(tbb::global_control::max_allowed_parallelism, numThreads));
         daal::threader_env()->setNumberOfThreads(numThreads);
@@ -95,6 +106,12 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalCo
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderFor(backend, n, a, func);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
         int i;
         for (i = r.begin(); i < r.end(); i++)
@@ -114,6 +131,12 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a,
 DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::functype_int64 func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderForInt64(backend, n, a, func);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, 1), [&](tbb::blocked_range<int64_t> r) {
         int64_t i;
         for (i = r.begin(); i < r.end(); i++)
@@ -133,6 +156,12 @@ DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::funct
 DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderFor(backend, n, a, func);
+        return;
+    }
     tbb::parallel_for(
         tbb::blocked_range<int>(0, n, 1),
         [&](tbb::blocked_range<int> r) {
@@ -155,6 +184,12 @@ DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const voi
 DAAL_EXPORT void _daal_threader_for_int32ptr(const int * begin, const int * end, const void * a, daal::functype_int32ptr func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderForInt32ptr(backend, begin, end, a, func);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<const int *>(begin, end, 1), [&](tbb::blocked_range<const int *> r) {
         const int * i;
         for (i = r.begin(); i != r.end(); i++)
@@ -171,10 +206,57 @@ DAAL_EXPORT void _daal_threader_for_int32ptr(const int * begin, const int * end,
 #endif
 }
 
+namespace
+{
+std::atomic<bool> deterministicReductions(false);
+
+/* Reduces the values of the fixed blocks of [0, n) by the pairwise tree whose shape depends on n only,
+   so the result is the same for any number of threads and any threading layer */
+template <typename BlockFunc>
+int64_t deterministicParallelReduce(int64_t n, int64_t init, const BlockFunc & blockFunc, const void * b,
+                                    daal::reduction_functype_int64 reduction_func)
+{
+    const int64_t nBlocks = n < int64_t(daal::deterministicReductionSlots) ? n : int64_t(daal::deterministicReductionSlots);
+    if (nBlocks < 2)
+    {
+        return blockFunc(0, n, init);
+    }
+
+    int64_t values[daal::deterministicReductionSlots];
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) { values[iBlock] = blockFunc(n * iBlock / nBlocks, n * (iBlock + 1) / nBlocks, init); });
+
+    for (int64_t step = 1; step < nBlocks; step *= 2)
+    {
+        for (int64_t i = 0; i + step < nBlocks; i += 2 * step)
+        {
+            values[i] = reduction_func(values[i], values[i + step], b);
+        }
+    }
+    return values[0];
+}
+} // namespace
+
+DAAL_EXPORT void _daal_set_deterministic_reductions(bool enable)
+{
+    deterministicReductions.store(enable);
+}
+
+DAAL_EXPORT bool _daal_is_deterministic_reductions_enabled()
+{
+    return deterministicReductions.load();
+}
+
 DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64(int32_t n, int64_t init, const void * a, daal::loop_functype_int32_int64 loop_func,
                                                       const void * b, daal::reduction_functype_int64 reduction_func)
 {
+    if (_daal_is_deterministic_reductions_enabled())
+    {
+        return deterministicParallelReduce(
+            n, init, [&](int64_t begin, int64_t end, int64_t value) { return loop_func(int32_t(begin), int32_t(end), value, a); }, b, reduction_func);
+    }
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend()) return backendParallelReduce(backend, n, init, a, loop_func, b, reduction_func);
     return tbb::parallel_reduce(
         tbb::blocked_range<int32_t>(0, n), init,
         [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
@@ -189,7 +271,14 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64(int32_t n, int64_t init, c
 DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64_simple(int32_t n, int64_t init, const void * a, daal::loop_functype_int32_int64 loop_func,
                                                              const void * b, daal::reduction_functype_int64 reduction_func)
 {
+    if (_daal_is_deterministic_reductions_enabled())
+    {
+        return deterministicParallelReduce(
+            n, init, [&](int64_t begin, int64_t end, int64_t value) { return loop_func(int32_t(begin), int32_t(end), value, a); }, b, reduction_func);
+    }
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend()) return backendParallelReduce(backend, n, init, a, loop_func, b, reduction_func);
     return tbb::parallel_reduce(
         tbb::blocked_range<int32_t>(0, n), init,
         [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
@@ -205,7 +294,18 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32ptr_int64_simple(const int32_t *
                                                                 daal::loop_functype_int32ptr_int64 loop_func, const void * b,
                                                                 daal::reduction_functype_int64 reduction_func)
 {
+    if (_daal_is_deterministic_reductions_enabled())
+    {
+        return deterministicParallelReduce(
+            end - begin, init, [&](int64_t first, int64_t last, int64_t value) { return loop_func(begin + first, begin + last, value, a); }, b,
+            reduction_func);
+    }
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        return backendParallelReduce(backend, begin, end, init, a, loop_func, b, reduction_func);
+    }
     return tbb::parallel_reduce(
         tbb::blocked_range<const int32_t *>(begin, end), init,
         [&](const tbb::blocked_range<const int32_t *> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
@@ -217,12 +317,49 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32ptr_int64_simple(const int32_t *
 #endif
 }
 
+#if defined(DAAL_TBB_NUMA_ARENAS)
+namespace
+{
+std::atomic<bool> numaAffinity(false);
+} // namespace
+#endif
+
+DAAL_EXPORT void _daal_set_numa_affinity(bool enable)
+{
+#if defined(DAAL_TBB_NUMA_ARENAS)
+    numaAffinity.store(enable);
+#endif
+}
+
+DAAL_EXPORT bool _daal_is_numa_affinity_enabled()
+{
+#if defined(DAAL_TBB_NUMA_ARENAS)
+    return numaAffinity.load() && !getThreadingBackend() && NumaArenas::system().size() > 1;
+#else
+    return false;
+#endif
+}
+
 DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::functype_static func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendStaticThreaderFor(backend, n, a, func);
+        return;
+    }
     const size_t nthreads           = _daal_threader_get_max_threads();
     const size_t nblocks_per_thread = n / nthreads + !!(n % nthreads);
 
+    #if defined(DAAL_TBB_NUMA_ARENAS)
+    if (_daal_is_numa_affinity_enabled() && !_daal_is_in_parallel())
+    {
+        numaStaticThreaderFor(NumaArenas::system(), n, nthreads, [&](size_t i, size_t tid) { func(i, tid, a); });
+        return;
+    }
+    #endif
+
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, nthreads, 1),
         [&](tbb::blocked_range<size_t> r) {
@@ -248,6 +385,12 @@ template <typename F>
 DAAL_EXPORT void _daal_parallel_sort_template(F * begin_p, F * end_p)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendParallelSort(backend, begin_p, end_p);
+        return;
+    }
     tbb::parallel_sort(begin_p, end_p);
 #elif defined(__DO_SEQ_LAYER__)
     daal::algorithms::internal::qSort<F>(end_p - begin_p, begin_p);
@@ -268,6 +411,12 @@ DAAL_PARALLEL_SORT_IMPL(daal::IdxValType<double>, pair_fp64_uint64)
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderForBlocked(backend, n, a, func);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); });
 #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
@@ -297,6 +446,12 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
 DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const ParallelRegion region;
+    if (ThreadingBackendImpl * backend = region.backend())
+    {
+        backendThreaderForBreak(backend, n, a, func);
+        return;
+    }
     tbb::task_group_context context;
     tbb::parallel_for(
         tbb::blocked_range<int>(0, n, 1),
@@ -324,6 +479,7 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
 #if defined(__DO_TBB_LAYER__)
+    if (ThreadingBackendImpl * backend = getThreadingBackend()) return backend->getMaxThreads();
     return tbb::this_task_arena::max_concurrency();
 #elif defined(__DO_SEQ_LAYER__)
     return 1;
@@ -333,17 +489,43 @@ DAAL_EXPORT int _daal_threader_get_max_threads()
 DAAL_EXPORT int _daal_threader_get_current_thread_index()
 {
 #if defined(__DO_TBB_LAYER__)
+    if (ThreadingBackendImpl * backend = getThreadingBackend()) return backend->getCurrentThreadIndex();
     return tbb::this_task_arena::current_thread_index();
 #elif defined(__DO_SEQ_LAYER__)
     return 1;
 #endif
 }
 
+#if defined(__DO_TBB_LAYER__)
+namespace
+{
+/* TLS bound to the backend that was active when it was created, NULL stands for TBB.
+   The backend cannot be changed while the TLS is live */
+struct TlsHandle
+{
+    ThreadingBackendImpl * backend;
+    void * storage;
+};
+
+inline tbb::enumerable_thread_specific<void *> * tbbTls(const TlsHandle * handle)
+{
+    return static_cast<tbb::enumerable_thread_specific<void *> *>(handle->storage);
+}
+} // namespace
+#endif
+
 DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::enumerable_thread_specific<void *> * p = new tbb::enumerable_thread_specific<void *>([=]() -> void * { return func(a); });
-    return (void *)p;
+    ThreadingBackendImpl * const backend = acquireThreadingBackend();
+    void * const storage                 = backend ? backendNewTls(backend, a, func) :
+                                                     new tbb::enumerable_thread_specific<void *>([=]() -> void * { return func(a); });
+    if (!storage)
+    {
+        releaseThreadingBackend();
+        return nullptr;
+    }
+    return new TlsHandle { backend, storage };
 #elif defined(__DO_SEQ_LAYER__)
     return func(a);
 #endif
@@ -352,8 +534,18 @@ DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 DAAL_EXPORT void _daal_del_tls_ptr(void * tlsPtr)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::enumerable_thread_specific<void *> * p = static_cast<tbb::enumerable_thread_specific<void *> *>(tlsPtr);
-    delete p;
+    TlsHandle * const handle = static_cast<TlsHandle *>(tlsPtr);
+    if (!handle) return;
+    if (handle->backend)
+    {
+        backendDelTls(handle->storage);
+    }
+    else
+    {
+        delete tbbTls(handle);
+    }
+    delete handle;
+    releaseThreadingBackend();
 #elif defined(__DO_SEQ_LAYER__)
 #endif
 }
@@ -361,8 +553,9 @@ DAAL_EXPORT void _daal_del_tls_ptr(void * tlsPtr)
 DAAL_EXPORT void * _daal_get_tls_local(void * tlsPtr)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::enumerable_thread_specific<void *> * p = static_cast<tbb::enumerable_thread_specific<void *> *>(tlsPtr);
-    return p->local();
+    const TlsHandle * const handle = static_cast<const TlsHandle *>(tlsPtr);
+    if (handle->backend) return backendGetTlsLocal(handle->backend, handle->storage);
+    return tbbTls(handle)->local();
 #elif defined(__DO_SEQ_LAYER__)
     return tlsPtr;
 #endif
@@ -371,7 +564,13 @@ DAAL_EXPORT void * _daal_get_tls_local(void * tlsPtr)
 DAAL_EXPORT void _daal_reduce_tls(void * tlsPtr, void * a, daal::tls_reduce_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::enumerable_thread_specific<void *> * p = static_cast<tbb::enumerable_thread_specific<void *> *>(tlsPtr);
+    const TlsHandle * const handle = static_cast<const TlsHandle *>(tlsPtr);
+    if (handle->backend)
+    {
+        backendReduceTls(handle->storage, a, func);
+        return;
+    }
+    tbb::enumerable_thread_specific<void *> * p = tbbTls(handle);
 
     for (auto it = p->begin(); it != p->end(); ++it)
     {
@@ -385,8 +584,14 @@ DAAL_EXPORT void _daal_reduce_tls(void * tlsPtr, void * a, daal::tls_reduce_func
 DAAL_EXPORT void _daal_parallel_reduce_tls(void * tlsPtr, void * a, daal::tls_reduce_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
+    const TlsHandle * const handle = static_cast<const TlsHandle *>(tlsPtr);
+    if (handle->backend)
+    {
+        backendParallelReduceTls(handle->backend, handle->storage, a, func);
+        return;
+    }
     size_t n                                    = 0;
-    tbb::enumerable_thread_specific<void *> * p = static_cast<tbb::enumerable_thread_specific<void *> *>(tlsPtr);
+    tbb::enumerable_thread_specific<void *> * p = tbbTls(handle);
 
     for (auto it = p->begin(); it != p->end(); ++it, ++n)
         ;
@@ -442,6 +647,7 @@ DAAL_EXPORT void _daal_del_mutex(void * mutexPtr)
 DAAL_EXPORT bool _daal_is_in_parallel()
 {
 #if defined(__DO_TBB_LAYER__)
+    if (getThreadingBackend()) return isInBackendParallel();
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
     return tbb::task::current_context() != nullptr;
     #else
@@ -458,6 +664,27 @@ DAAL_EXPORT void * _daal_threader_env()
     return &env;
 }
 
+DAAL_EXPORT int _daal_get_threading_backend()
+{
+#if defined(__DO_TBB_LAYER__)
+    ThreadingBackendImpl * backend = getThreadingBackend();
+    return backend ? backend->id() : daal::threadingBackendTbb;
+#else
+    return daal::threadingBackendSerial;
+#endif
+}
+
+DAAL_EXPORT bool _daal_set_threading_executor(const daal::ThreadingExecutor * executor)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (!setThreadingExecutor(executor)) return false;
+    daal::threader_env()->setNumberOfThreads(_daal_threader_get_max_threads());
+    return true;
+#else
+    return false;
+#endif
+}
+
 #if defined(__DO_TBB_LAYER__)
 template <typename T, typename Key, typename Pred>
 //Returns an index of the first element in the range[ar, ar + n) that is not less than(i.e.greater or equal to) value.
@@ -766,6 +993,8 @@ DAAL_EXPORT void _daal_release_ls_local(void * lsPtr, void * p)
 
 DAAL_EXPORT void * _daal_new_task_group()
 {
+    /* The backends run the tasks in the calling thread, so their task groups need no state */
+    if (getThreadingBackend()) return nullptr;
     return new tbb::task_group();
 }
 
@@ -776,6 +1005,13 @@ DAAL_EXPORT void _daal_del_task_group(void * taskGroupPtr)
 
 DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t)
 {
+    if (!taskGroupPtr)
+    {
+        t->run();
+        t->destroy();
+        return;
+    }
+
     struct shared_task
     {
         typedef Atomic<int> RefCounterType;
@@ -811,7 +1047,7 @@ DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t)
 
 DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
 {
-    ((tbb::task_group *)taskGroupPtr)->wait();
+    if (taskGroupPtr) ((tbb::task_group *)taskGroupPtr)->wait();
 }
 
 #else
@@ -39,6 +39,17 @@ struct IdxValType
     bool operator>(const IdxValType & o) const { return o.value == value ? index > o.index : value > o.value; }
     bool operator<=(const IdxValType & o) const { return value < o.value || (value == o.value && index == o.index); }
 };
+
+/* Element of the key-value sorts of the threading layer, the elements are ordered by the keys only */
+template <typename KeyType, typename ValueType>
+struct KeyValType
+{
+    KeyType key;
+    ValueType val;
+
+    bool operator<(const KeyValType & o) const { return key < o.key; }
+};
+
 typedef void (*functype)(int i, const void * a);
 typedef void (*functype_int64)(int64_t i, const void * a);
 typedef void (*functype_int32ptr)(const int * i, const void * a);
@@ -51,6 +62,36 @@ typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t e
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
 typedef int64_t (*reduction_functype_int64)(int64_t a, int64_t b, const void * reduction);
+typedef void (*executor_range_functype)(int64_t begin, int64_t end, const void * a);
+
+/**
+ *  Backends of the threading layer. The backend is selected when the library is loaded
+ *  from the DAAL_THREADING_BACKEND environment variable: tbb (default), omp or serial.
+ */
+enum ThreadingBackend
+{
+    threadingBackendTbb      = 0, /*!< Intel(R) oneAPI Threading Building Blocks */
+    threadingBackendOmp      = 1, /*!< OpenMP, available if the threading layer is built with OpenMP */
+    threadingBackendSerial   = 2, /*!< Sequential execution in the calling thread */
+    threadingBackendExecutor = 3  /*!< Executor provided by the user */
+};
+
+/**
+ *  Executor provided by the user to run the parallel loops of the library on its own threads
+ */
+struct ThreadingExecutor
+{
+    void * context; /*!< Pointer passed to the functions of the executor */
+
+    /* Returns the number of threads that run the loops, must be positive */
+    int (*getMaxThreads)(void * context);
+
+    /* Returns the index of the calling thread in the range [0, getMaxThreads()) */
+    int (*getCurrentThreadIndex)(void * context);
+
+    /* Calls func on the non-overlapping ranges that cover [0, n) and returns after all the calls complete */
+    void (*parallelFor)(void * context, int64_t n, const void * a, executor_range_functype func);
+};
 
 class task;
 } // namespace daal
@@ -104,6 +145,15 @@ extern "C"
 
     DAAL_EXPORT void * _daal_threader_env();
 
+    DAAL_EXPORT void _daal_set_numa_affinity(bool enable);
+    DAAL_EXPORT bool _daal_is_numa_affinity_enabled();
+
+    DAAL_EXPORT void _daal_set_deterministic_reductions(bool enable);
+    DAAL_EXPORT bool _daal_is_deterministic_reductions_enabled();
+
+    DAAL_EXPORT int _daal_get_threading_backend();
+    DAAL_EXPORT bool _daal_set_threading_executor(const daal::ThreadingExecutor * executor);
+
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
 
@@ -114,6 +164,36 @@ extern "C"
     DAAL_PARALLEL_SORT_DECL(daal::IdxValType<float>, pair_fp32_uint64)
     DAAL_PARALLEL_SORT_DECL(daal::IdxValType<double>, pair_fp64_uint64)
 #undef DAAL_PARALLEL_SORT_DECL
+
+#define DAAL_PARALLEL_RADIX_SORT_DECL(TYPE, NAMESUFFIX)                                                           \
+    DAAL_EXPORT void _daal_parallel_radix_sort_##NAMESUFFIX(TYPE * begin_ptr, TYPE * end_ptr, TYPE * buffer_ptr);
+    DAAL_PARALLEL_RADIX_SORT_DECL(int, int32)
+    DAAL_PARALLEL_RADIX_SORT_DECL(int64_t, int64)
+    DAAL_PARALLEL_RADIX_SORT_DECL(float, fp32)
+    DAAL_PARALLEL_RADIX_SORT_DECL(double, fp64)
+#undef DAAL_PARALLEL_RADIX_SORT_DECL
+
+#define DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(KEYTYPE, VALTYPE, NAMESUFFIX)                                      \
+    DAAL_EXPORT void _daal_parallel_radix_sort_##NAMESUFFIX(daal::KeyValType<KEYTYPE, VALTYPE> * begin_ptr,   \
+                                                            daal::KeyValType<KEYTYPE, VALTYPE> * end_ptr,     \
+                                                            daal::KeyValType<KEYTYPE, VALTYPE> * buffer_ptr);
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(int, int, pair_int32_int32)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(int64_t, int, pair_int64_int32)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(float, int, pair_fp32_int32)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(double, int, pair_fp64_int32)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(int, size_t, pair_int32_uint64)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(int64_t, size_t, pair_int64_uint64)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(float, size_t, pair_fp32_uint64)
+    DAAL_PARALLEL_RADIX_SORT_PAIR_DECL(double, size_t, pair_fp64_uint64)
+#undef DAAL_PARALLEL_RADIX_SORT_PAIR_DECL
+
+#define DAAL_PARALLEL_SEGMENTED_SORT_DECL(TYPE, NAMESUFFIX)                                                                    \
+    DAAL_EXPORT void _daal_parallel_segmented_sort_##NAMESUFFIX(TYPE * data_ptr, const int64_t * offsets, int64_t n_segments);
+    DAAL_PARALLEL_SEGMENTED_SORT_DECL(int, int32)
+    DAAL_PARALLEL_SEGMENTED_SORT_DECL(int64_t, int64)
+    DAAL_PARALLEL_SEGMENTED_SORT_DECL(float, fp32)
+    DAAL_PARALLEL_SEGMENTED_SORT_DECL(double, fp64)
+#undef DAAL_PARALLEL_SEGMENTED_SORT_DECL
 }
 
 namespace daal
@@ -140,6 +220,48 @@ inline void parallel_sort<double>(daal::IdxValType<double> * beginPtr, daal::Idx
     _daal_parallel_sort_pair_fp64_uint64(beginPtr, endPtr);
 }
 
+/* Stable LSD radix sort of [beginPtr, endPtr) in the ascending order of the keys, -0 and +0 are equal keys, NaNs go after +inf.
+   bufferPtr points to the memory for endPtr - beginPtr elements that is used as the scratch space */
+#define DAAL_PARALLEL_RADIX_SORT(TYPE, NAMESUFFIX)                                    \
+    inline void parallel_radix_sort(TYPE * beginPtr, TYPE * endPtr, TYPE * bufferPtr) \
+    {                                                                                 \
+        _daal_parallel_radix_sort_##NAMESUFFIX(beginPtr, endPtr, bufferPtr);          \
+    }
+DAAL_PARALLEL_RADIX_SORT(int, int32)
+DAAL_PARALLEL_RADIX_SORT(int64_t, int64)
+DAAL_PARALLEL_RADIX_SORT(float, fp32)
+DAAL_PARALLEL_RADIX_SORT(double, fp64)
+#undef DAAL_PARALLEL_RADIX_SORT
+
+#define DAAL_PARALLEL_RADIX_SORT_PAIR(KEYTYPE, VALTYPE, NAMESUFFIX)                                                 \
+    inline void parallel_radix_sort(KeyValType<KEYTYPE, VALTYPE> * beginPtr, KeyValType<KEYTYPE, VALTYPE> * endPtr, \
+                                    KeyValType<KEYTYPE, VALTYPE> * bufferPtr)                                       \
+    {                                                                                                               \
+        _daal_parallel_radix_sort_##NAMESUFFIX(beginPtr, endPtr, bufferPtr);                                        \
+    }
+DAAL_PARALLEL_RADIX_SORT_PAIR(int, int, pair_int32_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR(int64_t, int, pair_int64_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR(float, int, pair_fp32_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR(double, int, pair_fp64_int32)
+DAAL_PARALLEL_RADIX_SORT_PAIR(int, size_t, pair_int32_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR(int64_t, size_t, pair_int64_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR(float, size_t, pair_fp32_uint64)
+DAAL_PARALLEL_RADIX_SORT_PAIR(double, size_t, pair_fp64_uint64)
+#undef DAAL_PARALLEL_RADIX_SORT_PAIR
+
+/* Sorts the segments [dataPtr + offsets[i], dataPtr + offsets[i + 1]), i = 0, ..., nSegments - 1, in the order of parallel_radix_sort.
+   The small segments are sorted in parallel with each other, the large ones one by one by the parallel radix sort */
+#define DAAL_PARALLEL_SEGMENTED_SORT(TYPE, NAMESUFFIX)                                              \
+    inline void parallel_segmented_sort(TYPE * dataPtr, const int64_t * offsets, int64_t nSegments) \
+    {                                                                                               \
+        _daal_parallel_segmented_sort_##NAMESUFFIX(dataPtr, offsets, nSegments);                    \
+    }
+DAAL_PARALLEL_SEGMENTED_SORT(int, int32)
+DAAL_PARALLEL_SEGMENTED_SORT(int64_t, int64)
+DAAL_PARALLEL_SEGMENTED_SORT(float, fp32)
+DAAL_PARALLEL_SEGMENTED_SORT(double, fp64)
+#undef DAAL_PARALLEL_SEGMENTED_SORT
+
 inline int threader_get_max_threads_number()
 {
     return _daal_threader_get_max_threads();
@@ -150,6 +272,33 @@ inline int threader_get_max_current_thread_index()
     return _daal_threader_get_current_thread_index();
 }
 
+/* In the NUMA affinity mode static_threader_for runs the consecutive threads on the same NUMA node,
+   so the blocks of the memory first-touched with the same partitioning are processed on the node they reside on */
+inline void threader_set_numa_affinity(bool enable)
+{
+    _daal_set_numa_affinity(enable);
+}
+
+inline bool threader_is_numa_affinity_enabled()
+{
+    return _daal_is_numa_affinity_enabled();
+}
+
+/* Number of the fixed blocks whose partial results are combined by the reductions in the deterministic mode */
+const size_t deterministicReductionSlots = 64;
+
+/* In the deterministic mode the reductions split the work into the blocks that do not depend on the number of threads
+   and combine the partial results of the blocks in the fixed order, so the results are bitwise reproducible */
+inline void threader_set_deterministic_reductions(bool enable)
+{
+    _daal_set_deterministic_reductions(enable);
+}
+
+inline bool threader_is_deterministic_reductions_enabled()
+{
+    return _daal_is_deterministic_reductions_enabled();
+}
+
 inline void * threaded_scalable_malloc(const size_t size, const size_t alignment)
 {
     return _threaded_scalable_malloc(size, alignment);
@@ -193,6 +342,13 @@ inline void threader_func(int i, const void * a)
     lambda(i);
 }
 
+template <typename F>
+inline void threader_func_int64(int64_t i, const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda(i);
+}
+
 template <typename F>
 inline void static_threader_func(size_t i, size_t tid, const void * a)
 {
@@ -227,7 +383,7 @@ inline void threader_for_int64(int64_t n, const F & lambda)
 {
     const void * a = static_cast<const void *>(&lambda);
 
-    _daal_threader_for_int64(n, a, threader_func<F>);
+    _daal_threader_for_int64(n, a, threader_func_int64<F>);
 }
 
 template <typename F>
@@ -394,7 +550,65 @@ public:
     template <typename lambdaType>
     explicit static_tls(const lambdaType & lambda)
     {
-        _nThreads = threader_get_max_threads_number();
+        init(lambda, threader_get_max_threads_number());
+    }
+
+    virtual ~static_tls()
+    {
+        if (_deleter)
+        {
+            _deleter->del(_creater);
+        }
+        delete _deleter;
+        delete _storage;
+    }
+
+    F local(size_t tid)
+    {
+        if (_storage)
+        {
+            if (!_storage[tid])
+            {
+                _storage[tid] = static_cast<F>(_creater_func(_creater));
+            }
+
+            return _storage[tid];
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    template <typename lambdaType>
+    void reduce(const lambdaType & lambda)
+    {
+        if (_storage)
+        {
+            for (size_t i = 0; i < _nThreads; ++i)
+            {
+                if (_storage[i]) lambda(_storage[i]);
+            }
+        }
+    }
+
+    size_t nthreads() const { return _nThreads; }
+
+protected:
+    template <typename lambdaType>
+    static_tls(const lambdaType & lambda, size_t nSlots)
+    {
+        init(lambda, nSlots);
+    }
+
+    F * _storage     = nullptr;
+    size_t _nThreads = 0;
+
+private:
+    template <typename lambdaType>
+    void init(const lambdaType & lambda, size_t nSlots)
+    {
+        _nThreads = nSlots;
 
         _storage = new F[_nThreads];
 
@@ -422,53 +636,164 @@ public:
         _creater_func = creater_func<F, lambdaType>;
     }
 
-    virtual ~static_tls()
+    void * _creater                  = nullptr;
+    daal::tls_functype _creater_func = nullptr;
+    static_tls_deleter * _deleter    = nullptr;
+};
+
+/**
+ *  \brief Storage of the partial results of the reduction that are computed by reduction_static_threader_for.
+ *
+ *  In the default mode it is static_tls with the slot per thread. In the deterministic mode it has deterministicReductionSlots slots,
+ *  one per fixed block of the iterations, and combine_pairwise merges them by the tree whose shape does not depend on the number of threads.
+ *  The mode is fixed at construction.
+ */
+template <typename F>
+class reduction_tls : public static_tls<F>
+{
+public:
+    template <typename lambdaType>
+    explicit reduction_tls(const lambdaType & lambda) : reduction_tls(lambda, threader_is_deterministic_reductions_enabled())
+    {}
+
+    bool deterministic() const { return _deterministic; }
+
+    /* In the deterministic mode merges the partial results into the first slot: combine(to, from) adds from to to and releases from.
+       In the default mode does nothing, the partial results are left for reduce */
+    template <typename lambdaType>
+    void combine_pairwise(const lambdaType & combine)
     {
-        if (_deleter)
+        if (!_deterministic || !this->_storage)
         {
-            _deleter->del(_creater);
+            return;
+        }
+
+        F * storage         = this->_storage;
+        const size_t nSlots = this->_nThreads;
+        for (size_t step = 1; step < nSlots; step *= 2)
+        {
+            const size_t nPairs = (nSlots + 2 * step - 1) / (2 * step);
+            threader_for(nPairs, nPairs, [&](int iPair) {
+                const size_t to   = iPair * 2 * step;
+                const size_t from = to + step;
+                if (from >= nSlots || !storage[from])
+                {
+                    return;
+                }
+
+                if (storage[to])
+                {
+                    combine(storage[to], storage[from]);
+                }
+                else
+                {
+                    storage[to] = storage[from];
+                }
+                storage[from] = nullptr;
+            });
         }
-        delete _deleter;
-        delete _storage;
     }
 
-    F local(size_t tid)
+private:
+    template <typename lambdaType>
+    reduction_tls(const lambdaType & lambda, bool deterministic)
+        : static_tls<F>(lambda, deterministic ? deterministicReductionSlots : threader_get_max_threads_number()), _deterministic(deterministic)
+    {}
+
+    bool _deterministic;
+};
+
+/* Calls lambda(i, slot) for i in [0, n) with the slot of tls that accumulates the partial result of the iteration i.
+   In the default mode it is static_threader_for, in the deterministic mode the iterations are split into
+   at most deterministicReductionSlots contiguous blocks that do not depend on the number of threads */
+template <typename F, typename lambdaType>
+inline void reduction_static_threader_for(const reduction_tls<F> & tls, size_t n, const lambdaType & lambda)
+{
+    if (!tls.deterministic())
     {
-        if (_storage)
+        static_threader_for(n, lambda);
+        return;
+    }
+
+    const size_t nSlots = n < deterministicReductionSlots ? n : deterministicReductionSlots;
+    threader_for(nSlots, nSlots, [&](int iSlot) {
+        const size_t begin = n * iSlot / nSlots;
+        const size_t end   = n * (iSlot + 1) / nSlots;
+        for (size_t i = begin; i < end; ++i)
         {
-            if (!_storage[tid])
-            {
-                _storage[tid] = static_cast<F>(_creater_func(_creater));
-            }
+            lambda(i, size_t(iSlot));
+        }
+    });
+}
 
-            return _storage[tid];
+/**
+ *  \brief Storage of the partial results of the reduction over the iterations whose cost varies.
+ *
+ *  In the default mode it is tls of the threads that run the iterations scheduled dynamically by threader_for.
+ *  In the deterministic mode it is reduction_tls, and the iterations are split by reduction_static_threader_for.
+ *  The mode is fixed at construction.
+ */
+template <typename F>
+class dynamic_reduction_tls
+{
+public:
+    template <typename lambdaType>
+    explicit dynamic_reduction_tls(const lambdaType & lambda) : _tls(nullptr), _reductionTls(nullptr)
+    {
+        if (threader_is_deterministic_reductions_enabled())
+        {
+            _reductionTls = new reduction_tls<F>(lambda);
         }
         else
         {
-            return nullptr;
+            _tls = new tls<F>(lambda);
         }
     }
 
+    ~dynamic_reduction_tls()
+    {
+        delete _tls;
+        delete _reductionTls;
+    }
+
+    bool deterministic() const { return _reductionTls != nullptr; }
+
+    /* Calls lambda(i, local) for i in [0, n) with the partial result local that accumulates the iteration i */
     template <typename lambdaType>
-    void reduce(const lambdaType & lambda)
+    void parallel_for(size_t n, const lambdaType & lambda)
     {
-        if (_storage)
+        if (_reductionTls)
         {
-            for (size_t i = 0; i < _nThreads; ++i)
-            {
-                if (_storage[i]) lambda(_storage[i]);
-            }
+            reduction_tls<F> & slots = *_reductionTls;
+            reduction_static_threader_for(slots, n, [&](size_t i, size_t slot) { lambda(int(i), slots.local(slot)); });
+        }
+        else
+        {
+            tls<F> & local = *_tls;
+            threader_for(n, n, [&](int i) { lambda(i, local.local()); });
         }
     }
 
-    size_t nthreads() const { return _nThreads; }
+    /* Passes the partial results to lambda, in the order of the blocks in the deterministic mode */
+    template <typename lambdaType>
+    void reduce(const lambdaType & lambda)
+    {
+        if (_reductionTls)
+        {
+            _reductionTls->reduce(lambda);
+        }
+        else
+        {
+            _tls->reduce(lambda);
+        }
+    }
 
 private:
-    F * _storage                     = nullptr;
-    size_t _nThreads                 = 0;
-    void * _creater                  = nullptr;
-    daal::tls_functype _creater_func = nullptr;
-    static_tls_deleter * _deleter    = nullptr;
+    dynamic_reduction_tls(const dynamic_reduction_tls &);
+    dynamic_reduction_tls & operator=(const dynamic_reduction_tls &);
+
+    tls<F> * _tls;
+    reduction_tls<F> * _reductionTls;
 };
 
 template <typename F>
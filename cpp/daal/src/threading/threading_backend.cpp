@@ -0,0 +1,539 @@
+/* file: threading_backend.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the backends that replace TBB in the threading layer.
+//--
+*/
+
+#include "src/threading/threading_backend.h"
+
+#if defined(__DO_TBB_LAYER__)
+
+    #include <stdlib.h> // malloc, free and getenv
+    #include <string.h>
+    #include <algorithm>
+    #include <atomic>
+
+    #if defined(_OPENMP)
+        #include <omp.h>
+    #endif
+
+namespace daal
+{
+namespace internal
+{
+namespace
+{
+/* Number of the blocks per thread the loops and the reductions are split into to balance the load */
+const int64_t blocksPerThread = 4;
+/* Maximal number of the partial results of the reduction */
+const int64_t maxReduceBlocks = 256;
+/* Minimal number of the elements sorted by one thread */
+const int64_t minSortBlockSize = 1 << 14;
+
+/* Depth of the loops of the backend run by the calling thread */
+thread_local int backendLoopDepth = 0;
+
+/* Depth of the parallel regions of the threading layer run by the calling thread */
+thread_local int parallelRegionDepth = 0;
+
+inline int64_t min(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+/* Adapts the lambda that takes the range to the function passed to the backend */
+template <typename F>
+void rangeFunc(int64_t begin, int64_t end, const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda(begin, end);
+}
+
+template <typename F>
+void parallelFor(ThreadingBackendImpl * backend, int64_t n, int64_t grainSize, const F & lambda)
+{
+    backendParallelFor(backend, n, grainSize, &lambda, rangeFunc<F>);
+}
+
+/* Splits [0, n) into the blocks, at most blocksPerThread per thread */
+struct Blocking
+{
+    Blocking(int64_t n, int64_t nThreads, int64_t maxBlocks)
+    {
+        nBlocks   = min(min(n, nThreads * blocksPerThread), maxBlocks);
+        blockSize = nBlocks ? (n + nBlocks - 1) / nBlocks : 0;
+        nBlocks   = blockSize ? (n + blockSize - 1) / blockSize : 0;
+        size      = n;
+    }
+
+    int64_t begin(int64_t iBlock) const { return iBlock * blockSize; }
+    int64_t end(int64_t iBlock) const { return min(size, (iBlock + 1) * blockSize); }
+
+    int64_t nBlocks;
+    int64_t blockSize;
+    int64_t size;
+};
+
+class SerialBackend : public ThreadingBackendImpl
+{
+public:
+    ThreadingBackend id() const DAAL_C11_OVERRIDE { return threadingBackendSerial; }
+    int getMaxThreads() DAAL_C11_OVERRIDE { return 1; }
+    int getCurrentThreadIndex() DAAL_C11_OVERRIDE { return 0; }
+    size_t setNumberOfThreads(size_t) DAAL_C11_OVERRIDE { return 1; }
+
+    void parallelFor(int64_t n, int64_t, const void * a, executor_range_functype func) DAAL_C11_OVERRIDE { func(0, n, a); }
+};
+
+    #if defined(_OPENMP)
+class OmpBackend : public ThreadingBackendImpl
+{
+public:
+    OmpBackend() : _numThreads(0) {}
+
+    ThreadingBackend id() const DAAL_C11_OVERRIDE { return threadingBackendOmp; }
+
+    int getMaxThreads() DAAL_C11_OVERRIDE
+    {
+        const int maxThreads = omp_get_max_threads();
+        const int numThreads = _numThreads.load(std::memory_order_relaxed);
+        return (numThreads > 0 && numThreads < maxThreads) ? numThreads : maxThreads;
+    }
+
+    int getCurrentThreadIndex() DAAL_C11_OVERRIDE { return omp_get_thread_num(); }
+
+    size_t setNumberOfThreads(size_t numThreads) DAAL_C11_OVERRIDE
+    {
+        _numThreads.store(int(numThreads), std::memory_order_relaxed);
+        return size_t(getMaxThreads());
+    }
+
+    void parallelFor(int64_t n, int64_t grainSize, const void * a, executor_range_functype func) DAAL_C11_OVERRIDE
+    {
+        const int nThreads = getMaxThreads();
+        const Blocking blocking((n + grainSize - 1) / grainSize, nThreads, n);
+        if (nThreads == 1 || blocking.nBlocks <= 1)
+        {
+            func(0, n, a);
+            return;
+        }
+
+        const int64_t nBlocks = blocking.nBlocks;
+        #pragma omp parallel for schedule(dynamic, 1) num_threads(nThreads)
+        for (int64_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            func(min(n, blocking.begin(iBlock) * grainSize), min(n, blocking.end(iBlock) * grainSize), a);
+        }
+    }
+
+private:
+    std::atomic<int> _numThreads;
+};
+    #endif
+
+class ExecutorBackend : public ThreadingBackendImpl
+{
+public:
+    ExecutorBackend(const ThreadingExecutor & executor) : _executor(executor) {}
+
+    ThreadingBackend id() const DAAL_C11_OVERRIDE { return threadingBackendExecutor; }
+    int getMaxThreads() DAAL_C11_OVERRIDE { return _executor.getMaxThreads(_executor.context); }
+    int getCurrentThreadIndex() DAAL_C11_OVERRIDE { return _executor.getCurrentThreadIndex(_executor.context); }
+    size_t setNumberOfThreads(size_t) DAAL_C11_OVERRIDE { return size_t(getMaxThreads()); }
+
+    void parallelFor(int64_t n, int64_t, const void * a, executor_range_functype func) DAAL_C11_OVERRIDE
+    {
+        _executor.parallelFor(_executor.context, n, a, func);
+    }
+
+private:
+    ThreadingExecutor _executor;
+};
+
+/* Selects the backend from the DAAL_THREADING_BACKEND environment variable, NULL stands for TBB */
+ThreadingBackendImpl * selectBackend()
+{
+    const char * name = getenv("DAAL_THREADING_BACKEND");
+    if (name)
+    {
+        if (!strcmp(name, "serial"))
+        {
+            static SerialBackend serialBackend;
+            return &serialBackend;
+        }
+    #if defined(_OPENMP)
+        if (!strcmp(name, "omp"))
+        {
+            static OmpBackend ompBackend;
+            return &ompBackend;
+        }
+    #endif
+    }
+    return nullptr;
+}
+
+ThreadingBackendImpl * getSelectedBackend()
+{
+    static ThreadingBackendImpl * const selectedBackend = selectBackend();
+    return selectedBackend;
+}
+
+std::atomic<ThreadingBackendImpl *> & activeBackend()
+{
+    static std::atomic<ThreadingBackendImpl *> backend(getSelectedBackend());
+    return backend;
+}
+
+/* Number of the shards of the counter of the live parallel regions and TLS that use the active backend */
+const int64_t nUserShards = 64;
+
+/* The shard is padded to the cache line, so the threads that use different shards do not contend */
+struct alignas(64) UserShard
+{
+    std::atomic<int64_t> nUsers;
+};
+
+/* Number of the live parallel regions and TLS that use the active backend, split into the shards.
+   A shard is chosen by the thread that acquires the backend, the backend may be released by another thread,
+   so only the sum over all shards is meaningful */
+UserShard * backendUsers()
+{
+    static UserShard users[nUserShards] = {};
+    return users;
+}
+
+/* Set while the active backend is being changed */
+std::atomic<bool> & isSwitchingBackend()
+{
+    static std::atomic<bool> isSwitching(false);
+    return isSwitching;
+}
+
+std::atomic<int64_t> & userShardOfThread()
+{
+    static std::atomic<int64_t> nThreads(0);
+    static thread_local const int64_t iShard = nThreads.fetch_add(1, std::memory_order_relaxed) % nUserShards;
+    return backendUsers()[iShard].nUsers;
+}
+
+/* Per-thread values of the TLS indexed by the thread index of the backend */
+struct BackendTls
+{
+    void * a;
+    tls_functype func;
+    int64_t nValues;
+    void ** values;
+};
+
+template <typename Index, typename LoopFunc>
+int64_t parallelReduce(ThreadingBackendImpl * backend, Index first, int64_t n, int64_t init, const void * a, LoopFunc loopFunc, const void * b,
+                       reduction_functype_int64 reductionFunc)
+{
+    const Blocking blocking(n, backend->getMaxThreads(), maxReduceBlocks);
+    if (blocking.nBlocks <= 1)
+    {
+        return loopFunc(first, first + n, init, a);
+    }
+
+    /* The partial results are combined in the order of the blocks, so the result does not depend on the scheduling */
+    int64_t partial[maxReduceBlocks];
+    parallelFor(backend, blocking.nBlocks, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t iBlock = begin; iBlock < end; ++iBlock)
+        {
+            partial[iBlock] = loopFunc(first + blocking.begin(iBlock), first + blocking.end(iBlock), init, a);
+        }
+    });
+
+    int64_t result = partial[0];
+    for (int64_t iBlock = 1; iBlock < blocking.nBlocks; ++iBlock)
+    {
+        result = reductionFunc(result, partial[iBlock], b);
+    }
+    return result;
+}
+
+} // namespace
+
+ThreadingBackendImpl * getThreadingBackend()
+{
+    return activeBackend().load(std::memory_order_acquire);
+}
+
+bool setThreadingExecutor(const ThreadingExecutor * executor)
+{
+    if (executor
+        && (!executor->getMaxThreads || !executor->getCurrentThreadIndex || !executor->parallelFor || executor->getMaxThreads(executor->context) < 1))
+    {
+        return false;
+    }
+
+    /* The sequentially consistent flag and counters make either the setter see the new user or the user see the flag */
+    bool isSwitching = false;
+    if (!isSwitchingBackend().compare_exchange_strong(isSwitching, true, std::memory_order_seq_cst)) return false;
+
+    int64_t nUsers = 0;
+    for (int64_t iShard = 0; iShard < nUserShards; ++iShard) nUsers += backendUsers()[iShard].nUsers.load(std::memory_order_seq_cst);
+    if (nUsers == 0)
+    {
+        /* The previous executor is not deleted as the queries of the number of threads may still use it */
+        activeBackend().store(executor ? new ExecutorBackend(*executor) : getSelectedBackend(), std::memory_order_release);
+    }
+    isSwitchingBackend().store(false, std::memory_order_release);
+    return nUsers == 0;
+}
+
+ThreadingBackendImpl * acquireThreadingBackend()
+{
+    std::atomic<int64_t> & users = userShardOfThread();
+    for (;;)
+    {
+        users.fetch_add(1, std::memory_order_seq_cst);
+        if (!isSwitchingBackend().load(std::memory_order_seq_cst)) break;
+
+        /* The change of the backend takes a few instructions, so it is waited for by spinning */
+        users.fetch_sub(1, std::memory_order_relaxed);
+        while (isSwitchingBackend().load(std::memory_order_relaxed))
+        {}
+    }
+    return getThreadingBackend();
+}
+
+void releaseThreadingBackend()
+{
+    userShardOfThread().fetch_sub(1, std::memory_order_release);
+}
+
+ThreadingBackendImpl * enterParallelRegion()
+{
+    /* The regions nested into the region of the calling thread are covered by the outermost one */
+    if (parallelRegionDepth++ > 0) return getThreadingBackend();
+    return acquireThreadingBackend();
+}
+
+void leaveParallelRegion()
+{
+    if (--parallelRegionDepth == 0) releaseThreadingBackend();
+}
+
+bool isInBackendParallel()
+{
+    return backendLoopDepth > 0;
+}
+
+void backendParallelFor(ThreadingBackendImpl * backend, int64_t n, int64_t grainSize, const void * a, executor_range_functype func)
+{
+    if (n <= 0) return;
+    if (backendLoopDepth > 0)
+    {
+        func(0, n, a);
+        return;
+    }
+
+    struct LoopBody
+    {
+        const void * a;
+        executor_range_functype func;
+    } body = { a, func };
+
+    backend->parallelFor(n, grainSize > 0 ? grainSize : 1, &body, [](int64_t begin, int64_t end, const void * p) {
+        const LoopBody & loopBody = *static_cast<const LoopBody *>(p);
+        ++backendLoopDepth;
+        loopBody.func(begin, end, loopBody.a);
+        --backendLoopDepth;
+    });
+}
+
+void backendThreaderFor(ThreadingBackendImpl * backend, int64_t n, const void * a, functype func)
+{
+    parallelFor(backend, n, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) func(int(i), a);
+    });
+}
+
+void backendThreaderForInt64(ThreadingBackendImpl * backend, int64_t n, const void * a, functype_int64 func)
+{
+    parallelFor(backend, n, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) func(i, a);
+    });
+}
+
+void backendThreaderForInt32ptr(ThreadingBackendImpl * backend, const int * begin, const int * end, const void * a, functype_int32ptr func)
+{
+    parallelFor(backend, end - begin, 1, [&](int64_t rangeBegin, int64_t rangeEnd) {
+        for (const int * i = begin + rangeBegin; i != begin + rangeEnd; ++i) func(i, a);
+    });
+}
+
+void backendStaticThreaderFor(ThreadingBackendImpl * backend, size_t n, const void * a, functype_static func)
+{
+    const size_t nthreads           = backend->getMaxThreads();
+    const size_t nblocks_per_thread = n / nthreads + !!(n % nthreads);
+
+    parallelFor(backend, nthreads, 1, [&](int64_t rangeBegin, int64_t rangeEnd) {
+        for (size_t tid = rangeBegin; tid < size_t(rangeEnd); ++tid)
+        {
+            const size_t begin = tid * nblocks_per_thread;
+            const size_t end   = n < begin + nblocks_per_thread ? n : begin + nblocks_per_thread;
+            for (size_t i = begin; i < end; ++i) func(i, tid, a);
+        }
+    });
+}
+
+void backendThreaderForBlocked(ThreadingBackendImpl * backend, int n, const void * a, functype2 func)
+{
+    parallelFor(backend, n, 1, [&](int64_t begin, int64_t end) { func(int(begin), int(end - begin), a); });
+}
+
+void backendThreaderForBreak(ThreadingBackendImpl * backend, int n, const void * a, functype_break func)
+{
+    std::atomic<bool> cancelled(false);
+    parallelFor(backend, n, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end && !cancelled.load(std::memory_order_relaxed); ++i)
+        {
+            bool needBreak = false;
+            func(int(i), needBreak, a);
+            if (needBreak) cancelled.store(true, std::memory_order_relaxed);
+        }
+    });
+}
+
+int64_t backendParallelReduce(ThreadingBackendImpl * backend, int32_t n, int64_t init, const void * a, loop_functype_int32_int64 loopFunc,
+                              const void * b, reduction_functype_int64 reductionFunc)
+{
+    return parallelReduce(
+        backend, int64_t(0), n, init, a,
+        [&](int64_t begin, int64_t end, int64_t value, const void * p) { return loopFunc(int32_t(begin), int32_t(end), value, p); }, b,
+        reductionFunc);
+}
+
+int64_t backendParallelReduce(ThreadingBackendImpl * backend, const int32_t * begin, const int32_t * end, int64_t init, const void * a,
+                              loop_functype_int32ptr_int64 loopFunc, const void * b, reduction_functype_int64 reductionFunc)
+{
+    return parallelReduce(backend, begin, end - begin, init, a, loopFunc, b, reductionFunc);
+}
+
+void * backendNewTls(ThreadingBackendImpl * backend, void * a, tls_functype func)
+{
+    BackendTls * tls = static_cast<BackendTls *>(::malloc(sizeof(BackendTls)));
+    if (!tls) return nullptr;
+
+    tls->a       = a;
+    tls->func    = func;
+    tls->nValues = backend->getMaxThreads();
+    tls->values  = static_cast<void **>(::calloc(tls->nValues, sizeof(void *)));
+    if (!tls->values)
+    {
+        ::free(tls);
+        return nullptr;
+    }
+    return tls;
+}
+
+void * backendGetTlsLocal(ThreadingBackendImpl * backend, void * tlsPtr)
+{
+    BackendTls * tls = static_cast<BackendTls *>(tlsPtr);
+    const int tid    = backend->getCurrentThreadIndex();
+    if (tid < 0 || tid >= tls->nValues) return nullptr;
+
+    /* Each value is accessed only by the thread with its index, so no locking is needed */
+    if (!tls->values[tid]) tls->values[tid] = tls->func(tls->a);
+    return tls->values[tid];
+}
+
+void backendReduceTls(void * tlsPtr, void * a, tls_reduce_functype func)
+{
+    BackendTls * tls = static_cast<BackendTls *>(tlsPtr);
+    for (int64_t i = 0; i < tls->nValues; ++i)
+    {
+        if (tls->values[i]) func(tls->values[i], a);
+    }
+}
+
+void backendParallelReduceTls(ThreadingBackendImpl * backend, void * tlsPtr, void * a, tls_reduce_functype func)
+{
+    BackendTls * tls = static_cast<BackendTls *>(tlsPtr);
+    parallelFor(backend, tls->nValues, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i)
+        {
+            if (tls->values[i]) func(tls->values[i], a);
+        }
+    });
+}
+
+void backendDelTls(void * tlsPtr)
+{
+    BackendTls * tls = static_cast<BackendTls *>(tlsPtr);
+    if (!tls) return;
+    ::free(tls->values);
+    ::free(tls);
+}
+
+template <typename T>
+void backendParallelSort(ThreadingBackendImpl * backend, T * begin, T * end)
+{
+    const int64_t n = end - begin;
+    const Blocking blocking(n, backend->getMaxThreads(), n / minSortBlockSize);
+    T * buffer = blocking.nBlocks > 1 ? static_cast<T *>(::malloc(sizeof(T) * n)) : nullptr;
+    if (!buffer)
+    {
+        std::sort(begin, end);
+        return;
+    }
+
+    parallelFor(backend, blocking.nBlocks, 1, [&](int64_t rangeBegin, int64_t rangeEnd) {
+        for (int64_t iBlock = rangeBegin; iBlock < rangeEnd; ++iBlock) std::sort(begin + blocking.begin(iBlock), begin + blocking.end(iBlock));
+    });
+
+    /* The sorted blocks are merged pairwise until one sorted run remains */
+    T * src = begin;
+    T * dst = buffer;
+    for (int64_t width = blocking.blockSize; width < n; width *= 2)
+    {
+        parallelFor(backend, (n + 2 * width - 1) / (2 * width), 1, [&](int64_t rangeBegin, int64_t rangeEnd) {
+            for (int64_t iMerge = rangeBegin; iMerge < rangeEnd; ++iMerge)
+            {
+                const int64_t first  = iMerge * 2 * width;
+                const int64_t middle = min(n, first + width);
+                const int64_t last   = min(n, first + 2 * width);
+                std::merge(src + first, src + middle, src + middle, src + last, dst + first);
+            }
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != begin)
+    {
+        parallelFor(backend, n, minSortBlockSize, [&](int64_t rangeBegin, int64_t rangeEnd) {
+            std::copy(src + rangeBegin, src + rangeEnd, begin + rangeBegin);
+        });
+    }
+    ::free(buffer);
+}
+
+template void backendParallelSort<int>(ThreadingBackendImpl * backend, int * begin, int * end);
+template void backendParallelSort<size_t>(ThreadingBackendImpl * backend, size_t * begin, size_t * end);
+template void backendParallelSort<IdxValType<int> >(ThreadingBackendImpl * backend, IdxValType<int> * begin, IdxValType<int> * end);
+template void backendParallelSort<IdxValType<float> >(ThreadingBackendImpl * backend, IdxValType<float> * begin, IdxValType<float> * end);
+template void backendParallelSort<IdxValType<double> >(ThreadingBackendImpl * backend, IdxValType<double> * begin, IdxValType<double> * end);
+
+} // namespace internal
+} // namespace daal
+
+#endif
@@ -0,0 +1,134 @@
+/* file: threading_backend.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the backends that replace TBB in the threading layer.
+//--
+*/
+
+#ifndef __THREADING_BACKEND_H__
+#define __THREADING_BACKEND_H__
+
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace internal
+{
+/**
+ *  \brief Backend that runs the parallel loops of the threading layer instead of TBB.
+ *
+ *  All the entry points of the threading layer are expressed through the parallel loop
+ *  over the ranges and the index of the current thread, so a backend implements only these.
+ *  The loops nested into the loop of a backend run sequentially in the calling thread.
+ */
+class ThreadingBackendImpl
+{
+public:
+    virtual ~ThreadingBackendImpl() {}
+
+    virtual ThreadingBackend id() const = 0;
+
+    /* Returns the number of threads that run the loops */
+    virtual int getMaxThreads() = 0;
+
+    /* Returns the index of the calling thread in the range [0, getMaxThreads()) */
+    virtual int getCurrentThreadIndex() = 0;
+
+    /* Limits the number of threads that run the loops, returns the resulting number of threads */
+    virtual size_t setNumberOfThreads(size_t numThreads) = 0;
+
+    /* Calls func on the non-overlapping ranges of at least grainSize iterations that cover [0, n) */
+    virtual void parallelFor(int64_t n, int64_t grainSize, const void * a, executor_range_functype func) = 0;
+};
+
+/**
+ *  \brief Returns the active backend, or NULL if the loops are run by TBB
+ */
+ThreadingBackendImpl * getThreadingBackend();
+
+/**
+ *  \brief Makes the executor of the user the active backend, or restores the backend selected at load time if executor is NULL.
+ *  Fails while a parallel region or a TLS of the threading layer is live, as they are bound to the active backend
+ */
+bool setThreadingExecutor(const ThreadingExecutor * executor);
+
+/**
+ *  \brief Returns true if the calling thread runs the loop of the backend
+ */
+bool isInBackendParallel();
+
+/**
+ *  \brief Keeps the active backend from being changed until releaseThreadingBackend is called, returns the active backend
+ */
+ThreadingBackendImpl * acquireThreadingBackend();
+
+/**
+ *  \brief Allows the active backend to be changed after the matching call of acquireThreadingBackend
+ */
+void releaseThreadingBackend();
+
+/* Marks the outermost parallel region of the calling thread */
+ThreadingBackendImpl * enterParallelRegion();
+void leaveParallelRegion();
+
+/**
+ *  \brief Parallel region of the threading layer run by the backend that was active when the region started.
+ *  setThreadingExecutor fails while the region runs
+ */
+class ParallelRegion
+{
+public:
+    ParallelRegion() : _backend(enterParallelRegion()) {}
+    ~ParallelRegion() { leaveParallelRegion(); }
+
+    ThreadingBackendImpl * backend() const { return _backend; }
+
+private:
+    ParallelRegion(const ParallelRegion &);
+    ParallelRegion & operator=(const ParallelRegion &);
+
+    ThreadingBackendImpl * _backend;
+};
+
+/* Implementations of the entry points of the threading layer on top of the backend */
+void backendParallelFor(ThreadingBackendImpl * backend, int64_t n, int64_t grainSize, const void * a, executor_range_functype func);
+void backendThreaderFor(ThreadingBackendImpl * backend, int64_t n, const void * a, functype func);
+void backendThreaderForInt64(ThreadingBackendImpl * backend, int64_t n, const void * a, functype_int64 func);
+void backendThreaderForInt32ptr(ThreadingBackendImpl * backend, const int * begin, const int * end, const void * a, functype_int32ptr func);
+void backendStaticThreaderFor(ThreadingBackendImpl * backend, size_t n, const void * a, functype_static func);
+void backendThreaderForBlocked(ThreadingBackendImpl * backend, int n, const void * a, functype2 func);
+void backendThreaderForBreak(ThreadingBackendImpl * backend, int n, const void * a, functype_break func);
+int64_t backendParallelReduce(ThreadingBackendImpl * backend, int32_t n, int64_t init, const void * a, loop_functype_int32_int64 loopFunc,
+                              const void * b, reduction_functype_int64 reductionFunc);
+int64_t backendParallelReduce(ThreadingBackendImpl * backend, const int32_t * begin, const int32_t * end, int64_t init, const void * a,
+                              loop_functype_int32ptr_int64 loopFunc, const void * b, reduction_functype_int64 reductionFunc);
+
+void * backendNewTls(ThreadingBackendImpl * backend, void * a, tls_functype func);
+void * backendGetTlsLocal(ThreadingBackendImpl * backend, void * tlsPtr);
+void backendReduceTls(void * tlsPtr, void * a, tls_reduce_functype func);
+void backendParallelReduceTls(ThreadingBackendImpl * backend, void * tlsPtr, void * a, tls_reduce_functype func);
+void backendDelTls(void * tlsPtr);
+
+template <typename T>
+void backendParallelSort(ThreadingBackendImpl * backend, T * begin, T * end);
+
+} // namespace internal
+} // namespace daal
+
+#endif
@@ -0,0 +1,149 @@
+/* file: threading_numa.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the NUMA affinity mode of static_threader_for in the TBB threading layer.
+//--
+*/
+
+#ifndef __THREADING_NUMA_H__
+#define __THREADING_NUMA_H__
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/info.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+namespace daal
+{
+namespace internal
+{
+/**
+ *  \brief Task arenas that run the threads of static_threader_for in the NUMA affinity mode, one arena per NUMA node
+ */
+class NumaArenas
+{
+public:
+    /* Arenas constrained to the NUMA nodes of the system, empty if there is only one node */
+    static NumaArenas & system()
+    {
+        static NumaArenas arenas(systemConstraints());
+        return arenas;
+    }
+
+    /* Arenas with the given constraints, the concurrency of an arena is its max_concurrency
+       or the default concurrency of its NUMA node */
+    explicit NumaArenas(const std::vector<tbb::task_arena::constraints> & constraints) : _totalConcurrency(0)
+    {
+        for (size_t i = 0; i < constraints.size(); ++i)
+        {
+            const size_t concurrency = constraints[i].max_concurrency > 0 ? size_t(constraints[i].max_concurrency) :
+                                                                            size_t(tbb::info::default_concurrency(constraints[i].numa_id));
+            _arenas.emplace_back(new tbb::task_arena(constraints[i]));
+            _concurrency.push_back(concurrency);
+            _totalConcurrency += concurrency;
+        }
+    }
+
+    size_t size() const { return _arenas.size(); }
+    tbb::task_arena & arena(size_t i) { return *_arenas[i]; }
+    size_t concurrency(size_t i) const { return _concurrency[i]; }
+    size_t totalConcurrency() const { return _totalConcurrency; }
+
+    /* First thread of static_threader_for run in the arena iNode, the arena iNode runs the threads [threadBegin(iNode), threadBegin(iNode + 1)) */
+    size_t threadBegin(size_t iNode, size_t nthreads) const
+    {
+        size_t nodesConcurrency = 0;
+        for (size_t i = 0; i < iNode; ++i) nodesConcurrency += _concurrency[i];
+        return nthreads * nodesConcurrency / _totalConcurrency;
+    }
+
+private:
+    static std::vector<tbb::task_arena::constraints> systemConstraints()
+    {
+        std::vector<tbb::task_arena::constraints> constraints;
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        if (nodes.size() < 2) return constraints;
+
+        for (size_t i = 0; i < nodes.size(); ++i) constraints.push_back(tbb::task_arena::constraints(nodes[i]));
+        return constraints;
+    }
+
+    NumaArenas(const NumaArenas &);
+    NumaArenas & operator=(const NumaArenas &);
+
+    std::vector<std::unique_ptr<tbb::task_arena> > _arenas;
+    std::vector<size_t> _concurrency;
+    size_t _totalConcurrency;
+};
+
+/**
+ *  \brief Calls func(i, tid) for i in [0, n) with the same split of [0, n) among nthreads threads as static_threader_for.
+ *  The consecutive threads run in the arena of the same NUMA node, the number of threads per node is proportional to its concurrency
+ */
+template <typename F>
+void numaStaticThreaderFor(NumaArenas & arenas, size_t n, size_t nthreads, const F & func)
+{
+    const size_t nNodes             = arenas.size();
+    const size_t nblocks_per_thread = n / nthreads + !!(n % nthreads);
+
+    const auto processThread = [&](size_t tid) {
+        const size_t begin = tid * nblocks_per_thread;
+        const size_t end   = n < begin + nblocks_per_thread ? n : begin + nblocks_per_thread;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            func(i, tid);
+        }
+    };
+
+    std::vector<tbb::task_group> groups(nNodes);
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        const size_t tidBegin   = arenas.threadBegin(iNode, nthreads);
+        const size_t tidEnd     = arenas.threadBegin(iNode + 1, nthreads);
+        tbb::task_group & group = groups[iNode];
+        arenas.arena(iNode).execute([&group, &processThread, tidBegin, tidEnd]() {
+            group.run([&processThread, tidBegin, tidEnd]() {
+                tbb::parallel_for(
+                    tbb::blocked_range<size_t>(tidBegin, tidEnd, 1),
+                    [&](tbb::blocked_range<size_t> r) {
+                        for (size_t tid = r.begin(); tid < r.end(); ++tid) processThread(tid);
+                    },
+                    tbb::static_partitioner());
+            });
+        });
+    }
+
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        tbb::task_group & group = groups[iNode];
+        arenas.arena(iNode).execute([&group]() { group.wait(); });
+    }
+}
+
+} // namespace internal
+} // namespace daal
+
+#endif
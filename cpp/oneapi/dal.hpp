@@ -23,11 +23,13 @@
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/infer.hpp"
 #include "oneapi/dal/read.hpp"
+#include "oneapi/dal/serialization.hpp"
 #include "oneapi/dal/train.hpp"
 
 /* Tables */
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/csr.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "oneapi/dal/table/column_accessor.hpp"
 
@@ -17,4 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/decision_forest/infer.hpp"
+#include "oneapi/dal/algo/decision_forest/serialization.hpp"
 #include "oneapi/dal/algo/decision_forest/train.hpp"
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/dtrees/forest/classification/df_classification_model_impl.h>
+#include <daal/src/algorithms/dtrees/forest/regression/df_regression_model_impl.h>
+
+#include "oneapi/dal/algo/decision_forest/detail/serialization_ops.hpp"
+#include "oneapi/dal/algo/decision_forest/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/archive_conversion.hpp"
+
+namespace oneapi::dal::decision_forest::detail {
+namespace v1 {
+
+namespace daal_df = daal::algorithms::decision_forest;
+namespace daal_dtrees = daal::algorithms::dtrees::internal;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+using error_msg = dal::detail::error_messages;
+
+template <typename Task>
+struct daal_model_types;
+
+template <>
+struct daal_model_types<task::classification> {
+    using model_ptr_t = daal_df::classification::ModelPtr;
+    using model_impl_t = daal_df::classification::internal::ModelImpl;
+    using interop_t = backend::model_interop_cls;
+};
+
+template <>
+struct daal_model_types<task::regression> {
+    using model_ptr_t = daal_df::regression::ModelPtr;
+    using model_impl_t = daal_df::regression::internal::ModelImpl;
+    using interop_t = backend::model_interop_reg;
+};
+
+template <typename T>
+static void write_optional_block(dal::detail::binary_output_archive& archive,
+                                 const T* data,
+                                 std::int64_t count) {
+    archive.write_block(data, data ? count * std::int64_t(sizeof(T)) : 0);
+}
+
+/// Reads the per-node table of the tree, returns the empty pointer for the absent table
+template <typename T>
+static daal_dm::NumericTablePtr read_optional_table(dal::detail::binary_input_archive& archive,
+                                                    std::int64_t row_count,
+                                                    std::int64_t column_count) {
+    const auto block = archive.read_block<T>();
+    if (block.get_count() == 0) {
+        return daal_dm::NumericTablePtr();
+    }
+    if (block.get_count() != row_count * column_count) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    daal::services::Status status;
+    const auto nt = daal_dm::HomogenNumericTable<T>::create(
+        interop::wrap_archive_block(block),
+        dal::detail::integral_cast<std::size_t>(column_count),
+        dal::detail::integral_cast<std::size_t>(row_count),
+        &status);
+    interop::status_to_exception(status);
+    return nt;
+}
+
+template <typename Task>
+void serialization_ops<Task>::serialize(dal::detail::binary_output_archive& archive,
+                                        const model<Task>& m) const {
+    using types = daal_model_types<Task>;
+    using node_t = daal_dtrees::DecisionTreeNode;
+
+    const auto& impl = dal::detail::get_impl(m);
+    const auto interop = impl.get_interop();
+    archive.write(bool(interop));
+    if (!interop) {
+        return;
+    }
+
+    const auto daal_model = static_cast<const typename types::interop_t*>(interop)->get_model();
+    const auto& daal_impl = static_cast<const typename types::model_impl_t&>(*daal_model);
+    const std::int64_t tree_count = daal_impl.size();
+    const std::int64_t prob_class_count = daal_impl.getNumClasses();
+
+    archive.write(impl.tree_count);
+    archive.write(impl.class_count);
+    archive.write(std::int64_t(daal_model->getNumberOfFeatures()));
+    archive.write(tree_count);
+    archive.write(prob_class_count);
+
+    // Nodes are stored as is, the size of the node guards against the layout changes
+    archive.write(std::int64_t(sizeof(node_t)));
+
+    for (std::int64_t i = 0; i < tree_count; i++) {
+        const auto tree = daal_impl.at(i);
+        const std::int64_t node_count = tree->getNumberOfRows();
+
+        archive.write_block(tree->getArray(), node_count * std::int64_t(sizeof(node_t)));
+        write_optional_block(archive, daal_impl.getImpVals(i), node_count);
+        write_optional_block(archive, daal_impl.getNodeSampleCount(i), node_count);
+        write_optional_block(archive, daal_impl.getProbas(i), node_count * prob_class_count);
+    }
+}
+
+template <typename Task>
+model<Task> serialization_ops<Task>::deserialize(
+    dal::detail::binary_input_archive& archive) const {
+    using types = daal_model_types<Task>;
+    using node_t = daal_dtrees::DecisionTreeNode;
+
+    if (!archive.read<bool>()) {
+        return model<Task>{};
+    }
+
+    const auto model_tree_count = archive.read<std::int64_t>();
+    const auto model_class_count = archive.read<std::int64_t>();
+    const auto column_count = archive.read<std::int64_t>();
+    const auto tree_count = archive.read<std::int64_t>();
+    const auto prob_class_count = archive.read<std::int64_t>();
+    const auto node_size = archive.read<std::int64_t>();
+    if (column_count <= 0 || tree_count < 0 || prob_class_count < 0 ||
+        node_size != std::int64_t(sizeof(node_t))) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    const typename types::model_ptr_t daal_model(
+        new typename types::model_impl_t(dal::detail::integral_cast<std::size_t>(column_count)));
+    auto& daal_impl = static_cast<typename types::model_impl_t&>(*daal_model);
+    daal_impl.resize(dal::detail::integral_cast<std::size_t>(tree_count));
+
+    for (std::int64_t i = 0; i < tree_count; i++) {
+        const auto nodes = archive.read_block();
+        const std::int64_t node_count = nodes.get_count() / node_size;
+        if (node_count == 0 || nodes.get_count() % node_size != 0) {
+            throw invalid_argument(error_msg::archive_is_corrupted());
+        }
+        dal::detail::check_mul_overflow(node_count, prob_class_count);
+
+        const daal_dtrees::DecisionTreeTablePtr tree(new daal_dtrees::DecisionTreeTable(
+            interop::wrap_archive_block(nodes),
+            dal::detail::integral_cast<std::size_t>(node_count)));
+        const auto impurities = read_optional_table<double>(archive, node_count, 1);
+        const auto node_sample_counts = read_optional_table<int>(archive, node_count, 1);
+        const auto probabilities =
+            read_optional_table<double>(archive, prob_class_count, node_count);
+
+        if (!daal_impl.addTreeTables(tree, impurities, node_sample_counts, probabilities, i)) {
+            throw invalid_argument(error_msg::archive_is_corrupted());
+        }
+    }
+
+    const auto impl =
+        std::make_shared<detail::model_impl<Task>>(new typename types::interop_t{ daal_model });
+    impl->tree_count = model_tree_count;
+    impl->class_count = model_class_count;
+    return dal::detail::make_private<model<Task>>(impl);
+}
+
+template struct ONEDAL_EXPORT serialization_ops<task::classification>;
+template struct ONEDAL_EXPORT serialization_ops<task::regression>;
+
+} // namespace v1
+} // namespace oneapi::dal::decision_forest::detail
@@ -0,0 +1,35 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/decision_forest/common.hpp"
+#include "oneapi/dal/detail/archive.hpp"
+
+namespace oneapi::dal::decision_forest::detail {
+namespace v1 {
+
+template <typename Task>
+struct serialization_ops {
+    void serialize(dal::detail::binary_output_archive& archive, const model<Task>& m) const;
+    model<Task> deserialize(dal::detail::binary_input_archive& archive) const;
+};
+
+} // namespace v1
+
+using v1::serialization_ops;
+
+} // namespace oneapi::dal::decision_forest::detail
@@ -0,0 +1,35 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/decision_forest/detail/serialization_ops.hpp"
+#include "oneapi/dal/serialization.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+template <typename Task>
+struct serialization_ops<dal::decision_forest::model<Task>>
+        : dal::decision_forest::detail::serialization_ops<Task> {
+    static constexpr serialization_tag tag =
+        std::is_same_v<Task, dal::decision_forest::task::classification>
+            ? serialization_tag::decision_forest_classification_model
+            : serialization_tag::decision_forest_regression_model;
+};
+
+} // namespace v1
+} // namespace oneapi::dal::detail
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/decision_forest/train.hpp"
+#include "oneapi/dal/algo/decision_forest/infer.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::decision_forest::test {
+
+namespace te = dal::test::engine;
+namespace df = dal::decision_forest;
+
+TEST("decision forest classification 200K x 30, 50 trees", "[df][perf]") {
+    const auto data = GENERATE_DATAFRAME(te::dataframe_builder{ 200000, 30 }.fill_normal(0, 1));
+    const auto x = data.get_table(te::table_id::homogen<float>());
+    const auto y = te::make_binary_labels(x);
+
+    const auto dense_desc = df::descriptor<float, df::method::dense, df::task::classification>{}
+                                .set_class_count(2)
+                                .set_tree_count(50)
+                                .set_max_tree_depth(16);
+    const auto hist_desc = df::descriptor<float, df::method::hist, df::task::classification>{}
+                               .set_class_count(2)
+                               .set_tree_count(50)
+                               .set_max_tree_depth(16);
+    const auto model = dal::train(hist_desc, x, y).get_model();
+
+    te::set_benchmark_workload(data.get_row_count(), data.get_size());
+
+    BENCHMARK("train dense") {
+        return dal::train(dense_desc, x, y);
+    };
+
+    BENCHMARK("train hist") {
+        return dal::train(hist_desc, x, y);
+    };
+
+    BENCHMARK("infer") {
+        return dal::infer(hist_desc, model, x);
+    };
+}
+
+} // namespace oneapi::dal::decision_forest::test
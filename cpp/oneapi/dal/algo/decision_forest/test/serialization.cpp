@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/decision_forest/infer.hpp"
+#include "oneapi/dal/algo/decision_forest/train.hpp"
+#include "oneapi/dal/algo/decision_forest/serialization.hpp"
+#include "oneapi/dal/algo/kmeans/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::decision_forest::test {
+
+namespace te = dal::test::engine;
+namespace df = dal::decision_forest;
+
+template <typename Method>
+class df_serialization_test : public te::algo_fixture {
+public:
+    static constexpr std::int64_t row_count = 500;
+    static constexpr std::int64_t column_count = 6;
+    static constexpr std::int64_t class_count = 3;
+    static constexpr std::int64_t tree_count = 20;
+
+    df_serialization_test()
+            : data_(row_count * column_count),
+              labels_(row_count),
+              responses_(row_count) {
+        std::mt19937 rng(777);
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            float sum = 0.0f;
+            for (std::int64_t j = 0; j < column_count; j++) {
+                data_[i * column_count + j] = normal(rng);
+                sum += data_[i * column_count + j];
+            }
+            labels_[i] = sum < -1.0f ? 0.0f : (sum < 1.0f ? 1.0f : 2.0f);
+            responses_[i] = sum + 0.1f * normal(rng);
+        }
+    }
+
+    bool not_available_on_device() {
+        return get_policy().is_gpu() && std::is_same_v<Method, df::method::dense>;
+    }
+
+    auto get_classification_descriptor() const {
+        return df::descriptor<float, Method, df::task::classification>{}
+            .set_class_count(class_count)
+            .set_tree_count(tree_count)
+            .set_infer_mode(df::infer_mode::class_labels | df::infer_mode::class_probabilities);
+    }
+
+    auto get_regression_descriptor() const {
+        return df::descriptor<float, Method, df::task::regression>{}.set_tree_count(tree_count);
+    }
+
+    table get_data() const {
+        return homogen_table::wrap(data_.data(), row_count, column_count);
+    }
+
+    table get_labels() const {
+        return homogen_table::wrap(labels_.data(), row_count, 1);
+    }
+
+    table get_responses() const {
+        return homogen_table::wrap(responses_.data(), row_count, 1);
+    }
+
+    void check_tables_equal(const table& left, const table& right) {
+        REQUIRE(left.get_row_count() == right.get_row_count());
+        REQUIRE(left.get_column_count() == right.get_column_count());
+
+        const auto left_rows = row_accessor<const float>(left).pull();
+        const auto right_rows = row_accessor<const float>(right).pull();
+        for (std::int64_t i = 0; i < left_rows.get_count(); i++) {
+            REQUIRE(left_rows[i] == right_rows[i]);
+        }
+    }
+
+private:
+    std::vector<float> data_;
+    std::vector<float> labels_;
+    std::vector<float> responses_;
+};
+
+#define DF_SERIALIZATION_TEST(name)      \
+    TEMPLATE_TEST_M(df_serialization_test, \
+                    name,                  \
+                    "[df][serialization]", \
+                    df::method::dense,     \
+                    df::method::hist)
+
+DF_SERIALIZATION_TEST("restored classification model gives the same inference results") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_classification_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    const auto restored = deserialize<df::model<df::task::classification>>(archive);
+    REQUIRE(restored.get_tree_count() == model.get_tree_count());
+    REQUIRE(restored.get_class_count() == model.get_class_count());
+
+    const auto result = this->infer(desc, model, this->get_data());
+    const auto restored_result = this->infer(desc, restored, this->get_data());
+    this->check_tables_equal(result.get_labels(), restored_result.get_labels());
+    this->check_tables_equal(result.get_probabilities(), restored_result.get_probabilities());
+}
+
+DF_SERIALIZATION_TEST("restored regression model gives the same inference results") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_regression_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_responses()).get_model();
+
+    const auto archive = serialize(model);
+    const auto restored = deserialize<df::model<df::task::regression>>(archive);
+    REQUIRE(restored.get_tree_count() == model.get_tree_count());
+
+    const auto responses = this->infer(desc, model, this->get_data()).get_labels();
+    const auto restored_responses = this->infer(desc, restored, this->get_data()).get_labels();
+    this->check_tables_equal(responses, restored_responses);
+}
+
+DF_SERIALIZATION_TEST("throws if archive contains model of another type") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_classification_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    REQUIRE_THROWS_AS(deserialize<df::model<df::task::regression>>(archive), invalid_argument);
+    REQUIRE_THROWS_AS(deserialize<kmeans::model<>>(archive), invalid_argument);
+}
+
+DF_SERIALIZATION_TEST("throws if archive is truncated") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_classification_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    const auto truncated = array<byte_t>{ archive, archive.get_data(), archive.get_count() / 2 };
+    REQUIRE_THROWS_AS(deserialize<df::model<df::task::classification>>(truncated),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::decision_forest::test
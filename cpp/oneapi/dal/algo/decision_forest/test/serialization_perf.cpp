@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/dtrees/forest/classification/df_classification_model_impl.h>
+
+#include "oneapi/dal/algo/decision_forest/train.hpp"
+#include "oneapi/dal/algo/decision_forest/serialization.hpp"
+#include "oneapi/dal/algo/decision_forest/backend/model_impl.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::decision_forest::test {
+
+namespace te = dal::test::engine;
+namespace df = dal::decision_forest;
+namespace daal_df = daal::algorithms::decision_forest;
+namespace daal_dm = daal::data_management;
+
+TEST("decision forest model load 100K x 20, 500 trees", "[df][serialization][perf]") {
+    const auto data = GENERATE_DATAFRAME(te::dataframe_builder{ 100000, 20 }.fill_normal(0, 1));
+    const auto x = data.get_table(te::table_id::homogen<float>());
+    const auto y = te::make_binary_labels(x);
+
+    const auto desc = df::descriptor<float, df::method::hist, df::task::classification>{}
+                          .set_class_count(2)
+                          .set_tree_count(500)
+                          .set_max_tree_depth(16);
+    const auto model = dal::train(desc, x, y).get_model();
+
+    const auto archive = serialize(model);
+
+    // The same forest stored through the DAAL archive, as models were saved before the flat layout
+    const auto interop = static_cast<const backend::model_interop_cls*>(
+        dal::detail::get_impl(model).get_interop());
+    daal_dm::InputDataArchive daal_input_archive;
+    interop->get_model()->serialize(daal_input_archive);
+    const std::size_t daal_archive_size = daal_input_archive.getSizeOfArchive();
+    const auto daal_archive = daal_input_archive.getArchiveAsArraySharedPtr();
+
+    te::set_benchmark_workload(desc.get_tree_count(), archive.get_count());
+
+    BENCHMARK("load flat layout") {
+        return deserialize<df::model<df::task::classification>>(archive);
+    };
+
+    BENCHMARK("load DAAL archive") {
+        daal_dm::OutputDataArchive daal_output_archive(daal_archive.get(), daal_archive_size);
+        const daal_df::classification::ModelPtr restored(
+            new daal_df::classification::internal::ModelImpl());
+        restored->deserialize(daal_output_archive);
+        return restored;
+    };
+}
+
+} // namespace oneapi::dal::decision_forest::test
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cstring>
+
 #include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel.hpp"
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
+#include "oneapi/dal/backend/primitives/scan.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/graph/detail/service_functions_impl.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
@@ -28,6 +31,8 @@ namespace oneapi::dal::preview {
 namespace jaccard {
 namespace detail {
 
+namespace pr = dal::backend::primitives;
+
 template <typename Index>
 ONEDAL_FORCEINLINE std::size_t intersection(const Index *neigh_u,
                                             const Index *neigh_v,
@@ -66,8 +71,19 @@ vertex_similarity_result call_jaccard_default_kernel_scalar(
     Index *first_vertices = reinterpret_cast<Index *>(result_ptr);
     Index *second_vertices = first_vertices + number_elements_in_block;
     float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_block);
-    std::int64_t nnz = 0;
-    for (Index i = row_begin; i < row_end; ++i) {
+
+    // The rows are processed in parallel, every row writes the nonzero coefficients
+    // to its own part of the result, then the parts are compacted
+    const std::int64_t row_count = row_end - row_begin;
+    const std::int64_t column_count = column_end - column_begin;
+    auto row_offsets = dal::array<std::int64_t>::empty(row_count + 1);
+    std::int64_t *row_offsets_ptr = row_offsets.get_mutable_data();
+
+    dal::detail::threader_for_int64(row_count, [&](std::int64_t row) {
+        const Index i = row_begin + Index(row);
+        const std::int64_t row_start = row * column_count;
+        std::int64_t nnz = row_start;
+
         const auto i_neighbor_size = g_degrees[i];
         const auto i_neigbhors = g_vertex_neighbors + g_edge_offsets[i];
         const auto diagonal = min(i, column_end);
@@ -83,10 +99,7 @@ vertex_similarity_result call_jaccard_default_kernel_scalar(
                                    float(i_neighbor_size + j_neighbor_size - intersection_value);
                     first_vertices[nnz] = i;
                     second_vertices[nnz] = j;
-                    // Safe incrementing of nnz
-                    //max nnz = (2^(31)  * 2^(31))=(2^62) < 2^63 = max size of std::int64_t
                     nnz++;
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
                 }
             }
         }
@@ -111,11 +124,29 @@ vertex_similarity_result call_jaccard_default_kernel_scalar(
                     first_vertices[nnz] = i;
                     second_vertices[nnz] = j;
                     nnz++;
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
                 }
             }
         }
+        row_offsets_ptr[row] = nnz - row_start;
+    });
+
+    // The maximal nnz is row_count * column_count, so the sum does not overflow std::int64_t
+    const std::int64_t nnz = pr::exclusive_scan(row_offsets_ptr, row_offsets_ptr, row_count);
+    row_offsets_ptr[row_count] = nnz;
+
+    // The part of every row moves towards the beginning of the result, so the rows
+    // are moved in order to keep the parts of the following rows intact
+    for (std::int64_t row = 0; row < row_count; ++row) {
+        const std::int64_t src = row * column_count;
+        const std::int64_t dst = row_offsets_ptr[row];
+        const std::int64_t row_nnz = row_offsets_ptr[row + 1] - dst;
+        if (src != dst && row_nnz > 0) {
+            std::memmove(jaccard + dst, jaccard + src, row_nnz * sizeof(float));
+            std::memmove(first_vertices + dst, first_vertices + src, row_nnz * sizeof(Index));
+            std::memmove(second_vertices + dst, second_vertices + src, row_nnz * sizeof(Index));
+        }
     }
+
     vertex_similarity_result res(
         homogen_table::wrap(first_vertices, number_elements_in_block, 2, data_layout::column_major),
         homogen_table::wrap(jaccard, number_elements_in_block, 1, data_layout::column_major),
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/jaccard.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_csv_data_source.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+
+namespace oneapi::dal::preview::jaccard::test {
+
+namespace te = dal::test::engine;
+
+TEST("jaccard 10K vertices, 100K edges, 1K x 10K block", "[jaccard][perf]") {
+    constexpr std::int64_t vertex_count = 10000;
+    constexpr std::int64_t edge_count = 100000;
+    constexpr std::int64_t block_row_count = 1000;
+
+    const auto path = te::get_temp_file_path("jaccard_perf_graph.csv");
+    te::write_random_graph_csv(path, vertex_count, edge_count);
+    const auto graph =
+        dal::preview::load_graph::load(dal::preview::load_graph::descriptor<>{},
+                                       dal::preview::graph_csv_data_source{ path });
+
+    const auto desc =
+        descriptor<>{}.set_block({ 0, block_row_count }, { 0, vertex_count });
+    caching_builder builder;
+
+    te::set_benchmark_workload(block_row_count * vertex_count, 0);
+
+    BENCHMARK("vertex similarity") {
+        return dal::preview::vertex_similarity(desc, graph, builder);
+    };
+}
+
+} // namespace oneapi::dal::preview::jaccard::test
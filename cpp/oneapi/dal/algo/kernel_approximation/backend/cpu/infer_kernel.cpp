@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/kernel_function/kernel_function_approximation_kernel.h>
+
+#include "oneapi/dal/algo/kernel_approximation/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/kernel_approximation/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::kernel_approximation::backend {
+
+using dal::backend::context_cpu;
+using model_t = model<task::feature_map>;
+using input_t = infer_input<task::feature_map>;
+using result_t = infer_result<task::feature_map>;
+using descriptor_t = detail::descriptor_base<task::feature_map>;
+
+namespace daal_kernel_function = daal::algorithms::kernel_function;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_nystroem_kernel_t = daal_kernel_function::internal::NystroemKernel<Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rff_kernel_t = daal_kernel_function::internal::RandomFourierFeaturesKernel<Float, Cpu>;
+
+template <typename Float>
+static result_t call_daal_nystroem_kernel(const context_cpu& ctx,
+                                          const descriptor_t& desc,
+                                          const model_t& trained_model,
+                                          const table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t component_count = trained_model.get_landmarks().get_row_count();
+
+    auto kernel_impl = detail::get_kernel_function_impl(desc);
+    if (!kernel_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
+    }
+    const auto daal_kernel = kernel_impl->get_daal_kernel_function();
+
+    dal::detail::check_mul_overflow(row_count, component_count);
+    auto arr_features = array<Float>::empty(row_count * component_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_landmarks =
+        interop::convert_to_daal_table<Float>(trained_model.get_landmarks());
+    const auto daal_normalization =
+        interop::convert_to_daal_table<Float>(trained_model.get_normalization());
+    const auto daal_features =
+        interop::convert_to_daal_homogen_table(arr_features, row_count, component_count);
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_nystroem_kernel_t<Float,
+                                      interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .computeFeatures(daal_kernel,
+                             *daal_data,
+                             *daal_landmarks,
+                             *daal_normalization,
+                             *daal_features);
+    }));
+
+    return result_t{}.set_transformed_data(
+        dal::detail::homogen_table_builder{}
+            .reset(arr_features, row_count, component_count)
+            .build());
+}
+
+template <typename Float>
+static result_t call_daal_rff_kernel(const context_cpu& ctx,
+                                     const model_t& trained_model,
+                                     const table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t component_count = trained_model.get_frequencies().get_row_count();
+
+    dal::detail::check_mul_overflow(row_count, component_count);
+    auto arr_features = array<Float>::empty(row_count * component_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_frequencies =
+        interop::convert_to_daal_table<Float>(trained_model.get_frequencies());
+    const auto daal_phases = interop::convert_to_daal_table<Float>(trained_model.get_phases());
+    const auto daal_features =
+        interop::convert_to_daal_homogen_table(arr_features, row_count, component_count);
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_rff_kernel_t<Float, interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .computeFeatures(*daal_data, *daal_frequencies, *daal_phases, *daal_features);
+    }));
+
+    return result_t{}.set_transformed_data(
+        dal::detail::homogen_table_builder{}
+            .reset(arr_features, row_count, component_count)
+            .build());
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::nystroem, task::feature_map> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return call_daal_nystroem_kernel<Float>(ctx, desc, input.get_model(), input.get_data());
+    }
+};
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::random_fourier, task::feature_map> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return call_daal_rff_kernel<Float>(ctx, input.get_model(), input.get_data());
+    }
+};
+
+template struct infer_kernel_cpu<float, method::nystroem, task::feature_map>;
+template struct infer_kernel_cpu<float, method::random_fourier, task::feature_map>;
+template struct infer_kernel_cpu<double, method::nystroem, task::feature_map>;
+template struct infer_kernel_cpu<double, method::random_fourier, task::feature_map>;
+
+} // namespace oneapi::dal::kernel_approximation::backend
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/kernel_function/kernel_function_approximation_kernel.h>
+#include <daal/include/algorithms/engines/mt19937/mt19937.h>
+
+#include "oneapi/dal/algo/kernel_approximation/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/kernel_approximation/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::kernel_approximation::backend {
+
+using dal::backend::context_cpu;
+using model_t = model<task::feature_map>;
+using input_t = train_input<task::feature_map>;
+using result_t = train_result<task::feature_map>;
+using descriptor_t = detail::descriptor_base<task::feature_map>;
+
+namespace daal_kernel_function = daal::algorithms::kernel_function;
+namespace daal_mt19937 = daal::algorithms::engines::mt19937;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_nystroem_kernel_t = daal_kernel_function::internal::NystroemKernel<Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rff_kernel_t = daal_kernel_function::internal::RandomFourierFeaturesKernel<Float, Cpu>;
+
+// The number of K-Means iterations that refine the uniformly sampled landmarks
+constexpr std::int64_t landmark_kmeans_iteration_count = 10;
+
+inline auto get_daal_engine(const descriptor_t& desc) {
+    return daal_mt19937::Batch<>::create(static_cast<std::size_t>(desc.get_seed()));
+}
+
+inline detail::kernel_function_impl* get_kernel_impl(const descriptor_t& desc) {
+    auto kernel_impl = detail::get_kernel_function_impl(desc);
+    if (!kernel_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
+    }
+    return kernel_impl;
+}
+
+template <typename Float>
+static table select_kmeans_landmarks(const context_cpu& ctx,
+                                     const table& data,
+                                     const table& initial_landmarks) {
+    using kmeans_task_t = kmeans::task::clustering;
+    using kmeans_kernel_t =
+        kmeans::backend::train_kernel_cpu<Float, kmeans::method::lloyd_dense, kmeans_task_t>;
+
+    const auto kmeans_desc = kmeans::descriptor<Float, kmeans::method::lloyd_dense>{}
+                                 .set_cluster_count(initial_landmarks.get_row_count())
+                                 .set_max_iteration_count(landmark_kmeans_iteration_count)
+                                 .set_accuracy_threshold(0.0);
+    const auto kmeans_result =
+        kmeans_kernel_t{}(ctx, kmeans_desc, { data, initial_landmarks });
+    return kmeans_result.get_model().get_centroids();
+}
+
+template <typename Float>
+static result_t call_daal_nystroem_kernel(const context_cpu& ctx,
+                                          const descriptor_t& desc,
+                                          const table& data) {
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t component_count = desc.get_component_count();
+
+    dal::detail::check_mul_overflow(component_count, column_count);
+    dal::detail::check_mul_overflow(component_count, component_count);
+    auto arr_landmarks = array<Float>::empty(component_count * column_count);
+    auto arr_normalization = array<Float>::empty(component_count * component_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    daal::data_management::NumericTablePtr daal_landmarks =
+        interop::convert_to_daal_homogen_table(arr_landmarks, component_count, column_count);
+    const auto daal_normalization =
+        interop::convert_to_daal_homogen_table(arr_normalization, component_count, component_count);
+    const auto daal_engine = get_daal_engine(desc);
+    const auto daal_kernel = get_kernel_impl(desc)->get_daal_kernel_function();
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_nystroem_kernel_t<Float,
+                                      interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .sampleLandmarks(*daal_data, *daal_engine, *daal_landmarks);
+    }));
+
+    table landmarks = dal::detail::homogen_table_builder{}
+                          .reset(arr_landmarks, component_count, column_count)
+                          .build();
+    if (desc.get_landmark_selection_mode() == landmark_selection_mode::kmeans) {
+        landmarks = select_kmeans_landmarks<Float>(ctx, data, landmarks);
+        daal_landmarks = interop::convert_to_daal_table<Float>(landmarks);
+    }
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_nystroem_kernel_t<Float,
+                                      interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .computeNormalization(daal_kernel, *daal_landmarks, *daal_normalization);
+    }));
+
+    const auto mdl =
+        model_t{}
+            .set_landmarks(landmarks)
+            .set_normalization(dal::detail::homogen_table_builder{}
+                                   .reset(arr_normalization, component_count, component_count)
+                                   .build());
+    return result_t{}.set_model(mdl);
+}
+
+template <typename Float>
+static result_t call_daal_rff_kernel(const context_cpu& ctx,
+                                     const descriptor_t& desc,
+                                     const table& data) {
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t component_count = desc.get_component_count();
+
+    dal::detail::check_mul_overflow(component_count, column_count);
+    auto arr_frequencies = array<Float>::empty(component_count * column_count);
+    auto arr_phases = array<Float>::empty(1 * component_count);
+
+    const auto daal_frequencies =
+        interop::convert_to_daal_homogen_table(arr_frequencies, component_count, column_count);
+    const auto daal_phases = interop::convert_to_daal_homogen_table(arr_phases, 1, component_count);
+    const auto daal_engine = get_daal_engine(desc);
+    const Float sigma = static_cast<Float>(get_kernel_impl(desc)->get_sigma());
+
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_rff_kernel_t<Float, interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .sample(sigma, *daal_engine, *daal_frequencies, *daal_phases);
+    }));
+
+    // clang-format off
+    const auto mdl = model_t{}
+        .set_frequencies(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_frequencies, component_count, column_count)
+                .build()
+        )
+        .set_phases(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_phases, 1, component_count)
+                .build()
+        );
+    // clang-format on
+    return result_t{}.set_model(mdl);
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::nystroem, task::feature_map> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return call_daal_nystroem_kernel<Float>(ctx, desc, input.get_data());
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::random_fourier, task::feature_map> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return call_daal_rff_kernel<Float>(ctx, desc, input.get_data());
+    }
+};
+
+template struct train_kernel_cpu<float, method::nystroem, task::feature_map>;
+template struct train_kernel_cpu<float, method::random_fourier, task::feature_map>;
+template struct train_kernel_cpu<double, method::nystroem, task::feature_map>;
+template struct train_kernel_cpu<double, method::random_fourier, task::feature_map>;
+
+} // namespace oneapi::dal::kernel_approximation::backend
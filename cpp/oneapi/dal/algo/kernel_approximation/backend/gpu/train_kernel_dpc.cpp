@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kernel_approximation/backend/gpu/train_kernel.hpp"
+
+namespace oneapi::dal::kernel_approximation::backend {
+
+template <typename Float, typename Method>
+struct train_kernel_gpu<Float, Method, task::feature_map> {
+    train_result<task::feature_map> operator()(
+        const dal::backend::context_gpu& ctx,
+        const detail::descriptor_base<task::feature_map>& params,
+        const train_input<task::feature_map>& input) const {
+        throw unimplemented(
+            dal::detail::error_messages::kernel_approximation_is_not_implemented_for_gpu());
+    }
+};
+
+template struct train_kernel_gpu<float, method::nystroem, task::feature_map>;
+template struct train_kernel_gpu<float, method::random_fourier, task::feature_map>;
+template struct train_kernel_gpu<double, method::nystroem, task::feature_map>;
+template struct train_kernel_gpu<double, method::random_fourier, task::feature_map>;
+
+} // namespace oneapi::dal::kernel_approximation::backend
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kernel_approximation/common.hpp"
+#include "oneapi/dal/algo/kernel_approximation/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::kernel_approximation {
+namespace detail {
+namespace v1 {
+
+template <typename Task>
+class descriptor_impl : public base {
+public:
+    explicit descriptor_impl(const detail::kernel_function_ptr& kernel) : kernel(kernel) {}
+
+    detail::kernel_function_ptr kernel;
+    std::int64_t component_count = 100;
+    std::int64_t seed = 777;
+    landmark_selection_mode landmark_selection = landmark_selection_mode::uniform;
+};
+
+template <typename Task>
+class model_impl : public base {
+public:
+    table landmarks;
+    table normalization;
+    table frequencies;
+    table phases;
+};
+
+template <typename Task>
+descriptor_base<Task>::descriptor_base(const detail::kernel_function_ptr& kernel)
+        : impl_(new descriptor_impl<Task>{ kernel }) {}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_component_count() const {
+    return impl_->component_count;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_seed() const {
+    return impl_->seed;
+}
+
+template <typename Task>
+landmark_selection_mode descriptor_base<Task>::get_landmark_selection_mode() const {
+    return impl_->landmark_selection;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_component_count_impl(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error(dal::detail::error_messages::component_count_leq_zero());
+    }
+    impl_->component_count = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_seed_impl(std::int64_t value) {
+    impl_->seed = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_landmark_selection_mode_impl(landmark_selection_mode value) {
+    impl_->landmark_selection = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_kernel_impl(const detail::kernel_function_ptr& kernel) {
+    impl_->kernel = kernel;
+}
+
+template <typename Task>
+const detail::kernel_function_ptr& descriptor_base<Task>::get_kernel_impl() const {
+    return impl_->kernel;
+}
+
+template class ONEDAL_EXPORT descriptor_base<task::feature_map>;
+
+} // namespace v1
+} // namespace detail
+
+namespace v1 {
+
+using detail::v1::model_impl;
+
+template <typename Task>
+model<Task>::model() : impl_(new model_impl<Task>{}) {}
+
+template <typename Task>
+const table& model<Task>::get_landmarks() const {
+    return impl_->landmarks;
+}
+
+template <typename Task>
+const table& model<Task>::get_normalization() const {
+    return impl_->normalization;
+}
+
+template <typename Task>
+const table& model<Task>::get_frequencies() const {
+    return impl_->frequencies;
+}
+
+template <typename Task>
+const table& model<Task>::get_phases() const {
+    return impl_->phases;
+}
+
+template <typename Task>
+void model<Task>::set_landmarks_impl(const table& value) {
+    impl_->landmarks = value;
+}
+
+template <typename Task>
+void model<Task>::set_normalization_impl(const table& value) {
+    impl_->normalization = value;
+}
+
+template <typename Task>
+void model<Task>::set_frequencies_impl(const table& value) {
+    impl_->frequencies = value;
+}
+
+template <typename Task>
+void model<Task>::set_phases_impl(const table& value) {
+    impl_->phases = value;
+}
+
+template class ONEDAL_EXPORT model<task::feature_map>;
+
+} // namespace v1
+} // namespace oneapi::dal::kernel_approximation
@@ -0,0 +1,302 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/kernel_approximation/detail/kernel_function.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::kernel_approximation {
+
+namespace task {
+namespace v1 {
+/// Tag-type that parameterizes entities used for computing the explicit
+/// feature map that approximates the kernel function.
+struct feature_map {};
+
+/// Alias tag-type for feature map task.
+using by_default = feature_map;
+} // namespace v1
+
+using v1::feature_map;
+using v1::by_default;
+
+} // namespace task
+
+namespace method {
+namespace v1 {
+/// Tag-type that denotes Nystroem computational method. The feature map is
+/// built from the kernel values between the observation and the landmarks.
+struct nystroem {};
+
+/// Tag-type that denotes random Fourier features computational method.
+/// The feature map is built from the random projections of the observation.
+/// Can be used with :expr:`rbf_kernel::desc` only.
+struct random_fourier {};
+
+/// Alias tag-type for Nystroem computational method.
+using by_default = nystroem;
+} // namespace v1
+
+using v1::nystroem;
+using v1::random_fourier;
+using v1::by_default;
+
+} // namespace method
+
+namespace v1 {
+
+/// Available identifiers to specify the way the landmarks of the Nystroem method are selected
+enum class landmark_selection_mode {
+    /// The landmarks are sampled from the observations uniformly without replacement
+    uniform,
+    /// The landmarks are the centroids computed by several iterations of K-Means
+    /// started from the uniformly sampled observations
+    kmeans
+};
+
+} // namespace v1
+
+using v1::landmark_selection_mode;
+
+namespace detail {
+namespace v1 {
+struct descriptor_tag {};
+
+template <typename Task>
+class descriptor_impl;
+
+template <typename Task>
+class model_impl;
+
+template <typename Float>
+constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
+
+template <typename Method>
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method, method::nystroem, method::random_fourier>;
+
+template <typename Task>
+constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::feature_map>;
+
+template <typename Kernel>
+constexpr bool is_valid_kernel_v =
+    dal::detail::is_tag_one_of_v<Kernel,
+                                 linear_kernel::detail::descriptor_tag,
+                                 rbf_kernel::detail::descriptor_tag>;
+
+template <typename Method, typename Kernel>
+constexpr bool is_valid_method_kernel_v =
+    !std::is_same_v<Method, method::random_fourier> ||
+    dal::detail::is_tag_one_of_v<Kernel, rbf_kernel::detail::descriptor_tag>;
+
+template <typename Task = task::by_default>
+class descriptor_base : public base {
+    static_assert(is_valid_task_v<Task>);
+    friend detail::kernel_function_accessor;
+
+public:
+    using tag_t = descriptor_tag;
+    using float_t = float;
+    using method_t = method::by_default;
+    using task_t = Task;
+    using kernel_t = rbf_kernel::descriptor<float_t>;
+
+    /// The number of components $D$ of the feature map. Larger values give
+    /// more accurate approximation of the kernel function at the cost of computations.
+    /// For the Nystroem method it is the number of landmarks.
+    /// @invariant :expr:`component_count > 0`
+    /// @remark default = 100
+    std::int64_t get_component_count() const;
+
+    /// The seed of the random number generator that samples the landmarks or
+    /// the random projections
+    /// @remark default = 777
+    std::int64_t get_seed() const;
+
+    /// The way the landmarks are selected. Used with :expr:`method::nystroem` only.
+    /// @remark default = landmark_selection_mode::uniform
+    landmark_selection_mode get_landmark_selection_mode() const;
+
+protected:
+    explicit descriptor_base(const detail::kernel_function_ptr& kernel);
+
+    void set_component_count_impl(std::int64_t value);
+    void set_seed_impl(std::int64_t value);
+    void set_landmark_selection_mode_impl(landmark_selection_mode value);
+
+    void set_kernel_impl(const detail::kernel_function_ptr&);
+    const detail::kernel_function_ptr& get_kernel_impl() const;
+
+private:
+    dal::detail::pimpl<descriptor_impl<Task>> impl_;
+};
+
+} // namespace v1
+
+using v1::descriptor_tag;
+using v1::descriptor_impl;
+using v1::model_impl;
+using v1::descriptor_base;
+
+using v1::is_valid_float_v;
+using v1::is_valid_method_v;
+using v1::is_valid_task_v;
+using v1::is_valid_kernel_v;
+using v1::is_valid_method_kernel_v;
+
+} // namespace detail
+
+namespace v1 {
+
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::v1::nystroem` or :expr:`method::v1::random_fourier`.
+/// @tparam Task   Tag-type that specifies type of the problem to solve. Can
+///                be :expr:`task::v1::feature_map`.
+/// @tparam Kernel The descriptor of the approximated kernel function. Can be
+///                :expr:`rbf_kernel::desc` or :expr:`linear_kernel::desc`.
+template <typename Float = detail::descriptor_base<>::float_t,
+          typename Method = detail::descriptor_base<>::method_t,
+          typename Task = detail::descriptor_base<>::task_t,
+          typename Kernel = detail::descriptor_base<>::kernel_t>
+class descriptor : public detail::descriptor_base<Task> {
+    static_assert(detail::is_valid_float_v<Float>);
+    static_assert(detail::is_valid_method_v<Method>);
+    static_assert(detail::is_valid_task_v<Task>);
+    static_assert(detail::is_valid_kernel_v<Kernel>,
+                  "Custom kernel for kernel approximation is not supported. "
+                  "Use one of the predefined kernels.");
+    static_assert(detail::is_valid_method_kernel_v<Method, Kernel>,
+                  "Random Fourier features method supports RBF kernel only");
+
+    using base_t = detail::descriptor_base<Task>;
+
+public:
+    using float_t = Float;
+    using method_t = Method;
+    using task_t = Task;
+    using kernel_t = Kernel;
+
+    /// Creates a new instance of the class with the given :literal:`component_count`
+    /// and the descriptor of the kernel function
+    explicit descriptor(std::int64_t component_count = 100, const Kernel& kernel = kernel_t{})
+            : base_t(std::make_shared<detail::kernel_function<Kernel>>(kernel)) {
+        set_component_count(component_count);
+    }
+
+    /// The descriptor of the approximated kernel function `K(x,y)`
+    /// @remark default = :literal:`kernel`
+    const Kernel& get_kernel() const {
+        using kf_t = detail::kernel_function<Kernel>;
+        const auto kf = std::static_pointer_cast<kf_t>(base_t::get_kernel_impl());
+        return kf->get_kernel();
+    }
+
+    auto& set_kernel(const Kernel& kernel) {
+        base_t::set_kernel_impl(std::make_shared<detail::kernel_function<Kernel>>(kernel));
+        return *this;
+    }
+
+    auto& set_component_count(std::int64_t value) {
+        base_t::set_component_count_impl(value);
+        return *this;
+    }
+
+    auto& set_seed(std::int64_t value) {
+        base_t::set_seed_impl(value);
+        return *this;
+    }
+
+    auto& set_landmark_selection_mode(landmark_selection_mode value) {
+        base_t::set_landmark_selection_mode_impl(value);
+        return *this;
+    }
+};
+
+/// @tparam Task Tag-type that specifies type of the problem to solve. Can
+///              be :expr:`task::v1::feature_map`.
+template <typename Task = task::by_default>
+class model : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+    friend dal::detail::pimpl_accessor;
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the default property values.
+    model();
+
+    /// A $D \\times p$ table with the landmarks of the Nystroem method.
+    /// Empty for the random Fourier features method.
+    /// @remark default = table{}
+    const table& get_landmarks() const;
+
+    auto& set_landmarks(const table& value) {
+        set_landmarks_impl(value);
+        return *this;
+    }
+
+    /// A $D \\times D$ table with the normalization matrix of the Nystroem method,
+    /// the inverse square root of the kernel matrix of the landmarks.
+    /// Empty for the random Fourier features method.
+    /// @remark default = table{}
+    const table& get_normalization() const;
+
+    auto& set_normalization(const table& value) {
+        set_normalization_impl(value);
+        return *this;
+    }
+
+    /// A $D \\times p$ table with the random frequencies of the random Fourier
+    /// features method. Empty for the Nystroem method.
+    /// @remark default = table{}
+    const table& get_frequencies() const;
+
+    auto& set_frequencies(const table& value) {
+        set_frequencies_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times D$ table with the random phases of the random Fourier
+    /// features method. Empty for the Nystroem method.
+    /// @remark default = table{}
+    const table& get_phases() const;
+
+    auto& set_phases(const table& value) {
+        set_phases_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_landmarks_impl(const table&);
+    void set_normalization_impl(const table&);
+    void set_frequencies_impl(const table&);
+    void set_phases_impl(const table&);
+
+private:
+    dal::detail::pimpl<detail::model_impl<Task>> impl_;
+};
+
+} // namespace v1
+
+using v1::descriptor;
+using v1::model;
+
+} // namespace oneapi::dal::kernel_approximation
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kernel_approximation/detail/serialization_ops.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+
+namespace oneapi::dal::kernel_approximation::detail {
+namespace v1 {
+
+using dal::detail::serialize_table;
+using dal::detail::deserialize_table;
+
+template <typename Task>
+void serialization_ops<Task>::serialize(dal::detail::binary_output_archive& archive,
+                                        const model<Task>& m) const {
+    serialize_table(archive, m.get_landmarks());
+    serialize_table(archive, m.get_normalization());
+    serialize_table(archive, m.get_frequencies());
+    serialize_table(archive, m.get_phases());
+}
+
+template <typename Task>
+model<Task> serialization_ops<Task>::deserialize(
+    dal::detail::binary_input_archive& archive) const {
+    const auto landmarks = deserialize_table(archive);
+    const auto normalization = deserialize_table(archive);
+    const auto frequencies = deserialize_table(archive);
+    const auto phases = deserialize_table(archive);
+    return model<Task>{}
+        .set_landmarks(landmarks)
+        .set_normalization(normalization)
+        .set_frequencies(frequencies)
+        .set_phases(phases);
+}
+
+template struct ONEDAL_EXPORT serialization_ops<task::feature_map>;
+
+} // namespace v1
+} // namespace oneapi::dal::kernel_approximation::detail
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/kernel_approximation/train_types.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+
+namespace oneapi::dal::kernel_approximation::detail {
+namespace v1 {
+
+template <typename Context, typename Float, typename Method, typename Task, typename... Options>
+struct train_ops_dispatcher {
+    train_result<Task> operator()(const Context&,
+                                  const descriptor_base<Task>&,
+                                  const train_input<Task>&) const;
+};
+
+template <typename Descriptor>
+struct train_ops {
+    using float_t = typename Descriptor::float_t;
+    using task_t = typename Descriptor::task_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = train_input<task_t>;
+    using result_t = train_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    void check_preconditions(const Descriptor& desc, const input_t& input) const {
+        using msg = dal::detail::error_messages;
+
+        if (!input.get_data().has_data()) {
+            throw domain_error(msg::input_data_is_empty());
+        }
+        if constexpr (std::is_same_v<method_t, method::nystroem>) {
+            if (input.get_data().get_row_count() < desc.get_component_count()) {
+                throw invalid_argument(msg::input_data_rc_lt_desc_component_count());
+            }
+        }
+    }
+
+    void check_postconditions(const Descriptor& desc,
+                              const input_t& input,
+                              const result_t& result) const {
+        const auto& trained_model = result.get_model();
+        const std::int64_t component_count = desc.get_component_count();
+        const std::int64_t column_count = input.get_data().get_column_count();
+
+        if constexpr (std::is_same_v<method_t, method::nystroem>) {
+            ONEDAL_ASSERT(trained_model.get_landmarks().get_row_count() == component_count);
+            ONEDAL_ASSERT(trained_model.get_landmarks().get_column_count() == column_count);
+            ONEDAL_ASSERT(trained_model.get_normalization().get_row_count() == component_count);
+            ONEDAL_ASSERT(trained_model.get_normalization().get_column_count() ==
+                          component_count);
+        }
+        else {
+            ONEDAL_ASSERT(trained_model.get_frequencies().get_row_count() == component_count);
+            ONEDAL_ASSERT(trained_model.get_frequencies().get_column_count() == column_count);
+            ONEDAL_ASSERT(trained_model.get_phases().get_row_count() == 1);
+            ONEDAL_ASSERT(trained_model.get_phases().get_column_count() == component_count);
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            train_ops_dispatcher<Context, float_t, method_t, task_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace v1
+
+using v1::train_ops;
+
+} // namespace oneapi::dal::kernel_approximation::detail
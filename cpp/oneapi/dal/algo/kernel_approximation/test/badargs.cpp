@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+
+#include "oneapi/dal/algo/kernel_approximation/infer.hpp"
+#include "oneapi/dal/algo/kernel_approximation/train.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+
+namespace oneapi::dal::kernel_approximation::test {
+
+namespace te = dal::test::engine;
+
+template <typename Method>
+class kernel_approximation_badarg_test : public te::algo_fixture {
+public:
+    static constexpr std::int64_t row_count = 8;
+    static constexpr std::int64_t column_count = 2;
+    static constexpr std::int64_t element_count = row_count * column_count;
+
+    bool not_available_on_device() {
+        return get_policy().is_gpu();
+    }
+
+    auto get_descriptor() const {
+        return kernel_approximation::descriptor<float, Method, task::feature_map>{ 4 };
+    }
+
+    table get_data(std::int64_t override_row_count = row_count,
+                   std::int64_t override_column_count = column_count) const {
+        ONEDAL_ASSERT(override_row_count * override_column_count <= element_count);
+        return homogen_table::wrap(data_.data(), override_row_count, override_column_count);
+    }
+
+private:
+    static constexpr std::array<float, element_count> data_ = {
+        1.0, 1.0, 2.0, 2.0, 1.0, 2.0, 2.0, 1.0, -1.0, -1.0, -1.0, -2.0, -2.0, -1.0, -2.0, -2.0
+    };
+};
+
+#define KERNEL_APPROXIMATION_BADARG_TEST(name)              \
+    TEMPLATE_TEST_M(kernel_approximation_badarg_test,       \
+                    name,                                   \
+                    "[kernel_approximation][badarg]",       \
+                    kernel_approximation::method::nystroem, \
+                    kernel_approximation::method::random_fourier)
+
+KERNEL_APPROXIMATION_BADARG_TEST("accepts positive component_count") {
+    REQUIRE_NOTHROW(this->get_descriptor().set_component_count(1));
+}
+
+KERNEL_APPROXIMATION_BADARG_TEST("throws if component_count is not positive") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_component_count(0), domain_error);
+    REQUIRE_THROWS_AS(this->get_descriptor().set_component_count(-1), domain_error);
+}
+
+KERNEL_APPROXIMATION_BADARG_TEST("throws if train data is empty") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_THROWS_AS(this->train(this->get_descriptor(), homogen_table{}), domain_error);
+}
+
+KERNEL_APPROXIMATION_BADARG_TEST("throws if infer data is empty") {
+    SKIP_IF(this->not_available_on_device());
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data()).get_model();
+
+    REQUIRE_THROWS_AS(this->infer(desc, model, homogen_table{}), domain_error);
+}
+
+KERNEL_APPROXIMATION_BADARG_TEST("throws if model is empty") {
+    SKIP_IF(this->not_available_on_device());
+    const auto desc = this->get_descriptor();
+
+    REQUIRE_THROWS_AS(this->infer(desc, model<>{}, this->get_data()), domain_error);
+}
+
+KERNEL_APPROXIMATION_BADARG_TEST("throws if infer data column count neq train data") {
+    SKIP_IF(this->not_available_on_device());
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data()).get_model();
+
+    REQUIRE_THROWS_AS(this->infer(desc, model, this->get_data(16, 1)), invalid_argument);
+}
+
+TEMPLATE_TEST_M(kernel_approximation_badarg_test,
+                "throws if train data row count is less than landmark count",
+                "[kernel_approximation][badarg]",
+                kernel_approximation::method::nystroem) {
+    SKIP_IF(this->not_available_on_device());
+    const auto desc = this->get_descriptor().set_component_count(4);
+
+    REQUIRE_THROWS_AS(this->train(desc, this->get_data(2, 2)), invalid_argument);
+}
+
+} // namespace oneapi::dal::kernel_approximation::test
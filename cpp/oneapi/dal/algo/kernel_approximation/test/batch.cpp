@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+#include <cmath>
+
+#include "oneapi/dal/algo/kernel_approximation/infer.hpp"
+#include "oneapi/dal/algo/kernel_approximation/train.hpp"
+#include "oneapi/dal/algo/linear_kernel.hpp"
+#include "oneapi/dal/algo/rbf_kernel.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kernel_approximation::test {
+
+namespace te = dal::test::engine;
+namespace rbf = oneapi::dal::rbf_kernel;
+namespace linear = oneapi::dal::linear_kernel;
+
+template <typename TestType>
+class kernel_approximation_batch_test : public te::algo_fixture {
+public:
+    using Float = TestType;
+
+    static constexpr std::int64_t row_count = 24;
+    static constexpr std::int64_t column_count = 3;
+    static constexpr std::int64_t element_count = row_count * column_count;
+
+    bool not_available_on_device() {
+        return get_policy().is_gpu();
+    }
+
+    table get_data() {
+        // Deterministic points in the unit cube
+        for (std::int64_t i = 0; i < element_count; ++i) {
+            data_[i] = static_cast<Float>((i * 37 + 11) % 29) / Float(29);
+        }
+        return homogen_table::wrap(data_.data(), row_count, column_count);
+    }
+
+    // Returns the mean absolute difference between the exact kernel matrix
+    // and the dot products of the feature maps
+    template <typename Descriptor, typename Kernel>
+    double get_approximation_error(const Descriptor& desc, const Kernel& kernel) {
+        const auto data = get_data();
+
+        INFO("run training");
+        const auto model = this->train(desc, data).get_model();
+
+        INFO("run inference");
+        const auto features = this->infer(desc, model, data).get_transformed_data();
+        REQUIRE(features.get_row_count() == row_count);
+        REQUIRE(features.get_column_count() == desc.get_component_count());
+
+        INFO("compute exact kernel");
+        const auto exact = this->compute(kernel, data, data).get_values();
+
+        const auto features_arr = row_accessor<const Float>(features).pull();
+        const auto exact_arr = row_accessor<const Float>(exact).pull();
+        const std::int64_t component_count = features.get_column_count();
+
+        double error = 0.0;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            for (std::int64_t j = 0; j < row_count; ++j) {
+                double dot = 0.0;
+                for (std::int64_t k = 0; k < component_count; ++k) {
+                    dot += double(features_arr[i * component_count + k]) *
+                           double(features_arr[j * component_count + k]);
+                }
+                error += std::abs(dot - double(exact_arr[i * row_count + j]));
+            }
+        }
+        return error / double(row_count * row_count);
+    }
+
+private:
+    std::array<Float, element_count> data_;
+};
+
+TEMPLATE_TEST_M(kernel_approximation_batch_test,
+                "nystroem with all observations as landmarks reproduces rbf kernel",
+                "[kernel_approximation][integration][batch]",
+                float,
+                double) {
+    SKIP_IF(this->not_available_on_device());
+
+    using float_t = TestType;
+    using kernel_t = rbf::descriptor<float_t, rbf::method::dense>;
+
+    const auto kernel = kernel_t{}.set_sigma(0.5);
+    const auto desc = kernel_approximation::
+        descriptor<float_t, method::nystroem, task::feature_map, kernel_t>{ this->row_count,
+                                                                            kernel };
+
+    REQUIRE(this->get_approximation_error(desc, kernel) < 1e-2);
+}
+
+TEMPLATE_TEST_M(kernel_approximation_batch_test,
+                "nystroem reproduces low-rank linear kernel",
+                "[kernel_approximation][integration][batch]",
+                float,
+                double) {
+    SKIP_IF(this->not_available_on_device());
+
+    using float_t = TestType;
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+
+    const auto kernel = kernel_t{}.set_scale(1.0).set_shift(0.0);
+    const auto desc = kernel_approximation::
+        descriptor<float_t, method::nystroem, task::feature_map, kernel_t>{ 8, kernel };
+
+    REQUIRE(this->get_approximation_error(desc, kernel) < 1e-3);
+}
+
+TEMPLATE_TEST_M(kernel_approximation_batch_test,
+                "nystroem with k-means landmarks approximates rbf kernel",
+                "[kernel_approximation][integration][batch]",
+                float,
+                double) {
+    SKIP_IF(this->not_available_on_device());
+
+    using float_t = TestType;
+    using kernel_t = rbf::descriptor<float_t, rbf::method::dense>;
+
+    const auto kernel = kernel_t{}.set_sigma(1.0);
+    const auto desc =
+        kernel_approximation::descriptor<float_t, method::nystroem, task::feature_map, kernel_t>{
+            8,
+            kernel
+        }
+            .set_landmark_selection_mode(landmark_selection_mode::kmeans);
+
+    REQUIRE(this->get_approximation_error(desc, kernel) < 0.05);
+}
+
+TEMPLATE_TEST_M(kernel_approximation_batch_test,
+                "random fourier features approximate rbf kernel",
+                "[kernel_approximation][integration][batch]",
+                float,
+                double) {
+    SKIP_IF(this->not_available_on_device());
+
+    using float_t = TestType;
+    using kernel_t = rbf::descriptor<float_t, rbf::method::dense>;
+
+    const auto kernel = kernel_t{}.set_sigma(1.0);
+    const auto desc = kernel_approximation::
+        descriptor<float_t, method::random_fourier, task::feature_map, kernel_t>{ 4000, kernel };
+
+    REQUIRE(this->get_approximation_error(desc, kernel) < 0.05);
+}
+
+TEMPLATE_TEST_M(kernel_approximation_batch_test,
+                "random fourier features are reproducible with the same seed",
+                "[kernel_approximation][integration][batch]",
+                float,
+                double) {
+    SKIP_IF(this->not_available_on_device());
+
+    using float_t = TestType;
+    const auto desc = kernel_approximation::descriptor<float_t, method::random_fourier>{ 16 }
+                          .set_seed(42);
+    const auto data = this->get_data();
+
+    const auto first = this->train(desc, data).get_model().get_frequencies();
+    const auto second = this->train(desc, data).get_model().get_frequencies();
+
+    const auto first_arr = row_accessor<const float_t>(first).pull();
+    const auto second_arr = row_accessor<const float_t>(second).pull();
+    REQUIRE(first_arr.get_count() == second_arr.get_count());
+    for (std::int64_t i = 0; i < first_arr.get_count(); ++i) {
+        REQUIRE(first_arr[i] == second_arr[i]);
+    }
+}
+
+} // namespace oneapi::dal::kernel_approximation::test
@@ -17,4 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/kmeans/infer.hpp"
+#include "oneapi/dal/algo/kmeans/serialization.hpp"
 #include "oneapi/dal/algo/kmeans/train.hpp"
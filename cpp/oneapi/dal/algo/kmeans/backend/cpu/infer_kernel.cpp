@@ -23,6 +23,7 @@
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::kmeans::backend {
 
@@ -37,6 +38,10 @@ template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_csr_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydCSR, Float, Cpu>;
+
 template <typename Float, typename Task>
 static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_t& desc,
@@ -55,7 +60,14 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
     array<Float> arr_objective_function_value = array<Float>::empty(1);
     array<int> arr_iteration_count = array<int>::empty(1);
 
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const bool is_csr = (data.get_kind() == csr_table::kind());
+    daal::data_management::NumericTablePtr daal_data;
+    if (is_csr) {
+        daal_data = interop::convert_to_daal_csr_table<Float>(data);
+    }
+    else {
+        daal_data = interop::convert_to_daal_table<Float>(data);
+    }
     const auto daal_initial_centroids =
         interop::convert_to_daal_table<Float>(trained_model.get_centroids());
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
@@ -72,11 +84,20 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+    if (is_csr) {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_lloyd_csr_kernel_t>(ctx,
+                                                                             input,
+                                                                             output,
+                                                                             &par));
+    }
+    else {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
+                                                                               input,
+                                                                               output,
+                                                                               &par));
+    }
 
     return infer_result<Task>()
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
@@ -24,6 +24,7 @@
 #include "oneapi/dal/exceptions.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::kmeans::backend {
 
@@ -39,22 +40,39 @@ template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_csr_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydCSR, Float, Cpu>;
+
 template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_init_plus_plus_dense_kernel_t =
     daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_init_plus_plus_csr_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusCSR, Float, Cpu>;
+
+/// Sparse data is passed to DAAL CSR kernels as is, without conversion to the dense format
+template <typename Float>
+static daal::data_management::NumericTablePtr convert_data_to_daal_table(const table& data) {
+    if (data.get_kind() == csr_table::kind()) {
+        return interop::convert_to_daal_csr_table<Float>(data);
+    }
+    return interop::convert_to_daal_table<Float>(data);
+}
+
 template <typename Float>
 static daal::data_management::NumericTablePtr get_initial_centroids(
     const context_cpu& ctx,
     const descriptor_t& desc,
     const table& data,
+    const daal::data_management::NumericTablePtr& daal_data,
     const table& initial_centroids) {
     const int64_t column_count = data.get_column_count();
     const int64_t cluster_count = desc.get_cluster_count();
 
     daal::data_management::NumericTablePtr daal_initial_centroids;
     if (!initial_centroids.has_data()) {
-        const auto daal_data = interop::convert_to_daal_table<Float>(data);
         daal_kmeans_init::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count));
 
         const size_t init_len_input = 1;
@@ -67,15 +85,28 @@ static daal::data_management::NumericTablePtr get_initial_centroids(
             daal_initial_centroids.get()
         };
 
-        interop::status_to_exception(
-            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
-                ctx,
-                init_len_input,
-                init_input,
-                init_len_output,
-                init_output,
-                &par,
-                *(par.engine)));
+        if (data.get_kind() == csr_table::kind()) {
+            interop::status_to_exception(
+                interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_csr_kernel_t>(
+                    ctx,
+                    init_len_input,
+                    init_input,
+                    init_len_output,
+                    init_output,
+                    &par,
+                    *(par.engine)));
+        }
+        else {
+            interop::status_to_exception(
+                interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
+                    ctx,
+                    init_len_input,
+                    init_input,
+                    init_len_output,
+                    init_output,
+                    &par,
+                    *(par.engine)));
+        }
     }
     else {
         daal_initial_centroids = interop::convert_to_daal_table<Float>(initial_centroids);
@@ -99,9 +130,10 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                dal::detail::integral_cast<std::size_t>(max_iteration_count));
     par.accuracyThreshold = accuracy_threshold;
 
-    auto daal_initial_centroids = get_initial_centroids<Float>(ctx, desc, data, initial_centroids);
+    const auto daal_data = convert_data_to_daal_table<Float>(data);
 
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    auto daal_initial_centroids =
+        get_initial_centroids<Float>(ctx, desc, data, daal_data, initial_centroids);
 
     dal::detail::check_mul_overflow(cluster_count, column_count);
     array<Float> arr_centroids = array<Float>::empty(cluster_count * column_count);
@@ -125,11 +157,20 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+    if (data.get_kind() == csr_table::kind()) {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_lloyd_csr_kernel_t>(ctx,
+                                                                             input,
+                                                                             output,
+                                                                             &par));
+    }
+    else {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
+                                                                               input,
+                                                                               output,
+                                                                               &par));
+    }
 
     return train_result<Task>()
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
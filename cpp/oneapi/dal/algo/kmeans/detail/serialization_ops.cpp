@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/detail/serialization_ops.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+
+namespace oneapi::dal::kmeans::detail {
+namespace v1 {
+
+using dal::detail::serialize_table;
+using dal::detail::deserialize_table;
+
+template <typename Task>
+void serialization_ops<Task>::serialize(dal::detail::binary_output_archive& archive,
+                                        const model<Task>& m) const {
+    serialize_table(archive, m.get_centroids());
+}
+
+template <typename Task>
+model<Task> serialization_ops<Task>::deserialize(
+    dal::detail::binary_input_archive& archive) const {
+    return model<Task>{}.set_centroids(deserialize_table(archive));
+}
+
+template struct ONEDAL_EXPORT serialization_ops<task::clustering>;
+
+} // namespace v1
+} // namespace oneapi::dal::kmeans::detail
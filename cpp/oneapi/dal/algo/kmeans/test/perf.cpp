@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/algo/kmeans/infer.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+TEST("kmeans 1M x 20, 10 clusters", "[kmeans][perf]") {
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 1000000, 20 }.fill_normal(0, 1));
+    const auto data = df.get_table(te::table_id::homogen<float>());
+    const auto initial_centroids = df.get_table(te::table_id::homogen<float>(), { 0, 10 });
+
+    const auto desc = kmeans::descriptor<float>{ 10 }
+                          .set_max_iteration_count(10)
+                          .set_accuracy_threshold(0.0);
+    const auto model = dal::train(desc, data, initial_centroids).get_model();
+
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
+    BENCHMARK("train") {
+        return dal::train(desc, data, initial_centroids);
+    };
+
+    BENCHMARK("infer") {
+        return dal::infer(desc, model, data);
+    };
+}
+
+} // namespace oneapi::dal::kmeans::test
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <array>
+
+#include "oneapi/dal/algo/kmeans/infer.hpp"
+#include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/algo/kmeans/serialization.hpp"
+#include "oneapi/dal/algo/pca/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+template <typename Method>
+class kmeans_serialization_test : public te::algo_fixture {
+public:
+    static constexpr std::int64_t row_count = 8;
+    static constexpr std::int64_t column_count = 2;
+    static constexpr std::int64_t element_count = row_count * column_count;
+    static constexpr std::int64_t cluster_count = 2;
+
+    auto get_descriptor() const {
+        return kmeans::descriptor<float, Method, kmeans::task::clustering>{}.set_cluster_count(
+            cluster_count);
+    }
+
+    table get_data() const {
+        return homogen_table::wrap(data_.data(), row_count, column_count);
+    }
+
+    table get_initial_centroids() const {
+        return homogen_table::wrap(data_.data(), cluster_count, column_count);
+    }
+
+    void check_tables_equal(const table& left, const table& right) {
+        REQUIRE(left.get_row_count() == right.get_row_count());
+        REQUIRE(left.get_column_count() == right.get_column_count());
+
+        const auto left_rows = row_accessor<const float>(left).pull();
+        const auto right_rows = row_accessor<const float>(right).pull();
+        for (std::int64_t i = 0; i < left_rows.get_count(); i++) {
+            REQUIRE(left_rows[i] == right_rows[i]);
+        }
+    }
+
+private:
+    static constexpr std::array<float, element_count> data_ = {
+        1.0, 1.0, -1.0, -1.0, 1.0, 2.0, 2.0, 1.0, -1.0, -2.0, 2.0, 2.0, -2.0, -1.0, -2.0, -2.0
+    };
+};
+
+#define KMEANS_SERIALIZATION_TEST(name) \
+    TEMPLATE_TEST_M(kmeans_serialization_test, name, "[kmeans][serialization]", method::lloyd_dense)
+
+KMEANS_SERIALIZATION_TEST("restored model gives the same inference results") {
+    const auto desc = this->get_descriptor();
+    const auto model = train(desc, this->get_data(), this->get_initial_centroids()).get_model();
+
+    const auto archive = serialize(model);
+    const auto restored = deserialize<kmeans::model<>>(archive);
+
+    this->check_tables_equal(model.get_centroids(), restored.get_centroids());
+
+    const auto labels = infer(desc, model, this->get_data()).get_labels();
+    const auto restored_labels = infer(desc, restored, this->get_data()).get_labels();
+    this->check_tables_equal(labels, restored_labels);
+}
+
+KMEANS_SERIALIZATION_TEST("throws if archive contains model of another type") {
+    const auto desc = this->get_descriptor();
+    const auto model = train(desc, this->get_data(), this->get_initial_centroids()).get_model();
+
+    const auto archive = serialize(model);
+    REQUIRE_THROWS_AS(deserialize<pca::model<>>(archive), invalid_argument);
+}
+
+KMEANS_SERIALIZATION_TEST("throws if archive is truncated") {
+    const auto desc = this->get_descriptor();
+    const auto model = train(desc, this->get_data(), this->get_initial_centroids()).get_model();
+
+    const auto archive = serialize(model);
+    const auto truncated = array<byte_t>{ archive, archive.get_data(), archive.get_count() / 2 };
+    REQUIRE_THROWS_AS(deserialize<kmeans::model<>>(truncated), invalid_argument);
+}
+
+} // namespace oneapi::dal::kmeans::test
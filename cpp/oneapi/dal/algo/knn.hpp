@@ -17,4 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/algo/knn/serialization.hpp"
 #include "oneapi/dal/algo/knn/train.hpp"
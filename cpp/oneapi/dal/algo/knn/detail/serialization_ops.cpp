@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h>
+
+#include "oneapi/dal/algo/knn/detail/serialization_ops.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/archive_conversion.hpp"
+
+namespace oneapi::dal::knn::detail {
+namespace v1 {
+
+namespace daal_knn = daal::algorithms::kdtree_knn_classification;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+using error_msg = dal::detail::error_messages;
+
+static bool is_float64_table(const daal_dm::NumericTablePtr& nt) {
+    const auto dictionary = nt->getDictionarySharedPtr();
+    return (*dictionary)[0].indexType == daal_dm::features::getIndexNumType<double>();
+}
+
+template <typename Float>
+static void set_data_and_labels(daal_knn::Model::ModelImpl& impl,
+                                dal::detail::binary_input_archive& archive) {
+    constexpr bool copy_data_labels = false;
+    impl.setData<Float>(interop::deserialize_daal_table<Float>(archive), copy_data_labels);
+    impl.setLabels<Float>(interop::deserialize_daal_table<Float>(archive), copy_data_labels);
+}
+
+template <typename Task>
+void serialization_ops<Task>::serialize(dal::detail::binary_output_archive& archive,
+                                        const model<Task>& m) const {
+    const auto interop = dal::detail::get_impl(m).get_interop();
+    archive.write(bool(interop));
+    if (!interop) {
+        return;
+    }
+
+    // Only the KD-tree models are stored on host, brute force models
+    // are trained on GPU and refer to the device memory
+    const auto daal_model = dynamic_cast<daal_knn::Model*>(interop->get_daal_model().get());
+    if (!daal_model) {
+        throw unimplemented(error_msg::method_not_implemented());
+    }
+
+    const auto impl = daal_model->impl();
+    const auto kd_tree = impl->getKDTreeTable();
+    const bool is_float64 = is_float64_table(impl->getData());
+
+    archive.write(std::int64_t(impl->getNumberOfFeatures()));
+    archive.write(is_float64 ? data_type::float64 : data_type::float32);
+    archive.write(std::int64_t(impl->getRootNodeIndex()));
+    archive.write(std::int64_t(impl->getLastNodeIndex()));
+
+    // Nodes are stored as is, the size of the node guards against the layout changes
+    archive.write(std::int64_t(sizeof(daal_knn::KDTreeNode)));
+    archive.write_block(kd_tree->getArray(),
+                        std::int64_t(kd_tree->getNumberOfRows() * sizeof(daal_knn::KDTreeNode)));
+
+    if (is_float64) {
+        interop::serialize_daal_table<double>(archive, impl->getData());
+        interop::serialize_daal_table<double>(archive, impl->getLabels());
+    }
+    else {
+        interop::serialize_daal_table<float>(archive, impl->getData());
+        interop::serialize_daal_table<float>(archive, impl->getLabels());
+    }
+    interop::serialize_daal_table<std::size_t>(archive, impl->getIndices());
+}
+
+template <typename Task>
+model<Task> serialization_ops<Task>::deserialize(
+    dal::detail::binary_input_archive& archive) const {
+    if (!archive.read<bool>()) {
+        return model<Task>{};
+    }
+
+    const auto column_count = archive.read<std::int64_t>();
+    const auto dtype = archive.read<data_type>();
+    const auto root_node_index = archive.read<std::int64_t>();
+    const auto last_node_index = archive.read<std::int64_t>();
+    const auto node_size = archive.read<std::int64_t>();
+    if (column_count <= 0 || node_size != std::int64_t(sizeof(daal_knn::KDTreeNode)) ||
+        (dtype != data_type::float32 && dtype != data_type::float64)) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    const auto nodes = archive.read_block();
+    const std::int64_t node_count = nodes.get_count() / node_size;
+    if (root_node_index < 0 || root_node_index >= node_count || last_node_index < 0 ||
+        last_node_index > node_count) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    daal::services::Status status;
+    const daal::algorithms::classifier::ModelPtr model_ptr =
+        daal_knn::Model::create(dal::detail::integral_cast<std::size_t>(column_count), &status);
+    interop::status_to_exception(status);
+    const auto impl = static_cast<daal_knn::Model*>(model_ptr.get())->impl();
+
+    const daal_knn::KDTreeTablePtr kd_tree(
+        new daal_knn::KDTreeTable(interop::wrap_archive_block(nodes),
+                                  dal::detail::integral_cast<std::size_t>(node_count),
+                                  status));
+    interop::status_to_exception(status);
+    impl->setKDTreeTable(kd_tree);
+    impl->setRootNodeIndex(dal::detail::integral_cast<std::size_t>(root_node_index));
+    impl->setLastNodeIndex(dal::detail::integral_cast<std::size_t>(last_node_index));
+
+    if (dtype == data_type::float64) {
+        set_data_and_labels<double>(*impl, archive);
+    }
+    else {
+        set_data_and_labels<float>(*impl, archive);
+    }
+    impl->setIndices(interop::deserialize_daal_table<std::size_t>(archive));
+
+    if (!impl->getData() || !impl->getLabels() || !impl->getIndices()) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    const auto model_impl =
+        std::make_shared<detail::model_impl<Task>>(new backend::model_interop{ model_ptr });
+    return dal::detail::make_private<model<Task>>(model_impl);
+}
+
+template struct ONEDAL_EXPORT serialization_ops<task::classification>;
+
+} // namespace v1
+} // namespace oneapi::dal::knn::detail
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/infer.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+
+TEST("knn kd_tree 200K x 16, 10K queries, 5 neighbors", "[knn][perf]") {
+    const auto train_df =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 200000, 16 }.fill_uniform(-1, 1));
+    const auto infer_df =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 10000, 16 }.fill_uniform(-1, 1, 8888));
+    const auto x_train = train_df.get_table(te::table_id::homogen<float>());
+    const auto y_train = te::make_binary_labels(x_train);
+    const auto x_infer = infer_df.get_table(te::table_id::homogen<float>());
+
+    const auto desc = knn::descriptor<float, knn::method::kd_tree>{ 2, 5 };
+    const auto model = dal::train(desc, x_train, y_train).get_model();
+
+    te::set_benchmark_workload(train_df.get_row_count(), train_df.get_size());
+
+    BENCHMARK("train") {
+        return dal::train(desc, x_train, y_train);
+    };
+
+    te::set_benchmark_workload(infer_df.get_row_count(), infer_df.get_size());
+
+    BENCHMARK("infer") {
+        return dal::infer(desc, x_infer, model);
+    };
+}
+
+} // namespace oneapi::dal::knn::test
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h>
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/serialization.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+namespace daal_knn = daal::algorithms::kdtree_knn_classification;
+namespace daal_dm = daal::data_management;
+
+TEST("knn kd-tree model load 10M x 3", "[knn][serialization][perf]") {
+    const auto data = GENERATE_DATAFRAME(te::dataframe_builder{ 10000000, 3 }.fill_normal(0, 1));
+    const auto x = data.get_table(te::table_id::homogen<float>());
+    const auto y = te::make_binary_labels(x);
+
+    const auto desc = knn::descriptor<float, knn::method::kd_tree>{ 2, 5 };
+    const auto model = dal::train(desc, x, y).get_model();
+
+    const auto archive = serialize(model);
+
+    // The same tree stored through the DAAL archive, as models were saved before the flat layout
+    const auto& daal_model = dal::detail::get_impl(model).get_interop()->get_daal_model();
+    daal_dm::InputDataArchive daal_input_archive;
+    daal_model->serialize(daal_input_archive);
+    const std::size_t daal_archive_size = daal_input_archive.getSizeOfArchive();
+    const auto daal_archive = daal_input_archive.getArchiveAsArraySharedPtr();
+
+    te::set_benchmark_workload(data.get_row_count(), archive.get_count());
+
+    BENCHMARK("load flat layout") {
+        return deserialize<knn::model<>>(archive);
+    };
+
+    BENCHMARK("load DAAL archive") {
+        daal_dm::OutputDataArchive daal_output_archive(daal_archive.get(), daal_archive_size);
+        const daal_knn::ModelPtr restored(new daal_knn::Model());
+        restored->deserialize(daal_output_archive);
+        return restored;
+    };
+}
+
+} // namespace oneapi::dal::knn::test
@@ -18,3 +18,4 @@
 
 #include "oneapi/dal/algo/pca/train.hpp"
 #include "oneapi/dal/algo/pca/infer.hpp"
+#include "oneapi/dal/algo/pca/serialization.hpp"
@@ -22,6 +22,7 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::pca::backend {
 
@@ -51,7 +52,14 @@ static result_t call_daal_kernel(const context_cpu& ctx,
     auto arr_means = array<Float>::empty(1 * column_count);
     auto arr_vars = array<Float>::empty(1 * column_count);
 
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const bool is_csr = (data.get_kind() == csr_table::kind());
+    daal::data_management::NumericTablePtr daal_data;
+    if (is_csr) {
+        daal_data = interop::convert_to_daal_csr_table<Float>(data);
+    }
+    else {
+        daal_data = interop::convert_to_daal_table<Float>(data);
+    }
     const auto daal_eigenvectors =
         interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
     const auto daal_eigenvalues =
@@ -59,8 +67,15 @@ static result_t call_daal_kernel(const context_cpu& ctx,
     const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
     const auto daal_variances = interop::convert_to_daal_homogen_table(arr_vars, 1, column_count);
 
-    daal_cov::Batch<Float, daal_cov::defaultDense> covariance_alg;
-    covariance_alg.input.set(daal_cov::data, daal_data);
+    // Sparse data is processed by the CSR method of covariance without conversion
+    // to the dense format, the correlation kernel accesses the data only via covariance
+    daal_cov::Batch<Float, daal_cov::defaultDense> covariance_dense_alg;
+    daal_cov::Batch<Float, daal_cov::fastCSR> covariance_csr_alg;
+    daal_cov::BatchImpl* covariance_alg = &covariance_dense_alg;
+    if (is_csr) {
+        covariance_alg = &covariance_csr_alg;
+    }
+    covariance_alg->input.set(daal_cov::data, daal_data);
 
     constexpr bool is_correlation = false;
     constexpr std::uint64_t results_to_compute =
@@ -71,7 +86,7 @@ static result_t call_daal_kernel(const context_cpu& ctx,
         is_correlation,
         desc.get_deterministic(),
         *daal_data,
-        &covariance_alg,
+        covariance_alg,
         static_cast<DAAL_UINT64>(results_to_compute),
         *daal_eigenvectors,
         *daal_eigenvalues,
@@ -26,6 +26,8 @@ class descriptor_impl : public base {
 public:
     std::int64_t component_count = -1;
     bool deterministic = false;
+    std::int64_t oversampling_count = 10;
+    std::int64_t power_iteration_count = 2;
 };
 
 template <typename Task>
@@ -47,6 +49,16 @@ bool descriptor_base<Task>::get_deterministic() const {
     return impl_->deterministic;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_oversampling_count() const {
+    return impl_->oversampling_count;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_power_iteration_count() const {
+    return impl_->power_iteration_count;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_component_count_impl(std::int64_t value) {
     if (value < 0) {
@@ -60,6 +72,22 @@ void descriptor_base<Task>::set_deterministic_impl(bool value) {
     impl_->deterministic = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_oversampling_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error(dal::detail::error_messages::oversampling_count_lt_zero());
+    }
+    impl_->oversampling_count = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_power_iteration_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error(dal::detail::error_messages::power_iteration_count_lt_zero());
+    }
+    impl_->power_iteration_count = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::dim_reduction>;
 
 } // namespace v1
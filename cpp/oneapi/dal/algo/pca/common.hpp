@@ -45,6 +45,11 @@ struct cov {};
 /// Tag-type that denotes :ref:`SVD <pca_t_math_svd>` computational method.
 struct svd {};
 
+/// Tag-type that denotes randomized SVD computational method. It computes
+/// only the leading components from the projection of the data onto
+/// a random low-dimensional subspace.
+struct randomized {};
+
 /// Alias tag-type for :ref:`Covariance <pca_t_math_cov>` computational
 /// method.
 using by_default = cov;
@@ -52,6 +57,7 @@ using by_default = cov;
 
 using v1::cov;
 using v1::svd;
+using v1::randomized;
 using v1::by_default;
 
 } // namespace method
@@ -70,7 +76,8 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method, method::cov, method::svd>;
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method, method::cov, method::svd, method::randomized>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::dim_reduction>;
@@ -98,9 +105,25 @@ public:
     /// @remark default = true
     bool get_deterministic() const;
 
+    /// The number of random directions sampled by the randomized method in
+    /// addition to the requested components. Larger values improve the accuracy
+    /// of the components at the cost of computations.
+    /// Used with :expr:`method::randomized` only.
+    /// @remark default = 10
+    /// @invariant :expr:`oversampling_count >= 0`
+    std::int64_t get_oversampling_count() const;
+
+    /// The number of power iterations performed by the randomized method
+    /// to refine the sampled subspace. Used with :expr:`method::randomized` only.
+    /// @remark default = 2
+    /// @invariant :expr:`power_iteration_count >= 0`
+    std::int64_t get_power_iteration_count() const;
+
 protected:
     void set_component_count_impl(std::int64_t value);
     void set_deterministic_impl(bool value);
+    void set_oversampling_count_impl(std::int64_t value);
+    void set_power_iteration_count_impl(std::int64_t value);
 
 private:
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -125,7 +148,8 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::v1::cov` or :expr:`method::v1::svd`.
+///                be :expr:`method::v1::cov`, :expr:`method::v1::svd` or
+///                :expr:`method::v1::randomized`.
 /// @tparam Task   Tag-type that specifies type of the problem to solve. Can
 ///                be :expr:`task::v1::dim_reduction`.
 template <typename Float = detail::descriptor_base<>::float_t,
@@ -158,6 +182,16 @@ public:
         base_t::set_deterministic_impl(value);
         return *this;
     }
+
+    auto& set_oversampling_count(std::int64_t value) {
+        base_t::set_oversampling_count_impl(value);
+        return *this;
+    }
+
+    auto& set_power_iteration_count(std::int64_t value) {
+        base_t::set_power_iteration_count_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
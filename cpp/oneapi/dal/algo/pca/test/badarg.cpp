@@ -35,7 +35,8 @@ public:
     static constexpr std::int64_t element_count = row_count * column_count;
 
     bool not_available_on_device() {
-        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd>;
+        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd> ||
+                                std::is_same_v<Method, pca::method::randomized>;
         return get_policy().is_gpu() && is_svd;
     }
 
@@ -65,8 +66,13 @@ private:
     };
 };
 
-#define PCA_BADARG_TEST(name) \
-    TEMPLATE_TEST_M(pca_badarg_test, name, "[pca][badarg]", pca::method::cov, pca::method::svd)
+#define PCA_BADARG_TEST(name)                \
+    TEMPLATE_TEST_M(pca_badarg_test,         \
+                    name,                    \
+                    "[pca][badarg]",         \
+                    pca::method::cov,        \
+                    pca::method::svd,        \
+                    pca::method::randomized)
 
 PCA_BADARG_TEST("accepts non-negative component_count") {
     SKIP_IF(this->not_available_on_device());
@@ -78,6 +84,16 @@ PCA_BADARG_TEST("throws if component_count is negative") {
     REQUIRE_THROWS_AS(this->get_descriptor().set_component_count(-1), domain_error);
 }
 
+PCA_BADARG_TEST("throws if oversampling_count is negative") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_THROWS_AS(this->get_descriptor().set_oversampling_count(-1), domain_error);
+}
+
+PCA_BADARG_TEST("throws if power_iteration_count is negative") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_THROWS_AS(this->get_descriptor().set_power_iteration_count(-1), domain_error);
+}
+
 PCA_BADARG_TEST("throws if train data is empty") {
     SKIP_IF(this->not_available_on_device());
     const auto pca_desc = this->get_descriptor().set_component_count(2);
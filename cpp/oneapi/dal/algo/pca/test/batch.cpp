@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <random>
+
 #include "oneapi/dal/algo/pca/train.hpp"
 #include "oneapi/dal/algo/pca/infer.hpp"
 
@@ -34,7 +36,8 @@ public:
     using Method = std::tuple_element_t<1, TestType>;
 
     bool not_available_on_device() {
-        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd>;
+        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd> ||
+                                std::is_same_v<Method, pca::method::randomized>;
         return get_policy().is_gpu() && is_svd;
     }
 
@@ -168,7 +171,57 @@ public:
         CHECK(diff < tol);
     }
 
+    table get_low_rank_data(std::int64_t row_count, std::int64_t column_count) {
+        // A few dominant directions with well separated scales and a small noise,
+        // so the leading components are determined reliably
+        constexpr std::int64_t rank = 3;
+        const double scales[rank] = { 10.0, 5.0, 2.0 };
+
+        std::mt19937 rng(7777);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        std::vector<double> factors((row_count + column_count) * rank);
+        for (auto& f : factors) {
+            f = normal(rng);
+        }
+        const double* u = factors.data();
+        const double* v = factors.data() + row_count * rank;
+
+        low_rank_data_.resize(row_count * column_count);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                double x = 1e-3 * normal(rng);
+                for (std::int64_t k = 0; k < rank; k++) {
+                    x += scales[k] * u[i * rank + k] * v[j * rank + k];
+                }
+                low_rank_data_[i * column_count + j] = static_cast<Float>(x);
+            }
+        }
+        return homogen_table::wrap(low_rank_data_.data(), row_count, column_count);
+    }
+
+    void check_leading_components(const pca::train_result<>& reference,
+                                  const pca::train_result<>& result) {
+        const double tol = te::get_tolerance<Float>(1e-3, 1e-6);
+
+        INFO("check if eigenvalues match the reference")
+        const double diff =
+            te::rel_error(reference.get_eigenvalues(), result.get_eigenvalues(), tol);
+        CHECK(diff < tol);
+
+        INFO("check if eigenvectors match the reference up to the sign")
+        const auto R = la::matrix<double>::wrap(reference.get_eigenvectors());
+        const auto V = la::matrix<double>::wrap(result.get_eigenvectors());
+        const auto RxVT = la::dot(R, V.t());
+        for (std::int64_t i = 0; i < R.get_row_count(); i++) {
+            CAPTURE(i, RxVT.get(i, i));
+            CHECK(std::abs(std::abs(RxVT.get(i, i)) - 1.0) < tol);
+        }
+    }
+
 private:
+    std::vector<Float> low_rank_data_;
+
     static auto unpack_result(const pca::train_result<>& result) {
         const auto means = result.get_means();
         const auto variances = result.get_variances();
@@ -178,7 +231,8 @@ private:
     }
 };
 
-using pca_types = COMBINE_TYPES((float, double), (pca::method::cov, pca::method::svd));
+using pca_types = COMBINE_TYPES((float, double),
+                                (pca::method::cov, pca::method::svd, pca::method::randomized));
 
 TEMPLATE_LIST_TEST_M(pca_batch_test, "pca common flow", "[pca][integration][batch]", pca_types) {
     SKIP_IF(this->not_available_on_device());
@@ -214,4 +268,29 @@ TEMPLATE_LIST_TEST_M(pca_batch_test,
     this->general_checks(data, component_count, data_table_id);
 }
 
+using pca_randomized_types = COMBINE_TYPES((float, double), (pca::method::randomized));
+
+TEMPLATE_LIST_TEST_M(pca_batch_test,
+                     "randomized method matches svd on leading components",
+                     "[pca][integration][batch]",
+                     pca_randomized_types) {
+    SKIP_IF(this->not_available_on_device());
+    using Float = std::tuple_element_t<0, TestType>;
+
+    const std::int64_t component_count = GENERATE(1, 3);
+    const table x = this->get_low_rank_data(2000, 50);
+
+    const auto svd_desc = pca::descriptor<Float, pca::method::svd>{ component_count };
+    const auto randomized_desc = pca::descriptor<Float, pca::method::randomized>{ component_count }
+                                     .set_oversampling_count(10)
+                                     .set_power_iteration_count(2);
+
+    const auto svd_result = this->train(svd_desc, x);
+    const auto randomized_result = this->train(randomized_desc, x);
+
+    this->check_eigenvalues_order(randomized_result.get_eigenvalues());
+    this->check_eigenvectors_orthogonality(randomized_result.get_eigenvectors());
+    this->check_leading_components(svd_result, randomized_result);
+}
+
 } // namespace oneapi::dal::pca::test
@@ -33,7 +33,8 @@ public:
     static constexpr std::int64_t invalid_component_count = 0x7FFFFFFFFFFFFFFF;
 
     bool not_available_on_device() {
-        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd>;
+        constexpr bool is_svd = std::is_same_v<Method, pca::method::svd> ||
+                                std::is_same_v<Method, pca::method::randomized>;
         return get_policy().is_gpu() && is_svd;
     }
 
@@ -57,8 +58,13 @@ public:
     }
 };
 
-#define PCA_OVERFLOW_TEST(name) \
-    TEMPLATE_TEST_M(pca_overflow_test, name, "[pca][overflow]", pca::method::cov, pca::method::svd)
+#define PCA_OVERFLOW_TEST(name)              \
+    TEMPLATE_TEST_M(pca_overflow_test,       \
+                    name,                    \
+                    "[pca][overflow]",       \
+                    pca::method::cov,        \
+                    pca::method::svd,        \
+                    pca::method::randomized)
 
 PCA_OVERFLOW_TEST("train throws if component count leads to overflow") {
     SKIP_IF(this->not_available_on_device());
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/pca/train.hpp"
+#include "oneapi/dal/algo/pca/infer.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::pca::test {
+
+namespace te = dal::test::engine;
+
+TEST("pca 1M x 100, 10 components", "[pca][perf]") {
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 1000000, 100 }.fill_normal(0, 1));
+    const auto data = df.get_table(te::table_id::homogen<float>());
+
+    const auto cov_desc = pca::descriptor<float, pca::method::cov>{ 10 };
+    const auto svd_desc = pca::descriptor<float, pca::method::svd>{ 10 };
+    const auto model = dal::train(cov_desc, data).get_model();
+
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
+    BENCHMARK("train cov") {
+        return dal::train(cov_desc, data);
+    };
+
+    BENCHMARK("train svd") {
+        return dal::train(svd_desc, data);
+    };
+
+    BENCHMARK("infer") {
+        return dal::infer(cov_desc, model, data);
+    };
+}
+
+} // namespace oneapi::dal::pca::test
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/pca/infer.hpp"
+#include "oneapi/dal/algo/pca/train.hpp"
+#include "oneapi/dal/algo/pca/serialization.hpp"
+#include "oneapi/dal/algo/kmeans/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::pca::test {
+
+namespace te = dal::test::engine;
+
+template <typename Method>
+class pca_serialization_test : public te::algo_fixture {
+public:
+    static constexpr std::int64_t row_count = 200;
+    static constexpr std::int64_t column_count = 8;
+    static constexpr std::int64_t component_count = 3;
+
+    pca_serialization_test() : data_(row_count * column_count) {
+        std::mt19937 rng(777);
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                data_[i * column_count + j] = float(j + 1) * normal(rng);
+            }
+        }
+    }
+
+    bool not_available_on_device() {
+        return get_policy().is_gpu() && !std::is_same_v<Method, pca::method::cov>;
+    }
+
+    auto get_descriptor() const {
+        return pca::descriptor<float, Method>{}.set_component_count(component_count);
+    }
+
+    table get_data() const {
+        return homogen_table::wrap(data_.data(), row_count, column_count);
+    }
+
+    void check_tables_equal(const table& left, const table& right) {
+        REQUIRE(left.get_row_count() == right.get_row_count());
+        REQUIRE(left.get_column_count() == right.get_column_count());
+
+        const auto left_rows = row_accessor<const float>(left).pull();
+        const auto right_rows = row_accessor<const float>(right).pull();
+        for (std::int64_t i = 0; i < left_rows.get_count(); i++) {
+            REQUIRE(left_rows[i] == right_rows[i]);
+        }
+    }
+
+private:
+    std::vector<float> data_;
+};
+
+#define PCA_SERIALIZATION_TEST(name)        \
+    TEMPLATE_TEST_M(pca_serialization_test, \
+                    name,                   \
+                    "[pca][serialization]", \
+                    pca::method::cov,       \
+                    pca::method::svd)
+
+PCA_SERIALIZATION_TEST("restored model gives the same inference results") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data()).get_model();
+
+    const auto archive = serialize(model);
+    const auto restored = deserialize<pca::model<>>(archive);
+    this->check_tables_equal(model.get_eigenvectors(), restored.get_eigenvectors());
+
+    const auto transformed = this->infer(desc, model, this->get_data()).get_transformed_data();
+    const auto restored_transformed =
+        this->infer(desc, restored, this->get_data()).get_transformed_data();
+    this->check_tables_equal(transformed, restored_transformed);
+}
+
+PCA_SERIALIZATION_TEST("throws if archive contains model of another type") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data()).get_model();
+
+    const auto archive = serialize(model);
+    REQUIRE_THROWS_AS(deserialize<kmeans::model<>>(archive), invalid_argument);
+}
+
+PCA_SERIALIZATION_TEST("throws if archive is truncated") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data()).get_model();
+
+    const auto archive = serialize(model);
+    const auto truncated = array<byte_t>{ archive, archive.get_data(), archive.get_count() / 2 };
+    REQUIRE_THROWS_AS(deserialize<pca::model<>>(truncated), invalid_argument);
+}
+
+} // namespace oneapi::dal::pca::test
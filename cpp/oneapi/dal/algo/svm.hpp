@@ -17,4 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/svm/infer.hpp"
+#include "oneapi/dal/algo/svm/serialization.hpp"
 #include "oneapi/dal/algo/svm/train.hpp"
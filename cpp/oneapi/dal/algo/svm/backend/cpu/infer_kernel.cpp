@@ -16,6 +16,9 @@
 
 #include <daal/src/algorithms/svm/svm_predict_kernel.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "oneapi/dal/algo/svm/backend/cpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/svm/backend/model_interop.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
@@ -23,6 +26,7 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::svm::backend {
@@ -90,8 +94,132 @@ static result_t call_daal_kernel(const context_cpu& ctx,
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_label, row_count, 1).build());
 }
 
+template <typename Float>
+static result_t call_daal_multiclass_kernel(const context_cpu& ctx,
+                                            const descriptor_t& desc,
+                                            const model_t& trained_model,
+                                            const table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t class_count = trained_model.get_class_count();
+    const std::int64_t pair_count = class_count * (class_count - 1) / 2;
+    const std::int64_t support_vector_count = trained_model.get_support_vector_count();
+    const std::int64_t coeff_column_count = class_count - 1;
+
+    const auto arr_coeffs = row_accessor<const Float>{ trained_model.get_coeffs() }.pull();
+    const auto arr_biases = row_accessor<const Float>{ trained_model.get_biases() }.pull();
+    const auto arr_class_sv_counts =
+        row_accessor<const std::int32_t>{ trained_model.get_class_support_vector_counts() }
+            .pull();
+
+    std::vector<std::int64_t> class_sv_offsets(class_count + 1, 0);
+    for (std::int64_t c = 0; c < class_count; ++c) {
+        class_sv_offsets[c + 1] = class_sv_offsets[c] + arr_class_sv_counts[c];
+    }
+    if (class_sv_offsets[class_count] != support_vector_count) {
+        using msg = dal::detail::error_messages;
+        throw invalid_argument(
+            msg::input_model_support_vectors_rc_neq_input_model_support_vector_count());
+    }
+
+    auto kernel_impl = detail::get_kernel_function_impl(desc);
+    if (!kernel_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
+    }
+    const auto daal_kernel = kernel_impl->get_daal_kernel_function();
+    const auto daal_kernel_result =
+        daal_kernel_function::ResultPtr(new daal_kernel_function::Result());
+    daal_kernel->setResult(daal_kernel_result);
+    daal_kernel->getParameter()->computationMode = daal_kernel_function::matrixMatrix;
+    daal_kernel->getInput()->set(
+        daal_kernel_function::Y,
+        interop::convert_to_daal_table<Float>(trained_model.get_support_vectors()));
+
+    // The kernel values between the observations and the support vectors are
+    // computed once for all binary models, by blocks of rows to limit the memory
+    constexpr std::int64_t max_kernel_block_size = 1 << 22;
+    const std::int64_t block_row_count =
+        std::max<std::int64_t>(1,
+                               std::min(row_count,
+                                        max_kernel_block_size /
+                                            std::max<std::int64_t>(support_vector_count, 1)));
+    auto arr_kernel_values = array<Float>::empty(block_row_count * support_vector_count);
+
+    dal::detail::check_mul_overflow(row_count, pair_count);
+    auto arr_decision_function = array<Float>::empty(row_count * pair_count);
+    auto arr_label = array<Float>::empty(row_count);
+    Float* decision_function = arr_decision_function.get_mutable_data();
+    Float* labels = arr_label.get_mutable_data();
+    const Float* coeffs = arr_coeffs.get_data();
+    const Float* biases = arr_biases.get_data();
+
+    for (std::int64_t first_row = 0; first_row < row_count; first_row += block_row_count) {
+        const std::int64_t block_size = std::min(block_row_count, row_count - first_row);
+        const auto arr_block =
+            row_accessor<const Float>{ data }.pull({ first_row, first_row + block_size });
+
+        if (support_vector_count > 0) {
+            daal_kernel->getInput()->set(
+                daal_kernel_function::X,
+                interop::convert_to_daal_table<Float>(
+                    homogen_table::wrap(arr_block.get_data(), block_size, column_count)));
+            daal_kernel_result->set(daal_kernel_function::values,
+                                    interop::convert_to_daal_homogen_table(arr_kernel_values,
+                                                                           block_size,
+                                                                           support_vector_count));
+            interop::status_to_exception(daal_kernel->computeNoThrow());
+        }
+        const Float* kernel_values = arr_kernel_values.get_data();
+
+        // The binary model for classes i < j votes for class i if its decision function
+        // is positive and for class j otherwise, ties are resolved in favor of the
+        // smallest class
+        constexpr std::int64_t vote_block_size = 64;
+        const std::int64_t vote_block_count =
+            (block_size + vote_block_size - 1) / vote_block_size;
+        dal::detail::threader_for_int64(vote_block_count, [&](std::int64_t b) {
+            std::vector<std::int64_t> votes(class_count);
+            const std::int64_t end = std::min(block_size, (b + 1) * vote_block_size);
+            for (std::int64_t r = b * vote_block_size; r < end; ++r) {
+                const Float* kernel_row = kernel_values + r * support_vector_count;
+                Float* decision_row = decision_function + (first_row + r) * pair_count;
+                std::fill(votes.begin(), votes.end(), 0);
+
+                std::int64_t pair_index = 0;
+                for (std::int64_t i = 0; i < class_count; ++i) {
+                    for (std::int64_t j = i + 1; j < class_count; ++j, ++pair_index) {
+                        Float decision = biases[pair_index];
+                        for (std::int64_t s = class_sv_offsets[i]; s < class_sv_offsets[i + 1];
+                             ++s) {
+                            decision += coeffs[s * coeff_column_count + j - 1] * kernel_row[s];
+                        }
+                        for (std::int64_t s = class_sv_offsets[j]; s < class_sv_offsets[j + 1];
+                             ++s) {
+                            decision += coeffs[s * coeff_column_count + i] * kernel_row[s];
+                        }
+                        decision_row[pair_index] = decision;
+                        ++votes[decision > 0 ? i : j];
+                    }
+                }
+
+                labels[first_row + r] = static_cast<Float>(
+                    std::distance(votes.begin(), std::max_element(votes.begin(), votes.end())));
+            }
+        });
+    }
+
+    return result_t()
+        .set_decision_function(dal::detail::homogen_table_builder{}
+                                   .reset(arr_decision_function, row_count, pair_count)
+                                   .build())
+        .set_labels(dal::detail::homogen_table_builder{}.reset(arr_label, row_count, 1).build());
+}
+
 template <typename Float>
 static result_t infer(const context_cpu& ctx, const descriptor_t& desc, const input_t& input) {
+    if (input.get_model().get_class_count() > 2) {
+        return call_daal_multiclass_kernel<Float>(ctx, desc, input.get_model(), input.get_data());
+    }
     return call_daal_kernel<Float>(ctx, desc, input.get_model(), input.get_data());
 }
 
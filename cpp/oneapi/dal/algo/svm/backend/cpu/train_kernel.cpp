@@ -17,6 +17,10 @@
 #include <daal/src/algorithms/svm/svm_train_boser_kernel.h>
 #include <daal/src/algorithms/svm/svm_train_thunder_kernel.h>
 
+#include <algorithm>
+#include <exception>
+#include <vector>
+
 #include "oneapi/dal/algo/svm/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/algo/svm/backend/model_interop.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
@@ -26,6 +30,7 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::svm::backend {
@@ -38,41 +43,33 @@ using descriptor_t = detail::descriptor_base<task::classification>;
 
 namespace daal_svm = daal::algorithms::svm;
 namespace daal_kernel_function = daal::algorithms::kernel_function;
+namespace daal_dm = daal::data_management;
 namespace interop = dal::backend::interop;
 
 template <typename Float, daal::CpuType Cpu, typename Method>
 using daal_svm_kernel_t =
     daal_svm::training::internal::SVMTrainImpl<to_daal_method<Method>::value, Float, Cpu>;
 
-template <typename Float, typename Method>
-static result_t call_daal_kernel(const context_cpu& ctx,
-                                 const descriptor_t& desc,
-                                 const table& data,
-                                 const table& labels,
-                                 const table& weights) {
-    const int64_t row_count = data.get_row_count();
-    const int64_t column_count = data.get_column_count();
-
-    auto arr_label = row_accessor<const Float>{ labels }.pull();
-
-    binary_label_t<Float> unique_label;
-    auto arr_new_label = convert_labels(arr_label, { Float(-1.0), Float(1.0) }, unique_label);
-
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
-    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_new_label, row_count, 1);
-    const auto daal_weights = interop::convert_to_daal_table<Float>(weights);
+static std::uint64_t get_cache_byte(const descriptor_t& desc) {
+    const std::uint64_t cache_megabyte = static_cast<std::uint64_t>(desc.get_cache_size());
+    constexpr std::uint64_t megabyte = 1024 * 1024;
+    dal::detail::check_mul_overflow(cache_megabyte, megabyte);
+    return cache_megabyte * megabyte;
+}
 
+template <typename Float, typename Method>
+static daal_svm::ModelPtr train_daal_model(const context_cpu& ctx,
+                                           const descriptor_t& desc,
+                                           const daal_dm::NumericTablePtr& daal_data,
+                                           const daal_dm::NumericTablePtr& daal_labels,
+                                           const daal_dm::NumericTablePtr& daal_weights,
+                                           std::uint64_t cache_byte) {
     auto kernel_impl = detail::get_kernel_function_impl(desc);
     if (!kernel_impl) {
         throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
     }
     const auto daal_kernel = kernel_impl->get_daal_kernel_function();
 
-    const std::uint64_t cache_megabyte = static_cast<std::uint64_t>(desc.get_cache_size());
-    constexpr std::uint64_t megabyte = 1024 * 1024;
-    dal::detail::check_mul_overflow(cache_megabyte, megabyte);
-    const std::uint64_t cache_byte = cache_megabyte * megabyte;
-
     daal_svm::Parameter daal_parameter(
         daal_kernel,
         desc.get_c(),
@@ -82,7 +79,7 @@ static result_t call_daal_kernel(const context_cpu& ctx,
         cache_byte,
         desc.get_shrinking());
 
-    auto daal_model = daal_svm::Model::create<Float>(column_count);
+    auto daal_model = daal_svm::Model::create<Float>(daal_data->getNumberOfColumns());
 
     interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
         return daal_svm_kernel_t<
@@ -92,6 +89,33 @@ static result_t call_daal_kernel(const context_cpu& ctx,
             .compute(daal_data, daal_weights, *daal_labels, daal_model.get(), &daal_parameter);
     }));
 
+    return daal_model;
+}
+
+template <typename Float, typename Method>
+static result_t call_daal_kernel(const context_cpu& ctx,
+                                 const descriptor_t& desc,
+                                 const table& data,
+                                 const table& labels,
+                                 const table& weights) {
+    const int64_t row_count = data.get_row_count();
+
+    auto arr_label = row_accessor<const Float>{ labels }.pull();
+
+    binary_label_t<Float> unique_label;
+    auto arr_new_label = convert_labels(arr_label, { Float(-1.0), Float(1.0) }, unique_label);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_new_label, row_count, 1);
+    const auto daal_weights = interop::convert_to_daal_table<Float>(weights);
+
+    const auto daal_model = train_daal_model<Float, Method>(ctx,
+                                                            desc,
+                                                            daal_data,
+                                                            daal_labels,
+                                                            daal_weights,
+                                                            get_cache_byte(desc));
+
     auto table_support_indices =
         interop::convert_from_daal_homogen_table<Float>(daal_model->getSupportIndices());
 
@@ -102,8 +126,308 @@ static result_t call_daal_kernel(const context_cpu& ctx,
     return result_t().set_model(trained_model).set_support_indices(table_support_indices);
 }
 
+struct class_pair {
+    std::int64_t first;
+    std::int64_t second;
+};
+
+/// The binary model trained for the pair of classes. The support vectors are
+/// identified by their positions in the training set sorted by class
+template <typename Float>
+struct binary_model {
+    std::vector<std::int64_t> support_positions;
+    std::vector<Float> coeffs;
+    double bias = 0.0;
+};
+
+template <typename Float, typename Method>
+static void train_binary_model(const context_cpu& ctx,
+                               const descriptor_t& desc,
+                               const array<Float>& arr_sorted_data,
+                               const array<Float>& arr_sorted_weights,
+                               const std::vector<std::int64_t>& class_offsets,
+                               std::int64_t column_count,
+                               const class_pair& pair,
+                               std::uint64_t cache_byte,
+                               binary_model<Float>& result) {
+    const std::int64_t first_begin = class_offsets[pair.first];
+    const std::int64_t first_count = class_offsets[pair.first + 1] - first_begin;
+    const std::int64_t second_begin = class_offsets[pair.second];
+    const std::int64_t second_count = class_offsets[pair.second + 1] - second_begin;
+
+    // The pair with the class that has no samples always votes for the other class
+    if (first_count == 0 || second_count == 0) {
+        result.bias = first_count > 0 ? 1.0 : -1.0;
+        return;
+    }
+
+    const std::int64_t row_count = first_count + second_count;
+    const Float* sorted_data = arr_sorted_data.get_data();
+
+    auto arr_data = array<Float>::empty(row_count * column_count);
+    Float* data = arr_data.get_mutable_data();
+    std::copy(sorted_data + first_begin * column_count,
+              sorted_data + (first_begin + first_count) * column_count,
+              data);
+    std::copy(sorted_data + second_begin * column_count,
+              sorted_data + (second_begin + second_count) * column_count,
+              data + first_count * column_count);
+
+    // The samples of the first class are labeled as +1, so the positive decision
+    // function votes for the first class
+    auto arr_labels = array<Float>::empty(row_count);
+    Float* labels = arr_labels.get_mutable_data();
+    std::fill(labels, labels + first_count, Float(1.0));
+    std::fill(labels + first_count, labels + row_count, Float(-1.0));
+
+    array<Float> arr_weights;
+    if (arr_sorted_weights.get_count() > 0) {
+        const Float* sorted_weights = arr_sorted_weights.get_data();
+        arr_weights = array<Float>::empty(row_count);
+        Float* weights = arr_weights.get_mutable_data();
+        std::copy(sorted_weights + first_begin,
+                  sorted_weights + first_begin + first_count,
+                  weights);
+        std::copy(sorted_weights + second_begin,
+                  sorted_weights + second_begin + second_count,
+                  weights + first_count);
+    }
+
+    const auto daal_model = train_daal_model<Float, Method>(
+        ctx,
+        desc,
+        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count),
+        interop::convert_to_daal_homogen_table(arr_labels, row_count, 1),
+        interop::convert_to_daal_homogen_table(arr_weights, row_count, 1),
+        cache_byte);
+
+    result.bias = daal_model->getBias();
+
+    const auto daal_support_indices = daal_model->getSupportIndices();
+    if (!daal_support_indices || daal_support_indices->getNumberOfRows() == 0) {
+        return;
+    }
+
+    const auto arr_support_indices = row_accessor<const std::int32_t>{
+        interop::convert_from_daal_homogen_table<std::int32_t>(daal_support_indices)
+    }.pull();
+    const auto arr_coeffs = row_accessor<const Float>{
+        interop::convert_from_daal_homogen_table<Float>(
+            daal_model->getClassificationCoefficients())
+    }.pull();
+
+    const std::int64_t support_vector_count = arr_support_indices.get_count();
+    result.support_positions.resize(support_vector_count);
+    result.coeffs.resize(support_vector_count);
+    for (std::int64_t i = 0; i < support_vector_count; ++i) {
+        const std::int64_t index = arr_support_indices[i];
+        result.support_positions[i] =
+            index < first_count ? first_begin + index : second_begin + index - first_count;
+        result.coeffs[i] = arr_coeffs[i];
+    }
+}
+
+/// The index of the pair of classes in the order (0, 1), (0, 2), ..., (k - 2, k - 1)
+inline std::int64_t get_pair_index(std::int64_t first, std::int64_t second, std::int64_t k) {
+    return first * (2 * k - first - 1) / 2 + (second - first - 1);
+}
+
+template <typename Float, typename Method>
+static result_t call_daal_multiclass_kernel(const context_cpu& ctx,
+                                            const descriptor_t& desc,
+                                            const table& data,
+                                            const table& labels,
+                                            const table& weights) {
+    using msg = dal::detail::error_messages;
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t class_count = desc.get_class_count();
+    dal::detail::check_mul_overflow(row_count, column_count);
+    dal::detail::check_mul_overflow(class_count, class_count - 1);
+    const std::int64_t pair_count = class_count * (class_count - 1) / 2;
+
+    const auto arr_label = row_accessor<const Float>{ labels }.pull();
+
+    // Counting sort of the samples by class, the order of samples within the class is kept
+    std::vector<std::int64_t> class_offsets(class_count + 1, 0);
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        const Float label = arr_label[i];
+        if (!(label >= Float(0) && label < Float(class_count)) ||
+            Float(static_cast<std::int64_t>(label)) != label) {
+            throw invalid_argument(
+                msg::input_labels_out_of_range_expect_from_zero_to_class_count());
+        }
+        ++class_offsets[static_cast<std::int64_t>(label) + 1];
+    }
+    for (std::int64_t c = 0; c < class_count; ++c) {
+        class_offsets[c + 1] += class_offsets[c];
+    }
+
+    std::vector<std::int64_t> sorted_rows(row_count);
+    {
+        std::vector<std::int64_t> next_positions(class_offsets.begin(), class_offsets.end() - 1);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            sorted_rows[next_positions[static_cast<std::int64_t>(arr_label[i])]++] = i;
+        }
+    }
+
+    // The samples are gathered in class order once, so that the training set of each
+    // binary model consists of two contiguous blocks of the shared sorted copy
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    const Float* data_ptr = arr_data.get_data();
+    auto arr_sorted_data = array<Float>::empty(row_count * column_count);
+    Float* sorted_data = arr_sorted_data.get_mutable_data();
+    dal::detail::threader_for_int64(row_count, [&](std::int64_t i) {
+        const Float* row = data_ptr + sorted_rows[i] * column_count;
+        std::copy(row, row + column_count, sorted_data + i * column_count);
+    });
+
+    array<Float> arr_sorted_weights;
+    if (weights.has_data()) {
+        const auto arr_weights = row_accessor<const Float>{ weights }.pull();
+        arr_sorted_weights = array<Float>::empty(row_count);
+        Float* sorted_weights = arr_sorted_weights.get_mutable_data();
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            sorted_weights[i] = arr_weights[sorted_rows[i]];
+        }
+    }
+
+    // The binary models are trained concurrently, the largest ones are scheduled first
+    // to balance the load. The threads left idle at the end are taken by the nested
+    // parallel loops of the kernels that are still running
+    std::vector<class_pair> pairs;
+    pairs.reserve(pair_count);
+    for (std::int64_t i = 0; i < class_count; ++i) {
+        for (std::int64_t j = i + 1; j < class_count; ++j) {
+            pairs.push_back({ i, j });
+        }
+    }
+    const auto get_pair_row_count = [&](const class_pair& pair) {
+        return class_offsets[pair.first + 1] - class_offsets[pair.first] +
+               class_offsets[pair.second + 1] - class_offsets[pair.second];
+    };
+    std::stable_sort(pairs.begin(), pairs.end(), [&](const class_pair& a, const class_pair& b) {
+        return get_pair_row_count(a) > get_pair_row_count(b);
+    });
+
+    // The kernel matrix cache is split between the binary models trained at the same time
+    const std::int64_t concurrent_pair_count =
+        std::min<std::int64_t>(pair_count, dal::detail::threader_get_max_threads());
+    const std::uint64_t cache_byte =
+        get_cache_byte(desc) / static_cast<std::uint64_t>(concurrent_pair_count);
+
+    std::vector<binary_model<Float>> binary_models(pair_count);
+    std::vector<std::exception_ptr> errors(pair_count);
+    const std::int32_t pair_count_32 = dal::detail::integral_cast<std::int32_t>(pair_count);
+    dal::detail::threader_for(pair_count_32, pair_count_32, [&](std::int32_t p) {
+        const class_pair& pair = pairs[p];
+        try {
+            train_binary_model<Float, Method>(
+                ctx,
+                desc,
+                arr_sorted_data,
+                arr_sorted_weights,
+                class_offsets,
+                column_count,
+                pair,
+                cache_byte,
+                binary_models[get_pair_index(pair.first, pair.second, class_count)]);
+        }
+        catch (...) {
+            errors[p] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The support vectors of the multiclass model are the unique support vectors
+    // of the binary models grouped by class
+    std::vector<std::int64_t> support_vector_indices(row_count, -1);
+    for (const auto& model : binary_models) {
+        for (const std::int64_t position : model.support_positions) {
+            support_vector_indices[position] = 0;
+        }
+    }
+
+    std::vector<std::int64_t> support_positions;
+    auto arr_class_sv_counts = array<std::int32_t>::zeros(class_count);
+    std::int32_t* class_sv_counts = arr_class_sv_counts.get_mutable_data();
+    for (std::int64_t c = 0; c < class_count; ++c) {
+        for (std::int64_t position = class_offsets[c]; position < class_offsets[c + 1];
+             ++position) {
+            if (support_vector_indices[position] >= 0) {
+                support_vector_indices[position] = support_positions.size();
+                support_positions.push_back(position);
+                ++class_sv_counts[c];
+            }
+        }
+    }
+    const std::int64_t support_vector_count = support_positions.size();
+
+    auto arr_support_vectors = array<Float>::empty(support_vector_count * column_count);
+    auto arr_support_indices = array<Float>::empty(support_vector_count);
+    Float* support_vectors = arr_support_vectors.get_mutable_data();
+    Float* support_indices = arr_support_indices.get_mutable_data();
+    for (std::int64_t i = 0; i < support_vector_count; ++i) {
+        const std::int64_t position = support_positions[i];
+        std::copy(sorted_data + position * column_count,
+                  sorted_data + (position + 1) * column_count,
+                  support_vectors + i * column_count);
+        support_indices[i] = static_cast<Float>(sorted_rows[position]);
+    }
+
+    // The coefficient of the support vector of class i in the binary model for
+    // classes i and j is stored in column j if j < i and in column j - 1 otherwise
+    const std::int64_t coeff_column_count = class_count - 1;
+    auto arr_coeffs = array<Float>::zeros(support_vector_count * coeff_column_count);
+    auto arr_biases = array<Float>::empty(pair_count);
+    Float* coeffs = arr_coeffs.get_mutable_data();
+    Float* biases = arr_biases.get_mutable_data();
+    for (std::int64_t i = 0; i < class_count; ++i) {
+        for (std::int64_t j = i + 1; j < class_count; ++j) {
+            const std::int64_t pair_index = get_pair_index(i, j, class_count);
+            const auto& model = binary_models[pair_index];
+            biases[pair_index] = static_cast<Float>(model.bias);
+            for (std::size_t s = 0; s < model.support_positions.size(); ++s) {
+                const std::int64_t position = model.support_positions[s];
+                const std::int64_t column = position < class_offsets[i + 1] ? j - 1 : i;
+                coeffs[support_vector_indices[position] * coeff_column_count + column] =
+                    model.coeffs[s];
+            }
+        }
+    }
+
+    using dal::detail::homogen_table_builder;
+    const auto trained_model =
+        model_t{}
+            .set_support_vectors(homogen_table_builder{}
+                                     .reset(arr_support_vectors, support_vector_count, column_count)
+                                     .build())
+            .set_coeffs(homogen_table_builder{}
+                            .reset(arr_coeffs, support_vector_count, coeff_column_count)
+                            .build())
+            .set_class_count(class_count)
+            .set_biases(homogen_table_builder{}.reset(arr_biases, pair_count, 1).build())
+            .set_class_support_vector_counts(
+                homogen_table_builder{}.reset(arr_class_sv_counts, class_count, 1).build());
+
+    return result_t().set_model(trained_model).set_support_indices(
+        homogen_table_builder{}.reset(arr_support_indices, support_vector_count, 1).build());
+}
+
 template <typename Float, typename Method>
 static result_t train(const context_cpu& ctx, const descriptor_t& desc, const input_t& input) {
+    if (desc.get_class_count() > 2) {
+        return call_daal_multiclass_kernel<Float, Method>(ctx,
+                                                          desc,
+                                                          input.get_data(),
+                                                          input.get_labels(),
+                                                          input.get_weights());
+    }
     return call_daal_kernel<Float, Method>(ctx,
                                            desc,
                                            input.get_data(),
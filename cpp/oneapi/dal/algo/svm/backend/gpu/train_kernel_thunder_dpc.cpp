@@ -104,6 +104,10 @@ static result_t call_daal_kernel(const context_gpu& ctx,
 
 template <typename Float>
 static result_t train(const context_gpu& ctx, const descriptor_t& desc, const input_t& input) {
+    if (desc.get_class_count() > 2) {
+        throw unimplemented(
+            dal::detail::error_messages::svm_multiclass_is_not_implemented_for_gpu());
+    }
     return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_labels());
 }
 
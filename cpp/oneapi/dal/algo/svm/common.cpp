@@ -34,6 +34,7 @@ public:
     double cache_size = 200.0;
     double tau = 1e-6;
     bool shrinking = true;
+    std::int64_t class_count = 2;
 };
 
 template <typename Task>
@@ -44,6 +45,9 @@ public:
     double bias;
     double first_class_label;
     double second_class_label;
+    std::int64_t class_count = 2;
+    table biases;
+    table class_support_vector_counts;
 };
 
 template <typename Task>
@@ -80,6 +84,11 @@ bool descriptor_base<Task>::get_shrinking() const {
     return impl_->shrinking;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_class_count() const {
+    return impl_->class_count;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_c_impl(double value) {
     if (value <= 0.0) {
@@ -125,6 +134,14 @@ void descriptor_base<Task>::set_shrinking_impl(bool value) {
     impl_->shrinking = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_class_count_impl(std::int64_t value) {
+    if (value <= 1) {
+        throw domain_error(dal::detail::error_messages::class_count_leq_one());
+    }
+    impl_->class_count = value;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_kernel_impl(const detail::kernel_function_ptr& kernel) {
     impl_->kernel = kernel;
@@ -177,6 +194,21 @@ std::int64_t model<Task>::get_second_class_label() const {
     return impl_->second_class_label;
 }
 
+template <typename Task>
+std::int64_t model<Task>::get_class_count() const {
+    return impl_->class_count;
+}
+
+template <typename Task>
+const table& model<Task>::get_biases() const {
+    return impl_->biases;
+}
+
+template <typename Task>
+const table& model<Task>::get_class_support_vector_counts() const {
+    return impl_->class_support_vector_counts;
+}
+
 template <typename Task>
 void model<Task>::set_support_vectors_impl(const table& value) {
     impl_->support_vectors = value;
@@ -202,6 +234,24 @@ void model<Task>::set_second_class_label_impl(std::int64_t value) {
     impl_->second_class_label = value;
 }
 
+template <typename Task>
+void model<Task>::set_class_count_impl(std::int64_t value) {
+    if (value <= 1) {
+        throw domain_error(dal::detail::error_messages::class_count_leq_one());
+    }
+    impl_->class_count = value;
+}
+
+template <typename Task>
+void model<Task>::set_biases_impl(const table& value) {
+    impl_->biases = value;
+}
+
+template <typename Task>
+void model<Task>::set_class_support_vector_counts_impl(const table& value) {
+    impl_->class_support_vector_counts = value;
+}
+
 template class ONEDAL_EXPORT model<task::classification>;
 
 } // namespace v1
@@ -126,6 +126,13 @@ public:
     /// @remark default = true
     bool get_shrinking() const;
 
+    /// The number of classes. If :expr:`class_count > 2`, the multiclass problem is
+    /// solved by the one-vs-one scheme: a binary model is trained for each pair of
+    /// classes, and the class labels shall be the integers in the range $[0, class\\_count)$.
+    /// @invariant :expr:`class_count > 1`
+    /// @remark default = 2
+    std::int64_t get_class_count() const;
+
 protected:
     explicit descriptor_base(const detail::kernel_function_ptr& kernel);
 
@@ -135,6 +142,7 @@ protected:
     void set_cache_size_impl(double);
     void set_tau_impl(double);
     void set_shrinking_impl(bool);
+    void set_class_count_impl(std::int64_t);
 
     void set_kernel_impl(const detail::kernel_function_ptr&);
     const detail::kernel_function_ptr& get_kernel_impl() const;
@@ -234,6 +242,11 @@ public:
         base_t::set_shrinking_impl(value);
         return *this;
     }
+
+    auto& set_class_count(std::int64_t value) {
+        base_t::set_class_count_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies the type of the problem to solve. Can
@@ -264,7 +277,11 @@ public:
         return *this;
     }
 
-    /// A $nsv \\times 1$ table containing coefficients of Lagrange multiplier
+    /// A $nsv \\times 1$ table containing coefficients of Lagrange multiplier.
+    /// For the multiclass model, a $nsv \\times (k - 1)$ table, where $k$ is the number
+    /// of classes: the coefficient of the support vector of class $i$ in the binary model
+    /// for classes $i$ and $j$ is stored in column $j$ if $j < i$ and in column $j - 1$
+    /// otherwise.
     /// @remark default = table{}
     const table& get_coeffs() const;
 
@@ -282,6 +299,37 @@ public:
         return *this;
     }
 
+    /// The number of classes $k$
+    /// @remark default = 2
+    std::int64_t get_class_count() const;
+
+    auto& set_class_count(std::int64_t value) {
+        set_class_count_impl(value);
+        return *this;
+    }
+
+    /// A $k(k - 1)/2 \\times 1$ table containing the biases of the binary models of the
+    /// multiclass model for the class pairs $(0, 1), (0, 2), \\dots, (k - 2, k - 1)$.
+    /// Empty for the binary model.
+    /// @remark default = table{}
+    const table& get_biases() const;
+
+    auto& set_biases(const table& value) {
+        set_biases_impl(value);
+        return *this;
+    }
+
+    /// A $k \\times 1$ table containing the number of support vectors of each class in
+    /// the multiclass model. The support vectors are grouped by class in ascending
+    /// order. Empty for the binary model.
+    /// @remark default = table{}
+    const table& get_class_support_vector_counts() const;
+
+    auto& set_class_support_vector_counts(const table& value) {
+        set_class_support_vector_counts_impl(value);
+        return *this;
+    }
+
     /// The first unique value in class labels
     /// @remark default = 0
     std::int64_t get_first_class_label() const;
@@ -304,6 +352,9 @@ protected:
     void set_support_vectors_impl(const table&);
     void set_coeffs_impl(const table&);
     void set_bias_impl(double);
+    void set_class_count_impl(std::int64_t);
+    void set_biases_impl(const table&);
+    void set_class_support_vector_counts_impl(const table&);
     void set_first_class_label_impl(std::int64_t);
     void set_second_class_label_impl(std::int64_t);
 
@@ -64,6 +64,22 @@ struct infer_ops {
             throw invalid_argument(
                 msg::input_model_coeffs_rc_neq_input_model_support_vector_count());
         }
+
+        const std::int64_t class_count = input.get_model().get_class_count();
+        if (class_count > 2) {
+            if (input.get_model().get_coeffs().get_column_count() != class_count - 1) {
+                throw invalid_argument(msg::input_model_coeffs_cc_neq_class_count_minus_one());
+            }
+            if (input.get_model().get_biases().get_row_count() !=
+                class_count * (class_count - 1) / 2) {
+                throw invalid_argument(msg::input_model_biases_rc_neq_class_pair_count());
+            }
+            if (input.get_model().get_class_support_vector_counts().get_row_count() !=
+                class_count) {
+                throw invalid_argument(
+                    msg::input_model_class_support_vector_counts_rc_neq_class_count());
+            }
+        }
     }
 
     void check_postconditions(const Descriptor& params,
@@ -73,6 +89,9 @@ struct infer_ops {
         ONEDAL_ASSERT(result.get_decision_function().has_data());
         ONEDAL_ASSERT(result.get_decision_function().get_row_count() ==
                       result.get_labels().get_row_count());
+        ONEDAL_ASSERT(result.get_decision_function().get_column_count() ==
+                      input.get_model().get_class_count() *
+                          (input.get_model().get_class_count() - 1) / 2);
     }
 
     template <typename Context>
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/svm/detail/serialization_ops.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+
+namespace oneapi::dal::svm::detail {
+namespace v1 {
+
+using dal::detail::serialize_table;
+using dal::detail::deserialize_table;
+
+template <typename Task>
+void serialization_ops<Task>::serialize(dal::detail::binary_output_archive& archive,
+                                        const model<Task>& m) const {
+    serialize_table(archive, m.get_support_vectors());
+    serialize_table(archive, m.get_coeffs());
+    archive.write(m.get_bias());
+    archive.write(m.get_first_class_label());
+    archive.write(m.get_second_class_label());
+    archive.write(m.get_class_count());
+    serialize_table(archive, m.get_biases());
+    serialize_table(archive, m.get_class_support_vector_counts());
+}
+
+template <typename Task>
+model<Task> serialization_ops<Task>::deserialize(
+    dal::detail::binary_input_archive& archive) const {
+    const auto support_vectors = deserialize_table(archive);
+    const auto coeffs = deserialize_table(archive);
+    const auto bias = archive.read<double>();
+    const auto first_class_label = archive.read<std::int64_t>();
+    const auto second_class_label = archive.read<std::int64_t>();
+
+    auto m = model<Task>{}
+                 .set_support_vectors(support_vectors)
+                 .set_coeffs(coeffs)
+                 .set_bias(bias)
+                 .set_first_class_label(first_class_label)
+                 .set_second_class_label(second_class_label);
+
+    // The multiclass model fields are written since the version 2 of the archive
+    if (archive.get_version() >= 2) {
+        m.set_class_count(archive.read<std::int64_t>());
+        m.set_biases(deserialize_table(archive));
+        m.set_class_support_vector_counts(deserialize_table(archive));
+    }
+    return m;
+}
+
+template struct ONEDAL_EXPORT serialization_ops<task::classification>;
+
+} // namespace v1
+} // namespace oneapi::dal::svm::detail
@@ -72,6 +72,9 @@ struct train_ops {
         ONEDAL_ASSERT(result.get_support_indices().get_row_count() ==
                       result.get_support_vector_count());
         ONEDAL_ASSERT(result.get_coeffs().get_row_count() == result.get_support_vector_count());
+        ONEDAL_ASSERT(result.get_model().get_class_count() == params.get_class_count());
+        ONEDAL_ASSERT(params.get_class_count() == 2 ||
+                      result.get_coeffs().get_column_count() == params.get_class_count() - 1);
     }
 
     template <typename Context>
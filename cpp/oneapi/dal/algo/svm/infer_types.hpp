@@ -97,7 +97,9 @@ public:
     }
 
     /// The $n \\times 1$ table with the predicted class
-    /// decision function for each observation
+    /// decision function for each observation. For the multiclass model,
+    /// the $n \\times k(k - 1)/2$ table with the decision functions of the
+    /// binary models in the order of :expr:`model.biases`
     /// @remark default = table{}
     const table& get_decision_function() const;
 
@@ -141,6 +141,21 @@ SVM_BADARG_TEST("throws if tau is zero") {
     REQUIRE_THROWS_AS(this->get_descriptor().set_tau(0), domain_error);
 }
 
+SVM_BADARG_TEST("accepts class_count greater than one") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_NOTHROW(this->get_descriptor().set_class_count(3));
+}
+
+SVM_BADARG_TEST("throws if class_count is one") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_THROWS_AS(this->get_descriptor().set_class_count(1), domain_error);
+}
+
+SVM_BADARG_TEST("throws if class_count is zero") {
+    SKIP_IF(this->not_available_on_device());
+    REQUIRE_THROWS_AS(this->get_descriptor().set_class_count(0), domain_error);
+}
+
 SVM_BADARG_TEST("throws if train data is empty") {
     SKIP_IF(this->not_available_on_device());
     const auto svm_desc = this->get_descriptor();
@@ -226,4 +241,27 @@ SVM_BADARG_TEST("throws if infer model coeffs rows neq support_vector count") {
     REQUIRE_THROWS_AS(this->infer(svm_desc, model, this->get_infer_data()), invalid_argument);
 }
 
+SVM_BADARG_TEST("throws if multiclass train labels are out of range") {
+    SKIP_IF(this->get_policy().is_gpu());
+    using float_t = std::tuple_element_t<0, TestType>;
+    const auto svm_desc = this->get_descriptor().set_class_count(3);
+
+    constexpr std::int64_t row_count = 8;
+    constexpr std::array<float_t, row_count> labels_data = { 0.0, 1.0, 2.0, 3.0,
+                                                             0.0, 1.0, 2.0, 3.0 };
+    const auto labels = homogen_table::wrap(labels_data.data(), row_count, 1);
+
+    REQUIRE_THROWS_AS(this->train(svm_desc, this->get_train_data(), labels), invalid_argument);
+}
+
+SVM_BADARG_TEST("throws if infer multiclass model coeffs cols neq class_count - 1") {
+    SKIP_IF(this->not_available_on_device());
+    const auto svm_desc = this->get_descriptor();
+    auto model =
+        this->train(svm_desc, this->get_train_data(), this->get_train_labels()).get_model();
+    model.set_class_count(3);
+
+    REQUIRE_THROWS_AS(this->infer(svm_desc, model, this->get_infer_data()), invalid_argument);
+}
+
 } // namespace oneapi::dal::svm::test
@@ -561,4 +561,62 @@ TEMPLATE_LIST_TEST_M(svm_batch_test,
                         decision_function);
 }
 
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm can classify three linear separable classes",
+                     "[svm][integration][batch][linear][multiclass]",
+                     svm_types) {
+    SKIP_IF(this->get_policy().is_gpu());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+
+    constexpr std::int64_t row_count_train = 9;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t element_count_train = row_count_train * column_count;
+    constexpr std::int64_t class_count = 3;
+
+    constexpr std::array<float_t, element_count_train> x_data = {
+        -2.0, -2.0, -3.0, -2.0, -2.0, -3.0, 2.0, -2.0, 3.0,
+        -2.0, 2.0,  -3.0, 0.0,  3.0,  1.0,  3.0, -1.0, 3.0,
+    };
+    const auto x = homogen_table::wrap(x_data.data(), row_count_train, column_count);
+
+    constexpr std::array<float_t, row_count_train> y_data = {
+        0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 2.0, 2.0,
+    };
+    const auto y = homogen_table::wrap(y_data.data(), row_count_train, 1);
+
+    const auto svm_desc = svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{}
+                              .set_c(1.0)
+                              .set_class_count(class_count);
+
+    INFO("run training");
+    const auto train_result = this->train(svm_desc, x, y);
+    const auto model = train_result.get_model();
+    const std::int64_t support_vector_count = model.get_support_vector_count();
+
+    INFO("check if multiclass model shape is expected");
+    REQUIRE(model.get_class_count() == class_count);
+    REQUIRE(support_vector_count > 0);
+    REQUIRE(support_vector_count <= row_count_train);
+    REQUIRE(model.get_coeffs().get_row_count() == support_vector_count);
+    REQUIRE(model.get_coeffs().get_column_count() == class_count - 1);
+    REQUIRE(model.get_biases().get_row_count() == class_count * (class_count - 1) / 2);
+    REQUIRE(model.get_class_support_vector_counts().get_row_count() == class_count);
+    REQUIRE(train_result.get_support_indices().get_row_count() == support_vector_count);
+    REQUIRE(te::has_no_nans(model.get_coeffs()));
+
+    INFO("run inference");
+    const auto infer_result = this->infer(svm_desc, model, x);
+
+    INFO("check if decision_function shape is expected");
+    REQUIRE(infer_result.get_decision_function().get_row_count() == row_count_train);
+    REQUIRE(infer_result.get_decision_function().get_column_count() ==
+            class_count * (class_count - 1) / 2);
+
+    INFO("check if labels values is expected");
+    this->check_table_match(y, infer_result.get_labels());
+}
+
 } // namespace oneapi::dal::svm::test
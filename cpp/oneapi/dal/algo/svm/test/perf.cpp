@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/svm/train.hpp"
+#include "oneapi/dal/algo/svm/infer.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::svm::test {
+
+namespace te = dal::test::engine;
+
+TEST("svm thunder 20K x 20", "[svm][perf]") {
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 20000, 20 }.fill_uniform(-1, 1));
+    const auto x = df.get_table(te::table_id::homogen<float>());
+    const auto y = te::make_binary_labels(x);
+
+    using linear_desc_t = linear_kernel::descriptor<float>;
+    using rbf_desc_t = rbf_kernel::descriptor<float>;
+    const auto linear_desc =
+        svm::descriptor<float, svm::method::thunder, svm::task::classification, linear_desc_t>{}
+            .set_c(1.0);
+    const auto rbf_desc =
+        svm::descriptor<float, svm::method::thunder, svm::task::classification, rbf_desc_t>{
+            rbf_desc_t{}.set_sigma(2.0)
+        }.set_c(1.0);
+    const auto rbf_model = dal::train(rbf_desc, x, y).get_model();
+
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
+    BENCHMARK("train linear kernel") {
+        return dal::train(linear_desc, x, y);
+    };
+
+    BENCHMARK("train rbf kernel") {
+        return dal::train(rbf_desc, x, y);
+    };
+
+    BENCHMARK("infer rbf kernel") {
+        return dal::infer(rbf_desc, rbf_model, x);
+    };
+}
+
+} // namespace oneapi::dal::svm::test
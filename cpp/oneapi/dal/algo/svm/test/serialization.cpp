@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/svm/infer.hpp"
+#include "oneapi/dal/algo/svm/train.hpp"
+#include "oneapi/dal/algo/svm/serialization.hpp"
+#include "oneapi/dal/algo/kmeans/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::svm::test {
+
+namespace te = dal::test::engine;
+
+template <typename Method>
+class svm_serialization_test : public te::algo_fixture {
+public:
+    static constexpr std::int64_t row_count = 200;
+    static constexpr std::int64_t column_count = 4;
+
+    svm_serialization_test() : data_(row_count * column_count), labels_(row_count) {
+        std::mt19937 rng(777);
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            float sum = 0.0f;
+            for (std::int64_t j = 0; j < column_count; j++) {
+                data_[i * column_count + j] = normal(rng);
+                sum += data_[i * column_count + j];
+            }
+            labels_[i] = sum + 0.5f * normal(rng) < 0.0f ? -1.0f : 1.0f;
+        }
+    }
+
+    bool not_available_on_device() {
+        return get_policy().is_gpu() && std::is_same_v<Method, svm::method::smo>;
+    }
+
+    auto get_descriptor() const {
+        return svm::descriptor<float, Method, svm::task::classification>{}.set_c(1.0);
+    }
+
+    table get_data() const {
+        return homogen_table::wrap(data_.data(), row_count, column_count);
+    }
+
+    table get_labels() const {
+        return homogen_table::wrap(labels_.data(), row_count, 1);
+    }
+
+    void check_tables_equal(const table& left, const table& right) {
+        REQUIRE(left.get_row_count() == right.get_row_count());
+        REQUIRE(left.get_column_count() == right.get_column_count());
+
+        const auto left_rows = row_accessor<const float>(left).pull();
+        const auto right_rows = row_accessor<const float>(right).pull();
+        for (std::int64_t i = 0; i < left_rows.get_count(); i++) {
+            REQUIRE(left_rows[i] == right_rows[i]);
+        }
+    }
+
+private:
+    std::vector<float> data_;
+    std::vector<float> labels_;
+};
+
+#define SVM_SERIALIZATION_TEST(name)        \
+    TEMPLATE_TEST_M(svm_serialization_test, \
+                    name,                   \
+                    "[svm][serialization]", \
+                    svm::method::thunder,   \
+                    svm::method::smo)
+
+SVM_SERIALIZATION_TEST("restored model gives the same inference results") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    const auto restored = deserialize<svm::model<>>(archive);
+    REQUIRE(restored.get_support_vector_count() == model.get_support_vector_count());
+
+    const auto result = this->infer(desc, model, this->get_data());
+    const auto restored_result = this->infer(desc, restored, this->get_data());
+    this->check_tables_equal(result.get_labels(), restored_result.get_labels());
+    this->check_tables_equal(result.get_decision_function(),
+                             restored_result.get_decision_function());
+}
+
+SVM_SERIALIZATION_TEST("throws if archive contains model of another type") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    REQUIRE_THROWS_AS(deserialize<kmeans::model<>>(archive), invalid_argument);
+}
+
+SVM_SERIALIZATION_TEST("throws if archive is truncated") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor();
+    const auto model = this->train(desc, this->get_data(), this->get_labels()).get_model();
+
+    const auto archive = serialize(model);
+    const auto truncated = array<byte_t>{ archive, archive.get_data(), archive.get_count() / 2 };
+    REQUIRE_THROWS_AS(deserialize<svm::model<>>(truncated), invalid_argument);
+}
+
+} // namespace oneapi::dal::svm::test
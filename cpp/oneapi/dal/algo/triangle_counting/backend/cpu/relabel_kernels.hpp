@@ -17,14 +17,12 @@
 #pragma once
 
 #include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/primitives/scan.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::preview::triangle_counting::backend {
 
-template <typename Index>
-inline Index min(const Index& a, const Index& b) {
-    return (a >= b) ? b : a;
-}
+namespace pr = dal::backend::primitives;
 
 template <typename Cpu>
 void sort_ids_by_degree(const std::int32_t* degrees,
@@ -53,40 +51,8 @@ void fill_new_degrees_and_ids(const std::pair<std::int32_t, std::size_t>* degree
 template <typename Cpu>
 void parallel_prefix_sum(const std::int32_t* degrees_relabel,
                          std::int64_t* offsets,
-                         std::int64_t* part_prefix,
-                         std::int64_t* local_sums,
-                         std::int64_t block_size,
-                         std::int64_t num_blocks,
                          std::int64_t vertex_count) {
-    dal::detail::threader_for(num_blocks, num_blocks, [&](std::int64_t block) {
-        std::int64_t local_sum = 0;
-        std::int64_t block_end = min((std::int64_t)((block + 1) * block_size), vertex_count);
-        PRAGMA_VECTOR_ALWAYS
-        for (std::int64_t i = block * block_size; i < block_end; i++) {
-            local_sum += degrees_relabel[i];
-        }
-        local_sums[block] = local_sum;
-    });
-
-    std::int64_t total = 0;
-    PRAGMA_VECTOR_ALWAYS
-    for (std::int64_t block = 0; block < num_blocks; block++) {
-        part_prefix[block] = total;
-        total += local_sums[block];
-    }
-    part_prefix[num_blocks] = total;
-
-    dal::detail::threader_for(num_blocks, num_blocks, [&](std::int64_t block) {
-        std::int64_t local_total = part_prefix[block];
-        std::int64_t block_end =
-            min((std::int64_t)((block + 1) * block_size), (std::int64_t)vertex_count);
-        for (std::int64_t i = block * block_size; i < block_end; i++) {
-            offsets[i] = local_total;
-            local_total += degrees_relabel[i];
-        }
-    });
-
-    offsets[vertex_count] = part_prefix[num_blocks];
+    offsets[vertex_count] = pr::exclusive_scan(degrees_relabel, offsets, vertex_count);
 }
 
 template <typename Cpu>
@@ -30,10 +30,6 @@ template void fill_new_degrees_and_ids<__CPU_TAG__>(
 
 template void parallel_prefix_sum<__CPU_TAG__>(const std::int32_t* degrees_relabel,
                                                std::int64_t* offsets,
-                                               std::int64_t* part_prefix,
-                                               std::int64_t* local_sums,
-                                               std::int64_t block_size,
-                                               std::int64_t num_blocks,
                                                std::int64_t vertex_count);
 
 template void fill_relabeled_topology<__CPU_TAG__>(const std::int32_t* vertex_neighbors,
@@ -115,19 +115,9 @@ void fill_new_degrees_and_ids(const dal::detail::host_policy& policy,
 void parallel_prefix_sum(const dal::detail::host_policy& policy,
                          const std::int32_t* degrees_relabel,
                          std::int64_t* offsets,
-                         std::int64_t* part_prefix,
-                         std::int64_t* local_sums,
-                         std::int64_t block_size,
-                         std::int64_t num_blocks,
                          std::int64_t vertex_count) {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::parallel_prefix_sum<decltype(cpu)>(degrees_relabel,
-                                                           offsets,
-                                                           part_prefix,
-                                                           local_sums,
-                                                           block_size,
-                                                           num_blocks,
-                                                           vertex_count);
+        return backend::parallel_prefix_sum<decltype(cpu)>(degrees_relabel, offsets, vertex_count);
     });
 }
 
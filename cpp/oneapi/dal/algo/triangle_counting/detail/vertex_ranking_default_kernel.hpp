@@ -75,10 +75,6 @@ ONEDAL_EXPORT void fill_new_degrees_and_ids(
 ONEDAL_EXPORT void parallel_prefix_sum(const dal::detail::host_policy& policy,
                                        const std::int32_t* degrees_relabel,
                                        std::int64_t* offsets,
-                                       std::int64_t* part_prefix,
-                                       std::int64_t* local_sums,
-                                       std::int64_t block_size,
-                                       std::int64_t num_blocks,
                                        std::int64_t vertex_count);
 
 ONEDAL_EXPORT void fill_relabeled_topology(const dal::detail::host_policy& policy,
@@ -129,23 +125,7 @@ inline void relabel_by_greater_degree(const dal::detail::host_policy& ctx,
     std::int64_t* offsets =
         oneapi::dal::preview::detail::allocate(int64_allocator, vertex_count + 1);
 
-    const size_t block_size = 1 << 20;
-    const std::int64_t num_blocks = (vertex_count + block_size - 1) / block_size;
-    std::int64_t* local_sums = oneapi::dal::preview::detail::allocate(int64_allocator, num_blocks);
-    std::int64_t* part_prefix =
-        oneapi::dal::preview::detail::allocate(int64_allocator, num_blocks + 1);
-
-    parallel_prefix_sum(ctx,
-                        degrees_relabel,
-                        offsets,
-                        part_prefix,
-                        local_sums,
-                        block_size,
-                        num_blocks,
-                        vertex_count);
-
-    oneapi::dal::preview::detail::deallocate(int64_allocator, local_sums, num_blocks);
-    oneapi::dal::preview::detail::deallocate(int64_allocator, part_prefix, num_blocks + 1);
+    parallel_prefix_sum(ctx, degrees_relabel, offsets, vertex_count);
 
     fill_relabeled_topology(ctx,
                             vertex_neighbors,
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <memory>
+
+#include "oneapi/dal/algo/triangle_counting.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_csv_data_source.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::test {
+
+namespace te = dal::test::engine;
+
+TEST("triangle counting 100K vertices, 2M edges", "[triangle_counting][perf]") {
+    constexpr std::int64_t vertex_count = 100000;
+    constexpr std::int64_t edge_count = 2000000;
+
+    const auto path = te::get_temp_file_path("triangle_counting_perf_graph.csv");
+    te::write_random_graph_csv(path, vertex_count, edge_count);
+    const auto graph =
+        dal::preview::load_graph::load(dal::preview::load_graph::descriptor<>{},
+                                       dal::preview::graph_csv_data_source{ path });
+
+    std::allocator<char> alloc;
+    const auto global_desc =
+        descriptor<float, method::ordered_count, task::global, std::allocator<char>>{ alloc }
+            .set_relabel(relabel::yes);
+    const auto local_desc =
+        descriptor<float, method::ordered_count, task::local, std::allocator<char>>{ alloc };
+
+    te::set_benchmark_workload(vertex_count, 0);
+
+    BENCHMARK("global") {
+        return dal::preview::vertex_ranking(global_desc, graph);
+    };
+
+    BENCHMARK("local") {
+        return dal::preview::vertex_ranking(local_desc, graph);
+    };
+}
+
+} // namespace oneapi::dal::preview::triangle_counting::test
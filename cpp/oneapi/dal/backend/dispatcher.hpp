@@ -50,10 +50,34 @@ private:
     detail::cpu_extension cpu_extensions_;
 };
 
+/// Notifies the allocator of the host policy about the operation that runs in the scope
+class host_operation_scope {
+public:
+    explicit host_operation_scope(const detail::host_policy& ctx)
+            : allocator_(ctx.get_allocator()) {
+        if (allocator_) {
+            allocator_->begin_operation();
+        }
+    }
+
+    ~host_operation_scope() {
+        if (allocator_) {
+            allocator_->end_operation();
+        }
+    }
+
+    host_operation_scope(const host_operation_scope&) = delete;
+    host_operation_scope& operator=(const host_operation_scope&) = delete;
+
+private:
+    std::shared_ptr<detail::host_allocator_iface> allocator_;
+};
+
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
+        const host_operation_scope scope{ ctx };
         return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
     }
 };
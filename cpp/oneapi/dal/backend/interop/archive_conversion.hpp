@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/data_management/data/homogen_numeric_table.h>
+
+#include "oneapi/dal/detail/archive.hpp"
+#include "oneapi/dal/backend/interop/daal_object_owner.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+/// Refers to the block of the archive by the DAAL shared pointer. DAAL has no notion
+/// of immutable data, the memory shall not be modified via the returned pointer.
+template <typename T>
+inline daal::services::SharedPtr<T> wrap_archive_block(const array<T>& block) {
+    return daal::services::SharedPtr<T>(const_cast<T*>(block.get_data()),
+                                        daal_object_owner{ block });
+}
+
+/// Writes the DAAL table to the archive as the row-major block of values of type ``T``.
+/// The empty pointer is written as the table with zero rows and columns.
+template <typename T>
+inline void serialize_daal_table(dal::detail::binary_output_archive& archive,
+                                 const daal::data_management::NumericTablePtr& nt) {
+    const std::int64_t row_count = nt ? nt->getNumberOfRows() : 0;
+    const std::int64_t column_count = nt ? nt->getNumberOfColumns() : 0;
+    archive.write(row_count);
+    archive.write(column_count);
+    if (row_count == 0 || column_count == 0) {
+        return;
+    }
+
+    const std::int64_t size_in_bytes = row_count * column_count * std::int64_t(sizeof(T));
+    if (auto homogen = dynamic_cast<daal::data_management::HomogenNumericTable<T>*>(nt.get())) {
+        archive.write_block(homogen->getArray(), size_in_bytes);
+    }
+    else if constexpr (std::is_floating_point_v<T> || std::is_same_v<T, int>) {
+        daal::data_management::BlockDescriptor<T> block;
+        status_to_exception(
+            nt->getBlockOfRows(0, row_count, daal::data_management::readOnly, block));
+        archive.write_block(block.getBlockPtr(), size_in_bytes);
+        status_to_exception(nt->releaseBlockOfRows(block));
+    }
+    else {
+        throw unimplemented(dal::detail::error_messages::unsupported_data_type());
+    }
+}
+
+/// Reads the table written by ``serialize_daal_table``. The returned table refers to the memory
+/// of the archive without copying. Returns the empty pointer for the empty table.
+template <typename T>
+inline daal::data_management::NumericTablePtr deserialize_daal_table(
+    dal::detail::binary_input_archive& archive) {
+    using error_msg = dal::detail::error_messages;
+
+    const auto row_count = archive.read<std::int64_t>();
+    const auto column_count = archive.read<std::int64_t>();
+    if (row_count == 0 || column_count == 0) {
+        return daal::data_management::NumericTablePtr();
+    }
+    if (row_count < 0 || column_count < 0) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    const auto block = archive.read_block<T>();
+    dal::detail::check_mul_overflow(row_count, column_count);
+    if (block.get_count() != row_count * column_count) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    daal::services::Status status;
+    const auto nt = daal::data_management::HomogenNumericTable<T>::create(
+        wrap_archive_block(block),
+        dal::detail::integral_cast<std::size_t>(column_count),
+        dal::detail::integral_cast<std::size_t>(row_count),
+        &status);
+    status_to_exception(status);
+    return nt;
+}
+
+} // namespace oneapi::dal::backend::interop
@@ -22,6 +22,7 @@
 
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/table/backend/interop/host_homogen_table_adapter.hpp"
+#include "oneapi/dal/table/backend/interop/host_csr_table_adapter.hpp"
 
 namespace oneapi::dal::backend::interop {
 
@@ -71,6 +72,9 @@ inline daal::data_management::NumericTablePtr wrap_by_host_homogen_adapter(
         case data_type::float32: return host_homogen_table_adapter<float>::create(table);
         case data_type::float64: return host_homogen_table_adapter<double>::create(table);
         case data_type::int32: return host_homogen_table_adapter<std::int32_t>::create(table);
+        // The kernels read 16-bit floating-point data by blocks converted to float
+        case data_type::bfloat16: return host_homogen_table_adapter<float>::create(table);
+        case data_type::float16: return host_homogen_table_adapter<float>::create(table);
         default: return daal::data_management::NumericTablePtr();
     }
 }
@@ -103,6 +107,74 @@ inline daal::data_management::NumericTablePtr convert_to_daal_table(const table&
     }
 }
 
+template <typename Float>
+inline daal_csr_table_ptr_t copy_to_daal_csr_table(const csr_table& table) {
+    const std::int64_t row_count = table.get_row_count();
+    const std::int64_t non_zero_count = table.get_non_zero_count();
+    const std::size_t shift = (table.get_indexing() == sparse_indexing::one_based) ? 0 : 1;
+
+    auto values = array<Float>::empty(non_zero_count);
+    auto column_indices = array<std::size_t>::empty(non_zero_count);
+    auto row_offsets = array<std::size_t>::empty(row_count + 1);
+
+    Float* dst_values = values.get_mutable_data();
+    std::size_t* dst_column_indices = column_indices.get_mutable_data();
+    std::size_t* dst_row_offsets = row_offsets.get_mutable_data();
+
+    const auto copy_values = [&](const auto* src) {
+        for (std::int64_t i = 0; i < non_zero_count; i++) {
+            dst_values[i] = static_cast<Float>(src[i]);
+        }
+    };
+    switch (table.get_metadata().get_data_type(0)) {
+        case data_type::float32: copy_values(table.get_data<float>()); break;
+        case data_type::float64: copy_values(table.get_data<double>()); break;
+        case data_type::int32: copy_values(table.get_data<std::int32_t>()); break;
+        default: throw dal::domain_error(dal::detail::error_messages::unsupported_data_type());
+    }
+
+    const std::int64_t* src_column_indices = table.get_column_indices();
+    for (std::int64_t i = 0; i < non_zero_count; i++) {
+        dst_column_indices[i] = static_cast<std::size_t>(src_column_indices[i]) + shift;
+    }
+    const std::int64_t* src_row_offsets = table.get_row_offsets();
+    for (std::int64_t i = 0; i < row_count + 1; i++) {
+        dst_row_offsets[i] = static_cast<std::size_t>(src_row_offsets[i]) + shift;
+    }
+
+    daal::services::Status status;
+    auto result = daal::data_management::CSRNumericTable::create(
+        daal::services::SharedPtr<Float>(dst_values, daal_object_owner{ values }),
+        daal::services::SharedPtr<std::size_t>(dst_column_indices,
+                                               daal_object_owner{ column_indices }),
+        daal::services::SharedPtr<std::size_t>(dst_row_offsets, daal_object_owner{ row_offsets }),
+        dal::detail::integral_cast<std::size_t>(table.get_column_count()),
+        dal::detail::integral_cast<std::size_t>(row_count),
+        daal::data_management::CSRNumericTableIface::oneBased,
+        &status);
+    status_to_exception(status);
+    return result;
+}
+
+/// Passes the sparse table to DAAL CSR kernels. The data is not copied unless
+/// the table uses zero-based indexing, which DAAL does not support
+template <typename Float>
+inline daal_csr_table_ptr_t convert_to_daal_csr_table(const csr_table& table) {
+    auto wrapper = wrap_by_host_csr_adapter(table);
+    if (!wrapper) {
+        return copy_to_daal_csr_table<Float>(table);
+    }
+    else {
+        return wrapper;
+    }
+}
+
+template <typename Float>
+inline daal_csr_table_ptr_t convert_to_daal_csr_table(const table& table) {
+    ONEDAL_ASSERT(table.get_kind() == csr_table::kind());
+    return convert_to_daal_csr_table<Float>(static_cast<const csr_table&>(table));
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 template <typename T>
 inline auto convert_to_daal_sycl_homogen_table(sycl::queue& queue,
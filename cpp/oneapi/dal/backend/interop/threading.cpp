@@ -119,4 +119,20 @@ ONEDAL_PARALLEL_SORT_SPECIALIZATION(pair_int32_t_size_t, daal::IdxValType<int>,
 
 #undef ONEDAL_PARALLEL_SORT_SPECIALIZATION
 
+#define ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION(TYPE, DAALTYPE, NAMESUFFIX) \
+    template <>                                                                   \
+    ONEDAL_EXPORT void parallel_segmented_sort(TYPE *data_ptr,                    \
+                                               const std::int64_t *offsets,       \
+                                               std::int64_t n_segments) {         \
+        static_assert(sizeof(TYPE) == sizeof(DAALTYPE));                          \
+        _daal_parallel_segmented_sort_##NAMESUFFIX((DAALTYPE *)data_ptr,          \
+                                                   (const int64_t *)offsets,      \
+                                                   n_segments);                   \
+    }
+
+ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION(std::int32_t, int, int32)
+ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION(std::int64_t, int64_t, int64)
+
+#undef ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION
+
 } // namespace oneapi::dal::detail
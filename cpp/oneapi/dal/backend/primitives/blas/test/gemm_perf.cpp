@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/src/externals/service_blas.h>
+
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+namespace te = dal::test::engine;
+namespace interop = dal::backend::interop;
+
+// The host counterpart of the `gemm 2K x 2K x 2K` benchmark, CPU kernels
+// multiply matrices via the BLAS wrappers of DAAL dispatched by CPU type
+TEST("host gemm 2K x 2K x 2K", "[gemm][perf]") {
+    constexpr std::int64_t m = 2048;
+    constexpr std::int64_t n = 2048;
+    constexpr std::int64_t k = 2048;
+
+    const auto a_df = GENERATE_DATAFRAME(te::dataframe_builder{ m, k }.fill_uniform(-1, 1));
+    const auto b_df = GENERATE_DATAFRAME(te::dataframe_builder{ k, n }.fill_uniform(-1, 1, 8888));
+    const float* a = a_df.get_array().get_data();
+    const float* b = b_df.get_array().get_data();
+    auto c = array<float>::zeros(m * n);
+    float* c_ptr = c.get_mutable_data();
+
+    te::set_benchmark_workload(m, (m * k + k * n + m * n) * std::int64_t(sizeof(float)));
+
+    BENCHMARK("gemm") {
+        dal::backend::dispatch_by_cpu(context_cpu{}, [&](auto cpu) {
+            constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+            using blas_t = daal::internal::Blas<float, daal_cpu>;
+            using size_type = typename blas_t::SizeType;
+
+            // Row-major C = A * B is column-major C^T = B^T * A^T
+            const char trans = 'N';
+            const size_type m_ = m, n_ = n, k_ = k;
+            const float alpha = 1.0f, beta = 0.0f;
+            blas_t::xgemm(&trans, &trans, &n_, &m_, &k_, &alpha, b, &n_, a, &k_, &beta, c_ptr, &n_);
+        });
+    };
+}
+
+} // namespace oneapi::dal::backend::primitives::test
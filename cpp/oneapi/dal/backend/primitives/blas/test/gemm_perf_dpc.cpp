@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/backend/primitives/blas/gemm.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+namespace te = dal::test::engine;
+
+TEST("gemm 2K x 2K x 2K", "[gemm][perf]") {
+    DECLARE_TEST_POLICY(policy);
+    auto& queue = policy.get_queue();
+    const auto alloc = sycl::usm::alloc::device;
+
+    constexpr std::int64_t m = 2048;
+    constexpr std::int64_t n = 2048;
+    constexpr std::int64_t k = 2048;
+
+    const auto a_df = GENERATE_DATAFRAME(te::dataframe_builder{ m, k }.fill_uniform(-1, 1));
+    const auto b_df = GENERATE_DATAFRAME(te::dataframe_builder{ k, n }.fill_uniform(-1, 1, 8888));
+    const auto a_table = a_df.get_table(policy, te::table_id::homogen<float>());
+    const auto b_table = b_df.get_table(policy, te::table_id::homogen<float>());
+
+    const auto a_ary = row_accessor<const float>{ a_table }.pull(queue, { 0, -1 }, alloc);
+    const auto b_ary = row_accessor<const float>{ b_table }.pull(queue, { 0, -1 }, alloc);
+    const auto a = ndarray<float, 2>::wrap(a_ary, { m, k });
+    const auto b = ndarray<float, 2>::wrap(b_ary, { k, n });
+    auto c = ndarray<float, 2>::empty(queue, { m, n }, alloc);
+
+    // We need to wait until all previously submitted kernels are executed
+    queue.wait_and_throw();
+
+    te::set_benchmark_workload(m, (m * k + k * n + m * n) * std::int64_t(sizeof(float)));
+
+    BENCHMARK("gemm") {
+        gemm(queue, a, b, c).wait_and_throw();
+    };
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/backend/primitives/ndarray.hpp"
 
 namespace oneapi::dal::backend::primitives {
@@ -146,4 +147,53 @@ inline void for_each_block(const table& data, std::int64_t block_max_row_count,
                    std::forward<Body>(body));
 }
 
+/// Splits the range of `count` elements into contiguous blocks that are processed
+/// in parallel by the CPU primitives. There are at most four blocks per thread and
+/// every block except the last one has at least `min_block_size` elements.
+class parallel_blocking {
+public:
+    parallel_blocking(std::int64_t count, std::int64_t min_block_size) : count_(count) {
+        ONEDAL_ASSERT(count >= 0);
+        ONEDAL_ASSERT(min_block_size > 0);
+
+        const std::int64_t max_block_count =
+            4 * std::int64_t(dal::detail::threader_get_max_threads());
+        block_count_ = std::max<std::int64_t>(1, std::min(count / min_block_size, max_block_count));
+        block_size_ = count / block_count_ + std::int64_t(count % block_count_ > 0);
+    }
+
+    std::int64_t get_block_count() const {
+        return block_count_;
+    }
+
+    std::int64_t get_block_start_index(std::int64_t block_index) const {
+        return std::min(block_index * block_size_, count_);
+    }
+
+    std::int64_t get_block_end_index(std::int64_t block_index) const {
+        return std::min((block_index + 1) * block_size_, count_);
+    }
+
+private:
+    std::int64_t count_;
+    std::int64_t block_count_;
+    std::int64_t block_size_;
+};
+
+/// Calls `body(block_index, start_index, end_index)` in parallel for every block of `blocking`
+template <typename Body>
+inline void for_each_block_parallel(const parallel_blocking& blocking, Body&& body) {
+    const std::int64_t block_count = blocking.get_block_count();
+    if (block_count == 1) {
+        body(std::int64_t(0), blocking.get_block_start_index(0), blocking.get_block_end_index(0));
+        return;
+    }
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block_index) {
+        body(std::int64_t(block_index),
+             blocking.get_block_start_index(block_index),
+             blocking.get_block_end_index(block_index));
+    });
+}
+
 } // namespace oneapi::dal::backend::primitives
@@ -15,3 +15,6 @@
 *******************************************************************************/
 
 #pragma once
+
+#include "oneapi/dal/backend/primitives/reduction/histogram.hpp"
+#include "oneapi/dal/backend/primitives/reduction/reduce.hpp"
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/primitives/loops.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The minimal number of elements in the block processed by one thread in the histogram
+constexpr std::int64_t histogram_min_block_size = 16384;
+
+/// Computes the histogram of the values: `histogram[k]` is set to the number of the
+/// elements `i` of the input such that `bin_of(src[i]) == k`. The blocks of the input are
+/// counted in parallel into their own histograms, which are summed in the order of the
+/// blocks. The blocks are at least as large as the histogram, so the memory needed for
+/// the histograms of the blocks does not exceed the size of the input.
+///
+/// @tparam BinOf The functor that accepts the element of the input and returns
+///               the index of its bin in the range [0, bin_count)
+///
+/// @param src       The input array of `count` elements
+/// @param count     The number of elements
+/// @param histogram The output array of `bin_count` elements
+/// @param bin_count The number of bins
+/// @param bin_of    The user-provided mapping of the values to the bins
+template <typename T, typename Count, typename BinOf>
+inline void histogram(const T* src,
+                      std::int64_t count,
+                      Count* histogram,
+                      std::int64_t bin_count,
+                      BinOf&& bin_of) {
+    ONEDAL_ASSERT(count >= 0);
+    ONEDAL_ASSERT(bin_count > 0);
+    ONEDAL_ASSERT(histogram);
+    ONEDAL_ASSERT(count == 0 || src);
+
+    const auto count_block = [&](std::int64_t first, std::int64_t last, Count* result) {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (std::int64_t k = 0; k < bin_count; k++) {
+            result[k] = Count(0);
+        }
+        for (std::int64_t i = first; i < last; i++) {
+            const std::int64_t k = std::int64_t(bin_of(src[i]));
+            ONEDAL_ASSERT(k >= 0 && k < bin_count, "Bin index is out of range");
+            ++result[k];
+        }
+    };
+
+    const parallel_blocking blocking{ count, std::max(histogram_min_block_size, bin_count) };
+    const std::int64_t block_count = blocking.get_block_count();
+    if (block_count == 1) {
+        count_block(0, count, histogram);
+        return;
+    }
+
+    auto local_histograms = array<Count>::empty(block_count * bin_count);
+    Count* local_histograms_ptr = local_histograms.get_mutable_data();
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        count_block(first, last, local_histograms_ptr + b * bin_count);
+    });
+
+    const auto sum_bins = [&](std::int64_t, std::int64_t first, std::int64_t last) {
+        for (std::int64_t k = first; k < last; k++) {
+            histogram[k] = local_histograms_ptr[k];
+        }
+        for (std::int64_t b = 1; b < block_count; b++) {
+            const Count* local_histogram = local_histograms_ptr + b * bin_count;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (std::int64_t k = first; k < last; k++) {
+                histogram[k] += local_histogram[k];
+            }
+        }
+    };
+
+    const parallel_blocking bin_blocking{ bin_count, histogram_min_block_size };
+    for_each_block_parallel(bin_blocking, sum_bins);
+}
+
+/// Computes the histogram of the integer values in the range [0, bin_count):
+/// `histogram[k]` is set to the number of the elements of the input equal to `k`
+template <typename T, typename Count>
+inline void histogram(const T* src, std::int64_t count, Count* histogram, std::int64_t bin_count) {
+    static_assert(std::is_integral_v<T>, "The values must be the indices of the bins");
+    primitives::histogram(src, count, histogram, bin_count, [](const T& value) {
+        return value;
+    });
+}
+
+template <typename T, typename Count, typename BinOf>
+inline void histogram(const ndview<T, 1>& src, ndview<Count, 1>& histogram, BinOf&& bin_of) {
+    ONEDAL_ASSERT(histogram.has_mutable_data());
+    primitives::histogram(src.get_data(),
+                          src.get_count(),
+                          histogram.get_mutable_data(),
+                          histogram.get_count(),
+                          std::forward<BinOf>(bin_of));
+}
+
+} // namespace oneapi::dal::backend::primitives
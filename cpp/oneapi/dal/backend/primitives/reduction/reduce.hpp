@@ -0,0 +1,274 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/backend/primitives/loops.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The minimal number of input elements processed by one thread in the reductions
+constexpr std::int64_t reduction_min_block_size = 16384;
+
+/// The minimal number of output elements computed by one thread in the reductions
+/// along the leading dimension of the long vectors
+constexpr std::int64_t reduction_min_output_block_size = 1024;
+
+template <typename T>
+struct sum {
+    static constexpr T init_value = T(0);
+
+    T operator()(const T& a, const T& b) const {
+        return a + b;
+    }
+};
+
+template <typename T>
+struct maximum {
+    static constexpr T init_value = std::numeric_limits<T>::lowest();
+
+    T operator()(const T& a, const T& b) const {
+        return (a < b) ? b : a;
+    }
+};
+
+template <typename T>
+struct minimum {
+    static constexpr T init_value = std::numeric_limits<T>::max();
+
+    T operator()(const T& a, const T& b) const {
+        return (b < a) ? b : a;
+    }
+};
+
+template <typename T>
+struct identity {
+    T operator()(const T& x) const {
+        return x;
+    }
+};
+
+template <typename T>
+struct square {
+    T operator()(const T& x) const {
+        return x * x;
+    }
+};
+
+template <typename T>
+struct absolute {
+    T operator()(const T& x) const {
+        return std::abs(x);
+    }
+};
+
+namespace impl {
+
+/// Returns the minimal number of the reduced vectors in the block processed by one thread
+inline std::int64_t get_min_vector_count(std::int64_t vector_size) {
+    const std::int64_t nonzero_vector_size = std::max<std::int64_t>(vector_size, 1);
+    return std::max<std::int64_t>(1, reduction_min_block_size / nonzero_vector_size);
+}
+
+/// Computes `output[i] = binary(..., unary(data[i * stride + j]), ...)` over `j < vector_size`
+/// for every `i < vector_count`. The reduced vectors are contiguous, so they are processed
+/// by the vectorized loops in parallel.
+template <typename T, typename BinaryOp, typename UnaryOp>
+inline void reduce_contiguous_vectors(const T* data,
+                                      std::int64_t vector_count,
+                                      std::int64_t vector_size,
+                                      std::int64_t stride,
+                                      T* output,
+                                      const BinaryOp& binary,
+                                      const UnaryOp& unary) {
+    const parallel_blocking blocking{ vector_count, get_min_vector_count(vector_size) };
+
+    for_each_block_parallel(blocking, [&](std::int64_t, std::int64_t first, std::int64_t last) {
+        for (std::int64_t i = first; i < last; i++) {
+            const T* vector = data + i * stride;
+            T result = BinaryOp::init_value;
+            PRAGMA_VECTOR_ALWAYS
+            for (std::int64_t j = 0; j < vector_size; j++) {
+                result = binary(result, unary(vector[j]));
+            }
+            output[i] = result;
+        }
+    });
+}
+
+/// Computes `output[j] = binary(..., unary(data[i * stride + j]), ...)` over `i < vector_count`
+/// for every `j < vector_size`. The long vectors are split by the elements, so every thread
+/// computes its part of the output. The short vectors are split into the blocks of vectors
+/// reduced in parallel into the partial results, which are combined in the order of the blocks.
+template <typename T, typename BinaryOp, typename UnaryOp>
+inline void reduce_strided_vectors(const T* data,
+                                   std::int64_t vector_count,
+                                   std::int64_t vector_size,
+                                   std::int64_t stride,
+                                   T* output,
+                                   const BinaryOp& binary,
+                                   const UnaryOp& unary) {
+    const auto reduce_block = [&](std::int64_t first,
+                                  std::int64_t last,
+                                  std::int64_t j_first,
+                                  std::int64_t j_last,
+                                  T* result) {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (std::int64_t j = j_first; j < j_last; j++) {
+            result[j] = BinaryOp::init_value;
+        }
+        for (std::int64_t i = first; i < last; i++) {
+            const T* vector = data + i * stride;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (std::int64_t j = j_first; j < j_last; j++) {
+                result[j] = binary(result[j], unary(vector[j]));
+            }
+        }
+    };
+
+    if (vector_size >= reduction_min_block_size) {
+        const auto reduce_output_block = [&](std::int64_t, std::int64_t first, std::int64_t last) {
+            reduce_block(0, vector_count, first, last, output);
+        };
+        const parallel_blocking output_blocking{ vector_size, reduction_min_output_block_size };
+        for_each_block_parallel(output_blocking, reduce_output_block);
+        return;
+    }
+
+    const parallel_blocking blocking{ vector_count, get_min_vector_count(vector_size) };
+    const std::int64_t block_count = blocking.get_block_count();
+    if (block_count == 1) {
+        reduce_block(0, vector_count, 0, vector_size, output);
+        return;
+    }
+
+    auto partials = array<T>::empty(block_count * vector_size);
+    T* partials_ptr = partials.get_mutable_data();
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        reduce_block(first, last, 0, vector_size, partials_ptr + b * vector_size);
+    });
+
+    for (std::int64_t j = 0; j < vector_size; j++) {
+        output[j] = partials_ptr[j];
+    }
+    for (std::int64_t b = 1; b < block_count; b++) {
+        const T* partial = partials_ptr + b * vector_size;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (std::int64_t j = 0; j < vector_size; j++) {
+            output[j] = binary(output[j], partial[j]);
+        }
+    }
+}
+
+} // namespace impl
+
+/// Reduces every row of the matrix: `output[i] = binary(..., unary(input(i, j)), ...)`
+/// over all the columns `j`. The rows are reduced in parallel.
+///
+/// @tparam BinaryOp The reduction functor with the static `init_value` member, e.g. `sum<T>`
+/// @tparam UnaryOp  The functor applied to the elements before the reduction, e.g. `square<T>`
+///
+/// @param input  The matrix of `row_count x column_count` elements
+/// @param output The vector of `row_count` elements
+template <typename T,
+          ndorder order,
+          typename BinaryOp = sum<T>,
+          typename UnaryOp = identity<T>>
+inline void reduce_by_rows(const ndview<T, 2, order>& input,
+                           ndview<T, 1>& output,
+                           const BinaryOp& binary = BinaryOp{},
+                           const UnaryOp& unary = UnaryOp{}) {
+    ONEDAL_ASSERT(input.has_data());
+    ONEDAL_ASSERT(output.has_mutable_data());
+    ONEDAL_ASSERT(output.get_count() == input.get_dimension(0));
+
+    const std::int64_t row_count = input.get_dimension(0);
+    const std::int64_t column_count = input.get_dimension(1);
+    const std::int64_t stride = input.get_leading_stride();
+    T* output_ptr = output.get_mutable_data();
+
+    if constexpr (order == ndorder::c) {
+        impl::reduce_contiguous_vectors(input.get_data(),
+                                        row_count,
+                                        column_count,
+                                        stride,
+                                        output_ptr,
+                                        binary,
+                                        unary);
+    }
+    else {
+        impl::reduce_strided_vectors(input.get_data(),
+                                     column_count,
+                                     row_count,
+                                     stride,
+                                     output_ptr,
+                                     binary,
+                                     unary);
+    }
+}
+
+/// Reduces every column of the matrix: `output[j] = binary(..., unary(input(i, j)), ...)`
+/// over all the rows `i`. The columns are reduced in parallel.
+///
+/// @tparam BinaryOp The reduction functor with the static `init_value` member, e.g. `sum<T>`
+/// @tparam UnaryOp  The functor applied to the elements before the reduction, e.g. `square<T>`
+///
+/// @param input  The matrix of `row_count x column_count` elements
+/// @param output The vector of `column_count` elements
+template <typename T,
+          ndorder order,
+          typename BinaryOp = sum<T>,
+          typename UnaryOp = identity<T>>
+inline void reduce_by_columns(const ndview<T, 2, order>& input,
+                              ndview<T, 1>& output,
+                              const BinaryOp& binary = BinaryOp{},
+                              const UnaryOp& unary = UnaryOp{}) {
+    ONEDAL_ASSERT(input.has_data());
+    ONEDAL_ASSERT(output.has_mutable_data());
+    ONEDAL_ASSERT(output.get_count() == input.get_dimension(1));
+
+    const std::int64_t row_count = input.get_dimension(0);
+    const std::int64_t column_count = input.get_dimension(1);
+    const std::int64_t stride = input.get_leading_stride();
+    T* output_ptr = output.get_mutable_data();
+
+    if constexpr (order == ndorder::c) {
+        impl::reduce_strided_vectors(input.get_data(),
+                                     row_count,
+                                     column_count,
+                                     stride,
+                                     output_ptr,
+                                     binary,
+                                     unary);
+    }
+    else {
+        impl::reduce_contiguous_vectors(input.get_data(),
+                                        column_count,
+                                        row_count,
+                                        stride,
+                                        output_ptr,
+                                        binary,
+                                        unary);
+    }
+}
+
+} // namespace oneapi::dal::backend::primitives
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/primitives/reduction.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+TEST("histogram counts integer values", "[histogram]") {
+    const std::int64_t count = GENERATE(0, 1, 17, 16384, 100003);
+    const std::int64_t bin_count = GENERATE(1, 10, 70000);
+
+    std::vector<std::int32_t> src(count);
+    std::vector<std::int64_t> expected(bin_count, 0);
+    for (std::int64_t i = 0; i < count; i++) {
+        src[i] = std::int32_t((i * 7919) % bin_count);
+        ++expected[src[i]];
+    }
+    std::vector<std::int64_t> result(bin_count, -1);
+
+    histogram(src.data(), count, result.data(), bin_count);
+
+    REQUIRE(result == expected);
+}
+
+TEST("histogram maps values to bins", "[histogram]") {
+    const std::int64_t count = 100003;
+    const std::int64_t bin_count = 4;
+
+    std::vector<float> src(count);
+    std::vector<std::int32_t> expected(bin_count, 0);
+    for (std::int64_t i = 0; i < count; i++) {
+        src[i] = float(i % 100) / 100.0f;
+        ++expected[std::int64_t(src[i] * bin_count)];
+    }
+    std::vector<std::int32_t> result(bin_count);
+    const auto src_view = ndview<float, 1>::wrap(src.data(), { count });
+    auto result_view = ndview<std::int32_t, 1>::wrap(result.data(), { bin_count });
+
+    histogram(src_view, result_view, [&](float x) {
+        return std::int64_t(x * bin_count);
+    });
+
+    REQUIRE(result == expected);
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/primitives/reduction.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+class reduce_test {
+public:
+    std::vector<double> generate_matrix(std::int64_t row_count, std::int64_t column_count) const {
+        std::vector<double> data(row_count * column_count);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            data[i] = double(std::int64_t(i * 7919) % 101 - 50);
+        }
+        return data;
+    }
+
+    template <typename BinaryOp, typename UnaryOp>
+    std::vector<double> reduce_by_rows_naive(const std::vector<double>& data,
+                                             std::int64_t row_count,
+                                             std::int64_t column_count,
+                                             const BinaryOp& binary,
+                                             const UnaryOp& unary) const {
+        std::vector<double> result(row_count, BinaryOp::init_value);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                result[i] = binary(result[i], unary(data[i * column_count + j]));
+            }
+        }
+        return result;
+    }
+
+    template <typename BinaryOp, typename UnaryOp>
+    std::vector<double> reduce_by_columns_naive(const std::vector<double>& data,
+                                                std::int64_t row_count,
+                                                std::int64_t column_count,
+                                                const BinaryOp& binary,
+                                                const UnaryOp& unary) const {
+        std::vector<double> result(column_count, BinaryOp::init_value);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                result[j] = binary(result[j], unary(data[i * column_count + j]));
+            }
+        }
+        return result;
+    }
+
+    template <typename BinaryOp, typename UnaryOp>
+    void check_reductions(std::int64_t row_count,
+                          std::int64_t column_count,
+                          const BinaryOp& binary,
+                          const UnaryOp& unary) const {
+        // The values are integers, so the sums are exact for any order of the reduction
+        const auto data = generate_matrix(row_count, column_count);
+        const auto x = ndview<double, 2>::wrap(data.data(), { row_count, column_count });
+        const auto x_t = x.t();
+
+        const auto row_result = reduce_by_rows_naive(data, row_count, column_count, binary, unary);
+        const auto column_result =
+            reduce_by_columns_naive(data, row_count, column_count, binary, unary);
+
+        std::vector<double> rows(row_count);
+        std::vector<double> columns(column_count);
+        auto rows_view = ndview<double, 1>::wrap(rows.data(), { row_count });
+        auto columns_view = ndview<double, 1>::wrap(columns.data(), { column_count });
+
+        SECTION("c-order") {
+            reduce_by_rows(x, rows_view, binary, unary);
+            reduce_by_columns(x, columns_view, binary, unary);
+            REQUIRE(rows == row_result);
+            REQUIRE(columns == column_result);
+        }
+
+        SECTION("f-order") {
+            reduce_by_rows(x_t, columns_view, binary, unary);
+            reduce_by_columns(x_t, rows_view, binary, unary);
+            REQUIRE(rows == row_result);
+            REQUIRE(columns == column_result);
+        }
+    }
+};
+
+TEST_M(reduce_test, "sum of squares on tall matrix", "[reduction]") {
+    const std::int64_t row_count = GENERATE(1, 7, 100003);
+    check_reductions(row_count, 5, sum<double>{}, square<double>{});
+}
+
+TEST_M(reduce_test, "sum on wide matrix", "[reduction]") {
+    const std::int64_t column_count = GENERATE(3, 20000);
+    check_reductions(13, column_count, sum<double>{}, identity<double>{});
+}
+
+TEST_M(reduce_test, "minimum and maximum of absolute values", "[reduction]") {
+    const std::int64_t row_count = GENERATE(1, 50000);
+
+    SECTION("minimum") {
+        check_reductions(row_count, 3, minimum<double>{}, absolute<double>{});
+    }
+
+    SECTION("maximum") {
+        check_reductions(row_count, 3, maximum<double>{}, absolute<double>{});
+    }
+}
+
+} // namespace oneapi::dal::backend::primitives::test
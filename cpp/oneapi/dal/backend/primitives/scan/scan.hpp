@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/primitives/loops.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The minimal number of elements in the block processed by one thread in the scan
+constexpr std::int64_t scan_min_block_size = 16384;
+
+namespace impl {
+
+template <typename T, typename Out>
+inline Out sum_block(const T* src, std::int64_t start_index, std::int64_t end_index) {
+    Out sum = Out(0);
+    PRAGMA_VECTOR_ALWAYS
+    for (std::int64_t i = start_index; i < end_index; i++) {
+        sum += static_cast<Out>(src[i]);
+    }
+    return sum;
+}
+
+template <bool is_inclusive, typename T, typename Out>
+inline Out scan_block(const T* src,
+                      Out* dst,
+                      std::int64_t start_index,
+                      std::int64_t end_index,
+                      Out sum) {
+    for (std::int64_t i = start_index; i < end_index; i++) {
+        // The value is read before the write, so `src` and `dst` can be the same array
+        const Out value = static_cast<Out>(src[i]);
+        if constexpr (is_inclusive) {
+            sum += value;
+            dst[i] = sum;
+        }
+        else {
+            dst[i] = sum;
+            sum += value;
+        }
+    }
+    return sum;
+}
+
+template <bool is_inclusive, typename T, typename Out>
+inline Out scan(const T* src, Out* dst, std::int64_t count) {
+    ONEDAL_ASSERT(count >= 0);
+    if (count == 0) {
+        return Out(0);
+    }
+    ONEDAL_ASSERT(src);
+    ONEDAL_ASSERT(dst);
+
+    const parallel_blocking blocking{ count, scan_min_block_size };
+    const std::int64_t block_count = blocking.get_block_count();
+    if (block_count == 1) {
+        return scan_block<is_inclusive>(src, dst, 0, count, Out(0));
+    }
+
+    // The sums of the blocks are computed in parallel, their scan gives
+    // the initial value of every block for the second parallel pass
+    auto block_offsets = array<Out>::empty(block_count);
+    Out* block_offsets_ptr = block_offsets.get_mutable_data();
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        block_offsets_ptr[b] = sum_block<T, Out>(src, first, last);
+    });
+
+    const Out total =
+        scan_block<false>(block_offsets_ptr, block_offsets_ptr, 0, block_count, Out(0));
+
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        scan_block<is_inclusive>(src, dst, first, last, block_offsets_ptr[b]);
+    });
+    return total;
+}
+
+} // namespace impl
+
+/// Computes the inclusive prefix sum `dst[i] = src[0] + ... + src[i]` of `count` elements
+/// in parallel. The sums are accumulated in the type of the output, so it may be wider than
+/// the input type. The input and the output may be the same array.
+///
+/// @param src   The input array of `count` elements
+/// @param dst   The output array of `count` elements
+/// @param count The number of elements
+///
+/// @return The sum of all the elements of the input
+template <typename T, typename Out>
+inline Out inclusive_scan(const T* src, Out* dst, std::int64_t count) {
+    return impl::scan<true>(src, dst, count);
+}
+
+/// Computes the exclusive prefix sum `dst[i] = src[0] + ... + src[i - 1]`, `dst[0] = 0`,
+/// of `count` elements in parallel. The returned sum of all the elements is the value
+/// that follows the last output element, e.g. the last offset of the CSR layout:
+/// @code
+/// offsets[count] = exclusive_scan(degrees, offsets, count);
+/// @endcode
+///
+/// @param src   The input array of `count` elements
+/// @param dst   The output array of `count` elements
+/// @param count The number of elements
+///
+/// @return The sum of all the elements of the input
+template <typename T, typename Out>
+inline Out exclusive_scan(const T* src, Out* dst, std::int64_t count) {
+    return impl::scan<false>(src, dst, count);
+}
+
+template <typename T, typename Out>
+inline Out inclusive_scan(const ndview<T, 1>& src, ndview<Out, 1>& dst) {
+    ONEDAL_ASSERT(src.get_count() == dst.get_count());
+    return inclusive_scan(src.get_data(), dst.get_mutable_data(), src.get_count());
+}
+
+template <typename T, typename Out>
+inline Out exclusive_scan(const ndview<T, 1>& src, ndview<Out, 1>& dst) {
+    ONEDAL_ASSERT(src.get_count() == dst.get_count());
+    return exclusive_scan(src.get_data(), dst.get_mutable_data(), src.get_count());
+}
+
+} // namespace oneapi::dal::backend::primitives
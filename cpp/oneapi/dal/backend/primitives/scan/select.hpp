@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/primitives/scan/scan.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The minimal number of elements in the block processed by one thread in the selection
+constexpr std::int64_t select_min_block_size = 16384;
+
+/// Copies the elements of `src` that satisfy `predicate` to the beginning of `dst`
+/// preserving their order (stream compaction). The blocks of the input are processed
+/// in parallel: the selected elements of every block are counted first, the exclusive
+/// scan of the counts gives the position of every block in the output.
+/// The predicate is called twice for every element, so it must not have side effects.
+///
+/// @tparam Predicate The functor that accepts the element of the input and returns `bool`
+///
+/// @param src       The input array of `count` elements
+/// @param dst       The output array of at least `count` elements that does not overlap the input
+/// @param count     The number of elements
+/// @param predicate The user-provided selection criterion
+///
+/// @return The number of the selected elements
+template <typename T, typename Predicate>
+inline std::int64_t select_if(const T* src, T* dst, std::int64_t count, Predicate&& predicate) {
+    ONEDAL_ASSERT(count >= 0);
+    if (count == 0) {
+        return 0;
+    }
+    ONEDAL_ASSERT(src);
+    ONEDAL_ASSERT(dst);
+    ONEDAL_ASSERT(dst + count <= src || src + count <= dst, "Input and output overlap");
+
+    const auto select_block = [&](std::int64_t first, std::int64_t last, std::int64_t offset) {
+        for (std::int64_t i = first; i < last; i++) {
+            if (predicate(src[i])) {
+                dst[offset++] = src[i];
+            }
+        }
+        return offset;
+    };
+
+    const parallel_blocking blocking{ count, select_min_block_size };
+    const std::int64_t block_count = blocking.get_block_count();
+    if (block_count == 1) {
+        return select_block(0, count, 0);
+    }
+
+    auto block_offsets = array<std::int64_t>::empty(block_count);
+    std::int64_t* block_offsets_ptr = block_offsets.get_mutable_data();
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        std::int64_t selected_count = 0;
+        for (std::int64_t i = first; i < last; i++) {
+            selected_count += std::int64_t(bool(predicate(src[i])));
+        }
+        block_offsets_ptr[b] = selected_count;
+    });
+
+    const std::int64_t total = exclusive_scan(block_offsets_ptr, block_offsets_ptr, block_count);
+
+    for_each_block_parallel(blocking, [&](std::int64_t b, std::int64_t first, std::int64_t last) {
+        select_block(first, last, block_offsets_ptr[b]);
+    });
+    return total;
+}
+
+template <typename T, typename Predicate>
+inline std::int64_t select_if(const ndview<T, 1>& src, ndview<T, 1>& dst, Predicate&& predicate) {
+    ONEDAL_ASSERT(src.get_count() <= dst.get_count());
+    return select_if(src.get_data(),
+                     dst.get_mutable_data(),
+                     src.get_count(),
+                     std::forward<Predicate>(predicate));
+}
+
+} // namespace oneapi::dal::backend::primitives
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <numeric>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/primitives/scan.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+class scan_test {
+public:
+    std::vector<std::int32_t> generate_values(std::int64_t count) const {
+        std::vector<std::int32_t> values(count);
+        for (std::int64_t i = 0; i < count; i++) {
+            values[i] = std::int32_t((i * 7919) % 101) - 17;
+        }
+        return values;
+    }
+
+    template <typename T, typename Out>
+    void check_inclusive_scan(const std::vector<T>& src, const std::vector<Out>& dst) const {
+        Out sum = Out(0);
+        for (std::size_t i = 0; i < src.size(); i++) {
+            sum += Out(src[i]);
+            if (dst[i] != sum) {
+                CAPTURE(i, dst[i], sum);
+                FAIL();
+            }
+        }
+    }
+
+    template <typename T, typename Out>
+    void check_exclusive_scan(const std::vector<T>& src, const std::vector<Out>& dst) const {
+        Out sum = Out(0);
+        for (std::size_t i = 0; i < src.size(); i++) {
+            if (dst[i] != sum) {
+                CAPTURE(i, dst[i], sum);
+                FAIL();
+            }
+            sum += Out(src[i]);
+        }
+    }
+};
+
+TEST_M(scan_test, "inclusive scan computes prefix sums", "[scan]") {
+    const std::int64_t count = GENERATE(0, 1, 17, 16384, 100003);
+    const auto src = generate_values(count);
+    std::vector<std::int64_t> dst(count);
+
+    const std::int64_t total = inclusive_scan(src.data(), dst.data(), count);
+
+    check_inclusive_scan(src, dst);
+    REQUIRE(total == std::accumulate(src.begin(), src.end(), std::int64_t(0)));
+}
+
+TEST_M(scan_test, "exclusive scan computes prefix sums", "[scan]") {
+    const std::int64_t count = GENERATE(0, 1, 17, 16384, 100003);
+    const auto src = generate_values(count);
+    std::vector<std::int64_t> dst(count);
+
+    const std::int64_t total = exclusive_scan(src.data(), dst.data(), count);
+
+    check_exclusive_scan(src, dst);
+    REQUIRE(total == std::accumulate(src.begin(), src.end(), std::int64_t(0)));
+}
+
+TEST_M(scan_test, "scan can be computed in place", "[scan]") {
+    const std::int64_t count = GENERATE(17, 100003);
+    const auto src = generate_values(count);
+    auto dst = src;
+
+    SECTION("inclusive") {
+        inclusive_scan(dst.data(), dst.data(), count);
+        check_inclusive_scan(src, dst);
+    }
+
+    SECTION("exclusive") {
+        exclusive_scan(dst.data(), dst.data(), count);
+        check_exclusive_scan(src, dst);
+    }
+}
+
+TEST_M(scan_test, "exclusive scan reads atomic values", "[scan]") {
+    const std::int64_t count = 100003;
+    const auto src = generate_values(count);
+    std::vector<std::atomic<std::int32_t>> atomic_src(count);
+    for (std::int64_t i = 0; i < count; i++) {
+        atomic_src[i] = src[i];
+    }
+    std::vector<std::int64_t> dst(count);
+
+    exclusive_scan(atomic_src.data(), dst.data(), count);
+
+    check_exclusive_scan(src, dst);
+}
+
+TEST_M(scan_test, "scan accepts ndview", "[scan]") {
+    const std::int64_t count = 100;
+    const auto src = generate_values(count);
+    std::vector<std::int64_t> dst(count);
+    const auto src_view = ndview<std::int32_t, 1>::wrap(src.data(), { count });
+    auto dst_view = ndview<std::int64_t, 1>::wrap(dst.data(), { count });
+
+    exclusive_scan(src_view, dst_view);
+
+    check_exclusive_scan(src, dst);
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/primitives/scan.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+TEST("select_if keeps the order of the selected elements", "[select]") {
+    const std::int64_t count = GENERATE(0, 1, 17, 16384, 100003);
+    const auto is_selected = [](std::int64_t x) {
+        return x % 3 != 0;
+    };
+
+    std::vector<std::int64_t> src(count);
+    for (std::int64_t i = 0; i < count; i++) {
+        src[i] = (i * 7919) % 1009;
+    }
+    std::vector<std::int64_t> expected;
+    std::copy_if(src.begin(), src.end(), std::back_inserter(expected), is_selected);
+    std::vector<std::int64_t> dst(count);
+
+    const std::int64_t selected_count = select_if(src.data(), dst.data(), count, is_selected);
+
+    REQUIRE(selected_count == std::int64_t(expected.size()));
+    REQUIRE(std::equal(expected.begin(), expected.end(), dst.begin()));
+}
+
+TEST("select_if selects nothing and everything", "[select]") {
+    const std::int64_t count = 100003;
+    std::vector<float> src(count, 1.0f);
+    std::vector<float> dst(count, 0.0f);
+
+    SECTION("nothing") {
+        const auto selected_count = select_if(src.data(), dst.data(), count, [](float x) {
+            return x < 0.0f;
+        });
+        REQUIRE(selected_count == 0);
+        REQUIRE(std::all_of(dst.begin(), dst.end(), [](float x) {
+            return x == 0.0f;
+        }));
+    }
+
+    SECTION("everything") {
+        const auto selected_count = select_if(src.data(), dst.data(), count, [](float x) {
+            return x > 0.0f;
+        });
+        REQUIRE(selected_count == count);
+        REQUIRE(dst == src);
+    }
+}
+
+} // namespace oneapi::dal::backend::primitives::test
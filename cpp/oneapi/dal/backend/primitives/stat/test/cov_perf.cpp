@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/include/algorithms/covariance/covariance_batch.h>
+#include <daal/include/data_management/data/homogen_numeric_table.h>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+namespace te = dal::test::engine;
+namespace daal_cov = daal::algorithms::covariance;
+namespace daal_dm = daal::data_management;
+
+// The host counterpart of the `400K x 1K` benchmark, CPU kernels compute
+// the correlation matrix via the covariance algorithm of DAAL
+TEST("host 400K x 1K", "[cor][perf]") {
+    // 4 x 400K x 1K ~ 1.526Gb
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 400000, 1000 }.fill_uniform(-1, 1));
+
+    const auto data = daal_dm::HomogenNumericTable<float>::create(
+        const_cast<float*>(df.get_array().get_data()),
+        df.get_column_count(),
+        df.get_row_count());
+
+    daal_cov::Batch<float, daal_cov::defaultDense> algorithm;
+    algorithm.input.set(daal_cov::data, data);
+    algorithm.parameter.outputMatrixType = daal_cov::correlationMatrix;
+
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
+    BENCHMARK("correlation") {
+        REQUIRE(algorithm.compute().ok());
+    };
+}
+
+} // namespace oneapi::dal::backend::primitives::test
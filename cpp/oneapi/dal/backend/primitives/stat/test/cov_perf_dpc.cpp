@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
 #include "oneapi/dal/test/engine/fixtures.hpp"
 #include "oneapi/dal/test/engine/dataframe.hpp"
 #include "oneapi/dal/test/engine/math.hpp"
@@ -51,6 +52,8 @@ TEST("400K x 1K", "[cor][perf]") {
     // We need to wait until all previously submitted kernels are executed
     queue.wait_and_throw();
 
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
     BENCHMARK("correlation") {
         correlation(queue, data, sums, corr, means, vars, tmp, { sums_event }).wait_and_throw();
     };
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <utility>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -72,7 +73,113 @@ enum class data_type {
     uint64,
     float32,
     float64,
-    bfloat16
+    bfloat16,
+    float16
+};
+
+/// The 16-bit brain floating-point type that can be used to store the data in
+/// tables. It has the exponent range of :expr:`float` and 8 bits of precision.
+/// The algorithms convert the values to :expr:`float` before computations.
+struct bfloat16 {
+    bfloat16() = default;
+
+    /// Rounds the value to the nearest representable one, ties to even
+    explicit bfloat16(float value) {
+        std::uint32_t u;
+        std::memcpy(&u, &value, sizeof(u));
+        if ((u & 0x7fffffffu) > 0x7f800000u) {
+            // Keep NaN quiet, the rounding could turn it to infinity
+            bits = std::uint16_t((u >> 16) | 0x40u);
+        }
+        else {
+            bits = std::uint16_t((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+        }
+    }
+
+    explicit operator float() const {
+        const std::uint32_t u = std::uint32_t(bits) << 16;
+        float value;
+        std::memcpy(&value, &u, sizeof(value));
+        return value;
+    }
+
+    std::uint16_t bits;
+};
+
+/// The 16-bit IEEE 754 half-precision floating-point type that can be used to
+/// store the data in tables. The algorithms convert the values to :expr:`float`
+/// before computations.
+struct float16 {
+    float16() = default;
+
+    /// Rounds the value to the nearest representable one, ties to even.
+    /// The values that exceed the range of the type are converted to infinity.
+    explicit float16(float value) {
+        std::uint32_t u;
+        std::memcpy(&u, &value, sizeof(u));
+        const std::uint32_t sign = (u >> 16) & 0x8000u;
+        const std::uint32_t abs = u & 0x7fffffffu;
+
+        if (abs > 0x7f800000u) {
+            bits = std::uint16_t(sign | 0x7e00u);
+        }
+        else if (abs >= 0x47800000u) {
+            bits = std::uint16_t(sign | 0x7c00u);
+        }
+        else if (abs >= 0x38800000u) {
+            // Normal number: rebias the exponent and round the mantissa to 10 bits
+            std::uint32_t h = (abs >> 13) - (112u << 10);
+            const std::uint32_t rest = abs & 0x1fffu;
+            h += (rest > 0x1000u || (rest == 0x1000u && (h & 1u))) ? 1u : 0u;
+            bits = std::uint16_t(sign | h);
+        }
+        else if (abs >= 0x33000000u) {
+            // Subnormal number: the value is the mantissa with the implicit bit
+            // shifted right by [14, 24] bits
+            const std::uint32_t shift = 126u - (abs >> 23);
+            const std::uint32_t mantissa = (abs & 0x7fffffu) | 0x800000u;
+            std::uint32_t h = mantissa >> shift;
+            const std::uint32_t rest = mantissa & ((1u << shift) - 1u);
+            const std::uint32_t halfway = 1u << (shift - 1u);
+            h += (rest > halfway || (rest == halfway && (h & 1u))) ? 1u : 0u;
+            bits = std::uint16_t(sign | h);
+        }
+        else {
+            bits = std::uint16_t(sign);
+        }
+    }
+
+    explicit operator float() const {
+        const std::uint32_t sign = std::uint32_t(bits & 0x8000u) << 16;
+        const std::uint32_t exponent = (bits >> 10) & 0x1fu;
+        std::uint32_t mantissa = bits & 0x3ffu;
+
+        std::uint32_t u;
+        if (exponent == 0x1fu) {
+            u = sign | 0x7f800000u | (mantissa << 13);
+        }
+        else if (exponent != 0) {
+            u = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+        }
+        else if (mantissa == 0) {
+            u = sign;
+        }
+        else {
+            // Subnormal number is normalized in single precision
+            std::uint32_t e = 113;
+            while ((mantissa & 0x400u) == 0) {
+                mantissa <<= 1;
+                e--;
+            }
+            u = sign | (e << 23) | ((mantissa & 0x3ffu) << 13);
+        }
+
+        float value;
+        std::memcpy(&value, &u, sizeof(value));
+        return value;
+    }
+
+    std::uint16_t bits;
 };
 
 struct range {
@@ -94,6 +201,8 @@ public:
 using v1::byte_t;
 using v1::base;
 using v1::data_type;
+using v1::bfloat16;
+using v1::float16;
 using v1::range;
 
 } // namespace oneapi::dal
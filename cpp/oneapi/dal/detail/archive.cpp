@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "oneapi/dal/detail/archive.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+using error_msg = dal::detail::error_messages;
+
+static constexpr char archive_magic[8] = { 'o', 'n', 'e', 'D', 'A', 'L', '\0', '\0' };
+
+static std::int64_t get_padding(std::int64_t offset) {
+    const std::int64_t remainder = offset % binary_archive_alignment;
+    return remainder ? binary_archive_alignment - remainder : 0;
+}
+
+binary_output_archive::binary_output_archive(std::int64_t object_tag) : size_(0) {
+    write_bytes(archive_magic, sizeof(archive_magic));
+    write(binary_archive_version);
+    write(object_tag);
+}
+
+void binary_output_archive::write_block(const void* data, std::int64_t size_in_bytes) {
+    ONEDAL_ASSERT(size_in_bytes >= 0);
+    write(size_in_bytes);
+
+    const std::int64_t padding = get_padding(size_);
+    std::memset(grow(padding), 0, padding);
+
+    if (size_in_bytes > 0) {
+        ONEDAL_ASSERT(data != nullptr);
+        std::memcpy(grow(size_in_bytes), data, size_in_bytes);
+    }
+}
+
+array<byte_t> binary_output_archive::finish() {
+    auto result = array<byte_t>{ buffer_, buffer_.get_mutable_data(), size_ };
+    buffer_.reset();
+    size_ = 0;
+    return result;
+}
+
+void binary_output_archive::write_bytes(const void* data, std::int64_t size) {
+    std::memcpy(grow(size), data, size);
+}
+
+byte_t* binary_output_archive::grow(std::int64_t size) {
+    check_sum_overflow(size_, size);
+    const std::int64_t required_size = size_ + size;
+
+    if (required_size > buffer_.get_count()) {
+        // The buffer grows geometrically to keep the amortized cost of writing linear,
+        // the allocation is aligned, so the blocks are aligned in memory as well
+        const std::int64_t capacity = std::max(required_size, 2 * buffer_.get_count());
+        auto new_buffer = array<byte_t>::empty(std::max(capacity, std::int64_t(4096)));
+        if (size_ > 0) {
+            std::memcpy(new_buffer.get_mutable_data(), buffer_.get_data(), size_);
+        }
+        buffer_ = new_buffer;
+    }
+
+    byte_t* position = buffer_.get_mutable_data() + size_;
+    size_ = required_size;
+    return position;
+}
+
+binary_input_archive::binary_input_archive(const array<byte_t>& data, std::int64_t object_tag)
+        : data_(data),
+          offset_(0),
+          version_(0) {
+    char magic[sizeof(archive_magic)];
+    read_bytes(magic, sizeof(magic));
+    if (std::memcmp(magic, archive_magic, sizeof(archive_magic)) != 0) {
+        throw_archive_is_corrupted();
+    }
+
+    version_ = read<std::int64_t>();
+    if (version_ <= 0) {
+        throw_archive_is_corrupted();
+    }
+    if (version_ > binary_archive_version) {
+        throw invalid_argument(error_msg::archive_version_is_not_supported());
+    }
+
+    if (read<std::int64_t>() != object_tag) {
+        throw invalid_argument(error_msg::archive_object_type_mismatch());
+    }
+}
+
+array<byte_t> binary_input_archive::read_block() {
+    const auto size_in_bytes = read<std::int64_t>();
+    if (size_in_bytes < 0) {
+        throw_archive_is_corrupted();
+    }
+
+    advance(get_padding(offset_));
+    const byte_t* block = advance(size_in_bytes);
+    return array<byte_t>{ data_, block, size_in_bytes };
+}
+
+void binary_input_archive::read_bytes(void* data, std::int64_t size) {
+    std::memcpy(data, advance(size), size);
+}
+
+const byte_t* binary_input_archive::advance(std::int64_t size) {
+    if (size > data_.get_count() - offset_) {
+        throw_archive_is_corrupted();
+    }
+    const byte_t* position = data_.get_data() + offset_;
+    offset_ += size;
+    return position;
+}
+
+void binary_input_archive::throw_archive_is_corrupted() {
+    throw invalid_argument(error_msg::archive_is_corrupted());
+}
+
+} // namespace v1
+} // namespace oneapi::dal::detail
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/array.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// The version of the binary layout written by ``binary_output_archive``.
+/// Archives of the newer versions cannot be read.
+constexpr std::int64_t binary_archive_version = 2;
+
+/// The alignment of the data blocks relative to the beginning of the archive.
+/// Blocks of the archive placed at the aligned address (for example, the memory-mapped file)
+/// can be passed to the vectorized kernels in place.
+constexpr std::int64_t binary_archive_alignment = 64;
+
+/// Writes an object to the flat binary layout: the header is followed by the scalar fields
+/// and the aligned data blocks in the order of writing. Values are stored in the host byte order.
+class ONEDAL_EXPORT binary_output_archive {
+public:
+    /// @param object_tag The identifier of the serialized object type checked on reading
+    explicit binary_output_archive(std::int64_t object_tag);
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write_bytes(&value, sizeof(T));
+    }
+
+    /// Writes the size of the block followed by the block itself
+    /// placed at the offset multiple of ``binary_archive_alignment``
+    void write_block(const void* data, std::int64_t size_in_bytes);
+
+    template <typename T>
+    void write_block(const array<T>& data) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write_block(data.get_data(), data.get_size());
+    }
+
+    /// Returns the written archive. The archive cannot be used after the call.
+    array<byte_t> finish();
+
+private:
+    void write_bytes(const void* data, std::int64_t size);
+    byte_t* grow(std::int64_t size);
+
+    array<byte_t> buffer_;
+    std::int64_t size_;
+};
+
+/// Reads an object from the layout written by ``binary_output_archive``.
+/// Data blocks are returned as the arrays that refer to the memory of the archive,
+/// so the object can be used in place without deserialization of the blocks.
+class ONEDAL_EXPORT binary_input_archive {
+public:
+    /// Checks the header of the archive
+    /// @param data       The archive. The blocks read from the archive share its ownership.
+    /// @param object_tag The expected identifier of the object type
+    binary_input_archive(const array<byte_t>& data, std::int64_t object_tag);
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    /// Returns the next block of the archive without copying
+    array<byte_t> read_block();
+
+    template <typename T>
+    array<T> read_block() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto block = read_block();
+        if (block.get_count() % sizeof(T) != 0) {
+            throw_archive_is_corrupted();
+        }
+        return array<T>{ block,
+                         reinterpret_cast<const T*>(block.get_data()),
+                         block.get_count() / std::int64_t(sizeof(T)) };
+    }
+
+    /// The version of the layout the archive was written with
+    std::int64_t get_version() const {
+        return version_;
+    }
+
+private:
+    void read_bytes(void* data, std::int64_t size);
+    const byte_t* advance(std::int64_t size);
+    [[noreturn]] static void throw_archive_is_corrupted();
+
+    array<byte_t> data_;
+    std::int64_t offset_;
+    std::int64_t version_;
+};
+
+} // namespace v1
+
+using v1::binary_archive_version;
+using v1::binary_archive_alignment;
+using v1::binary_output_archive;
+using v1::binary_input_archive;
+
+} // namespace oneapi::dal::detail
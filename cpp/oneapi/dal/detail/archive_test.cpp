@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstring>
+
+#include "oneapi/dal/detail/archive.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::detail;
+
+constexpr std::int64_t test_tag = 42;
+
+TEST(archive_test, can_read_written_scalars_and_blocks) {
+    const float values[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+
+    binary_output_archive out{ test_tag };
+    out.write(std::int64_t(7));
+    out.write_block(array<float>::wrap(values, 5));
+    out.write(3.5);
+    out.write_block(nullptr, 0);
+    const auto data = out.finish();
+
+    binary_input_archive in{ data, test_tag };
+    ASSERT_EQ(in.get_version(), binary_archive_version);
+    ASSERT_EQ(in.read<std::int64_t>(), 7);
+
+    const auto block = in.read_block<float>();
+    ASSERT_EQ(block.get_count(), 5);
+    for (std::int64_t i = 0; i < 5; i++) {
+        ASSERT_FLOAT_EQ(block[i], values[i]);
+    }
+
+    ASSERT_DOUBLE_EQ(in.read<double>(), 3.5);
+    ASSERT_EQ(in.read_block().get_count(), 0);
+}
+
+TEST(archive_test, blocks_refer_to_aligned_memory_of_archive) {
+    const double values[] = { 1.0, 2.0, 3.0 };
+
+    binary_output_archive out{ test_tag };
+    out.write(std::int32_t(1));
+    out.write_block(array<double>::wrap(values, 3));
+    const auto data = out.finish();
+
+    binary_input_archive in{ data, test_tag };
+    in.read<std::int32_t>();
+    const auto block = in.read_block<double>();
+
+    const auto offset = reinterpret_cast<const byte_t*>(block.get_data()) - data.get_data();
+    ASSERT_GT(offset, 0);
+    ASSERT_LT(offset, data.get_count());
+    ASSERT_EQ(offset % binary_archive_alignment, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block.get_data()) % binary_archive_alignment, 0);
+}
+
+TEST(archive_test, throws_if_object_tag_mismatches) {
+    const auto data = binary_output_archive{ test_tag }.finish();
+    ASSERT_THROW((binary_input_archive{ data, test_tag + 1 }), invalid_argument);
+}
+
+TEST(archive_test, throws_if_magic_is_wrong) {
+    auto data = binary_output_archive{ test_tag }.finish();
+    data.get_mutable_data()[0] = 'x';
+    ASSERT_THROW((binary_input_archive{ data, test_tag }), invalid_argument);
+}
+
+TEST(archive_test, throws_if_version_is_newer) {
+    auto data = binary_output_archive{ test_tag }.finish();
+    const std::int64_t version = binary_archive_version + 1;
+    std::memcpy(data.get_mutable_data() + 8, &version, sizeof(version));
+    ASSERT_THROW((binary_input_archive{ data, test_tag }), invalid_argument);
+}
+
+TEST(archive_test, throws_if_archive_is_truncated) {
+    const float values[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    binary_output_archive out{ test_tag };
+    out.write_block(array<float>::wrap(values, 4));
+    const auto data = out.finish();
+    const auto truncated = array<byte_t>{ data, data.get_data(), data.get_count() - 1 };
+
+    binary_input_archive in{ truncated, test_tag };
+    ASSERT_THROW(in.read_block<float>(), invalid_argument);
+    ASSERT_THROW((binary_input_archive{ array<byte_t>{ data, data.get_data(), 4 }, test_tag }),
+                 invalid_argument);
+}
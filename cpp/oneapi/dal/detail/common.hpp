@@ -159,6 +159,12 @@ inline constexpr std::int64_t get_data_type_size(data_type t) {
     else if (t == data_type::uint64) {
         return sizeof(uint64_t);
     }
+    else if (t == data_type::bfloat16) {
+        return sizeof(bfloat16);
+    }
+    else if (t == data_type::float16) {
+        return sizeof(float16);
+    }
     else {
         throw unimplemented{ dal::detail::error_messages::unsupported_data_type() };
     }
@@ -184,10 +190,23 @@ inline constexpr data_type make_data_type_impl() {
     else if constexpr (std::is_same_v<double, T>) {
         return data_type::float64;
     }
+    else if constexpr (std::is_same_v<bfloat16, T>) {
+        return data_type::bfloat16;
+    }
+    else if constexpr (std::is_same_v<float16, T>) {
+        return data_type::float16;
+    }
 
-    static_assert(
-        is_one_of_v<T, std::int32_t, std::int64_t, std::uint32_t, std::uint64_t, float, double>,
-        "unsupported data type");
+    static_assert(is_one_of_v<T,
+                              std::int32_t,
+                              std::int64_t,
+                              std::uint32_t,
+                              std::uint64_t,
+                              float,
+                              double,
+                              bfloat16,
+                              float16>,
+                  "unsupported data type");
     return data_type::float32; // shall never come here
 }
 
@@ -197,7 +216,8 @@ inline constexpr data_type make_data_type() {
 }
 
 inline constexpr bool is_floating_point(data_type t) {
-    if (t == data_type::bfloat16 || t == data_type::float32 || t == data_type::float64) {
+    if (t == data_type::bfloat16 || t == data_type::float16 || t == data_type::float32 ||
+        t == data_type::float64) {
         return true;
     }
     else {
@@ -60,6 +60,8 @@ MSG(pushing_rows_is_not_supported, "Pushing rows is not supported")
 MSG(unsupported_conversion_types, "Unsupported conversion types")
 MSG(rc_leq_zero, "Row count is lower than or equal to zero")
 MSG(cc_leq_zero, "Column count is lower than or equal to zero")
+MSG(invalid_csr_row_offsets, "Row offsets of the CSR table are invalid")
+MSG(invalid_csr_column_indices, "Column indices of the CSR table are out of range")
 
 /* Ranges */
 MSG(invalid_range_of_rows, "Invalid range of rows")
@@ -84,6 +86,8 @@ MSG(input_labels_contain_only_one_unique_value_expect_two,
     "Input labels contain only one unique value, two unique values are expected")
 MSG(input_labels_contain_wrong_unique_values_count_expect_two,
     "Input labels contain wrong number of unique values, two unique values are expected")
+MSG(input_labels_out_of_range_expect_from_zero_to_class_count,
+    "Input labels are out of range, values from zero to class count minus one are expected")
 MSG(input_labels_table_has_wrong_cc_expect_one,
     "Input labels table has wrong column count, one column is expected")
 MSG(iteration_count_lt_zero, "Iteration count is lower than zero")
@@ -93,6 +97,12 @@ MSG(max_iteration_count_lt_zero, "Max iteration count lower than zero")
 /* IO */
 MSG(file_not_found, "File not found")
 
+/* Serialization */
+MSG(archive_is_corrupted, "Archive is corrupted or does not contain a serialized object")
+MSG(archive_object_type_mismatch, "Archive contains an object of another type")
+MSG(archive_version_is_not_supported,
+    "Archive was created with a newer version of the serialization format")
+
 /* K-Means */
 MSG(cluster_count_leq_zero, "Cluster count is lower than or equal to zero")
 MSG(input_initial_centroids_are_empty, "Input initial centroids are empty")
@@ -111,6 +121,19 @@ MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ dense method is not implemented for GPU")
 MSG(objective_function_value_lt_zero, "Objective function value is lower than zero")
 
+/* Kernel Approximation */
+MSG(component_count_leq_zero, "Component count is lower than or equal to zero")
+MSG(input_data_rc_lt_desc_component_count,
+    "Input data row count is lower than component count provided in descriptor")
+MSG(input_model_frequencies_are_empty, "Input model frequencies are empty")
+MSG(input_model_frequencies_cc_neq_input_data_cc,
+    "Input model frequencies column count is not equal to input data column count")
+MSG(input_model_landmarks_are_empty, "Input model landmarks are empty")
+MSG(input_model_landmarks_cc_neq_input_data_cc,
+    "Input model landmarks column count is not equal to input data column count")
+MSG(kernel_approximation_is_not_implemented_for_gpu,
+    "Kernel approximation is not implemented for GPU")
+
 /* k-NN */
 MSG(knn_brute_force_method_is_not_implemented_for_cpu,
     "k-NN brute force method is not implemented for CPU")
@@ -128,6 +151,8 @@ MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
 
 /* PCA */
 MSG(component_count_lt_zero, "Component count is lower than zero")
+MSG(oversampling_count_lt_zero, "Oversampling count is lower than zero")
+MSG(power_iteration_count_lt_zero, "Power iteration count is lower than zero")
 MSG(input_data_cc_lt_desc_component_count,
     "Input data column count is lower than component count provided in descriptor")
 MSG(input_model_eigenvectors_cc_neq_input_data_cc,
@@ -143,6 +168,12 @@ MSG(pca_svd_based_method_is_not_implemented_for_gpu,
 MSG(c_leq_zero, "C is lower than or equal to zero")
 MSG(cache_size_lt_zero, "Cache size is lower than zero")
 MSG(input_model_coeffs_are_empty, "Input model coeffs are empty")
+MSG(input_model_biases_rc_neq_class_pair_count,
+    "Input model biases row count is not equal to the number of class pairs")
+MSG(input_model_class_support_vector_counts_rc_neq_class_count,
+    "Input model class support vector counts row count is not equal to class count")
+MSG(input_model_coeffs_cc_neq_class_count_minus_one,
+    "Input model coeffs column count is not equal to class count minus one")
 MSG(input_model_coeffs_rc_neq_input_model_support_vector_count,
     "Input model coeffs row count is not equal to support vector count provided in input model")
 MSG(input_model_does_not_match_kernel_function, "Input model does not match kernel function type")
@@ -152,6 +183,8 @@ MSG(input_model_support_vectors_cc_neq_input_data_cc,
 MSG(input_model_support_vectors_rc_neq_input_model_support_vector_count,
     "Support vectors row count is not equal to support vector count in input model")
 MSG(sigma_leq_zero, "Sigma lower than or equal to zero")
+MSG(svm_multiclass_is_not_implemented_for_gpu,
+    "SVM multiclass classification is not implemented for GPU")
 MSG(svm_smo_method_is_not_implemented_for_gpu, "SVM SMO method is not implemented for GPU")
 MSG(tau_leq_zero, "Tau is lower than or equal to zero")
 MSG(unknown_kernel_function_type, "Unknown kernel function type")
@@ -94,6 +94,8 @@ public:
     MSG(unsupported_conversion_types);
     MSG(rc_leq_zero);
     MSG(cc_leq_zero);
+    MSG(invalid_csr_row_offsets);
+    MSG(invalid_csr_column_indices);
 
     /* Ranges */
     MSG(invalid_range_of_rows);
@@ -113,6 +115,7 @@ public:
     MSG(input_labels_are_empty);
     MSG(input_labels_contain_only_one_unique_value_expect_two);
     MSG(input_labels_contain_wrong_unique_values_count_expect_two);
+    MSG(input_labels_out_of_range_expect_from_zero_to_class_count);
     MSG(input_labels_table_has_wrong_cc_expect_one);
     MSG(iteration_count_lt_zero);
     MSG(max_iteration_count_leq_zero);
@@ -121,6 +124,11 @@ public:
     /* I/O */
     MSG(file_not_found);
 
+    /* Serialization */
+    MSG(archive_is_corrupted);
+    MSG(archive_object_type_mismatch);
+    MSG(archive_version_is_not_supported);
+
     /* Decision Forest */
     MSG(bootstrap_is_incompatible_with_error_metric);
     MSG(bootstrap_is_incompatible_with_variable_importance_mode);
@@ -147,6 +155,15 @@ public:
     MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu);
     MSG(objective_function_value_lt_zero);
 
+    /* Kernel Approximation */
+    MSG(component_count_leq_zero);
+    MSG(input_data_rc_lt_desc_component_count);
+    MSG(input_model_frequencies_are_empty);
+    MSG(input_model_frequencies_cc_neq_input_data_cc);
+    MSG(input_model_landmarks_are_empty);
+    MSG(input_model_landmarks_cc_neq_input_data_cc);
+    MSG(kernel_approximation_is_not_implemented_for_gpu);
+
     /* k-NN */
     MSG(knn_brute_force_method_is_not_implemented_for_cpu);
     MSG(knn_kd_tree_method_is_not_implemented_for_gpu);
@@ -159,6 +176,8 @@ public:
 
     /* PCA */
     MSG(component_count_lt_zero);
+    MSG(oversampling_count_lt_zero);
+    MSG(power_iteration_count_lt_zero);
     MSG(input_data_cc_lt_desc_component_count);
     MSG(input_model_eigenvectors_cc_neq_input_data_cc);
     MSG(input_model_eigenvectors_rc_neq_desc_component_count);
@@ -169,12 +188,16 @@ public:
     MSG(c_leq_zero);
     MSG(cache_size_lt_zero);
     MSG(input_model_coeffs_are_empty);
+    MSG(input_model_biases_rc_neq_class_pair_count);
+    MSG(input_model_class_support_vector_counts_rc_neq_class_count);
+    MSG(input_model_coeffs_cc_neq_class_count_minus_one);
     MSG(input_model_coeffs_rc_neq_input_model_support_vector_count);
     MSG(input_model_does_not_match_kernel_function);
     MSG(input_model_support_vectors_are_empty);
     MSG(input_model_support_vectors_cc_neq_input_data_cc);
     MSG(input_model_support_vectors_rc_neq_input_model_support_vector_count);
     MSG(sigma_leq_zero);
+    MSG(svm_multiclass_is_not_implemented_for_gpu);
     MSG(svm_smo_method_is_not_implemented_for_gpu);
     MSG(tau_leq_zero);
     MSG(unknown_kernel_function_type);
@@ -41,6 +41,25 @@ void free(const default_host_policy&, void* pointer) {
     daal::services::daal_free(pointer);
 }
 
+void* malloc(const host_policy& policy, std::size_t size) {
+    const auto& allocator = policy.get_allocator();
+    if (!allocator) {
+        return malloc(default_host_policy{}, size);
+    }
+    const auto allocate = [&](std::size_t bytes, std::size_t alignment) {
+        return allocator->allocate(bytes, alignment);
+    };
+    return alloc_impl(allocate, size, daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
+}
+
+void free(const host_policy& policy, void* pointer) {
+    const auto& allocator = policy.get_allocator();
+    if (!allocator) {
+        return free(default_host_policy{}, pointer);
+    }
+    allocator->deallocate(pointer);
+}
+
 void memset(const default_host_policy&, void* dest, std::int32_t value, std::int64_t size) {
     ONEDAL_ASSERT(dest != nullptr);
     std::memset(dest, value, detail::integral_cast<std::size_t>(size));
@@ -58,4 +77,9 @@ void memcpy(const default_host_policy&, void* dest, const void* src, std::int64_
     }
 }
 
+void first_touch(const default_host_policy&, void* data, std::int64_t size) {
+    ONEDAL_ASSERT(data != nullptr);
+    daal::services::daal_first_touch(data, detail::integral_cast<std::size_t>(size));
+}
+
 } // namespace oneapi::dal::detail::v1
@@ -27,6 +27,10 @@ namespace v1 {
 ONEDAL_EXPORT void* malloc(const default_host_policy&, std::size_t size);
 ONEDAL_EXPORT void* calloc(const default_host_policy&, std::size_t size);
 ONEDAL_EXPORT void free(const default_host_policy&, void* pointer);
+
+/// Allocate and free the memory with the allocator of the policy if it is set
+ONEDAL_EXPORT void* malloc(const host_policy& policy, std::size_t size);
+ONEDAL_EXPORT void free(const host_policy& policy, void* pointer);
 ONEDAL_EXPORT void memset(const default_host_policy&,
                           void* dest,
                           std::int32_t value,
@@ -36,6 +40,10 @@ ONEDAL_EXPORT void memcpy(const default_host_policy&,
                           const void* src,
                           std::int64_t size);
 
+/// Places the pages of the newly allocated memory on the NUMA nodes of the threads
+/// that process them if NUMA affinity is enabled, keeps the content intact
+ONEDAL_EXPORT void first_touch(const default_host_policy&, void* data, std::int64_t size);
+
 template <typename T>
 inline T* malloc(const default_host_policy& policy, std::int64_t count) {
     ONEDAL_ASSERT_MUL_OVERFLOW(std::size_t, sizeof(T), count);
@@ -43,6 +51,13 @@ inline T* malloc(const default_host_policy& policy, std::int64_t count) {
     return static_cast<T*>(malloc(policy, bytes_count));
 }
 
+template <typename T>
+inline T* malloc(const host_policy& policy, std::int64_t count) {
+    ONEDAL_ASSERT_MUL_OVERFLOW(std::size_t, sizeof(T), count);
+    const std::size_t bytes_count = sizeof(T) * count;
+    return static_cast<T*>(malloc(policy, bytes_count));
+}
+
 template <typename T>
 inline T* calloc(const default_host_policy& policy, std::int64_t count) {
     ONEDAL_ASSERT_MUL_OVERFLOW(std::size_t, sizeof(T), count);
@@ -56,6 +71,12 @@ inline void free(const default_host_policy& policy, T* pointer) {
     free(policy, reinterpret_cast<void*>(const_cast<mutable_t*>(pointer)));
 }
 
+template <typename T>
+inline void free(const host_policy& policy, T* pointer) {
+    using mutable_t = std::remove_const_t<T>;
+    free(policy, reinterpret_cast<void*>(const_cast<mutable_t*>(pointer)));
+}
+
 template <typename T>
 inline void fill(const default_host_policy& policy, T* dest, std::int64_t count, const T& value) {
     ONEDAL_ASSERT(dest != nullptr);
@@ -85,6 +106,7 @@ using v1::free;
 using v1::fill;
 using v1::memset;
 using v1::memcpy;
+using v1::first_touch;
 using v1::host_allocator;
 
 } // namespace oneapi::dal::detail
@@ -14,15 +14,21 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <mutex>
+
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
+#include <daal/include/services/daal_memory.h>
+#include <daal/src/services/service_host_arena.h>
+
 namespace oneapi::dal::detail {
 namespace v1 {
 
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::shared_ptr<host_allocator_iface> allocator;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -35,6 +41,63 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+void host_policy::set_allocator_impl(
+    const std::shared_ptr<host_allocator_iface>& allocator) noexcept {
+    impl_->allocator = allocator;
+}
+
+const std::shared_ptr<host_allocator_iface>& host_policy::get_allocator() const noexcept {
+    return impl_->allocator;
+}
+
+class host_arena_allocator_impl : public base {
+public:
+    explicit host_arena_allocator_impl(bool use_huge_pages) : arena(use_huge_pages) {}
+
+    daal::services::internal::HostArena arena;
+    std::mutex mutex;
+    std::int64_t operation_count = 0;
+};
+
+host_arena_allocator::host_arena_allocator(bool use_huge_pages)
+        : impl_(new host_arena_allocator_impl(use_huge_pages)) {}
+
+void* host_arena_allocator::allocate(std::size_t size, std::size_t alignment) {
+    void* pointer = impl_->arena.allocate(size, alignment);
+    return pointer ? pointer : daal::services::daal_malloc(size, alignment);
+}
+
+void host_arena_allocator::deallocate(void* pointer) {
+    // Frees the blocks of any arena as well as the ones taken from the default allocator
+    daal::services::daal_free(pointer);
+}
+
+void host_arena_allocator::begin_operation() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->operation_count++;
+    }
+
+    // The arena serves the library allocations of the thread that runs the operation,
+    // unless the operation is nested into the one with another arena on this thread
+    daal::services::internal::setCurrentHostArena(&impl_->arena);
+}
+
+void host_arena_allocator::end_operation() {
+    daal::services::internal::unsetCurrentHostArena(&impl_->arena);
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    ONEDAL_ASSERT(impl_->operation_count > 0);
+
+    if (--impl_->operation_count == 0) {
+        impl_->arena.reset();
+    }
+}
+
+std::int64_t host_arena_allocator::get_reserved_size() const {
+    return detail::integral_cast<std::int64_t>(impl_->arena.getReservedSize());
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <type_traits>
 #ifdef ONEDAL_DATA_PARALLEL
 #include <CL/sycl.hpp>
@@ -27,6 +28,7 @@ namespace oneapi::dal::detail {
 namespace v1 {
 
 class host_policy_impl;
+class host_arena_allocator_impl;
 class data_parallel_policy_impl;
 
 enum class cpu_extension : uint64_t {
@@ -41,6 +43,46 @@ enum class cpu_extension : uint64_t {
 
 class ONEDAL_EXPORT default_host_policy {};
 
+/// Allocator of the host memory used by the operations run with the host policy
+class ONEDAL_EXPORT host_allocator_iface {
+public:
+    virtual ~host_allocator_iface() = default;
+
+    /// Allocates the block of the given size and alignment, returns nullptr on failure
+    virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+    /// Frees the block returned by allocate()
+    virtual void deallocate(void* pointer) = 0;
+
+    /// Called before the operation run with the policy starts
+    virtual void begin_operation() {}
+
+    /// Called after the operation run with the policy completes
+    virtual void end_operation() {}
+};
+
+/// Allocator that keeps the host memory of the completed operations for the next ones.
+/// The memory is taken from the system in 2 MB chunks backed by the transparent huge pages
+/// if they are enabled. While the operation runs, the temporary buffers the library allocates
+/// on the thread that runs it are taken from the arena too, the ones allocated by the worker
+/// threads come from the default allocator. The arena is reset when the operation completes.
+/// The blocks that outlive the operation, e.g. the results, stay valid until they are freed.
+class ONEDAL_EXPORT host_arena_allocator : public host_allocator_iface {
+public:
+    explicit host_arena_allocator(bool use_huge_pages = true);
+
+    void* allocate(std::size_t size, std::size_t alignment) override;
+    void deallocate(void* pointer) override;
+    void begin_operation() override;
+    void end_operation() override;
+
+    /// The number of bytes the arena took from the system
+    std::int64_t get_reserved_size() const;
+
+private:
+    pimpl<host_arena_allocator_impl> impl_;
+};
+
 class ONEDAL_EXPORT host_policy : public base {
 public:
     host_policy();
@@ -52,13 +94,22 @@ public:
 
     cpu_extension get_enabled_cpu_extensions() const noexcept;
 
+    /// The allocator of the host memory, nullptr if the default one is used
+    const std::shared_ptr<host_allocator_iface>& get_allocator() const noexcept;
+
     auto& set_enabled_cpu_extensions(const cpu_extension& extensions) {
         set_enabled_cpu_extensions_impl(extensions);
         return *this;
     }
 
+    auto& set_allocator(const std::shared_ptr<host_allocator_iface>& allocator) {
+        set_allocator_impl(allocator);
+        return *this;
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_allocator_impl(const std::shared_ptr<host_allocator_iface>& allocator) noexcept;
 
     pimpl<host_policy_impl> impl_;
 };
@@ -101,6 +152,8 @@ constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
 
 using v1::cpu_extension;
 using v1::default_host_policy;
+using v1::host_allocator_iface;
+using v1::host_arena_allocator;
 using v1::host_policy;
 using v1::is_execution_policy;
 using v1::is_execution_policy_v;
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/memory_impl_host.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::detail;
+
+class counting_allocator : public host_allocator_iface {
+public:
+    void* allocate(std::size_t size, std::size_t alignment) override {
+        allocation_count++;
+        return malloc(default_host_policy{}, size);
+    }
+
+    void deallocate(void* pointer) override {
+        deallocation_count++;
+        free(default_host_policy{}, pointer);
+    }
+
+    void begin_operation() override {
+        operation_count++;
+    }
+
+    void end_operation() override {
+        completed_operation_count++;
+    }
+
+    std::int64_t allocation_count = 0;
+    std::int64_t deallocation_count = 0;
+    std::int64_t operation_count = 0;
+    std::int64_t completed_operation_count = 0;
+};
+
+TEST(host_policy_test, uses_default_allocator_if_not_set) {
+    host_policy policy;
+    ASSERT_EQ(policy.get_allocator(), nullptr);
+
+    float* data = malloc<float>(policy, 16);
+    ASSERT_NE(data, nullptr);
+    data[15] = 1.0f;
+    free(policy, data);
+}
+
+TEST(host_policy_test, allocates_with_allocator_of_policy) {
+    auto allocator = std::make_shared<counting_allocator>();
+    host_policy policy;
+    policy.set_allocator(allocator);
+
+    double* data = malloc<double>(policy, 8);
+    free(policy, data);
+
+    ASSERT_EQ(allocator->allocation_count, 1);
+    ASSERT_EQ(allocator->deallocation_count, 1);
+}
+
+TEST(host_policy_test, notifies_allocator_about_operation) {
+    struct kernel {
+        std::int64_t operator()(const backend::context_cpu&, const counting_allocator& allocator) {
+            return allocator.operation_count - allocator.completed_operation_count;
+        }
+    };
+
+    auto allocator = std::make_shared<counting_allocator>();
+    host_policy policy;
+    policy.set_allocator(allocator);
+
+    const auto running_count = backend::kernel_dispatcher<kernel>{}(policy, *allocator);
+
+    ASSERT_EQ(running_count, 1);
+    ASSERT_EQ(allocator->operation_count, 1);
+    ASSERT_EQ(allocator->completed_operation_count, 1);
+}
+
+TEST(host_arena_allocator_test, reuses_memory_of_completed_operation) {
+    auto allocator = std::make_shared<host_arena_allocator>();
+    host_policy policy;
+    policy.set_allocator(allocator);
+
+    allocator->begin_operation();
+    float* first = malloc<float>(policy, 1000);
+    std::memset(first, 0, 1000 * sizeof(float));
+    free(policy, first);
+    allocator->end_operation();
+
+    const std::int64_t reserved_size = allocator->get_reserved_size();
+    ASSERT_GT(reserved_size, 0);
+
+    allocator->begin_operation();
+    float* second = malloc<float>(policy, 1000);
+    free(policy, second);
+    allocator->end_operation();
+
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(allocator->get_reserved_size(), reserved_size);
+}
+
+TEST(host_arena_allocator_test, serves_library_allocations_during_operation) {
+    auto allocator = std::make_shared<host_arena_allocator>();
+
+    allocator->begin_operation();
+    void* temporary = malloc(default_host_policy{}, 4096);
+    const std::int64_t reserved_size = allocator->get_reserved_size();
+    free(default_host_policy{}, temporary);
+    allocator->end_operation();
+
+    ASSERT_GT(reserved_size, 0);
+}
+
+TEST(host_arena_allocator_test, keeps_blocks_that_outlive_operation_and_allocator) {
+    constexpr std::int64_t count = 1 << 20;
+    std::int32_t* result = nullptr;
+    {
+        auto allocator = std::make_shared<host_arena_allocator>(false);
+        host_policy policy;
+        policy.set_allocator(allocator);
+
+        allocator->begin_operation();
+        result = malloc<std::int32_t>(policy, count);
+        for (std::int64_t i = 0; i < count; i++) {
+            result[i] = static_cast<std::int32_t>(i);
+        }
+        allocator->end_operation();
+
+        allocator->begin_operation();
+        std::int32_t* temporary = malloc<std::int32_t>(policy, count);
+        ASSERT_NE(temporary, result);
+        std::memset(temporary, 0, count * sizeof(std::int32_t));
+        free(policy, temporary);
+        allocator->end_operation();
+    }
+
+    for (std::int64_t i = 0; i < count; i++) {
+        ASSERT_EQ(result[i], i);
+    }
+    free(default_host_policy{}, result);
+}
+
+TEST(host_arena_allocator_test, serves_library_allocations_of_calling_thread_only) {
+    auto allocator = std::make_shared<host_arena_allocator>();
+
+    allocator->begin_operation();
+    std::thread worker([&]() {
+        void* temporary = malloc(default_host_policy{}, 4096);
+        free(default_host_policy{}, temporary);
+    });
+    worker.join();
+    const std::int64_t reserved_size = allocator->get_reserved_size();
+    allocator->end_operation();
+
+    ASSERT_EQ(reserved_size, 0);
+}
+
+TEST(host_arena_allocator_test, reuses_chunk_of_block_that_outlives_operation) {
+    constexpr std::int64_t operation_count = 100;
+    constexpr std::int64_t temporary_size = 400000;
+    constexpr std::int64_t chunk_size = 2 * 1024 * 1024;
+
+    auto allocator = std::make_shared<host_arena_allocator>(false);
+    std::vector<void*> results;
+    for (std::int64_t i = 0; i < operation_count; i++) {
+        allocator->begin_operation();
+        void* temporaries[3];
+        for (auto& temporary : temporaries) {
+            temporary = malloc(default_host_policy{}, temporary_size);
+            std::memset(temporary, 0, temporary_size);
+        }
+        results.push_back(malloc(default_host_policy{}, 64));
+        for (auto& temporary : temporaries) {
+            free(default_host_policy{}, temporary);
+        }
+        allocator->end_operation();
+    }
+
+    // Every result pins its chunk, the temporaries of the next operations reuse the rest of it
+    ASSERT_LE(allocator->get_reserved_size(), 3 * chunk_size);
+    for (void* result : results) {
+        free(default_host_policy{}, result);
+    }
+}
+
+TEST(host_arena_allocator_test, gives_distinct_blocks_to_concurrent_operations) {
+    constexpr std::int64_t thread_count = 4;
+    constexpr std::int64_t block_count = 1000;
+    constexpr std::int64_t block_size = 1000;
+
+    auto allocator = std::make_shared<host_arena_allocator>();
+    std::vector<std::thread> threads;
+    std::vector<std::int32_t> is_intact(thread_count, 0);
+    for (std::int64_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t]() {
+            allocator->begin_operation();
+            std::vector<unsigned char*> blocks;
+            for (std::int64_t i = 0; i < block_count; i++) {
+                auto block = static_cast<unsigned char*>(malloc(default_host_policy{}, block_size));
+                std::memset(block, static_cast<int>(t + 1), block_size);
+                blocks.push_back(block);
+            }
+            bool intact = true;
+            for (auto block : blocks) {
+                for (std::int64_t j = 0; j < block_size; j++) {
+                    intact = intact && (block[j] == t + 1);
+                }
+                free(default_host_policy{}, block);
+            }
+            allocator->end_operation();
+            is_intact[t] = intact;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::int64_t t = 0; t < thread_count; t++) {
+        ASSERT_TRUE(is_intact[t]);
+    }
+}
@@ -245,4 +245,22 @@ ONEDAL_PARALLEL_SORT_SPECIALIZATION_DECL(oneapi::dal::preview::pair_int32_t_size
 
 #undef ONEDAL_PARALLEL_SORT_SPECIALIZATION_DECL
 
+template <typename F>
+ONEDAL_EXPORT void parallel_segmented_sort(F *data_ptr,
+                                           const std::int64_t *offsets,
+                                           std::int64_t n_segments) {
+    throw unimplemented(dal::detail::error_messages::unimplemented_sorting_procedure());
+}
+
+#define ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION_DECL(TYPE)            \
+    template <>                                                             \
+    ONEDAL_EXPORT void parallel_segmented_sort(TYPE *data_ptr,              \
+                                               const std::int64_t *offsets, \
+                                               std::int64_t n_segments);
+
+ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION_DECL(std::int32_t)
+ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION_DECL(std::int64_t)
+
+#undef ONEDAL_PARALLEL_SEGMENTED_SORT_SPECIALIZATION_DECL
+
 } // namespace oneapi::dal::detail
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/primitives/scan.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
@@ -25,6 +28,8 @@
 
 namespace oneapi::dal::preview::load_graph::backend {
 
+namespace pr = dal::backend::primitives;
+
 template <typename Cpu>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
     std::int32_t max_id = edges[0].first;
@@ -36,16 +41,12 @@ std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edge
     return vertex_count;
 }
 
-template <typename Cpu>
-std::int64_t compute_prefix_sum(const std::int32_t *degrees,
+template <typename Cpu, typename Degree>
+std::int64_t compute_prefix_sum(const Degree *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
+    const std::int64_t total_sum_degrees = pr::exclusive_scan(degrees, edge_offsets, degrees_count);
+    edge_offsets[degrees_count] = total_sum_degrees;
     return total_sum_degrees;
 }
 
@@ -71,10 +72,10 @@ void filter_neighbors_and_fill_new_degrees(std::int32_t *unfiltered_neighs,
                                            std::int32_t *new_degrees,
                                            std::int64_t vertex_count) {
     //removing self-loops,  multiple edges from graph, and make neighbors in CSR sorted
+    dal::detail::parallel_segmented_sort(unfiltered_neighs, unfiltered_offsets, vertex_count);
     dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
         auto start_p = unfiltered_neighs + unfiltered_offsets[u];
         auto end_p = unfiltered_neighs + unfiltered_offsets[u + 1];
-        dal::detail::parallel_sort(start_p, end_p);
         auto neighs_u_new_end = std::unique(start_p, end_p);
         neighs_u_new_end = std::remove(start_p, neighs_u_new_end, u);
         new_degrees[u] = (std::int32_t)std::distance(start_p, neighs_u_new_end);
@@ -25,6 +25,10 @@ template std::int64_t compute_prefix_sum<__CPU_TAG__>(const std::int32_t *degree
                                                       std::int64_t degrees_count,
                                                       std::int64_t *edge_offsets);
 
+template std::int64_t compute_prefix_sum<__CPU_TAG__>(const std::atomic<std::int32_t> *degrees,
+                                                      std::int64_t degrees_count,
+                                                      std::int64_t *edge_offsets);
+
 template void fill_filtered_neighs<__CPU_TAG__>(const std::int64_t *unfiltered_offsets,
                                                 const std::int32_t *unfiltered_neighs,
                                                 const std::int32_t *filtered_degrees,
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <filesystem>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::csv::test {
+
+namespace te = dal::test::engine;
+
+TEST("read csv 1M x 20", "[csv][perf]") {
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 1000000, 20 }.fill_uniform(-1, 1));
+
+    const auto path = te::get_temp_file_path("csv_perf_data.csv");
+    te::write_csv(path, df.get_table(te::table_id::homogen<float>()));
+    const auto file_size = std::int64_t(std::filesystem::file_size(path));
+
+    te::set_benchmark_workload(df.get_row_count(), file_size);
+
+    BENCHMARK("read") {
+        return dal::read<table>(csv::data_source{ path });
+    };
+}
+
+} // namespace oneapi::dal::csv::test
@@ -30,9 +30,20 @@ ONEDAL_EXPORT std::int64_t get_vertex_count_from_edge_list(const edge_list<std::
 }
 
 template <>
-std::int64_t compute_prefix_sum(const std::int32_t *degrees,
-                                std::int64_t degrees_count,
-                                std::int64_t *edge_offsets) {
+ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::int32_t *degrees,
+                                              std::int64_t degrees_count,
+                                              std::int64_t *edge_offsets) {
+    return dal::backend::dispatch_by_cpu(
+        dal::backend::context_cpu{ dal::detail::host_policy::get_default() },
+        [&](auto cpu) {
+            return backend::compute_prefix_sum<decltype(cpu)>(degrees, degrees_count, edge_offsets);
+        });
+}
+
+template <>
+ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::atomic<std::int32_t> *degrees,
+                                              std::int64_t degrees_count,
+                                              std::int64_t *edge_offsets) {
     return dal::backend::dispatch_by_cpu(
         dal::backend::context_cpu{ dal::detail::host_policy::get_default() },
         [&](auto cpu) {
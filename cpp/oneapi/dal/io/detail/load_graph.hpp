@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <atomic>
 #include <fstream>
+#include <type_traits>
 
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
@@ -80,19 +81,6 @@ void collect_degrees_from_edge_list(const edge_list<Index> &edges, AtomicType *d
     });
 }
 
-template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
-EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
-                                    std::int64_t degrees_count,
-                                    AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
-}
-
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
@@ -106,10 +94,20 @@ EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
     return total_sum_degrees;
 }
 
-template <typename Index, typename AtomicIndex>
-void fill_from_atomics(Index *arr, AtomicIndex *atomic_arr, std::int64_t elements_count) {
+template <>
+ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::int32_t *degrees,
+                                              std::int64_t degrees_count,
+                                              std::int64_t *edge_offsets);
+
+template <>
+ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::atomic<std::int32_t> *degrees,
+                                              std::int64_t degrees_count,
+                                              std::int64_t *edge_offsets);
+
+template <typename AtomicIndex, typename Index>
+void fill_atomics(AtomicIndex *atomic_arr, const Index *arr, std::int64_t elements_count) {
     dal::detail::threader_for_int64(elements_count, [&](std::int64_t n) {
-        arr[n] = atomic_arr[n].load();
+        atomic_arr[n].store(arr[n]);
     });
 }
 
@@ -145,12 +143,19 @@ void filter_neighbors_and_fill_new_degrees(VertexIndex *unfiltered_neighs,
                                            VertexIndex *new_degrees,
                                            std::int64_t vertex_count) {
     //removing self-loops,  multiple edges from graph, and make neighbors in CSR sorted
+    constexpr bool is_segmented_sort_supported =
+        (std::is_same_v<VertexIndex, std::int32_t> || std::is_same_v<VertexIndex, std::int64_t>) &&
+        std::is_same_v<EdgeIndex, std::int64_t>;
+    if constexpr (is_segmented_sort_supported) {
+        dal::detail::parallel_segmented_sort(unfiltered_neighs, unfiltered_offsets, vertex_count);
+    }
     dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
         auto start_p = unfiltered_neighs + unfiltered_offsets[u];
         auto end_p = unfiltered_neighs + unfiltered_offsets[u + 1];
 
-        //dal::detail::parallel_sort(start_p, end_p);
-        std::sort(start_p, end_p);
+        if constexpr (!is_segmented_sort_supported) {
+            std::sort(start_p, end_p);
+        }
         auto neighs_u_new_end = std::unique(start_p, end_p);
         neighs_u_new_end = std::remove(start_p, neighs_u_new_end, u);
         new_degrees[u] = (VertexIndex)std::distance(start_p, neighs_u_new_end);
@@ -200,22 +205,22 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
         throw range_error(dal::detail::error_messages::overflow_found_in_sum_of_two_values());
     }
 
-    atomic_edge_t *rows_vec_atomic =
-        oneapi::dal::preview::detail::allocate(atomic_edge_allocator, rows_vec_count);
-
-    rows_vec_atomic = new (rows_vec_atomic) atomic_edge_t[rows_vec_count]();
+    edge_t *unfiltered_offsets =
+        oneapi::dal::preview::detail::allocate(edge_allocator, rows_vec_count);
 
-    edge_t total_sum_degrees =
-        compute_prefix_sum_atomic<edge_t>(degrees_cv, vertex_count, rows_vec_atomic);
+    edge_t total_sum_degrees = compute_prefix_sum(degrees_cv, vertex_count, unfiltered_offsets);
 
     oneapi::dal::preview::detail::deallocate(atomic_vertex_allocator, degrees_cv, vertex_count);
 
     vertex_t *unfiltered_neighs =
         oneapi::dal::preview::detail::allocate(vertex_allocator, total_sum_degrees);
-    edge_t *unfiltered_offsets =
-        oneapi::dal::preview::detail::allocate(edge_allocator, rows_vec_count);
 
-    fill_from_atomics(unfiltered_offsets, rows_vec_atomic, rows_vec_count);
+    atomic_edge_t *rows_vec_atomic =
+        oneapi::dal::preview::detail::allocate(atomic_edge_allocator, rows_vec_count);
+
+    rows_vec_atomic = new (rows_vec_atomic) atomic_edge_t[rows_vec_count]();
+
+    fill_atomics(rows_vec_atomic, unfiltered_offsets, rows_vec_count);
 
     fill_unfiltered_neighs(edges, rows_vec_atomic, unfiltered_neighs);
 
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <filesystem>
+
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_csv_data_source.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+namespace te = dal::test::engine;
+
+TEST("load graph 1M vertices, 10M edges", "[load_graph][perf]") {
+    constexpr std::int64_t vertex_count = 1000000;
+    constexpr std::int64_t edge_count = 10000000;
+
+    const auto path = te::get_temp_file_path("load_graph_perf_graph.csv");
+    te::write_random_graph_csv(path, vertex_count, edge_count);
+    const auto file_size = std::int64_t(std::filesystem::file_size(path));
+
+    te::set_benchmark_workload(edge_count, file_size);
+
+    BENCHMARK("load") {
+        return load(descriptor<>{}, graph_csv_data_source{ path });
+    };
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
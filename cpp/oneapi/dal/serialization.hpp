@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/archive.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// Identifiers of the serializable object types written to the header of the archive
+enum class serialization_tag : std::int64_t {
+    kmeans_model = 1,
+    knn_model = 2,
+    pca_model = 3,
+    svm_model = 4,
+    decision_forest_classification_model = 5,
+    decision_forest_regression_model = 6,
+    kernel_approximation_model = 7,
+};
+
+/// Specialized for each serializable object type. Specializations provide the ``tag``
+/// of the type, ``void serialize(binary_output_archive&, const Object&)`` and
+/// ``Object deserialize(binary_input_archive&)``.
+template <typename Object>
+struct serialization_ops;
+
+} // namespace v1
+
+using v1::serialization_tag;
+using v1::serialization_ops;
+
+} // namespace oneapi::dal::detail
+
+namespace oneapi::dal {
+namespace v1 {
+
+/// Writes the object to the versioned flat binary layout. The layout can be stored as is
+/// and restored by ``deserialize`` with the same or the newer version of the library.
+///
+/// @tparam Object The type of the object, for example, a model of an algorithm
+/// @param object  The object to be serialized
+template <typename Object>
+array<byte_t> serialize(const Object& object) {
+    using ops_t = detail::serialization_ops<Object>;
+    detail::binary_output_archive archive{ static_cast<std::int64_t>(ops_t::tag) };
+    ops_t{}.serialize(archive, object);
+    return archive.finish();
+}
+
+/// Restores the object from the layout written by ``serialize``. The data of the object
+/// refers to the memory of the archive without copying, so the archive that wraps
+/// a memory-mapped file can be used for inference in place. The memory of the archive
+/// shall not be modified while the object exists.
+///
+/// @tparam Object The type of the object
+/// @param data    The archive, its ownership is shared with the restored object
+template <typename Object>
+Object deserialize(const array<byte_t>& data) {
+    using ops_t = detail::serialization_ops<Object>;
+    detail::binary_input_archive archive{ data, static_cast<std::int64_t>(ops_t::tag) };
+    return ops_t{}.deserialize(archive);
+}
+
+} // namespace v1
+
+using v1::serialize;
+using v1::deserialize;
+
+} // namespace oneapi::dal
@@ -14,17 +14,158 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "oneapi/dal/table/backend/convert.hpp"
+#include "oneapi/dal/table/backend/cpu/convert_kernel.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
 
 namespace oneapi::dal::backend {
 
+inline bool is_reduced_precision(data_type t) {
+    return t == data_type::bfloat16 || t == data_type::float16;
+}
+
+/// Converts the vector with 16-bit floating-point values on either side. The values
+/// are converted through :expr:`float` in chunks, so the conversion to or from
+/// :expr:`float` does not need an intermediate buffer. The strides are given in bytes.
+class reduced_precision_converter {
+public:
+    reduced_precision_converter(data_type src_type, data_type dst_type)
+            : src_type_(src_type),
+              dst_type_(dst_type) {}
+
+    void operator()(const byte_t* src,
+                    byte_t* dst,
+                    std::int64_t src_stride,
+                    std::int64_t dst_stride,
+                    std::int64_t element_count) const {
+        dispatch_by_cpu(context_cpu{}, [&](auto cpu) {
+            using cpu_t = decltype(cpu);
+            if (dst_type_ == data_type::float32) {
+                to_float<cpu_t>(src,
+                                reinterpret_cast<float*>(dst),
+                                src_stride,
+                                dst_stride,
+                                element_count);
+                return;
+            }
+            if (src_type_ == data_type::float32) {
+                from_float<cpu_t>(reinterpret_cast<const float*>(src),
+                                  dst,
+                                  src_stride,
+                                  dst_stride,
+                                  element_count);
+                return;
+            }
+
+            constexpr std::int64_t float_size = sizeof(float);
+            float buffer[chunk_size];
+            for (std::int64_t i = 0; i < element_count; i += chunk_size) {
+                const std::int64_t count = std::min(chunk_size, element_count - i);
+                const byte_t* src_chunk = src + i * src_stride;
+                byte_t* dst_chunk = dst + i * dst_stride;
+
+                if (is_reduced_precision(src_type_)) {
+                    to_float<cpu_t>(src_chunk, buffer, src_stride, float_size, count);
+                }
+                else {
+                    interop::daal_convert(src_chunk,
+                                          buffer,
+                                          src_type_,
+                                          data_type::float32,
+                                          src_stride,
+                                          float_size,
+                                          count);
+                }
+
+                if (is_reduced_precision(dst_type_)) {
+                    from_float<cpu_t>(buffer, dst_chunk, float_size, dst_stride, count);
+                }
+                else {
+                    interop::daal_convert(buffer,
+                                          dst_chunk,
+                                          data_type::float32,
+                                          dst_type_,
+                                          float_size,
+                                          dst_stride,
+                                          count);
+                }
+            }
+        });
+    }
+
+private:
+    static constexpr std::int64_t chunk_size = 512;
+
+    template <typename Cpu>
+    void to_float(const byte_t* src,
+                  float* dst,
+                  std::int64_t src_stride,
+                  std::int64_t dst_stride,
+                  std::int64_t element_count) const {
+        constexpr std::int64_t half_size = sizeof(bfloat16);
+        constexpr std::int64_t float_size = sizeof(float);
+        if (src_type_ == data_type::bfloat16) {
+            convert_to_float<Cpu>(reinterpret_cast<const bfloat16*>(src),
+                                  dst,
+                                  src_stride / half_size,
+                                  dst_stride / float_size,
+                                  element_count);
+        }
+        else {
+            convert_to_float<Cpu>(reinterpret_cast<const float16*>(src),
+                                  dst,
+                                  src_stride / half_size,
+                                  dst_stride / float_size,
+                                  element_count);
+        }
+    }
+
+    template <typename Cpu>
+    void from_float(const float* src,
+                    byte_t* dst,
+                    std::int64_t src_stride,
+                    std::int64_t dst_stride,
+                    std::int64_t element_count) const {
+        constexpr std::int64_t half_size = sizeof(bfloat16);
+        constexpr std::int64_t float_size = sizeof(float);
+        if (dst_type_ == data_type::bfloat16) {
+            convert_from_float<Cpu>(src,
+                                    reinterpret_cast<bfloat16*>(dst),
+                                    src_stride / float_size,
+                                    dst_stride / half_size,
+                                    element_count);
+        }
+        else {
+            convert_from_float<Cpu>(src,
+                                    reinterpret_cast<float16*>(dst),
+                                    src_stride / float_size,
+                                    dst_stride / half_size,
+                                    element_count);
+        }
+    }
+
+    data_type src_type_;
+    data_type dst_type_;
+};
+
 void convert_vector(const detail::default_host_policy& policy,
                     const void* src,
                     void* dst,
                     data_type src_type,
                     data_type dst_type,
                     std::int64_t element_count) {
+    if (is_reduced_precision(src_type) || is_reduced_precision(dst_type)) {
+        const std::int64_t src_size = detail::get_data_type_size(src_type);
+        const std::int64_t dst_size = detail::get_data_type_size(dst_type);
+        reduced_precision_converter{ src_type, dst_type }(reinterpret_cast<const byte_t*>(src),
+                                                          reinterpret_cast<byte_t*>(dst),
+                                                          src_size,
+                                                          dst_size,
+                                                          element_count);
+        return;
+    }
     interop::daal_convert(src, dst, src_type, dst_type, element_count);
 }
 
@@ -36,6 +177,14 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t src_stride,
                     std::int64_t dst_stride,
                     std::int64_t element_count) {
+    if (is_reduced_precision(src_type) || is_reduced_precision(dst_type)) {
+        reduced_precision_converter{ src_type, dst_type }(reinterpret_cast<const byte_t*>(src),
+                                                          reinterpret_cast<byte_t*>(dst),
+                                                          src_stride,
+                                                          dst_stride,
+                                                          element_count);
+        return;
+    }
     interop::daal_convert(src, dst, src_type, dst_type, src_stride, dst_stride, element_count);
 }
 
@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/common.hpp"
+
+namespace oneapi::dal::backend {
+
+/// Converts the values of 16-bit floating-point type to :expr:`float`.
+/// The strides are given in elements.
+template <typename Cpu, typename Half>
+void convert_to_float(const Half* src,
+                      float* dst,
+                      std::int64_t src_stride,
+                      std::int64_t dst_stride,
+                      std::int64_t element_count);
+
+/// Converts the values of :expr:`float` type to 16-bit floating-point type
+/// with rounding to nearest, ties to even. The strides are given in elements.
+template <typename Cpu, typename Half>
+void convert_from_float(const float* src,
+                        Half* dst,
+                        std::int64_t src_stride,
+                        std::int64_t dst_stride,
+                        std::int64_t element_count);
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/cpu/convert_kernel.hpp"
+#include "oneapi/dal/table/backend/cpu/convert_kernel_scalar.hpp"
+
+namespace oneapi::dal::backend {
+
+template <>
+void convert_to_float<__CPU_TAG__, bfloat16>(const bfloat16* src,
+                                             float* dst,
+                                             std::int64_t src_stride,
+                                             std::int64_t dst_stride,
+                                             std::int64_t element_count) {
+    convert_to_float_scalar(src, dst, src_stride, dst_stride, element_count);
+}
+
+template <>
+void convert_to_float<__CPU_TAG__, float16>(const float16* src,
+                                            float* dst,
+                                            std::int64_t src_stride,
+                                            std::int64_t dst_stride,
+                                            std::int64_t element_count) {
+    convert_to_float_scalar(src, dst, src_stride, dst_stride, element_count);
+}
+
+template <>
+void convert_from_float<__CPU_TAG__, bfloat16>(const float* src,
+                                               bfloat16* dst,
+                                               std::int64_t src_stride,
+                                               std::int64_t dst_stride,
+                                               std::int64_t element_count) {
+    convert_from_float_scalar(src, dst, src_stride, dst_stride, element_count);
+}
+
+template <>
+void convert_from_float<__CPU_TAG__, float16>(const float* src,
+                                              float16* dst,
+                                              std::int64_t src_stride,
+                                              std::int64_t dst_stride,
+                                              std::int64_t element_count) {
+    convert_from_float_scalar(src, dst, src_stride, dst_stride, element_count);
+}
+
+} // namespace oneapi::dal::backend
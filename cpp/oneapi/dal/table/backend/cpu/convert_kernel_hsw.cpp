@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <immintrin.h>
+
+#include "oneapi/dal/table/backend/cpu/convert_kernel.hpp"
+#include "oneapi/dal/table/backend/cpu/convert_kernel_scalar.hpp"
+
+namespace oneapi::dal::backend {
+
+using cpu_t = cpu_dispatch_avx2;
+
+template <>
+void convert_to_float<cpu_t, bfloat16>(const bfloat16* src,
+                                       float* dst,
+                                       std::int64_t src_stride,
+                                       std::int64_t dst_stride,
+                                       std::int64_t element_count) {
+    std::int64_t i = 0;
+#if defined(__AVX2__)
+    if (src_stride == 1 && dst_stride == 1) {
+        // bfloat16 is the upper half of float, so the conversion is a shift
+        for (; i + 8 <= element_count; i += 8) {
+            const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m256i u = _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16);
+            _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(u));
+        }
+    }
+#endif
+    convert_to_float_scalar(src + i * src_stride,
+                            dst + i * dst_stride,
+                            src_stride,
+                            dst_stride,
+                            element_count - i);
+}
+
+template <>
+void convert_to_float<cpu_t, float16>(const float16* src,
+                                      float* dst,
+                                      std::int64_t src_stride,
+                                      std::int64_t dst_stride,
+                                      std::int64_t element_count) {
+    std::int64_t i = 0;
+#if defined(__F16C__)
+    if (src_stride == 1 && dst_stride == 1) {
+        for (; i + 8 <= element_count; i += 8) {
+            const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+        }
+    }
+#endif
+    convert_to_float_scalar(src + i * src_stride,
+                            dst + i * dst_stride,
+                            src_stride,
+                            dst_stride,
+                            element_count - i);
+}
+
+template <>
+void convert_from_float<cpu_t, bfloat16>(const float* src,
+                                         bfloat16* dst,
+                                         std::int64_t src_stride,
+                                         std::int64_t dst_stride,
+                                         std::int64_t element_count) {
+    convert_from_float_scalar(src, dst, src_stride, dst_stride, element_count);
+}
+
+template <>
+void convert_from_float<cpu_t, float16>(const float* src,
+                                        float16* dst,
+                                        std::int64_t src_stride,
+                                        std::int64_t dst_stride,
+                                        std::int64_t element_count) {
+    std::int64_t i = 0;
+#if defined(__F16C__)
+    if (src_stride == 1 && dst_stride == 1) {
+        for (; i + 8 <= element_count; i += 8) {
+            const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+        }
+    }
+#endif
+    convert_from_float_scalar(src + i * src_stride,
+                              dst + i * dst_stride,
+                              src_stride,
+                              dst_stride,
+                              element_count - i);
+}
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/common.hpp"
+
+namespace oneapi::dal::backend {
+
+template <typename Half>
+inline void convert_to_float_scalar(const Half* src,
+                                    float* dst,
+                                    std::int64_t src_stride,
+                                    std::int64_t dst_stride,
+                                    std::int64_t element_count) {
+    if (src_stride == 1 && dst_stride == 1) {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i] = float(src[i]);
+        }
+    }
+    else {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i * dst_stride] = float(src[i * src_stride]);
+        }
+    }
+}
+
+template <typename Half>
+inline void convert_from_float_scalar(const float* src,
+                                      Half* dst,
+                                      std::int64_t src_stride,
+                                      std::int64_t dst_stride,
+                                      std::int64_t element_count) {
+    if (src_stride == 1 && dst_stride == 1) {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i] = Half{ src[i] };
+        }
+    }
+    else {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i * dst_stride] = Half{ src[i * src_stride] };
+        }
+    }
+}
+
+} // namespace oneapi::dal::backend
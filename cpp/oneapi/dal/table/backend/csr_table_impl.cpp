@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+#include "oneapi/dal/table/backend/homogen_table_impl.hpp"
+
+namespace oneapi::dal::backend {
+
+using error_msg = dal::detail::error_messages;
+
+csr_table_impl::csr_table_impl(std::int64_t row_count,
+                               std::int64_t column_count,
+                               const array<byte_t>& data,
+                               const array<std::int64_t>& column_indices,
+                               const array<std::int64_t>& row_offsets,
+                               data_type dtype,
+                               sparse_indexing indexing)
+        : meta_(create_homogen_metadata(column_count, dtype)),
+          data_(data),
+          column_indices_(column_indices),
+          row_offsets_(row_offsets),
+          row_count_(row_count),
+          col_count_(column_count),
+          indexing_(indexing) {
+    if (row_count <= 0) {
+        throw dal::domain_error(error_msg::rc_leq_zero());
+    }
+
+    if (column_count <= 0) {
+        throw dal::domain_error(error_msg::cc_leq_zero());
+    }
+
+    if (row_offsets.get_count() != row_count + 1) {
+        throw dal::invalid_argument(error_msg::invalid_csr_row_offsets());
+    }
+
+    const std::int64_t base = (indexing == sparse_indexing::one_based) ? 1 : 0;
+    const std::int64_t* offsets = row_offsets.get_data();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        if (offsets[i + 1] < offsets[i]) {
+            throw dal::invalid_argument(error_msg::invalid_csr_row_offsets());
+        }
+    }
+    if (offsets[0] != base || offsets[row_count] - base != column_indices.get_count()) {
+        throw dal::invalid_argument(error_msg::invalid_csr_row_offsets());
+    }
+
+    // The accessors expand the rows by the column indices, so they must not point out of the row
+    const std::int64_t* cols = column_indices.get_data();
+    for (std::int64_t k = 0; k < column_indices.get_count(); k++) {
+        if (cols[k] < base || cols[k] >= column_count + base) {
+            throw dal::invalid_argument(error_msg::invalid_csr_column_indices());
+        }
+    }
+
+    const std::int64_t dtype_size = detail::get_data_type_size(dtype);
+    detail::check_mul_overflow(column_indices.get_count(), dtype_size);
+    if (data.get_count() != column_indices.get_count() * dtype_size) {
+        throw dal::domain_error(error_msg::invalid_data_block_size());
+    }
+}
+
+static void check_block_row_range(const range& rows, std::int64_t origin_row_count) {
+    const std::int64_t range_row_count = rows.get_element_count(origin_row_count);
+    detail::check_sum_overflow(rows.start_idx, range_row_count);
+    if (rows.start_idx + range_row_count > origin_row_count) {
+        throw dal::range_error(error_msg::invalid_range_of_rows());
+    }
+}
+
+template <typename Body>
+static void dispatch_by_data_type(data_type dtype, const byte_t* data, Body&& body) {
+    switch (dtype) {
+        case data_type::float32: body(reinterpret_cast<const float*>(data)); break;
+        case data_type::float64: body(reinterpret_cast<const double*>(data)); break;
+        case data_type::int32: body(reinterpret_cast<const std::int32_t*>(data)); break;
+        default: throw dal::domain_error(error_msg::unsupported_data_type());
+    }
+}
+
+template <typename Data>
+void csr_table_impl::pull_rows(array<Data>& block, const range& rows) const {
+    check_block_row_range(rows, row_count_);
+
+    const std::int64_t block_row_count = rows.get_element_count(row_count_);
+    detail::check_mul_overflow(block_row_count, col_count_);
+    const std::int64_t element_count = block_row_count * col_count_;
+
+    if (block.get_count() < element_count || block.has_mutable_data() == false) {
+        block.reset(element_count);
+    }
+    Data* dst = block.get_mutable_data();
+    for (std::int64_t i = 0; i < element_count; i++) {
+        dst[i] = Data(0);
+    }
+
+    const std::int64_t base = (indexing_ == sparse_indexing::one_based) ? 1 : 0;
+    const std::int64_t* offsets = row_offsets_.get_data() + rows.start_idx;
+    const std::int64_t* cols = column_indices_.get_data();
+
+    dispatch_by_data_type(meta_.get_data_type(0), data_.get_data(), [&](const auto* values) {
+        for (std::int64_t i = 0; i < block_row_count; i++) {
+            Data* dst_row = dst + i * col_count_;
+            for (std::int64_t k = offsets[i] - base; k < offsets[i + 1] - base; k++) {
+                dst_row[cols[k] - base] = static_cast<Data>(values[k]);
+            }
+        }
+    });
+}
+
+template <typename Data>
+void csr_table_impl::pull_column(array<Data>& block,
+                                 std::int64_t column_index,
+                                 const range& rows) const {
+    check_block_row_range(rows, row_count_);
+    if (column_index >= col_count_) {
+        throw dal::range_error(error_msg::column_index_out_of_range());
+    }
+
+    const std::int64_t block_row_count = rows.get_element_count(row_count_);
+    if (block.get_count() < block_row_count || block.has_mutable_data() == false) {
+        block.reset(block_row_count);
+    }
+    Data* dst = block.get_mutable_data();
+
+    const std::int64_t base = (indexing_ == sparse_indexing::one_based) ? 1 : 0;
+    const std::int64_t* offsets = row_offsets_.get_data() + rows.start_idx;
+    const std::int64_t* cols = column_indices_.get_data();
+
+    dispatch_by_data_type(meta_.get_data_type(0), data_.get_data(), [&](const auto* values) {
+        for (std::int64_t i = 0; i < block_row_count; i++) {
+            dst[i] = Data(0);
+            for (std::int64_t k = offsets[i] - base; k < offsets[i + 1] - base; k++) {
+                if (cols[k] - base == column_index) {
+                    dst[i] = static_cast<Data>(values[k]);
+                    break;
+                }
+            }
+        }
+    });
+}
+
+#define INSTANTIATE_IMPL(Data)                                                            \
+    template void csr_table_impl::pull_rows(array<Data>& block, const range& rows) const; \
+    template void csr_table_impl::pull_column(array<Data>& block,                         \
+                                              std::int64_t column_index,                  \
+                                              const range& rows) const;
+
+INSTANTIATE_IMPL(float)
+INSTANTIATE_IMPL(double)
+INSTANTIATE_IMPL(std::int32_t)
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/csr.hpp"
+
+namespace oneapi::dal::backend {
+
+class csr_table_impl {
+public:
+    csr_table_impl() : row_count_(0), col_count_(0), indexing_(sparse_indexing::one_based) {}
+
+    csr_table_impl(std::int64_t row_count,
+                   std::int64_t column_count,
+                   const array<byte_t>& data,
+                   const array<std::int64_t>& column_indices,
+                   const array<std::int64_t>& row_offsets,
+                   data_type dtype,
+                   sparse_indexing indexing);
+
+    std::int64_t get_column_count() const {
+        return col_count_;
+    }
+
+    std::int64_t get_row_count() const {
+        return row_count_;
+    }
+
+    const table_metadata& get_metadata() const {
+        return meta_;
+    }
+
+    data_layout get_data_layout() const {
+        return data_layout::unknown;
+    }
+
+    const void* get_data() const {
+        return data_.get_data();
+    }
+
+    const std::int64_t* get_column_indices() const {
+        return column_indices_.get_data();
+    }
+
+    const std::int64_t* get_row_offsets() const {
+        return row_offsets_.get_data();
+    }
+
+    std::int64_t get_non_zero_count() const {
+        return column_indices_.get_count();
+    }
+
+    sparse_indexing get_indexing() const {
+        return indexing_;
+    }
+
+    /// Expands the requested rows to a dense row-major block, zeros are filled in
+    template <typename Data>
+    void pull_rows(array<Data>& block, const range& rows) const;
+
+    /// Expands the requested values of the column to a dense block
+    template <typename Data>
+    void pull_column(array<Data>& block, std::int64_t column_index, const range& rows) const;
+
+private:
+    table_metadata meta_;
+    array<byte_t> data_;
+    array<std::int64_t> column_indices_;
+    array<std::int64_t> row_offsets_;
+    std::int64_t row_count_;
+    std::int64_t col_count_;
+    sparse_indexing indexing_;
+};
+
+} // namespace oneapi::dal::backend
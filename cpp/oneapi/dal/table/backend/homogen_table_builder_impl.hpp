@@ -90,6 +90,7 @@ public:
 
         const std::int64_t data_size = get_data_size(row_count, column_count, dtype_);
         data_.reset(data_size);
+        detail::first_touch(detail::default_host_policy{}, data_.get_mutable_data(), data_size);
         row_count_ = row_count;
         column_count_ = column_count;
     }
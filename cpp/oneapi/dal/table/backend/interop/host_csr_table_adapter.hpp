@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/data_management/data/csr_numeric_table.h>
+
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/daal_object_owner.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+using daal_csr_table_ptr_t = daal::services::SharedPtr<daal::data_management::CSRNumericTable>;
+
+// DAAL stores the column indices and the row offsets of CSR tables in size_t arrays,
+// so the arrays of the oneDAL table can be passed to DAAL as is only if the types match
+static_assert(sizeof(std::int64_t) == sizeof(std::size_t));
+
+// This function shall be used only to represent immutable data on DAAL side.
+// Any attempts to change the data inside the returned table lead to undefined behavior.
+// The returned table refers to the data of the original table without copying;
+// the original table is kept alive until the last reference to its data on DAAL side is released.
+template <typename Data>
+inline daal_csr_table_ptr_t wrap_by_host_csr_adapter(const csr_table& table) {
+    using daal::data_management::CSRNumericTable;
+    using daal::data_management::CSRNumericTableIface;
+
+    auto data = const_cast<Data*>(table.get_data<Data>());
+    auto column_indices =
+        reinterpret_cast<std::size_t*>(const_cast<std::int64_t*>(table.get_column_indices()));
+    auto row_offsets =
+        reinterpret_cast<std::size_t*>(const_cast<std::int64_t*>(table.get_row_offsets()));
+
+    daal::services::Status status;
+    auto result = CSRNumericTable::create(
+        daal::services::SharedPtr<Data>(data, daal_object_owner{ table }),
+        daal::services::SharedPtr<std::size_t>(column_indices, daal_object_owner{ table }),
+        daal::services::SharedPtr<std::size_t>(row_offsets, daal_object_owner{ table }),
+        dal::detail::integral_cast<std::size_t>(table.get_column_count()),
+        dal::detail::integral_cast<std::size_t>(table.get_row_count()),
+        CSRNumericTableIface::oneBased,
+        &status);
+    status_to_exception(status);
+    return result;
+}
+
+// DAAL CSR kernels expect one-based indices, tables with zero-based indexing cannot be wrapped.
+// Returns an empty pointer in that case, as well as for the data types unknown to DAAL.
+inline daal_csr_table_ptr_t wrap_by_host_csr_adapter(const csr_table& table) {
+    if (table.get_indexing() != sparse_indexing::one_based) {
+        return daal_csr_table_ptr_t();
+    }
+
+    const auto& dtype = table.get_metadata().get_data_type(0);
+
+    switch (dtype) {
+        case data_type::float32: return wrap_by_host_csr_adapter<float>(table);
+        case data_type::float64: return wrap_by_host_csr_adapter<double>(table);
+        case data_type::int32: return wrap_by_host_csr_adapter<std::int32_t>(table);
+        default: return daal_csr_table_ptr_t();
+    }
+}
+
+} // namespace oneapi::dal::backend::interop
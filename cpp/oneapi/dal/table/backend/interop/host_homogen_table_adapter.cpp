@@ -216,7 +216,7 @@ auto host_homogen_table_adapter<Data>::read_rows_impl(std::size_t vector_idx,
         return daal::services::ErrorMethodNotImplemented;
     }
 
-    if (is_rowmajor_) {
+    if (is_direct_access_) {
         return base::getBlockOfRows(vector_idx, vector_num, rwflag, block);
     }
     else {
@@ -276,7 +276,7 @@ auto host_homogen_table_adapter<Data>::read_column_values_impl(std::size_t featu
         return daal::services::ErrorMethodNotImplemented;
     }
 
-    if (is_rowmajor_) {
+    if (is_direct_access_) {
         return base::getBlockOfColumnValues(feature_idx, vector_idx, value_num, rwflag, block);
     }
     else {
@@ -331,17 +331,32 @@ bool host_homogen_table_adapter<Data>::check_column_index_in_range(const block_i
     return info.single_column_requested && info.column_index < column_count;
 }
 
+static bool is_direct_access_possible(const homogen_table& table, data_type dtype) {
+    return table.has_data() && table.get_data_layout() == data_layout::row_major &&
+           table.get_metadata().get_data_type(0) == dtype;
+}
+
+template <typename Data>
+static daal::services::SharedPtr<Data> get_direct_access_data(const homogen_table& table) {
+    if (!is_direct_access_possible(table, detail::make_data_type<Data>())) {
+        // The values are available via accessors only
+        return daal::services::SharedPtr<Data>{};
+    }
+    // The following const_cast is safe only when this class is used for read-only
+    // operations. Use on write leads to undefined behaviour.
+    return daal::services::SharedPtr<Data>{ const_cast<Data*>(table.get_data<Data>()),
+                                            daal_object_owner(table) };
+}
+
 template <typename Data>
 host_homogen_table_adapter<Data>::host_homogen_table_adapter(const homogen_table& table,
                                                              status_t& stat)
-        // The following const_cast is safe only when this class is used for read-only
-        // operations. Use on write leads to undefined behaviour.
         : base(daal::data_management::DictionaryIface::equal,
-               ptr_data_t{ const_cast<Data*>(table.get_data<Data>()), daal_object_owner(table) },
+               get_direct_access_data<Data>(table),
                table.get_column_count(),
                table.get_row_count(),
                stat),
-          is_rowmajor_(table.get_data_layout() == data_layout::row_major) {
+          is_direct_access_(is_direct_access_possible(table, detail::make_data_type<Data>())) {
     if (!stat.ok()) {
         return;
     }
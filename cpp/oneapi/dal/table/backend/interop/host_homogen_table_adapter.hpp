@@ -29,6 +29,8 @@ namespace oneapi::dal::backend::interop {
 
 // This class shall be used only to represent immutable data on DAAL side.
 // Any attempts to change the data inside objects of that class lead to undefined behavior.
+// The table may store the values of other type than Data, e.g. bfloat16, then the blocks
+// requested by DAAL are converted by accessors and the whole table is never copied.
 template <typename Data>
 class host_homogen_table_adapter : public daal::data_management::HomogenNumericTable<Data> {
     using base = daal::data_management::HomogenNumericTable<Data>;
@@ -114,7 +116,7 @@ private:
     host_homogen_table_adapter(const homogen_table& table, status_t& stat);
 
 private:
-    const bool is_rowmajor_;
+    const bool is_direct_access_;
     homogen_table original_table_;
 };
 
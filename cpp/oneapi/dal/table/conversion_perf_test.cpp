@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::test {
+
+namespace te = dal::test::engine;
+namespace interop = dal::backend::interop;
+
+TEST("table conversion 1M x 50", "[table][perf]") {
+    const auto df = GENERATE_DATAFRAME(te::dataframe_builder{ 1000000, 50 }.fill_uniform(-1, 1));
+    const auto float_table = df.get_table(te::table_id::homogen<float>());
+    const auto double_table = df.get_table(te::table_id::homogen<double>());
+    const auto& float_homogen = static_cast<const homogen_table&>(float_table);
+
+    te::set_benchmark_workload(df.get_row_count(), df.get_size());
+
+    BENCHMARK("pull rows without conversion") {
+        return row_accessor<const float>{ float_table }.pull();
+    };
+
+    BENCHMARK("pull rows float64 to float32") {
+        return row_accessor<const float>{ double_table }.pull();
+    };
+
+    BENCHMARK("pull rows float32 to float64") {
+        return row_accessor<const double>{ float_table }.pull();
+    };
+
+    BENCHMARK("wrap to daal table") {
+        return interop::convert_to_daal_table<float>(float_homogen);
+    };
+
+    BENCHMARK("copy to daal table") {
+        return interop::copy_to_daal_homogen_table<float>(float_table);
+    };
+
+    const auto daal_table = interop::copy_to_daal_homogen_table<float>(float_table);
+
+    BENCHMARK("convert from daal table") {
+        return interop::convert_from_daal_homogen_table<float>(daal_table);
+    };
+}
+
+} // namespace oneapi::dal::test
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+
+using std::int64_t;
+
+namespace oneapi::dal {
+namespace v1 {
+
+int64_t csr_table::kind() {
+    return 2;
+}
+
+csr_table::csr_table() {
+    table::init_impl(
+        new detail::csr_table_impl_wrapper{ backend::csr_table_impl{}, csr_table::kind() });
+}
+
+const void* csr_table::get_data() const {
+    const auto& impl = detail::cast_impl<detail::csr_table_impl_iface>(*this);
+    return impl.get_data();
+}
+
+const int64_t* csr_table::get_column_indices() const {
+    const auto& impl = detail::cast_impl<detail::csr_table_impl_iface>(*this);
+    return impl.get_column_indices();
+}
+
+const int64_t* csr_table::get_row_offsets() const {
+    const auto& impl = detail::cast_impl<detail::csr_table_impl_iface>(*this);
+    return impl.get_row_offsets();
+}
+
+int64_t csr_table::get_non_zero_count() const {
+    const auto& impl = detail::cast_impl<detail::csr_table_impl_iface>(*this);
+    return impl.get_non_zero_count();
+}
+
+sparse_indexing csr_table::get_indexing() const {
+    const auto& impl = detail::cast_impl<detail::csr_table_impl_iface>(*this);
+    return impl.get_indexing();
+}
+
+void csr_table::init_impl(int64_t row_count,
+                          int64_t column_count,
+                          const array<byte_t>& data,
+                          const array<int64_t>& column_indices,
+                          const array<int64_t>& row_offsets,
+                          const data_type& dtype,
+                          sparse_indexing indexing) {
+    auto* wrapper = new detail::csr_table_impl_wrapper{
+        backend::csr_table_impl{ row_count,
+                                 column_count,
+                                 data,
+                                 column_indices,
+                                 row_offsets,
+                                 dtype,
+                                 indexing },
+        csr_table::kind()
+    };
+    table::init_impl(wrapper);
+}
+
+} // namespace v1
+} // namespace oneapi::dal
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal {
+namespace v1 {
+
+/// Indexing of the column indices and the row offsets in the sparse table
+enum class sparse_indexing { zero_based, one_based };
+
+class ONEDAL_EXPORT csr_table : public table {
+    friend detail::pimpl_accessor;
+    using pimpl = detail::pimpl<detail::csr_table_impl_iface>;
+
+public:
+    /// Returns the unique id of ``csr_table`` class.
+    static std::int64_t kind();
+
+    /// Creates a new ``csr_table`` instance from externally-defined data blocks in the
+    /// compressed sparse row (CSR) format. Table object refers to the data but does not
+    /// own it. The responsibility to free the data remains on the user side.
+    ///
+    /// @tparam Data                  The type of elements in the data block that will be stored into the table.
+    ///                               The :literal:`Data` type should be at least :expr:`float`, :expr:`double` or :expr:`std::int32_t`.
+    /// @param data_pointer           The pointer to the non-zero values of the table.
+    /// @param column_indices_pointer The pointer to the column indices of the non-zero values.
+    /// @param row_offsets_pointer    The pointer to the offsets of the rows in the arrays of values and column indices.
+    ///                               Contains :expr:`row_count + 1` elements.
+    /// @param row_count              The number of rows in the table.
+    /// @param column_count           The number of columns in the table.
+    /// @param indexing               The indexing of the column indices and the row offsets.
+    template <typename Data>
+    static csr_table wrap(const Data* data_pointer,
+                          const std::int64_t* column_indices_pointer,
+                          const std::int64_t* row_offsets_pointer,
+                          std::int64_t row_count,
+                          std::int64_t column_count,
+                          sparse_indexing indexing = sparse_indexing::one_based) {
+        return csr_table{ data_pointer,
+                          column_indices_pointer,
+                          row_offsets_pointer,
+                          row_count,
+                          column_count,
+                          dal::detail::empty_delete<const Data>(),
+                          dal::detail::empty_delete<const std::int64_t>(),
+                          dal::detail::empty_delete<const std::int64_t>(),
+                          indexing };
+    }
+
+public:
+    /// Creates a new ``csr_table`` instance with zero number of rows and columns.
+    /// The :expr:`kind` is set to``csr_table::kind()``.
+    csr_table();
+
+    /// Creates a new ``csr_table`` instance from externally-defined data blocks in the
+    /// compressed sparse row (CSR) format. Table object owns the data blocks.
+    ///
+    /// @tparam Data                   The type of elements in the data block that will be stored into the table.
+    ///                                The :literal:`Data` type should be at least :expr:`float`, :expr:`double` or :expr:`std::int32_t`.
+    /// @tparam ConstDataDeleter       The type of a deleter called on ``data_pointer`` when
+    ///                                the last table that refers it is out of the scope.
+    /// @tparam ConstIndexDeleter      The type of a deleter called on ``column_indices_pointer`` and
+    ///                                ``row_offsets_pointer`` when the last table that refers them is out of the scope.
+    ///
+    /// @param data_pointer            The pointer to the non-zero values of the table.
+    /// @param column_indices_pointer  The pointer to the column indices of the non-zero values.
+    /// @param row_offsets_pointer     The pointer to the offsets of the rows in the arrays of values and column indices.
+    ///                                Contains :expr:`row_count + 1` elements.
+    /// @param row_count               The number of rows in the table.
+    /// @param column_count            The number of columns in the table.
+    /// @param data_deleter            The deleter that is called on the ``data_pointer``.
+    /// @param column_indices_deleter  The deleter that is called on the ``column_indices_pointer``.
+    /// @param row_offsets_deleter     The deleter that is called on the ``row_offsets_pointer``.
+    /// @param indexing                The indexing of the column indices and the row offsets.
+    template <typename Data, typename ConstDataDeleter, typename ConstIndexDeleter>
+    csr_table(const Data* data_pointer,
+              const std::int64_t* column_indices_pointer,
+              const std::int64_t* row_offsets_pointer,
+              std::int64_t row_count,
+              std::int64_t column_count,
+              ConstDataDeleter&& data_deleter,
+              ConstIndexDeleter&& column_indices_deleter,
+              ConstIndexDeleter&& row_offsets_deleter,
+              sparse_indexing indexing = sparse_indexing::one_based) {
+        init_impl(data_pointer,
+                  column_indices_pointer,
+                  row_offsets_pointer,
+                  row_count,
+                  column_count,
+                  std::forward<ConstDataDeleter>(data_deleter),
+                  std::forward<ConstIndexDeleter>(column_indices_deleter),
+                  std::forward<ConstIndexDeleter>(row_offsets_deleter),
+                  indexing);
+    }
+
+    /// Returns the :literal:`data` pointer cast to the :literal:`Data` type. No checks are
+    /// performed that this type is the actual type of the data within the table.
+    template <typename Data>
+    const Data* get_data() const {
+        return reinterpret_cast<const Data*>(this->get_data());
+    }
+
+    /// The pointer to the non-zero values of the table.
+    /// Should be equal to ``nullptr`` when :expr:`row_count == 0` and :expr:`column_count == 0`.
+    const void* get_data() const;
+
+    /// The pointer to the column indices of the non-zero values.
+    const std::int64_t* get_column_indices() const;
+
+    /// The pointer to the offsets of the rows. Contains :expr:`row_count + 1` elements.
+    const std::int64_t* get_row_offsets() const;
+
+    /// The number of non-zero values in the table.
+    std::int64_t get_non_zero_count() const;
+
+    /// The indexing of the column indices and the row offsets.
+    sparse_indexing get_indexing() const;
+
+    /// The unique id of the csr table type.
+    std::int64_t get_kind() const {
+        return kind();
+    }
+
+private:
+    template <typename Data, typename ConstDataDeleter, typename ConstIndexDeleter>
+    void init_impl(const Data* data_pointer,
+                   const std::int64_t* column_indices_pointer,
+                   const std::int64_t* row_offsets_pointer,
+                   std::int64_t row_count,
+                   std::int64_t column_count,
+                   ConstDataDeleter&& data_deleter,
+                   ConstIndexDeleter&& column_indices_deleter,
+                   ConstIndexDeleter&& row_offsets_deleter,
+                   sparse_indexing indexing) {
+        using error_msg = dal::detail::error_messages;
+
+        if (row_count <= 0) {
+            throw dal::domain_error(error_msg::rc_leq_zero());
+        }
+
+        if (column_count <= 0) {
+            throw dal::domain_error(error_msg::cc_leq_zero());
+        }
+
+        const std::int64_t base = (indexing == sparse_indexing::one_based) ? 1 : 0;
+        const std::int64_t non_zero_count = row_offsets_pointer[row_count] - base;
+        if (row_offsets_pointer[0] != base || non_zero_count < 0) {
+            throw dal::invalid_argument(error_msg::invalid_csr_row_offsets());
+        }
+
+        dal::detail::check_mul_overflow(non_zero_count, static_cast<std::int64_t>(sizeof(Data)));
+        array<Data> data_array{ data_pointer,
+                                non_zero_count,
+                                std::forward<ConstDataDeleter>(data_deleter) };
+        auto byte_array = array<byte_t>{ data_array,
+                                         reinterpret_cast<const byte_t*>(data_pointer),
+                                         non_zero_count * static_cast<std::int64_t>(sizeof(Data)) };
+
+        array<std::int64_t> column_indices{ column_indices_pointer,
+                                            non_zero_count,
+                                            std::forward<ConstIndexDeleter>(
+                                                column_indices_deleter) };
+        array<std::int64_t> row_offsets{ row_offsets_pointer,
+                                         row_count + 1,
+                                         std::forward<ConstIndexDeleter>(row_offsets_deleter) };
+
+        init_impl(row_count,
+                  column_count,
+                  byte_array,
+                  column_indices,
+                  row_offsets,
+                  detail::make_data_type<Data>(),
+                  indexing);
+    }
+
+    void init_impl(std::int64_t row_count,
+                   std::int64_t column_count,
+                   const array<byte_t>& data,
+                   const array<std::int64_t>& column_indices,
+                   const array<std::int64_t>& row_offsets,
+                   const data_type& dtype,
+                   sparse_indexing indexing);
+
+private:
+    csr_table(const pimpl& impl) : table(impl) {}
+};
+
+} // namespace v1
+
+using v1::sparse_indexing;
+using v1::csr_table;
+
+} // namespace oneapi::dal
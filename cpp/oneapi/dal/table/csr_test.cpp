@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using namespace oneapi;
+
+TEST(csr_table_test, can_construct_empty_table) {
+    csr_table t;
+
+    ASSERT_FALSE(t.has_data());
+    ASSERT_EQ(t.get_kind(), csr_table::kind());
+    ASSERT_EQ(t.get_row_count(), 0);
+    ASSERT_EQ(t.get_column_count(), 0);
+    ASSERT_EQ(t.get_non_zero_count(), 0);
+}
+
+TEST(csr_table_test, can_wrap_one_based_table_3x4) {
+    // 1 0 2 0
+    // 0 0 0 0
+    // 0 3 0 4
+    const float data[] = { 1.f, 2.f, 3.f, 4.f };
+    const std::int64_t column_indices[] = { 1, 3, 2, 4 };
+    const std::int64_t row_offsets[] = { 1, 3, 3, 5 };
+
+    auto t = csr_table::wrap(data, column_indices, row_offsets, 3, 4);
+
+    ASSERT_TRUE(t.has_data());
+    ASSERT_EQ(t.get_kind(), csr_table::kind());
+    ASSERT_EQ(t.get_row_count(), 3);
+    ASSERT_EQ(t.get_column_count(), 4);
+    ASSERT_EQ(t.get_non_zero_count(), 4);
+    ASSERT_EQ(t.get_indexing(), sparse_indexing::one_based);
+    ASSERT_EQ(t.get_data<float>(), data);
+    ASSERT_EQ(t.get_column_indices(), column_indices);
+    ASSERT_EQ(t.get_row_offsets(), row_offsets);
+    ASSERT_EQ(t.get_metadata().get_data_type(0), data_type::float32);
+}
+
+TEST(csr_table_test, can_pull_dense_rows) {
+    const double data[] = { 1.0, 2.0, 3.0, 4.0 };
+    const std::int64_t column_indices[] = { 1, 3, 2, 4 };
+    const std::int64_t row_offsets[] = { 1, 3, 3, 5 };
+    const float expected[] = { 0.f, 0.f, 0.f, 0.f, 0.f, 3.f, 0.f, 4.f };
+
+    const table t = csr_table::wrap(data, column_indices, row_offsets, 3, 4);
+    const auto rows = row_accessor<const float>{ t }.pull({ 1, 3 });
+
+    ASSERT_EQ(rows.get_count(), 8);
+    for (std::int64_t i = 0; i < rows.get_count(); i++) {
+        ASSERT_EQ(rows[i], expected[i]);
+    }
+}
+
+TEST(csr_table_test, can_pull_dense_column) {
+    const float data[] = { 1.f, 2.f, 3.f, 4.f };
+    const std::int64_t column_indices[] = { 1, 3, 2, 4 };
+    const std::int64_t row_offsets[] = { 1, 3, 3, 5 };
+
+    const table t = csr_table::wrap(data, column_indices, row_offsets, 3, 4);
+    const auto column = column_accessor<const double>{ t }.pull(2);
+
+    ASSERT_EQ(column.get_count(), 3);
+    ASSERT_EQ(column[0], 2.0);
+    ASSERT_EQ(column[1], 0.0);
+    ASSERT_EQ(column[2], 0.0);
+}
+
+TEST(csr_table_test, can_wrap_zero_based_table) {
+    const std::int32_t data[] = { 5, 6 };
+    const std::int64_t column_indices[] = { 1, 0 };
+    const std::int64_t row_offsets[] = { 0, 1, 2 };
+
+    auto t = csr_table::wrap(data, column_indices, row_offsets, 2, 2, sparse_indexing::zero_based);
+    ASSERT_EQ(t.get_indexing(), sparse_indexing::zero_based);
+
+    const auto rows = row_accessor<const std::int32_t>{ t }.pull();
+    ASSERT_EQ(rows.get_count(), 4);
+    ASSERT_EQ(rows[0], 0);
+    ASSERT_EQ(rows[1], 5);
+    ASSERT_EQ(rows[2], 6);
+    ASSERT_EQ(rows[3], 0);
+}
+
+TEST(csr_table_bad_arg_test, invalid_constructor) {
+    const float data[] = { 1.f, 2.f };
+    const std::int64_t column_indices[] = { 1, 2 };
+    const std::int64_t row_offsets[] = { 1, 2, 3 };
+
+    ASSERT_NO_THROW(csr_table::wrap(data, column_indices, row_offsets, 2, 2));
+    ASSERT_THROW(csr_table::wrap(data, column_indices, row_offsets, 0, 2), dal::domain_error);
+    ASSERT_THROW(csr_table::wrap(data, column_indices, row_offsets, 2, -1), dal::domain_error);
+}
+
+TEST(csr_table_bad_arg_test, invalid_row_offsets) {
+    const float data[] = { 1.f, 2.f, 3.f };
+    const std::int64_t column_indices[] = { 1, 2, 1 };
+    const std::int64_t decreasing_row_offsets[] = { 1, 3, 2, 4 };
+    const std::int64_t below_first_row_offsets[] = { 1, 0, 4, 4 };
+    const std::int64_t zero_based_row_offsets[] = { 0, 1, 2, 3 };
+    const std::int64_t negative_count_row_offsets[] = { 1, 1, 1, 0 };
+
+    ASSERT_THROW(csr_table::wrap(data, column_indices, decreasing_row_offsets, 3, 2),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data, column_indices, below_first_row_offsets, 3, 2),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data, column_indices, zero_based_row_offsets, 3, 2),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data, column_indices, negative_count_row_offsets, 3, 2),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data,
+                                 column_indices,
+                                 decreasing_row_offsets,
+                                 3,
+                                 2,
+                                 sparse_indexing::zero_based),
+                 dal::invalid_argument);
+}
+
+TEST(csr_table_bad_arg_test, invalid_column_indices) {
+    const float data[] = { 1.f, 2.f, 3.f };
+    const std::int64_t row_offsets[] = { 1, 3, 3, 4 };
+    const std::int64_t zero_based_row_offsets[] = { 0, 2, 2, 3 };
+    const std::int64_t last_column_indices[] = { 1, 3, 3 };
+    const std::int64_t past_last_column_indices[] = { 1, 4, 2 };
+    const std::int64_t zero_column_indices[] = { 1, 2, 0 };
+    const std::int64_t negative_column_indices[] = { -1, 0, 1 };
+
+    ASSERT_NO_THROW(csr_table::wrap(data, last_column_indices, row_offsets, 3, 3));
+    ASSERT_THROW(csr_table::wrap(data, past_last_column_indices, row_offsets, 3, 3),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data, zero_column_indices, row_offsets, 3, 3),
+                 dal::invalid_argument);
+
+    ASSERT_NO_THROW(csr_table::wrap(data,
+                                    zero_column_indices,
+                                    zero_based_row_offsets,
+                                    3,
+                                    3,
+                                    sparse_indexing::zero_based));
+    ASSERT_THROW(csr_table::wrap(data,
+                                 last_column_indices,
+                                 zero_based_row_offsets,
+                                 3,
+                                 3,
+                                 sparse_indexing::zero_based),
+                 dal::invalid_argument);
+    ASSERT_THROW(csr_table::wrap(data,
+                                 negative_column_indices,
+                                 zero_based_row_offsets,
+                                 3,
+                                 3,
+                                 sparse_indexing::zero_based),
+                 dal::invalid_argument);
+}
+
+TEST(csr_table_bad_arg_test, invalid_non_zero_count) {
+    const auto data = array<float>::zeros(2);
+    const auto column_indices = array<std::int64_t>::full(2, std::int64_t(1));
+    auto row_offsets = array<std::int64_t>::full(3, std::int64_t(1));
+    row_offsets.get_mutable_data()[2] = 4;
+
+    const std::int64_t byte_count = data.get_count() * sizeof(float);
+    const auto bytes =
+        array<byte_t>{ data, reinterpret_cast<const byte_t*>(data.get_data()), byte_count };
+
+    ASSERT_THROW((backend::csr_table_impl{ 2,
+                                           2,
+                                           bytes,
+                                           column_indices,
+                                           row_offsets,
+                                           data_type::float32,
+                                           sparse_indexing::one_based }),
+                 dal::invalid_argument);
+}
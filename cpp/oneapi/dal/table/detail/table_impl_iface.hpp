@@ -22,10 +22,12 @@ namespace oneapi::dal {
 namespace v1 {
 class table_metadata;
 enum class data_layout;
+enum class sparse_indexing;
 } // namespace v1
 
 using v1::table_metadata;
 using v1::data_layout;
+using v1::sparse_indexing;
 
 } // namespace oneapi::dal
 
@@ -45,4 +47,13 @@ public:
     virtual const void* get_data() const = 0;
 };
 
+class csr_table_impl_iface : public table_impl_iface {
+public:
+    virtual const void* get_data() const = 0;
+    virtual const std::int64_t* get_column_indices() const = 0;
+    virtual const std::int64_t* get_row_offsets() const = 0;
+    virtual std::int64_t get_non_zero_count() const = 0;
+    virtual sparse_indexing get_indexing() const = 0;
+};
+
 } // namespace oneapi::dal::detail
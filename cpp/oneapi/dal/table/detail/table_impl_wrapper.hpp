@@ -144,9 +144,90 @@ private:
 #endif
 };
 
+template <typename Impl>
+class csr_table_impl_wrapper : public csr_table_impl_iface, public base {
+public:
+#ifdef ONEDAL_DATA_PARALLEL
+    csr_table_impl_wrapper(Impl&& obj, std::int64_t csr_table_kind)
+            : kind_(csr_table_kind),
+              impl_(std::move(obj)),
+              host_access_ptr_(new access_wrapper_host<Impl>{ impl_ }),
+              dpc_access_ptr_(new access_wrapper_dpc<Impl>{ impl_ }) {}
+#else
+    csr_table_impl_wrapper(Impl&& obj, std::int64_t csr_table_kind)
+            : kind_(csr_table_kind),
+              impl_(std::move(obj)),
+              host_access_ptr_(new access_wrapper_host<Impl>{ impl_ }) {}
+#endif
+
+    std::int64_t get_column_count() const override {
+        return impl_.get_column_count();
+    }
+
+    std::int64_t get_row_count() const override {
+        return impl_.get_row_count();
+    }
+
+    const table_metadata& get_metadata() const override {
+        return impl_.get_metadata();
+    }
+
+    const void* get_data() const override {
+        return impl_.get_data();
+    }
+
+    const std::int64_t* get_column_indices() const override {
+        return impl_.get_column_indices();
+    }
+
+    const std::int64_t* get_row_offsets() const override {
+        return impl_.get_row_offsets();
+    }
+
+    std::int64_t get_non_zero_count() const override {
+        return impl_.get_non_zero_count();
+    }
+
+    sparse_indexing get_indexing() const override {
+        return impl_.get_indexing();
+    }
+
+    std::int64_t get_kind() const override {
+        return kind_;
+    }
+
+    data_layout get_data_layout() const override {
+        return impl_.get_data_layout();
+    }
+
+    access_iface_host& get_access_iface_host() const override {
+        return *host_access_ptr_.get();
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    access_iface_dpc& get_access_iface_dpc() const override {
+        return *dpc_access_ptr_.get();
+    }
+#endif
+
+    Impl& get() {
+        return impl_;
+    }
+
+private:
+    const std::int64_t kind_;
+    Impl impl_;
+
+    unique<access_iface_host> host_access_ptr_;
+#ifdef ONEDAL_DATA_PARALLEL
+    unique<access_iface_dpc> dpc_access_ptr_;
+#endif
+};
+
 } // namespace v1
 
 using v1::table_impl_wrapper;
 using v1::homogen_table_impl_wrapper;
+using v1::csr_table_impl_wrapper;
 
 } // namespace oneapi::dal::detail
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+using error_msg = dal::detail::error_messages;
+
+void serialize_table(binary_output_archive& archive, const table& t) {
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+
+    archive.write(row_count);
+    archive.write(column_count);
+    if (!t.has_data()) {
+        return;
+    }
+
+    if (t.get_kind() == homogen_table::kind()) {
+        const auto& homogen = static_cast<const homogen_table&>(t);
+        const data_type dtype = t.get_metadata().get_data_type(0);
+        const std::int64_t dtype_size = get_data_type_size(dtype);
+        check_mul_overflow(row_count, column_count);
+        check_mul_overflow(row_count * column_count, dtype_size);
+
+        archive.write(dtype);
+        archive.write(homogen.get_data_layout());
+        archive.write_block(homogen.get_data(), row_count * column_count * dtype_size);
+    }
+    else {
+        const auto rows = row_accessor<const double>{ t }.pull();
+        archive.write(data_type::float64);
+        archive.write(data_layout::row_major);
+        archive.write_block(rows);
+    }
+}
+
+template <typename Data>
+static table build_table(const array<byte_t>& block,
+                         std::int64_t row_count,
+                         std::int64_t column_count,
+                         data_layout layout) {
+    check_mul_overflow(row_count * column_count, std::int64_t(sizeof(Data)));
+    if (block.get_count() != row_count * column_count * std::int64_t(sizeof(Data))) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+    const auto data = array<Data>{ block,
+                                   reinterpret_cast<const Data*>(block.get_data()),
+                                   row_count * column_count };
+    return homogen_table_builder{}.reset(data, row_count, column_count).set_layout(layout).build();
+}
+
+table deserialize_table(binary_input_archive& archive) {
+    const auto row_count = archive.read<std::int64_t>();
+    const auto column_count = archive.read<std::int64_t>();
+    if (row_count == 0 && column_count == 0) {
+        return table{};
+    }
+    if (row_count <= 0 || column_count <= 0) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+    check_mul_overflow(row_count, column_count);
+
+    const auto dtype = archive.read<data_type>();
+    const auto layout = archive.read<data_layout>();
+    if (layout != data_layout::row_major && layout != data_layout::column_major) {
+        throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+
+    const auto block = archive.read_block();
+    switch (dtype) {
+        case data_type::float32:
+            return build_table<float>(block, row_count, column_count, layout);
+        case data_type::float64:
+            return build_table<double>(block, row_count, column_count, layout);
+        case data_type::int32:
+            return build_table<std::int32_t>(block, row_count, column_count, layout);
+        case data_type::bfloat16:
+            return build_table<bfloat16>(block, row_count, column_count, layout);
+        case data_type::float16:
+            return build_table<float16>(block, row_count, column_count, layout);
+        default: throw invalid_argument(error_msg::archive_is_corrupted());
+    }
+}
+
+} // namespace v1
+} // namespace oneapi::dal::detail
@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/archive.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// Writes the table to the archive. Homogen tables are written as is,
+/// tables of other kinds are converted to the row-major :expr:`float64` data.
+ONEDAL_EXPORT void serialize_table(binary_output_archive& archive, const table& t);
+
+/// Reads the table written by ``serialize_table``. The returned table is homogen,
+/// its data refers to the memory of the archive without copying.
+ONEDAL_EXPORT table deserialize_table(binary_input_archive& archive);
+
+} // namespace v1
+
+using v1::serialize_table;
+using v1::deserialize_table;
+
+} // namespace oneapi::dal::detail
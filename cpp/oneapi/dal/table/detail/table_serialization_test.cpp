@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::detail;
+
+constexpr std::int64_t test_tag = 1;
+
+static table serialize_and_deserialize(const table& t) {
+    binary_output_archive out{ test_tag };
+    serialize_table(out, t);
+    binary_input_archive in{ out.finish(), test_tag };
+    return deserialize_table(in);
+}
+
+TEST(table_serialization_test, can_serialize_homogen_table) {
+    const float data[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+    const auto t = homogen_table::wrap(data, 2, 3, data_layout::column_major);
+
+    const auto restored = serialize_and_deserialize(t);
+
+    ASSERT_EQ(restored.get_kind(), homogen_table::kind());
+    ASSERT_EQ(restored.get_row_count(), 2);
+    ASSERT_EQ(restored.get_column_count(), 3);
+    ASSERT_EQ(restored.get_data_layout(), data_layout::column_major);
+    ASSERT_EQ(restored.get_metadata().get_data_type(0), data_type::float32);
+
+    const auto& homogen = static_cast<const homogen_table&>(restored);
+    const float* restored_data = homogen.get_data<float>();
+    ASSERT_NE(restored_data, data);
+    for (std::int64_t i = 0; i < 6; i++) {
+        ASSERT_FLOAT_EQ(restored_data[i], data[i]);
+    }
+}
+
+TEST(table_serialization_test, can_serialize_empty_table) {
+    const auto restored = serialize_and_deserialize(table{});
+    ASSERT_FALSE(restored.has_data());
+}
+
+TEST(table_serialization_test, converts_csr_table_to_dense_float64) {
+    const float data[] = { 1.0f, 2.0f, 3.0f };
+    const std::int64_t column_indices[] = { 1, 3, 2 };
+    const std::int64_t row_offsets[] = { 1, 3, 4 };
+    const auto t = csr_table::wrap(data, column_indices, row_offsets, 2, 3);
+
+    const auto restored = serialize_and_deserialize(t);
+
+    ASSERT_EQ(restored.get_kind(), homogen_table::kind());
+    ASSERT_EQ(restored.get_metadata().get_data_type(0), data_type::float64);
+
+    const double expected[] = { 1.0, 0.0, 2.0, 0.0, 3.0, 0.0 };
+    const auto rows = row_accessor<const double>{ restored }.pull();
+    ASSERT_EQ(rows.get_count(), 6);
+    for (std::int64_t i = 0; i < 6; i++) {
+        ASSERT_DOUBLE_EQ(rows[i], expected[i]);
+    }
+}
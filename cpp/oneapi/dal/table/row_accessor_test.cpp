@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <limits>
+
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "oneapi/dal/table/column_accessor.hpp"
 #include "gtest/gtest.h"
@@ -104,6 +107,55 @@ TEST(homogen_table_test, can_read_rows_from_column_major_table_with_conversion)
     ASSERT_EQ(rows_data[1], -2);
 }
 
+TEST(homogen_table_test, can_read_bfloat16_table_via_row_accessor) {
+    const float values[] = { 1.0f, 2.5f, -3.0f, 0.0f, -0.5f, 1024.0f, 7.0f, -8.25f, 9.5f };
+    bfloat16 data[9];
+    for (std::int64_t i = 0; i < 9; i++) {
+        data[i] = bfloat16{ values[i] };
+    }
+
+    auto t = homogen_table::wrap(data, 3, 3);
+    ASSERT_EQ(t.get_metadata().get_data_type(0), data_type::bfloat16);
+
+    const auto rows_block = row_accessor<const float>(t).pull({ 1, 3 });
+    ASSERT_EQ(rows_block.get_count(), 2 * t.get_column_count());
+
+    for (std::int64_t i = 0; i < rows_block.get_count(); i++) {
+        ASSERT_EQ(rows_block[i], values[i + 3]);
+    }
+}
+
+TEST(homogen_table_test, can_read_float16_column_major_table_via_row_accessor) {
+    const float values[] = { 1.0f, 2.5f, -3.0f, 0.0f, -0.5f, 1024.0f };
+    float16 data[6];
+    for (std::int64_t i = 0; i < 6; i++) {
+        data[i] = float16{ values[i] };
+    }
+
+    auto t = homogen_table::wrap(data, 3, 2, data_layout::column_major);
+    const auto rows_block = row_accessor<const double>(t).pull({ 0, -1 });
+
+    for (std::int64_t i = 0; i < 3; i++) {
+        ASSERT_EQ(rows_block[i * 2], double(values[i]));
+        ASSERT_EQ(rows_block[i * 2 + 1], double(values[i + 3]));
+    }
+}
+
+TEST(homogen_table_test, can_round_reduced_precision_to_nearest_even) {
+    // 1 + 2^-8 is exactly halfway between two bfloat16 values, it rounds to
+    // the even one, while 1 + 2^-8 + 2^-16 rounds up
+    ASSERT_EQ(float(bfloat16{ 1.0f + 1.0f / 256.0f }), 1.0f);
+    ASSERT_EQ(float(bfloat16{ 1.0f + 1.0f / 256.0f + 1.0f / 65536.0f }), 1.0078125f);
+
+    // 1 + 2^-11 is halfway between two float16 values
+    ASSERT_EQ(float(float16{ 1.0f + 1.0f / 2048.0f }), 1.0f);
+    ASSERT_EQ(float(float16{ 1.0f + 3.0f / 2048.0f }), 1.001953125f);
+
+    ASSERT_EQ(float(float16{ 1e6f }), std::numeric_limits<float>::infinity());
+    ASSERT_EQ(float(float16{ 5.9604645e-8f }), 5.9604645e-8f);
+    ASSERT_TRUE(std::isnan(float(bfloat16{ std::numeric_limits<float>::quiet_NaN() })));
+}
+
 TEST(row_accessor_bad_arg_test, invalid_range) {
     detail::homogen_table_builder b;
     b.reset(array<float>::zeros(3 * 2), 3, 2);
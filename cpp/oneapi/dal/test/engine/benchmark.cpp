@@ -0,0 +1,393 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+
+namespace oneapi::dal::test::engine {
+
+static std::string escape_json(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped.push_back(' ');
+        }
+        else {
+            escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+static std::string unescape_json(const std::string& str) {
+    std::string unescaped;
+    unescaped.reserve(str.size());
+    for (std::size_t i = 0; i < str.size(); i++) {
+        if (str[i] == '\\' && i + 1 < str.size()) {
+            i++;
+        }
+        unescaped.push_back(str[i]);
+    }
+    return unescaped;
+}
+
+/// Finds the value of the string field in the record written by `write_report`
+static bool find_json_string(const std::string& line, const std::string& key, std::string& value) {
+    const std::string prefix = "\"" + key + "\": \"";
+    const auto begin = line.find(prefix);
+    if (begin == std::string::npos) {
+        return false;
+    }
+
+    auto end = begin + prefix.size();
+    while (end < line.size() && line[end] != '"') {
+        end += (line[end] == '\\') ? 2 : 1;
+    }
+    if (end >= line.size()) {
+        return false;
+    }
+
+    value = unescape_json(line.substr(begin + prefix.size(), end - begin - prefix.size()));
+    return true;
+}
+
+/// Finds the value of the numeric field in the record written by `write_report`
+static bool find_json_number(const std::string& line, const std::string& key, double& value) {
+    const std::string prefix = "\"" + key + "\": ";
+    const auto begin = line.find(prefix);
+    if (begin == std::string::npos) {
+        return false;
+    }
+
+    std::istringstream in{ line.substr(begin + prefix.size()) };
+    return bool(in >> value);
+}
+
+static double per_second(std::int64_t count, double duration_ns) {
+    return (duration_ns > 0.0) ? double(count) * 1e9 / duration_ns : 0.0;
+}
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+/// Returns the value of the memory field of `/proc/self/status` in bytes,
+/// 0 if the field is not available
+static std::int64_t read_proc_status_bytes(const std::string& field) {
+    std::ifstream status{ "/proc/self/status" };
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0) {
+            std::istringstream in{ line.substr(field.size()) };
+            std::int64_t kilobytes = 0;
+            return (in >> kilobytes) ? kilobytes * 1024 : 0;
+        }
+    }
+    return 0;
+}
+#endif
+
+benchmark_registry& benchmark_registry::get_instance() {
+    static benchmark_registry registry;
+    return registry;
+}
+
+void benchmark_registry::load_baseline(const std::string& path) {
+    std::ifstream in{ path };
+    if (!in.is_open()) {
+        throw std::runtime_error{ "Cannot open benchmark baseline file " + path };
+    }
+
+    // The report has one record per line, see `write_report`
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string test_case, name;
+        double mean_ns = 0.0;
+        if (find_json_string(line, "test_case", test_case) &&
+            find_json_string(line, "name", name) && find_json_number(line, "mean_ns", mean_ns)) {
+            baseline_[{ test_case, name }] = mean_ns;
+        }
+    }
+}
+
+void benchmark_registry::start_benchmark() {
+    rss_before_ = get_current_rss();
+    peak_rss_reset_ = reset_peak_rss();
+}
+
+void benchmark_registry::add(benchmark_record record) {
+    record.test_case = test_case_;
+    record.workload = workload_;
+    record.rss_before = rss_before_;
+    record.peak_rss = get_peak_rss();
+    record.peak_rss_per_case = peak_rss_reset_;
+
+    const auto it = baseline_.find({ record.test_case, record.name });
+    if (it != baseline_.end()) {
+        record.baseline_mean_ns = it->second;
+    }
+
+    records_.push_back(std::move(record));
+    peak_rss_reset_ = false;
+}
+
+std::string benchmark_registry::get_report_path() const {
+    if (!report_path_.empty()) {
+        return report_path_;
+    }
+
+    // Bazel collects the files written to this directory as test outputs
+    const char* outputs_dir = std::getenv("TEST_UNDECLARED_OUTPUTS_DIR");
+    if (outputs_dir) {
+        return (std::filesystem::path{ outputs_dir } / "benchmark_report.json").string();
+    }
+
+    return std::string{};
+}
+
+void benchmark_registry::write_report() const {
+    const std::string path = get_report_path();
+    if (records_.empty() || path.empty()) {
+        return;
+    }
+
+    std::ofstream out{ path };
+    if (!out.is_open()) {
+        throw std::runtime_error{ "Cannot open benchmark report file " + path };
+    }
+
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    out << "{\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < records_.size(); i++) {
+        const auto& r = records_[i];
+        out << (i > 0 ? "," : "") << "\n    {";
+        out << "\"test_case\": \"" << escape_json(r.test_case) << "\", ";
+        out << "\"name\": \"" << escape_json(r.name) << "\", ";
+        out << "\"samples\": " << r.sample_count << ", ";
+        out << "\"iterations\": " << r.iteration_count << ", ";
+        out << "\"mean_ns\": " << r.mean_ns << ", ";
+        out << "\"mean_lower_bound_ns\": " << r.mean_lower_bound_ns << ", ";
+        out << "\"mean_upper_bound_ns\": " << r.mean_upper_bound_ns << ", ";
+        out << "\"standard_deviation_ns\": " << r.standard_deviation_ns << ", ";
+        out << "\"rows\": " << r.workload.row_count << ", ";
+        out << "\"bytes\": " << r.workload.byte_count << ", ";
+        out << "\"rows_per_second\": " << per_second(r.workload.row_count, r.mean_ns) << ", ";
+        out << "\"bytes_per_second\": " << per_second(r.workload.byte_count, r.mean_ns) << ", ";
+        out << "\"rss_before_bytes\": " << r.rss_before << ", ";
+        out << "\"peak_rss_bytes\": " << r.peak_rss << ", ";
+        const std::int64_t rss_increase = std::max<std::int64_t>(r.peak_rss - r.rss_before, 0);
+        out << "\"peak_rss_increase_bytes\": " << rss_increase << ", ";
+        out << "\"peak_rss_per_case\": " << (r.peak_rss_per_case ? "true" : "false");
+        if (r.baseline_mean_ns > 0.0) {
+            out << ", \"baseline_mean_ns\": " << r.baseline_mean_ns << ", ";
+            out << "\"speedup\": " << r.baseline_mean_ns / r.mean_ns;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+std::int64_t benchmark_registry::print_baseline_comparison(std::ostream& out) const {
+    if (baseline_.empty() || records_.empty()) {
+        return 0;
+    }
+
+    std::int64_t regression_count = 0;
+    const auto flags = out.flags();
+    out << "\nComparison with the baseline (regression threshold "
+        << regression_threshold_ * 100.0 << "%):\n";
+    out << std::fixed << std::setprecision(3);
+    for (const auto& r : records_) {
+        out << "  " << r.test_case << " / " << r.name << ": " << r.mean_ns * 1e-6 << " ms";
+        if (r.baseline_mean_ns <= 0.0) {
+            out << ", no baseline\n";
+            continue;
+        }
+
+        const double change = r.mean_ns / r.baseline_mean_ns - 1.0;
+        const bool is_regression = change > regression_threshold_;
+        regression_count += is_regression;
+        out << ", baseline " << r.baseline_mean_ns * 1e-6 << " ms, " << std::showpos
+            << change * 100.0 << std::noshowpos << "%" << (is_regression ? " REGRESSION" : "")
+            << "\n";
+    }
+    out << regression_count << " of " << records_.size()
+        << " benchmarks regressed against the baseline\n";
+    out.flags(flags);
+    return regression_count;
+}
+
+std::int64_t get_current_rss() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return std::int64_t(counters.WorkingSetSize);
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(),
+                  MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info),
+                  &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    return std::int64_t(info.resident_size);
+#else
+    return read_proc_status_bytes("VmRSS:");
+#endif
+}
+
+bool reset_peak_rss() {
+#if defined(_WIN32) || defined(__APPLE__)
+    return false;
+#else
+    // Writing 5 to `clear_refs` resets the peak resident set size reported
+    // as VmHWM to the current one (Linux 4.0+)
+    std::ofstream clear_refs{ "/proc/self/clear_refs" };
+    if (!clear_refs.is_open()) {
+        return false;
+    }
+    clear_refs << "5";
+    clear_refs.flush();
+    return bool(clear_refs);
+#endif
+}
+
+std::int64_t get_peak_rss() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return std::int64_t(counters.PeakWorkingSetSize);
+#else
+#if !defined(__APPLE__)
+    // Unlike VmHWM, `ru_maxrss` is not affected by `reset_peak_rss`
+    const std::int64_t hwm = read_proc_status_bytes("VmHWM:");
+    if (hwm > 0) {
+        return hwm;
+    }
+#endif
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    // macOS reports the maximum resident set size in bytes
+    return std::int64_t(usage.ru_maxrss);
+#else
+    return std::int64_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+std::string get_temp_file_path(const std::string& file_name) {
+    // Bazel provides the private writable directory for each test
+    const char* test_tmp_dir = std::getenv("TEST_TMPDIR");
+    const std::filesystem::path dir =
+        test_tmp_dir ? std::filesystem::path{ test_tmp_dir }
+                     : std::filesystem::temp_directory_path();
+    return (dir / file_name).string();
+}
+
+table make_binary_labels(const table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const auto rows = row_accessor<const float>{ data }.pull();
+    const float* rows_ptr = rows.get_data();
+
+    auto labels = array<float>::empty(row_count);
+    float* labels_ptr = labels.get_mutable_data();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        labels_ptr[i] = (rows_ptr[i * column_count] > 0.0f) ? 1.0f : 0.0f;
+    }
+    return dal::detail::homogen_table_builder{}.reset(labels, row_count, 1).build();
+}
+
+void write_csv(const std::string& path, const table& t) {
+    std::ofstream out{ path };
+    if (!out.is_open()) {
+        throw std::runtime_error{ "Cannot open file " + path };
+    }
+
+    const auto rows = row_accessor<const float>{ t }.pull();
+    const float* rows_ptr = rows.get_data();
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+
+    out << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for (std::int64_t i = 0; i < row_count; i++) {
+        for (std::int64_t j = 0; j < column_count; j++) {
+            out << rows_ptr[i * column_count + j];
+            out << (j + 1 < column_count ? ',' : '\n');
+        }
+    }
+}
+
+void write_random_graph_csv(const std::string& path,
+                            std::int64_t vertex_count,
+                            std::int64_t edge_count,
+                            std::int64_t seed) {
+    std::ofstream out{ path };
+    if (!out.is_open()) {
+        throw std::runtime_error{ "Cannot open file " + path };
+    }
+
+    const auto df = dataframe_builder{ edge_count, 2 }
+                        .fill_uniform(0, double(vertex_count), seed)
+                        .build();
+    const float* edges = df.get_array().get_data();
+
+    // The last vertex always has an edge, so the loaded graph has exactly
+    // `vertex_count` vertices
+    out << 0 << ' ' << vertex_count - 1 << '\n';
+    for (std::int64_t i = 0; i < edge_count; i++) {
+        const auto u = std::min(std::int64_t(edges[2 * i]), vertex_count - 1);
+        const auto v = std::min(std::int64_t(edges[2 * i + 1]), vertex_count - 1);
+        if (u != v) {
+            out << u << ' ' << v << '\n';
+        }
+    }
+}
+
+} // namespace oneapi::dal::test::engine
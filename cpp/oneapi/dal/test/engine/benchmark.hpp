@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::test::engine {
+
+/// The amount of data processed by one run of the benchmark,
+/// used to compute the throughput
+struct benchmark_workload {
+    std::int64_t row_count = 0;
+    std::int64_t byte_count = 0;
+};
+
+struct benchmark_record {
+    std::string test_case;
+    std::string name;
+    std::int64_t sample_count = 0;
+    std::int64_t iteration_count = 0;
+    double mean_ns = 0.0;
+    double mean_lower_bound_ns = 0.0;
+    double mean_upper_bound_ns = 0.0;
+    double standard_deviation_ns = 0.0;
+    benchmark_workload workload;
+    /// Resident set size of the process before the benchmark has started
+    std::int64_t rss_before = 0;
+    /// Peak resident set size observed while the benchmark was running. If the
+    /// peak cannot be reset on this platform, this is the peak of the whole
+    /// process up to the end of the benchmark and `peak_rss_per_case` is false
+    std::int64_t peak_rss = 0;
+    bool peak_rss_per_case = false;
+    /// Mean time of the same benchmark in the baseline report, 0 if the
+    /// baseline does not contain it
+    double baseline_mean_ns = 0.0;
+};
+
+/// Collects the results of the benchmarks executed by the test runner and
+/// writes them to the JSON report once the run is finished
+class benchmark_registry {
+public:
+    static benchmark_registry& get_instance();
+
+    void set_report_path(const std::string& path) {
+        report_path_ = path;
+    }
+
+    /// Loads the report of the previous run that the results are compared with
+    void load_baseline(const std::string& path);
+
+    /// Relative slowdown against the baseline, above which the benchmark is
+    /// reported as a regression
+    void set_regression_threshold(double threshold) {
+        regression_threshold_ = threshold;
+    }
+
+    void set_workload(const benchmark_workload& workload) {
+        workload_ = workload;
+    }
+
+    void start_test_case(const std::string& name) {
+        test_case_ = name;
+        workload_ = benchmark_workload{};
+    }
+
+    /// Samples the resident set size and resets the peak of it, so the next
+    /// record gets the memory consumption of this benchmark only
+    void start_benchmark();
+
+    /// Completes the record with the name of the current test case, the workload,
+    /// the resident set sizes and the baseline time
+    void add(benchmark_record record);
+
+    void write_report() const;
+
+    /// Prints the comparison with the baseline and returns the number of
+    /// benchmarks slower than the baseline by more than the threshold
+    std::int64_t print_baseline_comparison(std::ostream& out) const;
+
+private:
+    benchmark_registry() = default;
+
+    std::string get_report_path() const;
+
+    std::string report_path_;
+    std::string test_case_;
+    benchmark_workload workload_;
+    std::int64_t rss_before_ = 0;
+    bool peak_rss_reset_ = false;
+    double regression_threshold_ = 0.05;
+    std::map<std::pair<std::string, std::string>, double> baseline_;
+    std::vector<benchmark_record> records_;
+};
+
+/// Sets the workload of the benchmarks that follow in the current test case
+inline void set_benchmark_workload(std::int64_t row_count, std::int64_t byte_count) {
+    benchmark_registry::get_instance().set_workload({ row_count, byte_count });
+}
+
+/// Returns the current resident set size of the process in bytes
+std::int64_t get_current_rss();
+
+/// Returns the peak resident set size of the process in bytes since the start
+/// of the process or since the last successful `reset_peak_rss` call
+std::int64_t get_peak_rss();
+
+/// Resets the peak resident set size of the process to the current one,
+/// returns false if the platform does not support it
+bool reset_peak_rss();
+
+/// Returns the path to the file in the temporary directory of the test
+std::string get_temp_file_path(const std::string& file_name);
+
+/// Returns the n x 1 table of binary labels, the label of the observation
+/// is 1 if its first feature is positive and 0 otherwise
+table make_binary_labels(const table& data);
+
+/// Writes the host table to the CSV file without header
+void write_csv(const std::string& path, const table& t);
+
+/// Writes the edge list of the random graph to the CSV file, the source and
+/// the destination vertices are sampled uniformly by the dataframe engine
+void write_random_graph_csv(const std::string& path,
+                            std::int64_t vertex_count,
+                            std::int64_t edge_count,
+                            std::int64_t seed = 7777);
+
+} // namespace oneapi::dal::test::engine
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <iostream>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -22,6 +23,46 @@
 #define CATCH_CONFIG_RUNNER
 #include "oneapi/dal/test/engine/catch.hpp"
 #include "oneapi/dal/test/engine/config.hpp"
+#include "oneapi/dal/test/engine/benchmark.hpp"
+
+namespace oneapi::dal::test::engine {
+
+class benchmark_listener : public Catch::TestEventListenerBase {
+public:
+    using TestEventListenerBase::TestEventListenerBase;
+
+    void testCaseStarting(const Catch::TestCaseInfo& info) override {
+        TestEventListenerBase::testCaseStarting(info);
+        benchmark_registry::get_instance().start_test_case(info.name);
+    }
+
+    void benchmarkPreparing(std::string const& name) override {
+        TestEventListenerBase::benchmarkPreparing(name);
+        benchmark_registry::get_instance().start_benchmark();
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        benchmark_record record;
+        record.name = stats.info.name;
+        record.sample_count = stats.info.samples;
+        record.iteration_count = stats.info.iterations;
+        record.mean_ns = stats.mean.point.count();
+        record.mean_lower_bound_ns = stats.mean.lower_bound.count();
+        record.mean_upper_bound_ns = stats.mean.upper_bound.count();
+        record.standard_deviation_ns = stats.standardDeviation.point.count();
+        benchmark_registry::get_instance().add(std::move(record));
+    }
+
+    void testRunEnded(const Catch::TestRunStats& stats) override {
+        TestEventListenerBase::testRunEnded(stats);
+        benchmark_registry::get_instance().write_report();
+        benchmark_registry::get_instance().print_baseline_comparison(std::cout);
+    }
+};
+
+CATCH_REGISTER_LISTENER(benchmark_listener)
+
+} // namespace oneapi::dal::test::engine
 
 int main(int argc, char** argv) {
     using namespace Catch::clara;
@@ -30,8 +71,15 @@ int main(int argc, char** argv) {
     global_config config;
     Catch::Session session;
 
-    auto cli =
-        session.cli() | Opt(config.device_selector, "device")["--device"]("DPC++ device selector");
+    auto cli = session.cli() |
+               Opt(config.device_selector, "device")["--device"]("DPC++ device selector") |
+               Opt(config.benchmark_report, "path")["--benchmark-report"](
+                   "JSON file to write the benchmark results to") |
+               Opt(config.benchmark_baseline, "path")["--benchmark-baseline"](
+                   "JSON benchmark report of the previous run to compare the results with") |
+               Opt(config.benchmark_regression_threshold,
+                   "fraction")["--benchmark-regression-threshold"](
+                   "Relative slowdown against the baseline reported as a regression");
 
     session.cli(cli);
 
@@ -41,6 +89,13 @@ int main(int argc, char** argv) {
         return parse_status;
     }
 
+    auto& benchmarks = oneapi::dal::test::engine::benchmark_registry::get_instance();
+    benchmarks.set_report_path(config.benchmark_report);
+    benchmarks.set_regression_threshold(config.benchmark_regression_threshold);
+    if (!config.benchmark_baseline.empty()) {
+        benchmarks.load_baseline(config.benchmark_baseline);
+    }
+
     oneapi::dal::test::engine::global_setup(config);
     const int status = session.run();
     oneapi::dal::test::engine::global_cleanup();
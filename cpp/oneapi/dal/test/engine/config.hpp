@@ -22,6 +22,9 @@ namespace oneapi::dal::test::engine {
 
 struct global_config {
     std::string device_selector;
+    std::string benchmark_report;
+    std::string benchmark_baseline;
+    double benchmark_regression_threshold = 0.05;
 };
 
 void global_setup(const global_config& config);
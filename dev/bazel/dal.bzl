@@ -219,6 +219,60 @@ def dal_test(name, hdrs=[], srcs=[], dal_deps=[], dal_test_deps=[],
 
 def dal_test_suite(name, srcs=[], tests=[],
                    compile_as=[ "c++", "dpc++" ], **kwargs):
+    _dal_test_suite(
+        name = name,
+        srcs = srcs,
+        tests = tests,
+        compile_as = compile_as,
+        test_rule = dal_test,
+        **kwargs,
+    )
+
+def dal_collect_test_suites(name, root, modules, tests=[], **kwargs):
+    test_deps = []
+    for module_name in modules:
+        test_label = "{0}/{1}:tests".format(root, module_name)
+        test_deps.append(test_label)
+    dal_test_suite(
+        name = name,
+        tests = tests + test_deps,
+        **kwargs,
+    )
+
+def dal_benchmark(name, tags=[], args=[], private=True, **kwargs):
+    # Benchmarks are excluded from wildcard patterns like `//...` and
+    # run one at a time to get stable timings
+    dal_test(
+        name = name,
+        framework = "catch2",
+        tags = tags + ["benchmark", "exclusive", "manual"],
+        args = [ "--benchmark-samples", "10" ] + args,
+        private = private,
+        **kwargs,
+    )
+
+def dal_benchmark_suite(name, srcs=[], benchmarks=[],
+                        compile_as=[ "c++" ], **kwargs):
+    _dal_test_suite(
+        name = name,
+        srcs = srcs,
+        tests = benchmarks,
+        compile_as = compile_as,
+        test_rule = dal_benchmark,
+        **kwargs,
+    )
+
+def dal_collect_benchmark_suites(name, root, modules, benchmarks=[]):
+    benchmark_deps = []
+    for module_name in modules:
+        benchmark_label = "{0}/{1}:benchmarks".format(root, module_name)
+        benchmark_deps.append(benchmark_label)
+    native.test_suite(
+        name = name,
+        tests = benchmarks + benchmark_deps,
+    )
+
+def _dal_test_suite(name, srcs, tests, compile_as, test_rule, **kwargs):
     targets = []
     for test_file in srcs:
         target = test_file.replace(".cpp", "").replace("/", "_")
@@ -233,7 +287,7 @@ def dal_test_suite(name, srcs=[], tests=[],
                 utils.warn("Test name ends with '_dpc' suffix but compiled for both " +
                            "C++ and DPC++. Please check 'compile_as' attribute of the " +
                            "'dal_test_suite(name = {})'. ".format(name))
-        dal_test(
+        test_rule(
             name = target,
             srcs = [test_file],
             compile_as = compile_as,
@@ -245,17 +299,6 @@ def dal_test_suite(name, srcs=[], tests=[],
         tests = tests + targets,
     )
 
-def dal_collect_test_suites(name, root, modules, tests=[], **kwargs):
-    test_deps = []
-    for module_name in modules:
-        test_label = "{0}/{1}:tests".format(root, module_name)
-        test_deps.append(test_label)
-    dal_test_suite(
-        name = name,
-        tests = tests + test_deps,
-        **kwargs,
-    )
-
 def dal_example(name, dal_deps=[], **kwargs):
     dal_test(
         name = name,
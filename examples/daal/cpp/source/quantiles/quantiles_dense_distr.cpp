@@ -0,0 +1,104 @@
+/* file: quantiles_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing quantiles in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_DENSE_DISTRIBUTED"></a>
+ * \example quantiles_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+/* Input data set parameters */
+const size_t nBlocks = 4;
+
+const string datasetFileNames[] = { "../data/distributed/covcormoments_dense_1.csv", "../data/distributed/covcormoments_dense_2.csv",
+                                    "../data/distributed/covcormoments_dense_3.csv", "../data/distributed/covcormoments_dense_4.csv" };
+
+quantiles::PartialResultPtr partialResult[nBlocks];
+quantiles::ResultPtr result;
+
+void computestep1Local(size_t i);
+void computeOnMasterNode();
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    printNumericTable(result->get(quantiles::quantiles), "Quantiles");
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute the quantile sketches in the distributed processing mode using the default method */
+    quantiles::Distributed<step1Local> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(quantiles::data, dataSource.getNumericTable());
+
+    /* Compute the quantile sketches of the local data */
+    algorithm.compute();
+
+    /* Get the computed partial results that can be serialized and sent to the master node */
+    partialResult[block] = algorithm.getPartialResult();
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to compute quantiles in the distributed processing mode using the default method */
+    quantiles::Distributed<step2Master> algorithm;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(quantiles::partialResults, partialResult[i]);
+    }
+
+    /* Merge the quantile sketches computed on local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed quantiles */
+    result = algorithm.getResult();
+}